@@ -0,0 +1,685 @@
+//===--------------------------------------------------------------------------------------------===
+// bench.c - JAWC microbenchmarks
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <term/arg.h>
+#include <term/printing.h>
+#include "audit.h"
+#include "bulk.h"
+#include "bundle.h"
+#include "game.h"
+#include "memory.h"
+#include "pool.h"
+#include "printing.h"
+#include "profile.h"
+#include "query.h"
+#include "reverse.h"
+#include "solver.h"
+#include "stats.h"
+#include "tile.h"
+#include "verify.h"
+#include "wal.h"
+
+#define COUNTOF(arr) (sizeof(arr) / sizeof(arr[0]))
+#define MAX_RUNS (64)
+
+typedef struct {
+    const char      *name;
+    void            (*setup)(void);
+    void            (*run)(uint64_t iterations);
+    void            (*teardown)(void);
+} bench_t;
+
+typedef struct {
+    const char      *name;
+    uint64_t        iterations;
+    unsigned        runs;
+    double          median_ns;
+    double          min_ns;
+    double          max_ns;
+    double          allocs;
+    double          bytes;
+} bench_result_t;
+
+static const term_param_t params[] = {
+    {'f', 0, "filter", TERM_ARG_VALUE, "only run benchmarks whose name contains FILTER"},
+    {'r', 0, "runs", TERM_ARG_VALUE, "timed runs per benchmark (default 5)"},
+    {'t', 0, "min-time", TERM_ARG_VALUE, "minimum milliseconds per run (default 50)"},
+    {'j', 0, "json", TERM_ARG_VALUE, "also write results as JSON"},
+    {'v', 0, "verify", TERM_ARG_OPTION, "check every scorer against score_check() instead"},
+    {'T', 0, "threads", TERM_ARG_VALUE, "threads for --verify and pool_* (default: one per core)"},
+};
+
+static const char *uses[] = {
+    "[--filter FILTER] [--runs RUNS] [--min-time MS] [--json RESULTS_FILE]",
+    "--verify [--threads THREADS]",
+};
+
+// Keeps the compiler from optimising benchmark bodies away.
+static volatile uint64_t sink;
+
+static lexicon_t lexicon;
+static char (*strings)[WORD_UTF8_SIZE];
+static word_t *misses;
+static hset_t set;
+static game_t game;
+static stats_t stats;
+static char stats_path[64];
+static FILE *stream;
+static char *stream_buf;
+static size_t stream_size;
+static unsigned pool_threads;
+static pool_t pool;
+static pattern_t *pool_scratch;
+static solver_t solver;
+static wal_t wal;
+static reverse_t reverse;
+static reverse_batch_t batch;
+static auditor_t auditor;
+static char *bulk_in;
+static char *bulk_out;
+static query_index_t query_index;
+static query_t query;
+static double *entropy;
+
+static void setup_lexicon(void) {
+    lexicon_init(&lexicon);
+    strings = safe_malloc(lexicon.guess_count * sizeof(*strings));
+    misses = safe_malloc(lexicon.guess_count * sizeof(word_t));
+    
+    // Lookups that miss: random letters, which are almost never valid words.
+    srand(1234);
+    for(unsigned i = 0; i < lexicon.guess_count; ++i) {
+        lang_decode(lexicon.lang, lexicon.guesses[i], false, strings[i]);
+        
+        letter_t letters[WORD_SIZE];
+        do {
+            for(unsigned j = 0; j < WORD_SIZE; ++j) letters[j] = rand() % lexicon.lang->size;
+            misses[i] = word_pack(letters);
+        } while(lexicon_contains(&lexicon, misses[i]));
+    }
+}
+
+static void teardown_lexicon(void) {
+    safe_free(strings);
+    safe_free(misses);
+    lexicon_fini(&lexicon);
+}
+
+static void run_hash_str(uint64_t iterations) {
+    uint64_t acc = 0;
+    for(uint64_t i = 0; i < iterations; ++i) {
+        acc += jawc_hash_str(strings[i % lexicon.guess_count]);
+    }
+    sink = acc;
+}
+
+static void run_hset_insert(uint64_t iterations) {
+    hset_init(&set);
+    for(uint64_t i = 0; i < iterations; ++i) {
+        unsigned idx = i % lexicon.guess_count;
+        if(!idx && i) {
+            hset_fini(&set);
+            hset_init(&set);
+        }
+        hset_insert(&set, lexicon.guesses[idx]);
+    }
+    hset_fini(&set);
+}
+
+static void run_hset_hit(uint64_t iterations) {
+    uint64_t acc = 0;
+    for(uint64_t i = 0; i < iterations; ++i) {
+        acc += hset_contains(&lexicon.valid, lexicon.guesses[(i * 7919) % lexicon.guess_count]);
+    }
+    sink = acc;
+}
+
+static void run_hset_miss(uint64_t iterations) {
+    uint64_t acc = 0;
+    for(uint64_t i = 0; i < iterations; ++i) {
+        acc += hset_contains(&lexicon.valid, misses[(i * 7919) % lexicon.guess_count]);
+    }
+    sink = acc;
+}
+
+static void run_score_check(uint64_t iterations) {
+    uint64_t acc = 0;
+    letter_state_t check[WORD_SIZE];
+    for(uint64_t i = 0; i < iterations; ++i) {
+        word_t guess = lexicon.guesses[i % lexicon.guess_count];
+        word_t answer = lexicon.answers[(i * 7919) % lexicon.answer_count];
+        acc += score_check(guess, answer, check);
+        acc += check[0];
+    }
+    sink = acc;
+}
+
+static void run_score_batch(uint64_t iterations) {
+    uint64_t acc = 0;
+    pattern_t patterns[256];
+    for(uint64_t i = 0; i < iterations; i += 256) {
+        unsigned count = iterations - i < 256 ? iterations - i : 256;
+        unsigned start = (i / 256 * 256) % (lexicon.answer_count - 256);
+        score_batch(lexicon.guesses[(i / 256) % lexicon.guess_count], lexicon.answers + start,
+                    count, patterns);
+        acc += patterns[count-1];
+    }
+    sink = acc;
+}
+
+static void run_lexicon_init(uint64_t iterations) {
+    for(uint64_t i = 0; i < iterations; ++i) {
+        lexicon_t lex;
+        lexicon_init(&lex);
+        sink = lex.guess_count;
+        lexicon_fini(&lex);
+    }
+}
+
+static char bundle_path[64];
+
+static void setup_bundle(void) {
+    strcpy(bundle_path, "/tmp/jawc_bench_XXXXXX");
+    int fd = mkstemp(bundle_path);
+    if(fd >= 0) close(fd);
+    bundle_build(bundle_path, 0);
+}
+
+static void teardown_bundle(void) {
+    unlink(bundle_path);
+}
+
+// One op is what lexicon_init() does, from a bundle instead: map it, check it, point a lexicon at
+// it. The pages are already in the page cache, as they are for every process after the first.
+static void run_bundle_map(uint64_t iterations) {
+    for(uint64_t i = 0; i < iterations; ++i) {
+        bundle_t bundle;
+        lexicon_t lex;
+        if(bundle_map(&bundle, bundle_path) != BUNDLE_OK) abort();
+        bundle_lexicon(&bundle, &lex);
+        sink = lexicon_contains(&lex, lex.guesses[i % lex.guess_count]);
+        lexicon_fini(&lex);
+        bundle_unmap(&bundle);
+    }
+}
+
+static void run_game_init(uint64_t iterations) {
+    for(uint64_t i = 0; i < iterations; ++i) {
+        game_init(&game, &lexicon, 1 + i % 100);
+        sink = game.boards[0].answer;
+        game_fini(&game);
+    }
+}
+
+// One op is one practice round starting over: the game and the solver reset in place, where a
+// new round used to reallocate the solver's sets.
+static void setup_game_reset(void) {
+    setup_lexicon();
+    game_init(&game, &lexicon, 100);
+    solver_init(&solver, &game);
+}
+
+static void run_game_reset(uint64_t iterations) {
+    for(uint64_t i = 0; i < iterations; ++i) {
+        game_reset(&game, i % lexicon.target_count);
+        solver_reset(&solver);
+        sink = game.boards[0].answer;
+    }
+}
+
+// One op is one submitted guess. A fresh game is started every MAX_GUESSES submissions, so
+// game_init is amortised into the figure.
+static void run_game_submit(uint64_t iterations) {
+    const guess_t *guess = NULL;
+    for(uint64_t i = 0; i < iterations; ++i) {
+        unsigned turn = i % MAX_GUESSES;
+        if(!turn) game_init(&game, &lexicon, 1 + (i / MAX_GUESSES) % 100);
+        
+        result_t result = game_submit(&game, strings[(i * 7919) % lexicon.guess_count], &guess);
+        sink = result;
+        if(turn == MAX_GUESSES-1) game_fini(&game);
+    }
+    if(iterations % MAX_GUESSES) game_fini(&game);
+}
+
+static void setup_stats(void) {
+    strcpy(stats_path, "/tmp/jawc_bench_XXXXXX");
+    int fd = mkstemp(stats_path);
+    if(fd >= 0) close(fd);
+    stats = (stats_t){.won = 120, .played = 130, .cur_streak = 12, .max_streak = 40,
+                      .last_won = 300, .last_played = 300, .guesses = {1, 12, 40, 50, 15, 2}};
+    save_stats(&stats, stats_path);
+}
+
+static void teardown_stats(void) {
+    unlink(stats_path);
+}
+
+static void run_load_stats(uint64_t iterations) {
+    for(uint64_t i = 0; i < iterations; ++i) {
+        stats_t loaded = {.won = 0};
+        sink = load_stats(&loaded, stats_path);
+    }
+}
+
+static void run_save_stats(uint64_t iterations) {
+    for(uint64_t i = 0; i < iterations; ++i) {
+        sink = save_stats(&stats, stats_path);
+    }
+}
+
+static void setup_print_board(void) {
+    setup_lexicon();
+    game_init(&game, &lexicon, 100);
+    const guess_t *guess = NULL;
+    game_submit(&game, "crane", &guess);
+    game_submit(&game, "slate", &guess);
+    game_submit(&game, "moldy", &guess);
+    stream = open_memstream(&stream_buf, &stream_size);
+}
+
+static void teardown_print_board(void) {
+    fclose(stream);
+    free(stream_buf);
+    game_fini(&game);
+    teardown_lexicon();
+}
+
+static void run_print_board(uint64_t iterations) {
+    for(uint64_t i = 0; i < iterations; ++i) {
+        fseek(stream, 0, SEEK_SET);
+        print_board(&game, true, stream);
+    }
+    fflush(stream);
+    sink = stream_size;
+}
+
+static void setup_pool(void) {
+    setup_lexicon();
+    pool_init(&pool, pool_threads);
+    pool_scratch = safe_malloc(pool.thread_count * lexicon.answer_count);
+}
+
+static void teardown_pool(void) {
+    safe_free(pool_scratch);
+    pool_fini(&pool);
+    teardown_lexicon();
+}
+
+static void empty_task(void *arg, unsigned worker) {
+    (void)worker;
+    sink = (uintptr_t)arg;
+}
+
+static void run_pool_spawn(uint64_t iterations) {
+    for(uint64_t i = 0; i < iterations; ++i) {
+        pool_future_t future;
+        pool_spawn(&pool, &future, empty_task, NULL);
+        pool_join(&pool, &future);
+    }
+}
+
+static void score_guesses(void *ctx, unsigned worker, unsigned begin, unsigned end) {
+    (void)ctx;
+    pattern_t *patterns = pool_scratch + worker * lexicon.answer_count;
+    for(unsigned i = begin; i < end; ++i) {
+        score_batch(lexicon.guesses[i % lexicon.guess_count], lexicon.answers,
+                    lexicon.answer_count, patterns);
+    }
+}
+
+// One op is one guess scored against every answer, each its own task: the grain the book and
+// solver searches work at.
+static void run_pool_for(uint64_t iterations) {
+    pool_for(&pool, iterations, 1, score_guesses, NULL);
+}
+
+// An unlucky opener (no common letters) leaves over a thousand candidates: the worst case for a
+// hint, which has to stay interactive anyway.
+static void setup_hint(void) {
+    setup_lexicon();
+    game_init(&game, &lexicon, 100);
+    const guess_t *guess = NULL;
+    game_submit(&game, "fuzzy", &guess);
+    solver_init(&solver, &game);
+}
+
+static void teardown_hint(void) {
+    solver_fini(&solver);
+    game_fini(&game);
+    teardown_lexicon();
+}
+
+static void run_hint(uint64_t iterations) {
+    for(uint64_t i = 0; i < iterations; ++i) {
+        sink = solver_hint(&solver);
+    }
+}
+
+static void run_hint_budget(uint64_t iterations) {
+    for(uint64_t i = 0; i < iterations; ++i) {
+        sink = solver_hint_within(&solver, 5000000, NULL, NULL);
+    }
+}
+
+static void setup_wal(void) {
+    setup_lexicon();
+    strcpy(stats_path, "/tmp/jawc_bench_XXXXXX");
+    int fd = mkstemp(stats_path);
+    if(fd >= 0) close(fd);
+    unlink(stats_path);
+    wal_options_t options = {.fsync = false, .group_window_ns = 0, .compact_bytes = 1 << 20};
+    wal_open(&wal, &lexicon, stats_path, &options);
+    game_init(&game, &lexicon, 100);
+}
+
+static void teardown_wal(void) {
+    game_fini(&game);
+    wal_close(&wal);
+    unlink(stats_path);
+    teardown_lexicon();
+}
+
+// One op is one guess logged and committed (without fsync, so this is the cost of the log itself
+// rather than of the disk). Each session ends after six guesses, so compaction is included.
+static void run_wal_commit(uint64_t iterations) {
+    for(uint64_t i = 0; i < iterations; ++i) {
+        uint32_t id = i / MAX_GUESSES;
+        if(i % MAX_GUESSES == 0) wal_begin(&wal, id, &game);
+        uint64_t lsn = wal_guess(&wal, id, lexicon.guesses[i % lexicon.guess_count]);
+        if(i % MAX_GUESSES == MAX_GUESSES - 1) lsn = wal_end(&wal, id);
+        sink = wal_commit(&wal, lsn);
+    }
+}
+
+static void setup_reverse(void) {
+    setup_lexicon();
+    reverse_init(&reverse, &lexicon, 0);
+    reverse_batch_init(&batch, &reverse);
+}
+
+static void teardown_reverse(void) {
+    reverse_batch_fini(&batch);
+    reverse_fini(&reverse);
+    teardown_lexicon();
+}
+
+// One op is one five-row share sheet checked against every answer. The rows are what the first
+// guesses score against puzzle 100, so most answers drop out early in the grid.
+static void run_reverse_grid(uint64_t iterations) {
+    word_t answer = lexicon_target(&lexicon, 100);
+    pattern_t rows[5];
+    for(uint64_t i = 0; i < iterations; ++i) {
+        for(unsigned r = 0; r < 5; ++r) {
+            rows[r] = score_word(lexicon.guesses[(i * 5 + r) % lexicon.guess_count], answer);
+        }
+        reverse_batch_add(&batch, rows, 5);
+    }
+    sink = batch.grid_count;
+}
+
+static void setup_audit(void) {
+    setup_lexicon();
+    auditor_init(&auditor, &lexicon);
+}
+
+static void teardown_audit(void) {
+    auditor_fini(&auditor);
+    teardown_lexicon();
+}
+
+// One op is one three-guess game replayed, with a handful of openers so that the first split is
+// mostly cached, as it is for a real log.
+static void run_audit_game(uint64_t iterations) {
+    audit_score_t score;
+    for(uint64_t i = 0; i < iterations; ++i) {
+        audit_game_t game = {.player = 0, .answer = lexicon.answers[i % lexicon.answer_count]};
+        game.guesses[0] = lexicon.answers[(i % 8) * 100];
+        game.guesses[1] = lexicon.guesses[(i * 7) % lexicon.guess_count];
+        game.guesses[2] = game.answer;
+        game.guess_count = 3;
+        audit_score(&auditor, &game, &score);
+        sink = score.won;
+    }
+}
+
+#define BULK_LINES      (4096)
+#define BULK_LINE_SIZE  (2 * WORD_SIZE + 2)
+
+static void setup_bulk(void) {
+    setup_lexicon();
+    bulk_in = safe_malloc(BULK_LINES * BULK_LINE_SIZE);
+    bulk_out = safe_malloc(2 * BULK_LINES * BULK_LINE_SIZE);
+    for(unsigned i = 0; i < BULK_LINES; ++i) {
+        char *line = bulk_in + i * BULK_LINE_SIZE;
+        memcpy(line, strings[(i * 7919) % lexicon.guess_count], WORD_SIZE);
+        line[WORD_SIZE] = ' ';
+        memcpy(line + WORD_SIZE + 1, strings[(i * 104729) % lexicon.guess_count], WORD_SIZE);
+        line[BULK_LINE_SIZE-1] = '\n';
+    }
+}
+
+static void teardown_bulk(void) {
+    safe_free(bulk_in);
+    safe_free(bulk_out);
+    teardown_lexicon();
+}
+
+// One op is one "GUESS ANSWER" line scored, without the I/O around it.
+static void run_bulk_score(uint64_t iterations) {
+    for(uint64_t done = 0; done < iterations; done += BULK_LINES) {
+        uint64_t lines = iterations - done < BULK_LINES ? iterations - done : BULK_LINES;
+        sink = bulk_chunk(&lexicon, BULK_SCORE, bulk_in, lines * BULK_LINE_SIZE, bulk_out);
+    }
+}
+
+static void setup_query(void) {
+    setup_lexicon();
+    query_index_init(&query_index, &lexicon);
+    query_clear(lexicon.lang, &query);
+    query_parse(lexicon.lang, "?r??? +ae -sl t!4", &query);
+}
+
+static void teardown_query(void) {
+    query_index_fini(&query_index);
+    teardown_lexicon();
+}
+
+// One op is one query over every valid guess, counted and paged, with one position fixed, two
+// letters required and a few ruled out.
+static void run_query(uint64_t iterations) {
+    unsigned page[20];
+    for(uint64_t i = 0; i < iterations; ++i) {
+        sink = query_run(&query_index, &query, i % 4, page, 20);
+    }
+}
+
+static void setup_tile(void) {
+    setup_lexicon();
+    entropy = safe_malloc(lexicon.guess_count * sizeof(double));
+}
+
+static void teardown_tile(void) {
+    safe_free(entropy);
+    teardown_lexicon();
+}
+
+// One op is every valid guess ranked against the first 256 answers, on one thread: a position a
+// few guesses into a game on a large dictionary.
+static void run_tile_entropy(uint64_t iterations) {
+    tile_options_t options = {.threads = 1, .spill_path = NULL};
+    for(uint64_t i = 0; i < iterations; ++i) {
+        tile_entropy(&lexicon, lexicon.answers, 256, &options, entropy);
+        sink = entropy[i % lexicon.guess_count] > 0;
+    }
+}
+
+static const bench_t benchmarks[] = {
+    {"jawc_hash_str", setup_lexicon, run_hash_str, teardown_lexicon},
+    {"hset_insert", setup_lexicon, run_hset_insert, teardown_lexicon},
+    {"hset_contains_hit", setup_lexicon, run_hset_hit, teardown_lexicon},
+    {"hset_contains_miss", setup_lexicon, run_hset_miss, teardown_lexicon},
+    {"score_check", setup_lexicon, run_score_check, teardown_lexicon},
+    {"score_batch", setup_lexicon, run_score_batch, teardown_lexicon},
+    {"lexicon_init", NULL, run_lexicon_init, NULL},
+    {"bundle_map", setup_bundle, run_bundle_map, teardown_bundle},
+    {"game_init", setup_lexicon, run_game_init, teardown_lexicon},
+    {"game_reset", setup_game_reset, run_game_reset, teardown_hint},
+    {"game_submit", setup_lexicon, run_game_submit, teardown_lexicon},
+    {"load_stats", setup_stats, run_load_stats, teardown_stats},
+    {"save_stats", setup_stats, run_save_stats, teardown_stats},
+    {"print_board", setup_print_board, run_print_board, teardown_print_board},
+    {"pool_spawn_join", setup_pool, run_pool_spawn, teardown_pool},
+    {"pool_for_guess", setup_pool, run_pool_for, teardown_pool},
+    {"hint_unlucky", setup_hint, run_hint, teardown_hint},
+    {"hint_unlucky_5ms", setup_hint, run_hint_budget, teardown_hint},
+    {"wal_guess_commit", setup_wal, run_wal_commit, teardown_wal},
+    {"reverse_grid", setup_reverse, run_reverse_grid, teardown_reverse},
+    {"audit_game", setup_audit, run_audit_game, teardown_audit},
+    {"bulk_score", setup_bulk, run_bulk_score, teardown_bulk},
+    {"query_words", setup_query, run_query, teardown_query},
+    {"tile_entropy_256", setup_tile, run_tile_entropy, teardown_tile},
+};
+
+static int compare_double(const void *a, const void *b) {
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+static uint64_t time_run(const bench_t *bench, uint64_t iterations) {
+    uint64_t start = prof_now();
+    bench->run(iterations);
+    return prof_now() - start;
+}
+
+static bench_result_t run_benchmark(const bench_t *bench, unsigned runs, uint64_t min_time) {
+    if(bench->setup) bench->setup();
+    
+    // Warm up, and grow the iteration count until one run takes at least `min_time`.
+    uint64_t iterations = 1;
+    uint64_t elapsed = time_run(bench, iterations);
+    while(elapsed < min_time) {
+        uint64_t scale = elapsed ? (min_time * 2) / elapsed : 100;
+        iterations *= scale < 2 ? 2 : (scale > 100 ? 100 : scale);
+        elapsed = time_run(bench, iterations);
+    }
+    
+    double ns[MAX_RUNS];
+    mem_stats_t before, after;
+    mem_stats(&before);
+    for(unsigned i = 0; i < runs; ++i) {
+        ns[i] = (double)time_run(bench, iterations) / iterations;
+    }
+    mem_stats(&after);
+    if(bench->teardown) bench->teardown();
+    
+    qsort(ns, runs, sizeof(double), compare_double);
+    uint64_t ops = iterations * runs;
+    return (bench_result_t){
+        .name = bench->name,
+        .iterations = iterations,
+        .runs = runs,
+        .median_ns = ns[runs / 2],
+        .min_ns = ns[0],
+        .max_ns = ns[runs-1],
+        .allocs = (double)(after.allocs - before.allocs) / ops,
+        .bytes = (double)(after.total_bytes - before.total_bytes) / ops,
+    };
+}
+
+static void write_json(const char *path, const bench_result_t *results, unsigned count) {
+    FILE *out = fopen(path, "wb");
+    if(!out) term_error("jawc_bench", 1, "could not write results to '%s'", path);
+    
+    fprintf(out, "{\"benchmarks\": [\n");
+    for(unsigned i = 0; i < count; ++i) {
+        const bench_result_t *r = &results[i];
+        fprintf(out, "  {\"name\": \"%s\", \"iterations\": %llu, \"runs\": %u, "
+                "\"ns_per_op\": {\"median\": %.3f, \"min\": %.3f, \"max\": %.3f}, "
+                "\"ops_per_sec\": %.1f, \"allocs_per_op\": %.4f, \"bytes_per_op\": %.2f}%s\n",
+                r->name, (unsigned long long)r->iterations, r->runs,
+                r->median_ns, r->min_ns, r->max_ns, 1e9 / r->median_ns, r->allocs, r->bytes,
+                i < count-1 ? "," : "");
+    }
+    fprintf(out, "]}\n");
+    fclose(out);
+}
+
+int main(int argc, const char **argv) {
+    term_arg_parser_t args;
+    term_arg_parser_init(&args, argc, argv);
+    
+    const char *filter = NULL;
+    const char *json_path = NULL;
+    unsigned runs = 5;
+    bool verify = false;
+    uint64_t min_time = 50 * 1000000ull;
+    
+    term_arg_result_t r = term_arg_parse(&args, params, COUNTOF(params));
+    while(r.name != TERM_ARG_DONE) {
+        switch(r.name) {
+        case TERM_ARG_HELP:
+            term_print_usage(stdout, "jawc_bench", uses, COUNTOF(uses));
+            term_print_help(stdout, params, COUNTOF(params));
+            return 0;
+        
+        case TERM_ARG_ERROR:
+            term_error("jawc_bench", 1, "%s", args.error);
+            break;
+        
+        case TERM_ARG_VERSION:
+            printf("jawc_bench version 1.0r1 (" __DATE__ ")\n");
+            return 0;
+        
+        case 'f':
+            filter = r.value;
+            break;
+        case 'r':
+            runs = atoi(r.value);
+            if(runs < 1 || runs > MAX_RUNS) term_error("jawc_bench", 1, "runs must be 1-%d", MAX_RUNS);
+            break;
+        case 't':
+            min_time = atoi(r.value) * 1000000ull;
+            break;
+        case 'j':
+            json_path = r.value;
+            break;
+        case 'v':
+            verify = true;
+            break;
+        case 'T':
+            pool_threads = atoi(r.value);
+            break;
+        }
+        r = term_arg_parse(&args, params, COUNTOF(params));
+    }
+    
+    if(verify) return verify_scorers(pool_threads) ? 0 : 1;
+    
+    bench_result_t results[COUNTOF(benchmarks)];
+    unsigned count = 0;
+    
+    printf("%-20s %12s %12s %12s %14s %10s\n",
+           "benchmark", "ns/op", "min", "max", "ops/s", "allocs/op");
+    for(unsigned i = 0; i < COUNTOF(benchmarks); ++i) {
+        if(filter && !strstr(benchmarks[i].name, filter)) continue;
+        
+        const bench_result_t *res = &results[count++];
+        results[count-1] = run_benchmark(&benchmarks[i], runs, min_time);
+        printf("%-20s %12.2f %12.2f %12.2f %14.0f %10.3f\n", res->name,
+               res->median_ns, res->min_ns, res->max_ns, 1e9 / res->median_ns, res->allocs);
+    }
+    
+    if(json_path) write_json(json_path, results, count);
+    return 0;
+}
@@ -0,0 +1,70 @@
+//===--------------------------------------------------------------------------------------------===
+// hist.c - Log-linear latency histograms
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "hist.h"
+#include <assert.h>
+#include <string.h>
+
+// Above 2 * HIST_HALF, a value keeps its top HIST_SUB_BITS bits: `shift` says how many were
+// dropped, and the bucket is the kept bits offset by one row of HIST_HALF per shift.
+static unsigned bucket_of(uint64_t value) {
+    if(value < 2 * HIST_HALF) return value;
+    unsigned shift = 63 - __builtin_clzll(value) - HIST_SUB_BITS + 1;
+    return shift * HIST_HALF + (value >> shift);
+}
+
+static uint64_t bucket_top(unsigned bucket) {
+    if(bucket < 2 * HIST_HALF) return bucket;
+    unsigned shift = bucket / HIST_HALF - 1;
+    uint64_t kept = bucket - shift * HIST_HALF;
+    return ((kept + 1) << shift) - 1;
+}
+
+void hist_init(hist_t *hist) {
+    assert(hist);
+    memset(hist, 0, sizeof(*hist));
+    hist->min = UINT64_MAX;
+}
+
+void hist_record(hist_t *hist, uint64_t value) {
+    assert(hist);
+    hist->buckets[bucket_of(value)] += 1;
+    hist->count += 1;
+    hist->total += value;
+    if(value < hist->min) hist->min = value;
+    if(value > hist->max) hist->max = value;
+}
+
+void hist_merge(hist_t *dst, const hist_t *src) {
+    assert(dst);
+    assert(src);
+    for(unsigned i = 0; i < HIST_BUCKETS; ++i) {
+        dst->buckets[i] += src->buckets[i];
+    }
+    dst->count += src->count;
+    dst->total += src->total;
+    if(src->min < dst->min) dst->min = src->min;
+    if(src->max > dst->max) dst->max = src->max;
+}
+
+uint64_t hist_percentile(const hist_t *hist, double percentile) {
+    assert(hist);
+    if(!hist->count) return 0;
+    uint64_t rank = (uint64_t)(percentile / 100.0 * hist->count + 0.5);
+    if(rank < 1) rank = 1;
+    if(rank > hist->count) rank = hist->count;
+    
+    uint64_t seen = 0;
+    for(unsigned i = 0; i < HIST_BUCKETS; ++i) {
+        seen += hist->buckets[i];
+        if(seen < rank) continue;
+        uint64_t top = bucket_top(i);
+        return top < hist->max ? top : hist->max;
+    }
+    return hist->max;
+}
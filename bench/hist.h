@@ -0,0 +1,37 @@
+//===--------------------------------------------------------------------------------------------===
+// hist.h - Log-linear latency histograms
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef HIST_H
+#define HIST_H
+
+#include <stdint.h>
+
+// HDR-style buckets: values below 2^HIST_SUB_BITS are exact; above that, each power of two is split
+// into 2^(HIST_SUB_BITS-1) equal buckets, so any value is within ~3% of its bucket's bounds, from
+// nanoseconds to hours, in fixed space.
+#define HIST_SUB_BITS       (6)
+#define HIST_HALF           (1u << (HIST_SUB_BITS - 1))
+#define HIST_BUCKETS        ((64 - HIST_SUB_BITS + 2) * HIST_HALF)
+
+typedef struct {
+    uint64_t        count;
+    uint64_t        total;
+    uint64_t        min;
+    uint64_t        max;
+    uint64_t        buckets[HIST_BUCKETS];
+} hist_t;
+
+void hist_init(hist_t *hist);
+void hist_record(hist_t *hist, uint64_t value);
+void hist_merge(hist_t *dst, const hist_t *src);
+
+// Highest value that could be in the bucket holding the `percentile` (0-100) mark: like HDR
+// histograms, an overestimate by at most the bucket's width.
+uint64_t hist_percentile(const hist_t *hist, double percentile);
+
+#endif /* end of include guard: HIST_H */
@@ -0,0 +1,475 @@
+//===--------------------------------------------------------------------------------------------===
+// loadgen.c - Simulated players against the embedded session API
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <term/arg.h>
+#include <term/printing.h>
+#include "hist.h"
+#include "jawc.h"
+#include "memory.h"
+#include "profile.h"
+
+#define COUNTOF(arr) (sizeof(arr) / sizeof(arr[0]))
+
+typedef enum {
+    OP_NEW_GAME,
+    OP_GUESS,
+    OP_HINT,
+    OP_REPORT,
+    OP_COUNT,
+} op_t;
+
+static const char *op_names[OP_COUNT] = {
+    [OP_NEW_GAME] = "new_game",
+    [OP_GUESS] = "guess",
+    [OP_HINT] = "hint",
+    [OP_REPORT] = "report",
+};
+
+typedef struct {
+    unsigned        players;
+    unsigned        threads;
+    unsigned        boards;
+    double          duration;       // Seconds.
+    double          think_ms;       // Mean pause between a player's actions.
+    double          hint_rate;      // Odds of asking for a hint before a guess.
+    double          hint_budget_ms; // 0 for unbounded hints.
+    uint64_t        seed;
+    const char      *session_path;
+    bool            fsync;
+    bool            reports;        // Analyse every game once it's over.
+} config_t;
+
+// A player keeps its own random stream, so what it plays depends on the seed and its index only,
+// not on how the threads happen to be scheduled.
+typedef struct {
+    uint32_t        id;
+    uint64_t        rng;
+    uint64_t        due;            // When it acts next.
+    bool            playing;
+    bool            hinted;
+    bool            reporting;      // The game is over, and its report is due next.
+    bool            won;
+    word_t          hint;
+    game_t          game;
+    solver_t        solver;
+} player_t;
+
+typedef struct {
+    unsigned        index;
+    player_t        *players;
+    unsigned        player_count;
+    player_t        **heap;         // Min-heap on `due`.
+    hist_t          hists[OP_COUNT];
+    analyst_t       analyst;
+    unsigned        games_won;
+    unsigned        games_lost;
+} driver_t;
+
+static config_t config;
+static lexicon_t lexicon;
+static wal_t wal;
+static uint64_t deadline;
+
+static const term_param_t params[] = {
+    {'n', 0, "players", TERM_ARG_VALUE, "concurrent sessions (default 1000)"},
+    {'j', 0, "threads", TERM_ARG_VALUE, "threads driving them (default: one per core)"},
+    {'b', 0, "boards", TERM_ARG_VALUE, "boards per game: 1, 2, 4 or 8 (default 1)"},
+    {'d', 0, "duration", TERM_ARG_VALUE, "seconds to run for (default 10)"},
+    {'t', 0, "think", TERM_ARG_VALUE, "mean think time between actions, in ms (default 100)"},
+    {'H', 0, "hints", TERM_ARG_VALUE, "odds of asking for a hint before a guess (default 0.05)"},
+    {'B', 0, "hint-budget", TERM_ARG_VALUE, "answer hints within MS milliseconds"},
+    {'s', 0, "seed", TERM_ARG_VALUE, "random seed (default 1)"},
+    {'S', 0, "session", TERM_ARG_VALUE, "log every session to a new write-ahead log"},
+    {'f', 0, "fsync", TERM_ARG_OPTION, "with --session, sync each commit group to disk"},
+    {'r', 0, "reports", TERM_ARG_OPTION, "write a post-game report after every game"},
+};
+
+static const char *uses[] = {
+    "[--players N] [--threads N] [--boards N] [--duration S] [--think MS] [--seed N]",
+    "[--hints P] [--hint-budget MS] [--session LOG_FILE [--fsync]] [--reports]",
+};
+
+// Player behaviour -----------------------------------------------------------------------------
+
+static uint64_t next_random(uint64_t *state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+static double uniform(uint64_t *state) {
+    return (next_random(state) >> 11) * 0x1.0p-53;
+}
+
+// Exponentially distributed, like the gaps between independent arrivals.
+static uint64_t think_time(player_t *player) {
+    if(config.think_ms <= 0) return 0;
+    return -log(1.0 - uniform(&player->rng)) * config.think_ms * 1e6;
+}
+
+static unsigned nth_candidate(const cset_t *set, unsigned n) {
+    for(unsigned block = 0;; ++block) {
+        uint64_t bits = set->bits[block];
+        unsigned count = __builtin_popcountll(bits);
+        if(n >= count) {
+            n -= count;
+            continue;
+        }
+        for(; n; --n) {
+            bits &= bits - 1;
+        }
+        return block * 64 + __builtin_ctzll(bits);
+    }
+}
+
+// Candidates for the first board still in play.
+static const cset_t *open_board(player_t *player) {
+    solver_update(&player->solver);
+    for(unsigned b = 0; b < player->game.board_count; ++b) {
+        if(board_is_solved(&player->game.boards[b])) continue;
+        if(player->solver.boards[b].size) return &player->solver.boards[b];
+    }
+    return NULL;
+}
+
+// Most players open with a word they know, then play something that fits what they've seen so
+// far. Some slip up and play a word that doesn't fit, and a few make typos.
+static void pick_guess(player_t *player, char *out) {
+    double roll = uniform(&player->rng);
+    const cset_t *set = NULL;
+    word_t word;
+    if(player->hinted) {
+        word = player->hint;
+    } else if(roll < 0.03) {
+        for(unsigned i = 0; i < WORD_SIZE; ++i) {
+            out[i] = 'a' + next_random(&player->rng) % 26;
+        }
+        out[WORD_SIZE] = '\0';
+        return;
+    } else if(player->game.guess_count && roll < 0.85 && (set = open_board(player))) {
+        word = lexicon.answers[nth_candidate(set, next_random(&player->rng) % set->size)];
+    } else if(roll < 0.95) {
+        word = lexicon.answers[next_random(&player->rng) % lexicon.answer_count];
+    } else {
+        word = lexicon.guesses[next_random(&player->rng) % lexicon.guess_count];
+    }
+    lang_decode(lexicon.lang, word, false, out);
+}
+
+// Actions --------------------------------------------------------------------------------------
+
+static void new_game(player_t *player) {
+    // game_init_boards() only plays puzzles up to today's: the puzzle is picked from the whole
+    // list by resetting the new game.
+    unsigned seq = next_random(&player->rng) % lexicon.target_count;
+    game_init_boards(&player->game, &lexicon, -1, config.boards);
+    game_reset(&player->game, seq);
+    solver_init(&player->solver, &player->game);
+    if(config.session_path) wal_commit(&wal, wal_begin(&wal, player->id, &player->game));
+    player->playing = true;
+    player->hinted = false;
+}
+
+static void end_game(driver_t *driver, player_t *player, bool won) {
+    if(config.session_path) wal_commit(&wal, wal_end(&wal, player->id));
+    solver_fini(&player->solver);
+    game_fini(&player->game);
+    player->playing = false;
+    if(won) {
+        driver->games_won += 1;
+    } else {
+        driver->games_lost += 1;
+    }
+}
+
+static void guess(driver_t *driver, player_t *player) {
+    char word[WORD_UTF8_SIZE];
+    pick_guess(player, word);
+    player->hinted = false;
+    
+    const guess_t *accepted = NULL;
+    result_t result = game_submit(&player->game, word, &accepted);
+    if(config.session_path && accepted) {
+        wal_commit(&wal, wal_guess(&wal, player->id, accepted->word));
+    }
+    if(result != GAME_RESULT_WON && result != GAME_RESULT_LOST) return;
+    if(config.reports) {
+        player->reporting = true;
+        player->won = result == GAME_RESULT_WON;
+    } else {
+        end_game(driver, player, result == GAME_RESULT_WON);
+    }
+}
+
+static void report(driver_t *driver, player_t *player) {
+    analysis_t analysis;
+    analysis_run(&driver->analyst, &player->game, &analysis);
+    player->reporting = false;
+    end_game(driver, player, player->won);
+}
+
+static void hint(player_t *player) {
+    if(config.hint_budget_ms > 0) {
+        player->hint = solver_hint_within(&player->solver, config.hint_budget_ms * 1e6, NULL, NULL);
+    } else {
+        player->hint = solver_hint(&player->solver);
+    }
+    player->hinted = true;
+}
+
+static op_t act(driver_t *driver, player_t *player) {
+    if(!player->playing) {
+        new_game(player);
+        return OP_NEW_GAME;
+    }
+    if(player->reporting) {
+        report(driver, player);
+        return OP_REPORT;
+    }
+    if(!player->hinted && uniform(&player->rng) < config.hint_rate) {
+        hint(player);
+        return OP_HINT;
+    }
+    guess(driver, player);
+    return OP_GUESS;
+}
+
+// Scheduling -----------------------------------------------------------------------------------
+
+static void heap_sift_down(player_t **heap, unsigned count, unsigned i) {
+    for(;;) {
+        unsigned least = i;
+        unsigned left = 2 * i + 1;
+        unsigned right = left + 1;
+        if(left < count && heap[left]->due < heap[least]->due) least = left;
+        if(right < count && heap[right]->due < heap[least]->due) least = right;
+        if(least == i) return;
+        player_t *tmp = heap[i];
+        heap[i] = heap[least];
+        heap[least] = tmp;
+        i = least;
+    }
+}
+
+static void sleep_until(uint64_t when) {
+    uint64_t now = prof_now();
+    if(when <= now) return;
+    struct timespec delay = {(when - now) / 1000000000ull, (when - now) % 1000000000ull};
+    nanosleep(&delay, NULL);
+}
+
+// Each driver owns a slice of the players and runs them off a single timer heap: the player due
+// soonest acts, then goes back in the heap one think time later. Latency is measured from the
+// moment the action was due, so a driver that falls behind shows it as queueing delay instead of
+// silently sending less load (coordinated omission).
+static void *driver_main(void *arg) {
+    driver_t *driver = arg;
+    uint64_t start = prof_now();
+    for(unsigned i = 0; i < driver->player_count; ++i) {
+        player_t *player = &driver->players[i];
+        player->due = start + think_time(player);
+        driver->heap[i] = player;
+    }
+    for(unsigned i = driver->player_count / 2; i-- > 0;) {
+        heap_sift_down(driver->heap, driver->player_count, i);
+    }
+    
+    while(driver->player_count) {
+        player_t *player = driver->heap[0];
+        if(player->due >= deadline) break;
+        sleep_until(player->due);
+        
+        op_t op = act(driver, player);
+        uint64_t end = prof_now();
+        hist_record(&driver->hists[op], end - player->due);
+        player->due = end + think_time(player);
+        heap_sift_down(driver->heap, driver->player_count, 0);
+    }
+    
+    for(unsigned i = 0; i < driver->player_count; ++i) {
+        player_t *player = &driver->players[i];
+        if(!player->playing) continue;
+        solver_fini(&player->solver);
+        game_fini(&player->game);
+    }
+    return NULL;
+}
+
+// Report ---------------------------------------------------------------------------------------
+
+static void print_report(const hist_t *hists, double seconds, unsigned won, unsigned lost) {
+    printf("%-10s %10s %10s %10s %10s %10s %10s %10s %10s\n", "op", "count", "ops/s",
+           "mean (us)", "p50", "p90", "p99", "p99.9", "max");
+    uint64_t total = 0;
+    for(unsigned op = 0; op < OP_COUNT; ++op) {
+        const hist_t *hist = &hists[op];
+        total += hist->count;
+        if(!hist->count) continue;
+        printf("%-10s %10llu %10.0f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", op_names[op],
+               (unsigned long long)hist->count, hist->count / seconds,
+               hist->total / 1e3 / hist->count, hist_percentile(hist, 50) / 1e3,
+               hist_percentile(hist, 90) / 1e3, hist_percentile(hist, 99) / 1e3,
+               hist_percentile(hist, 99.9) / 1e3, hist->max / 1e3);
+    }
+    printf("\n%llu ops in %.2fs (%.0f ops/s), %u games won, %u lost\n", (unsigned long long)total,
+           seconds, total / seconds, won, lost);
+}
+
+int main(int argc, const char **argv) {
+    term_arg_parser_t args;
+    term_arg_parser_init(&args, argc, argv);
+    
+    config = (config_t){
+        .players = 1000,
+        .threads = 0,
+        .boards = 1,
+        .duration = 10,
+        .think_ms = 100,
+        .hint_rate = 0.05,
+        .hint_budget_ms = 0,
+        .seed = 1,
+        .session_path = NULL,
+        .fsync = false,
+        .reports = false,
+    };
+    
+    term_arg_result_t r = term_arg_parse(&args, params, COUNTOF(params));
+    while(r.name != TERM_ARG_DONE) {
+        switch(r.name) {
+        case TERM_ARG_HELP:
+            term_print_usage(stdout, "jawc_loadgen", uses, COUNTOF(uses));
+            term_print_help(stdout, params, COUNTOF(params));
+            return 0;
+        
+        case TERM_ARG_ERROR:
+            term_error("jawc_loadgen", 1, "%s", args.error);
+            break;
+        
+        case TERM_ARG_VERSION:
+            printf("jawc_loadgen version 1.0r1 (" __DATE__ ")\n");
+            return 0;
+        
+        case 'n':
+            config.players = atoi(r.value);
+            if(config.players < 1) term_error("jawc_loadgen", 1, "need at least one player");
+            break;
+        case 'j':
+            config.threads = atoi(r.value);
+            break;
+        case 'b':
+            config.boards = atoi(r.value);
+            if(config.boards != 1 && config.boards != 2 && config.boards != 4 && config.boards != 8) {
+                term_error("jawc_loadgen", 1, "can only play 1, 2, 4 or 8 boards");
+            }
+            break;
+        case 'd':
+            config.duration = atof(r.value);
+            break;
+        case 't':
+            config.think_ms = atof(r.value);
+            break;
+        case 'H':
+            config.hint_rate = atof(r.value);
+            break;
+        case 'B':
+            config.hint_budget_ms = atof(r.value);
+            break;
+        case 's':
+            config.seed = strtoull(r.value, NULL, 10);
+            break;
+        case 'S':
+            config.session_path = r.value;
+            break;
+        case 'f':
+            config.fsync = true;
+            break;
+        case 'r':
+            config.reports = true;
+            break;
+        }
+        r = term_arg_parse(&args, params, COUNTOF(params));
+    }
+    if(!config.threads) config.threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if(config.threads < 1) config.threads = 1;
+    if(config.threads > config.players) config.threads = config.players;
+    
+    lexicon_init(&lexicon);
+    if(config.session_path) {
+        // The log must start empty, and the path may well be a real server's log: refuse it
+        // rather than delete it.
+        if(access(config.session_path, F_OK) == 0) {
+            term_error("jawc_loadgen", 1, "'%s' already exists", config.session_path);
+        }
+        wal_options_t options = {.fsync = config.fsync, .compact_bytes = 1 << 20};
+        if(!wal_open(&wal, &lexicon, config.session_path, &options)) {
+            term_error("jawc_loadgen", 1, "could not open a session log at '%s'", config.session_path);
+        }
+    }
+    
+    player_t *players = safe_calloc(config.players, sizeof(player_t));
+    player_t **heap = safe_calloc(config.players, sizeof(player_t *));
+    driver_t *drivers = safe_calloc(config.threads, sizeof(driver_t));
+    pthread_t *threads = safe_calloc(config.threads, sizeof(pthread_t));
+    uint64_t seed_state = config.seed;
+    for(unsigned i = 0; i < config.players; ++i) {
+        players[i].id = i;
+        players[i].rng = next_random(&seed_state);
+    }
+    
+    uint64_t start = prof_now();
+    deadline = start + config.duration * 1e9;
+    for(unsigned t = 0; t < config.threads; ++t) {
+        driver_t *driver = &drivers[t];
+        unsigned begin = (uint64_t)t * config.players / config.threads;
+        unsigned end = (uint64_t)(t + 1) * config.players / config.threads;
+        driver->index = t;
+        driver->players = players + begin;
+        driver->heap = heap + begin;
+        driver->player_count = end - begin;
+        analyst_init(&driver->analyst, &lexicon, NULL, 0);
+        for(unsigned op = 0; op < OP_COUNT; ++op) {
+            hist_init(&driver->hists[op]);
+        }
+        pthread_create(&threads[t], NULL, driver_main, driver);
+    }
+    
+    static hist_t totals[OP_COUNT];
+    unsigned won = 0, lost = 0;
+    for(unsigned op = 0; op < OP_COUNT; ++op) {
+        hist_init(&totals[op]);
+    }
+    for(unsigned t = 0; t < config.threads; ++t) {
+        pthread_join(threads[t], NULL);
+        for(unsigned op = 0; op < OP_COUNT; ++op) {
+            hist_merge(&totals[op], &drivers[t].hists[op]);
+        }
+        won += drivers[t].games_won;
+        lost += drivers[t].games_lost;
+    }
+    double seconds = (prof_now() - start) / 1e9;
+    
+    printf("%u players on %u threads, %.0fms mean think time%s\n\n", config.players,
+           config.threads, config.think_ms, config.session_path ? ", logged" : "");
+    print_report(totals, seconds, won, lost);
+    
+    if(config.session_path) wal_close(&wal);
+    safe_free(players);
+    safe_free(heap);
+    safe_free(drivers);
+    safe_free(threads);
+    lexicon_fini(&lexicon);
+    return 0;
+}
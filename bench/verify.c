@@ -0,0 +1,184 @@
+//===--------------------------------------------------------------------------------------------===
+// verify.c - Differential check of the optimised scorers
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "verify.h"
+#include "lexicon.h"
+#include "memory.h"
+#include "partition.h"
+#include "pool.h"
+#include "score.h"
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#define GUESS_CHUNK (32)
+
+typedef struct {
+    const lexicon_t *lex;
+    partition_t     partition;
+    pattern_t       *expected;
+    pattern_t       *actual;
+} scratch_t;
+
+// A scorer fills in the pattern of `guess` against every answer of the lexicon, in answer order.
+typedef struct {
+    const char      *name;
+    void            (*score_row)(scratch_t *scratch, word_t guess, pattern_t *out);
+} scorer_t;
+
+typedef struct {
+    unsigned        guess;
+    unsigned        answer;
+    pattern_t       expected;
+    pattern_t       actual;
+} mismatch_t;
+
+static void row_batch(scratch_t *scratch, word_t guess, pattern_t *out) {
+    score_batch(guess, scratch->lex->answers, scratch->lex->answer_count, out);
+}
+
+static void row_word(scratch_t *scratch, word_t guess, pattern_t *out) {
+    for(unsigned i = 0; i < scratch->lex->answer_count; ++i) {
+        out[i] = score_word(guess, scratch->lex->answers[i]);
+    }
+}
+
+static void row_partition(scratch_t *scratch, word_t guess, pattern_t *out) {
+    partition_t *part = &scratch->partition;
+    partition_reset(part, scratch->lex);
+    partition_split(part, guess);
+    for(unsigned p = 0; p < PATTERN_COUNT; ++p) {
+        for(unsigned i = part->bucket_start[p]; i < part->bucket_start[p+1]; ++i) {
+            out[part->indices[i]] = p;
+        }
+    }
+}
+
+static const scorer_t scorers[] = {
+    {"score_batch", row_batch},
+    {"score_word", row_word},
+    {"partition_split", row_partition},
+};
+
+#define SCORER_COUNT (sizeof(scorers) / sizeof(scorers[0]))
+
+typedef struct {
+    const lexicon_t *lex;
+    scratch_t       *scratch;       // One per worker.
+    pthread_mutex_t lock;
+    // Guess index of each scorer's first known mismatch, so that later guesses can skip it.
+    atomic_uint     first_guess[SCORER_COUNT];
+    bool            failed[SCORER_COUNT];
+    mismatch_t      first[SCORER_COUNT];
+} verify_t;
+
+static bool is_before(const mismatch_t *a, const mismatch_t *b) {
+    return a->guess < b->guess || (a->guess == b->guess && a->answer < b->answer);
+}
+
+static void report(verify_t *verify, unsigned scorer, const mismatch_t *mismatch) {
+    pthread_mutex_lock(&verify->lock);
+    if(!verify->failed[scorer] || is_before(mismatch, &verify->first[scorer])) {
+        verify->failed[scorer] = true;
+        verify->first[scorer] = *mismatch;
+        atomic_store(&verify->first_guess[scorer], mismatch->guess);
+    }
+    pthread_mutex_unlock(&verify->lock);
+}
+
+static void verify_range(void *ctx, unsigned worker, unsigned begin, unsigned end) {
+    verify_t *verify = ctx;
+    const lexicon_t *lex = verify->lex;
+    scratch_t *scratch = &verify->scratch[worker];
+    unsigned count = lex->answer_count;
+    
+    for(unsigned g = begin; g < end; ++g) {
+        word_t guess = lex->guesses[g];
+        for(unsigned a = 0; a < count; ++a) {
+            letter_state_t check[WORD_SIZE];
+            score_check(guess, lex->answers[a], check);
+            scratch->expected[a] = pattern_encode(check);
+        }
+        
+        for(unsigned s = 0; s < SCORER_COUNT; ++s) {
+            // Ranges finish in any order: only an earlier guess can improve on a known mismatch.
+            if(atomic_load_explicit(&verify->first_guess[s], memory_order_relaxed) < g) continue;
+            scorers[s].score_row(scratch, guess, scratch->actual);
+            for(unsigned a = 0; a < count; ++a) {
+                if(scratch->actual[a] == scratch->expected[a]) continue;
+                report(verify, s, &(mismatch_t){g, a, scratch->expected[a], scratch->actual[a]});
+                break;
+            }
+        }
+    }
+}
+
+static void pattern_str(pattern_t pattern, char out[WORD_SIZE+1]) {
+    letter_state_t check[WORD_SIZE];
+    pattern_decode(pattern, check);
+    for(unsigned i = 0; i < WORD_SIZE; ++i) {
+        out[i] = check[i] == GAME_LETTER_RIGHT ? 'G' : (check[i] == GAME_LETTER_MISPLACED ? 'Y' : '.');
+    }
+    out[WORD_SIZE] = '\0';
+}
+
+bool verify_scorers(unsigned threads) {
+    lexicon_t lex;
+    lexicon_init(&lex);
+    pool_t pool;
+    pool_init(&pool, threads);
+    
+    verify_t verify = {.lex = &lex};
+    pthread_mutex_init(&verify.lock, NULL);
+    for(unsigned s = 0; s < SCORER_COUNT; ++s) {
+        atomic_init(&verify.first_guess[s], UINT_MAX);
+    }
+    verify.scratch = safe_malloc(pool.thread_count * sizeof(scratch_t));
+    for(unsigned i = 0; i < pool.thread_count; ++i) {
+        scratch_t *scratch = &verify.scratch[i];
+        scratch->lex = &lex;
+        partition_init(&scratch->partition, &lex);
+        scratch->expected = safe_malloc(lex.answer_count);
+        scratch->actual = safe_malloc(lex.answer_count);
+    }
+    
+    printf("checking %zu scorers on %u x %u pairs, %u threads\n",
+           SCORER_COUNT, lex.guess_count, lex.answer_count, pool.thread_count);
+    pool_for(&pool, lex.guess_count, GUESS_CHUNK, verify_range, &verify);
+    
+    bool ok = true;
+    for(unsigned s = 0; s < SCORER_COUNT; ++s) {
+        if(!verify.failed[s]) {
+            printf("%-20s ok\n", scorers[s].name);
+            continue;
+        }
+        
+        const mismatch_t *m = &verify.first[s];
+        char guess[WORD_UTF8_SIZE], answer[WORD_UTF8_SIZE];
+        char expected[WORD_SIZE+1], actual[WORD_SIZE+1];
+        lang_decode(lex.lang, lex.guesses[m->guess], false, guess);
+        lang_decode(lex.lang, lex.answers[m->answer], false, answer);
+        pattern_str(m->expected, expected);
+        pattern_str(m->actual, actual);
+        printf("%-20s MISMATCH guess=%s answer=%s expected=%s got=%s\n",
+               scorers[s].name, guess, answer, expected, actual);
+        ok = false;
+    }
+    
+    for(unsigned i = 0; i < pool.thread_count; ++i) {
+        partition_fini(&verify.scratch[i].partition);
+        safe_free(verify.scratch[i].expected);
+        safe_free(verify.scratch[i].actual);
+    }
+    safe_free(verify.scratch);
+    pthread_mutex_destroy(&verify.lock);
+    pool_fini(&pool);
+    lexicon_fini(&lex);
+    return ok;
+}
@@ -0,0 +1,19 @@
+//===--------------------------------------------------------------------------------------------===
+// verify.h - Differential check of the optimised scorers
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef VERIFY_H
+#define VERIFY_H
+
+#include <stdbool.h>
+
+// Compares score_check() with every other scorer over the full guess x answer cross product of the
+// built-in lexicon, on `threads` threads (0 for one per core). Prints the first mismatch of each
+// scorer, and returns whether they all agreed.
+bool verify_scorers(unsigned threads);
+
+#endif /* end of include guard: VERIFY_H */
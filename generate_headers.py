@@ -1,60 +1,91 @@
 #!/usr/bin/env python3
-XOR_KEY = 0x5a
+# Words are stored packed rather than as strings: five letters, 5 bits each, first letter in the
+# low bits. A table of uint32_t needs no relocations, so the whole dictionary is one read-only blob
+# even in a PIE build. Answers are XORed with ANSWER_KEY so they don't show up in `strings`.
+ANSWER_KEY = 0x15a5a5a
+LETTER_BITS = 5
+WORD_SIZE = 5
+PER_LINE = 8
 
 def output_head(out):
     out.write('// jawc dictionary data\n')
     out.write('\n')
-    
+
 def output_header_array(name, out):
-    out.write('extern const char *%s[];\n' % name)
+    out.write('extern const uint32_t %s[];\n' % name)
     out.write('extern const unsigned %s_size;\n' % name)
 
 def output_data_array(name, data, out):
-    out.write('const char *%s[] = {\n' %name)
-    
-    for word in data:
-        word = word.replace('\\', '\\\\').replace('"', '\\"').replace('?', '\\?')
-        out.write('   "%s",\n' % word)
+    out.write('const uint32_t %s[] = {\n' % name)
+
+    for i in range(0, len(data), PER_LINE):
+        out.write('    %s,\n' % ', '.join('0x%07x' % code for code in data[i:i+PER_LINE]))
     out.write('};')
     out.write('\n')
     out.write('const unsigned %s_size = %d;\n' % (name, len(data)))
 
-def xor_word(word, key):
-    return "".join([chr(ord(l) ^ key) for l in word])
+def pack_word(word):
+    assert len(word) == WORD_SIZE and word.isascii() and word.isalpha() and word.islower(), word
+    return sum((ord(l) - ord('a')) << (i * LETTER_BITS) for i, l in enumerate(word))
 
 with open('answers_decrypt.txt', 'r') as answers_txt, open('allowed-guesses.txt', 'r') as words_txt:
-    answers_ordered = [xor_word(word.rstrip(), XOR_KEY) for word in answers_txt]
+    answers_ordered = [pack_word(word.rstrip()) ^ ANSWER_KEY for word in answers_txt]
     answers = sorted(answers_ordered)
-    indices = [answers.index(word) for word in answers_ordered]
-    words = [word.rstrip() for word in words_txt]
-    
+    index_of = {code: i for i, code in enumerate(answers)}
+    indices = [index_of[code] for code in answers_ordered]
+    words = [pack_word(word.rstrip()) for word in words_txt]
+
 with open('src/dict.c', 'w') as out_c, open('src/dict.h', 'w') as out_h, open('src/target.c', 'w') as out_tgt:
     output_head(out_h)
-    
-    # const unsigned target_count = 2309;
-    # const unsigned targets[] = {
-    
-    out_tgt.write('const unsigned target_count = %d;\n' % len(indices))
-    out_tgt.write('const unsigned targets[] = {\n')
+
+    out_tgt.write('const unsigned dict_target_count = %d;\n' % len(indices))
+    out_tgt.write('const unsigned dict_targets[] = {\n')
     for idx in indices:
         out_tgt.write('    %d,\n' % idx)
     out_tgt.write('};\n')
-    
-    out_h.write('\n')
+
     out_h.write('#ifndef _JAWC_DICT_H_\n')
     out_h.write('#define _JAWC_DICT_H_\n')
     out_h.write('\n')
-    
-    output_header_array('answers', out_h)
-    output_header_array('words', out_h)
+    out_h.write('#include <stdint.h>\n')
+    out_h.write('\n')
+    out_h.write('// Packed words: %d letters of %d bits each (a = 0), first letter in the low bits.\n'
+                % (WORD_SIZE, LETTER_BITS))
+    out_h.write('#define DICT_LETTER_BITS    (%d)\n' % LETTER_BITS)
+    out_h.write('#define DICT_LETTER_MASK    ((1u << DICT_LETTER_BITS) - 1)\n')
+    out_h.write('#define DICT_ANSWER_KEY     (0x%07xu)\n' % ANSWER_KEY)
+    out_h.write('\n')
+
+    output_header_array('dict_answers', out_h)
+    output_header_array('dict_words', out_h)
+    out_h.write('// Puzzle number -> index in dict_answers (src/target.c).\n')
+    out_h.write('extern const unsigned dict_target_count;\n')
+    out_h.write('extern const unsigned dict_targets[];\n')
+    out_h.write('\n')
+    out_h.write('static inline uint32_t dict_answer(unsigned i) {\n')
+    out_h.write('    return dict_answers[i] ^ DICT_ANSWER_KEY;\n')
+    out_h.write('}\n')
+    out_h.write('\n')
+    out_h.write('static inline uint32_t dict_word(unsigned i) {\n')
+    out_h.write('    return dict_words[i];\n')
+    out_h.write('}\n')
+    out_h.write('\n')
+    out_h.write('static inline unsigned dict_letter(uint32_t packed, unsigned i) {\n')
+    out_h.write('    return (packed >> (i * DICT_LETTER_BITS)) & DICT_LETTER_MASK;\n')
+    out_h.write('}\n')
+    out_h.write('\n')
+    out_h.write('static inline void dict_decode(uint32_t packed, char out[%d]) {\n' % (WORD_SIZE + 1))
+    out_h.write('    for(unsigned i = 0; i < %d; ++i) {\n' % WORD_SIZE)
+    out_h.write("        out[i] = 'a' + dict_letter(packed, i);\n")
+    out_h.write('    }\n')
+    out_h.write("    out[%d] = '\\0';\n" % WORD_SIZE)
+    out_h.write('}\n')
+    out_h.write('\n')
     out_h.write('#endif\n')
-    
 
     output_head(out_c)
-    output_data_array('answers', answers, out_c)
+    out_c.write('#include "dict.h"\n')
     out_c.write('\n')
-    output_data_array('words', words, out_c)
+    output_data_array('dict_answers', answers, out_c)
     out_c.write('\n')
-
-    
-    
\ No newline at end of file
+    output_data_array('dict_words', words, out_c)
@@ -0,0 +1,179 @@
+//===--------------------------------------------------------------------------------------------===
+// analysis.c - Post-game analysis: information per guess, luck, and the solver's game
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "analysis.h"
+#include "memory.h"
+#include "profile.h"
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+// Each hint gets this fraction of what is left of its half of the budget: the first positions,
+// with the most candidates, get the most time.
+#define ANALYSIS_HINT_SHARE     (3)
+
+void analyst_init(analyst_t *analyst, const lexicon_t *lex, const book_t *book,
+                  uint64_t budget_ns) {
+    assert(analyst);
+    assert(lex);
+    analyst->lex = lex;
+    analyst->book = book;
+    analyst->budget_ns = budget_ns ? budget_ns : ANALYSIS_BUDGET_NS;
+    analyst->opener = WORD_NONE;
+}
+
+// A fresh copy of the puzzle `game` is playing, for replaying guesses into.
+static void restart(game_t *shadow, const game_t *game) {
+    if(game->mode == GAME_MODE_ABSURDLE) {
+        game_init_absurdle(shadow, game->lexicon);
+        return;
+    }
+    memset(shadow, 0, sizeof(*shadow));
+    shadow->lexicon = game->lexicon;
+    shadow->mode = game->mode;
+    shadow->seq = game->seq;
+    shadow->board_count = game->board_count;
+    shadow->max_guesses = game->max_guesses;
+    for(unsigned b = 0; b < game->board_count; ++b) {
+        shadow->boards[b].answer = game->boards[b].answer;
+    }
+}
+
+static bool board_open(const solver_t *solver, unsigned board) {
+    return !board_is_solved(&solver->game->boards[board]) && solver->boards[board].size;
+}
+
+// Entropy of the feedback `guess` would get on each board in play, summed.
+static double expected_bits(const solver_t *solver, word_t guess, unsigned *indices,
+                            word_t *words, pattern_t *patterns) {
+    const game_t *game = solver->game;
+    double bits = 0;
+    for(unsigned b = 0; b < game->board_count; ++b) {
+        if(!board_open(solver, b)) continue;
+        const cset_t *set = &solver->boards[b];
+        unsigned count = cset_list(set, indices);
+        for(unsigned i = 0; i < count; ++i) {
+            words[i] = game->lexicon->answers[indices[i]];
+        }
+        score_batch(guess, words, count, patterns);
+        
+        unsigned hist[PATTERN_COUNT] = {0};
+        for(unsigned i = 0; i < count; ++i) {
+            hist[patterns[i]] += 1;
+        }
+        bits += pattern_entropy(hist, count);
+    }
+    return bits;
+}
+
+static word_t best_guess(analyst_t *analyst, solver_t *solver, uint64_t budget_ns) {
+    const game_t *game = solver->game;
+    word_t hint = analyst->book ? book_hint(analyst->book, game) : WORD_NONE;
+    if(hint != WORD_NONE) return hint;
+    if(game->guess_count == 0) {
+        if(analyst->opener == WORD_NONE) analyst->opener = solver_hint(solver);
+        return analyst->opener;
+    }
+    // A budget of 0 would mean no limit at all.
+    return solver_hint_within(solver, budget_ns ? budget_ns : 1, NULL, NULL);
+}
+
+static uint64_t share_of(uint64_t deadline) {
+    uint64_t now = prof_now();
+    return now < deadline ? (deadline - now) / ANALYSIS_HINT_SHARE : 0;
+}
+
+static void judge_turns(analyst_t *analyst, const game_t *game, game_t *shadow, uint64_t deadline,
+                        analysis_t *out) {
+    unsigned capacity = game->lexicon->answer_count;
+    unsigned *indices = safe_malloc(capacity * sizeof(unsigned));
+    word_t *words = safe_malloc(capacity * sizeof(word_t));
+    pattern_t *patterns = safe_malloc(capacity * sizeof(pattern_t));
+    
+    solver_t solver;
+    solver_init(&solver, shadow);
+    out->turn_count = 0;
+    out->luck = 0;
+    for(unsigned i = 0; i < game->guess_count; ++i) {
+        analysis_turn_t *turn = &out->turns[out->turn_count++];
+        solver_update(&solver);
+        
+        unsigned before[MAX_BOARDS] = {0};
+        turn->guess = game->guesses[i].word;
+        turn->before = 0;
+        for(unsigned b = 0; b < shadow->board_count; ++b) {
+            if(!board_open(&solver, b)) continue;
+            before[b] = solver.boards[b].size;
+            turn->before += before[b];
+        }
+        turn->expected_bits = expected_bits(&solver, turn->guess, indices, words, patterns);
+        turn->best = best_guess(analyst, &solver, share_of(deadline));
+        turn->best_bits = expected_bits(&solver, turn->best, indices, words, patterns);
+        // A hint cut short can miss what the player found.
+        if(turn->expected_bits >= turn->best_bits) {
+            turn->best = turn->guess;
+            turn->best_bits = turn->expected_bits;
+        }
+        
+        const guess_t *replayed = NULL;
+        game_submit_word(shadow, turn->guess, &replayed);
+        solver_update(&solver);
+        turn->after = 0;
+        turn->gained_bits = 0;
+        for(unsigned b = 0; b < shadow->board_count; ++b) {
+            if(!before[b]) continue;
+            unsigned after = solver.boards[b].size;
+            turn->after += after;
+            if(after) turn->gained_bits += log2((double)before[b] / after);
+        }
+        out->luck += turn->gained_bits - turn->expected_bits;
+    }
+    solver_fini(&solver);
+    
+    safe_free(indices);
+    safe_free(words);
+    safe_free(patterns);
+}
+
+static void play_solver(analyst_t *analyst, game_t *shadow, uint64_t deadline, analysis_t *out) {
+    solver_t solver;
+    solver_init(&solver, shadow);
+    out->solver_turn_count = 0;
+    out->solver_won = false;
+    
+    result_t result = GAME_RESULT_AGAIN;
+    while(result == GAME_RESULT_AGAIN) {
+        word_t word = best_guess(analyst, &solver, share_of(deadline));
+        const guess_t *guess = NULL;
+        result = game_submit_word(shadow, word, &guess);
+        if(!guess) break;
+        out->solver_guesses[out->solver_turn_count++] = word;
+    }
+    out->solver_won = result == GAME_RESULT_WON;
+    solver_fini(&solver);
+}
+
+void analysis_run(analyst_t *analyst, const game_t *game, analysis_t *out) {
+    assert(analyst);
+    assert(game);
+    assert(out);
+    assert(game->lexicon == analyst->lex);
+    lexicon_wait(analyst->lex);
+    uint64_t start = prof_now();
+    
+    game_t shadow;
+    restart(&shadow, game);
+    judge_turns(analyst, game, &shadow, start + analyst->budget_ns / 2, out);
+    game_fini(&shadow);
+    
+    restart(&shadow, game);
+    play_solver(analyst, &shadow, start + analyst->budget_ns, out);
+    game_fini(&shadow);
+    
+    out->elapsed_ns = prof_now() - start;
+}
@@ -0,0 +1,59 @@
+//===--------------------------------------------------------------------------------------------===
+// analysis.h - Post-game analysis: information per guess, luck, and the solver's game
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef ANALYSIS_H
+#define ANALYSIS_H
+
+#include "solver.h"
+
+// Time a report may take by default: half of it is spent judging the player's guesses, the other
+// half playing the solver's game.
+#define ANALYSIS_BUDGET_NS      (50 * 1000000ull)
+
+typedef struct {
+    word_t          guess;
+    unsigned        before;         // Candidates left on the boards in play, summed.
+    unsigned        after;
+    double          expected_bits;  // What the guess was expected to tell, summed over the boards.
+    double          gained_bits;    // What its feedback did tell: log2(before / after) per board.
+    word_t          best;           // The best guess the solver found in the same position.
+    double          best_bits;      // What that one was expected to tell.
+} analysis_turn_t;
+
+typedef struct {
+    unsigned        turn_count;
+    analysis_turn_t turns[MAX_TURNS];
+    // Gained minus expected, over the whole game: 0 on average, positive when the feedback was
+    // kinder than the guesses deserved.
+    double          luck;
+    
+    // The solver's game on the same puzzle.
+    bool            solver_won;
+    unsigned        solver_turn_count;
+    word_t          solver_guesses[MAX_TURNS];
+    
+    uint64_t        elapsed_ns;
+} analysis_t;
+
+// Writes reports. Not thread-safe: give each thread its own.
+typedef struct {
+    const lexicon_t *lex;
+    const book_t    *book;          // Optional: answers the solver's first guesses right away.
+    uint64_t        budget_ns;
+    // Every game starts from the same position, so the best opener is only searched for once,
+    // without a budget. The first report pays for it.
+    word_t          opener;
+} analyst_t;
+
+// `book` can be NULL and must outlive the analyst. `budget_ns` 0 means ANALYSIS_BUDGET_NS.
+void analyst_init(analyst_t *analyst, const lexicon_t *lex, const book_t *book, uint64_t budget_ns);
+
+// Analyses a finished (or abandoned) game, which isn't modified.
+void analysis_run(analyst_t *analyst, const game_t *game, analysis_t *out);
+
+#endif /* end of include guard: ANALYSIS_H */
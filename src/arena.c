@@ -0,0 +1,133 @@
+//===--------------------------------------------------------------------------------------------===
+// arena.c - Head-to-head evaluation of solver strategies
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "arena.h"
+#include "memory.h"
+#include "pool.h"
+#include "profile.h"
+#include <assert.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct {
+    const lexicon_t *lex;
+    const strategy_t *strategy;
+    uint64_t        move_limit_ns;
+    void            **states;       // One instance per worker, made on the worker's first game.
+    arena_result_t  *results;       // One tally per worker.
+} match_t;
+
+static uint64_t thread_cpu_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void play(match_t *match, void *state, unsigned seq, arena_result_t *tally) {
+    const strategy_t *strategy = match->strategy;
+    game_t game;
+    game_init_target(&game, match->lex, seq);
+    
+    // Only the strategy's own calls count towards its CPU time, not the arena's bookkeeping.
+    uint64_t cpu_start = thread_cpu_now();
+    strategy->reset(state, &game);
+    tally->cpu_ns += thread_cpu_now() - cpu_start;
+    result_t result = GAME_RESULT_AGAIN;
+    while(result == GAME_RESULT_AGAIN) {
+        uint64_t start = prof_now();
+        cpu_start = thread_cpu_now();
+        word_t word = strategy->choose(state, &game, match->move_limit_ns);
+        tally->cpu_ns += thread_cpu_now() - cpu_start;
+        uint64_t elapsed = prof_now() - start;
+        if(elapsed > tally->slowest_move_ns) tally->slowest_move_ns = elapsed;
+        if(match->move_limit_ns && elapsed > match->move_limit_ns) {
+            tally->timeouts += 1;
+            break;
+        }
+        
+        const guess_t *guess = NULL;
+        result = game_submit_word(&game, word, &guess);
+        if(result == GAME_RESULT_NOT_A_WORD || result == GAME_RESULT_ALREADY_GUESSED) {
+            tally->invalid += 1;
+            break;
+        }
+    }
+    
+    tally->games += 1;
+    if(result == GAME_RESULT_WON) {
+        tally->solved += 1;
+        tally->guesses += game.guess_count;
+        tally->distribution[game.guess_count - 1] += 1;
+    } else {
+        tally->failed += 1;
+    }
+    game_fini(&game);
+}
+
+static void play_range(void *ctx, unsigned worker, unsigned begin, unsigned end) {
+    match_t *match = ctx;
+    if(!match->states[worker]) match->states[worker] = match->strategy->init(match->lex);
+    for(unsigned seq = begin; seq < end; ++seq) {
+        play(match, match->states[worker], seq, &match->results[worker]);
+    }
+}
+
+void arena_run(const lexicon_t *lex, const strategy_t *const *strategies, unsigned count,
+               const arena_options_t *options, arena_result_t *results) {
+    assert(lex);
+    assert(strategies);
+    assert(options);
+    assert(results);
+    lexicon_wait(lex);
+    
+    pool_t pool;
+    pool_init(&pool, options->threads);
+    unsigned workers = pool.thread_count;
+    match_t match = {
+        .lex = lex,
+        .move_limit_ns = options->move_limit_ns,
+        .states = safe_malloc(workers * sizeof(void *)),
+        .results = safe_malloc(workers * sizeof(arena_result_t)),
+    };
+    
+    for(unsigned i = 0; i < count; ++i) {
+        match.strategy = strategies[i];
+        memset(match.states, 0, workers * sizeof(void *));
+        memset(match.results, 0, workers * sizeof(arena_result_t));
+        
+        uint64_t start = prof_now();
+        pool_for(&pool, lex->target_count, 1, play_range, &match);
+        uint64_t wall = prof_now() - start;
+        
+        arena_result_t *total = &results[i];
+        memset(total, 0, sizeof(*total));
+        total->strategy = strategies[i];
+        total->wall_ns = wall;
+        for(unsigned w = 0; w < workers; ++w) {
+            const arena_result_t *tally = &match.results[w];
+            total->games += tally->games;
+            total->solved += tally->solved;
+            total->failed += tally->failed;
+            total->invalid += tally->invalid;
+            total->timeouts += tally->timeouts;
+            total->guesses += tally->guesses;
+            total->cpu_ns += tally->cpu_ns;
+            for(unsigned g = 0; g < MAX_GUESSES; ++g) {
+                total->distribution[g] += tally->distribution[g];
+            }
+            if(tally->slowest_move_ns > total->slowest_move_ns) {
+                total->slowest_move_ns = tally->slowest_move_ns;
+            }
+            if(match.states[w] && strategies[i]->fini) strategies[i]->fini(match.states[w]);
+        }
+    }
+    
+    safe_free(match.states);
+    safe_free(match.results);
+    pool_fini(&pool);
+}
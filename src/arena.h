@@ -0,0 +1,40 @@
+//===--------------------------------------------------------------------------------------------===
+// arena.h - Head-to-head evaluation of solver strategies
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef ARENA_H
+#define ARENA_H
+
+#include "strategy.h"
+
+typedef struct {
+    unsigned        threads;        // 0 for one per CPU.
+    uint64_t        move_limit_ns;  // A move that takes longer forfeits the game. 0 for none.
+} arena_options_t;
+
+typedef struct {
+    const strategy_t *strategy;
+    unsigned        games;
+    unsigned        solved;
+    unsigned        failed;         // Lost, forfeited, or timed out: everything not solved.
+    unsigned        invalid;        // Forfeits for a guess game_submit() refused.
+    unsigned        timeouts;       // Forfeits for a move over the limit.
+    uint64_t        guesses;        // Summed over solved games.
+    unsigned        distribution[MAX_GUESSES];
+    uint64_t        cpu_ns;         // Thread CPU time in the strategy's reset() and choose().
+    uint64_t        slowest_move_ns;
+    uint64_t        wall_ns;
+} arena_result_t;
+
+// Plays every puzzle of the lexicon (every entry of `targets`) with each of the `count`
+// strategies, spreading the puzzles over a worker pool, each worker with its own strategy
+// instance. Strategies run one after the other so they don't compete for the CPU. Moves go
+// through game_submit_word(), like a player's would.
+void arena_run(const lexicon_t *lex, const strategy_t *const *strategies, unsigned count,
+               const arena_options_t *options, arena_result_t *results);
+
+#endif /* end of include guard: ARENA_H */
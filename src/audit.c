@@ -0,0 +1,327 @@
+//===--------------------------------------------------------------------------------------------===
+// audit.c - Suspicious-play detection over recorded games
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "audit.h"
+#include "memory.h"
+#include "pool.h"
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+
+// Lines per task: a game replays in microseconds, so tasks need a few hundred to be worth stealing.
+#define AUDIT_GRAIN     (512)
+
+static const char *skip_spaces(const char *str) {
+    while(*str == ' ' || *str == '\t') str += 1;
+    return str;
+}
+
+static const char *skip_word(const char *str) {
+    while(*str && *str != ' ' && *str != '\t' && *str != '\n' && *str != '\r') str += 1;
+    return str;
+}
+
+static bool at_end(const char *str) {
+    return !*str || *str == '\n' || *str == '\r';
+}
+
+void auditor_init(auditor_t *auditor, const lexicon_t *lex) {
+    assert(auditor);
+    assert(lex);
+    auditor->lex = lex;
+    partition_init(&auditor->part, lex);
+    
+    // The bucket sizes are all the entropy and its spread need, so their logs are tabulated once
+    // rather than taken 243 times per guess.
+    auditor->clogc = safe_malloc((lex->answer_count + 1) * sizeof(double));
+    auditor->clog2c = safe_malloc((lex->answer_count + 1) * sizeof(double));
+    auditor->clogc[0] = auditor->clog2c[0] = 0;
+    for(unsigned c = 1; c <= lex->answer_count; ++c) {
+        double bits = log2(c);
+        auditor->clogc[c] = c * bits;
+        auditor->clog2c[c] = c * bits * bits;
+    }
+    for(unsigned i = 0; i < AUDIT_OPENERS; ++i) {
+        auditor->opener_words[i] = WORD_NONE;
+    }
+}
+
+void auditor_fini(auditor_t *auditor) {
+    assert(auditor);
+    partition_fini(&auditor->part);
+    for(unsigned i = 0; i < AUDIT_OPENERS; ++i) {
+        if(auditor->opener_words[i] != WORD_NONE) partition_fini(&auditor->openers[i].part);
+    }
+    safe_free(auditor->clogc);
+    safe_free(auditor->clog2c);
+}
+
+// FNV-1a over the player's name, up to the first space.
+static uint64_t hash_player(const char *str) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for(; *str && *str != ' ' && *str != '\t' && *str != '\n' && *str != '\r'; ++str) {
+        hash = (hash ^ (unsigned char)*str) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+bool audit_parse(const lexicon_t *lex, const char *line, audit_game_t *out) {
+    assert(lex);
+    assert(line);
+    assert(out);
+    
+    line = skip_spaces(line);
+    if(at_end(line)) return false;
+    out->player = hash_player(line);
+    line = skip_spaces(skip_word(line));
+    if(!lang_encode(lex->lang, line, &out->answer)) return false;
+    line = skip_spaces(skip_word(line));
+    
+    out->guess_count = 0;
+    while(!at_end(line)) {
+        if(out->guess_count == MAX_GUESSES) return false;
+        if(out->guess_count && out->guesses[out->guess_count-1] == out->answer) return false;
+        word_t guess;
+        if(!lang_encode(lex->lang, line, &guess) || !lexicon_contains(lex, guess)) return false;
+        out->guesses[out->guess_count++] = guess;
+        line = skip_spaces(skip_word(line));
+    }
+    return out->guess_count > 0;
+}
+
+static bool has_answer(const partition_t *part, word_t answer) {
+    for(unsigned i = 0; i < part->count; ++i) {
+        if(part->words[i] == answer) return true;
+    }
+    return false;
+}
+
+static void bucket_sums(const auditor_t *auditor, const partition_t *part, double *sum,
+                        double *sum2) {
+    *sum = *sum2 = 0;
+    for(unsigned p = 0; p < PATTERN_COUNT; ++p) {
+        unsigned size = partition_bucket_size(part, p);
+        *sum += auditor->clogc[size];
+        *sum2 += auditor->clog2c[size];
+    }
+}
+
+// Splits the whole answer list on the first guess, or finds that split in the cache. Openers
+// follow a long tail, so the cache keeps the most used ones rather than the most recent.
+static const audit_opener_t *split_opener(auditor_t *auditor, word_t guess) {
+    unsigned slot = 0;
+    for(unsigned i = 0; i < AUDIT_OPENERS; ++i) {
+        if(auditor->opener_words[i] == guess) {
+            auditor->openers[i].hits += 1;
+            return &auditor->openers[i];
+        }
+        if(auditor->opener_words[i] == WORD_NONE) {
+            slot = i;
+            break;
+        }
+        if(auditor->openers[i].hits < auditor->openers[slot].hits) slot = i;
+    }
+    
+    audit_opener_t *opener = &auditor->openers[slot];
+    if(auditor->opener_words[slot] == WORD_NONE) {
+        partition_init(&opener->part, auditor->lex);
+    } else {
+        partition_reset(&opener->part, auditor->lex);
+        // Ages the counts, so that openers that were popular once don't stay forever.
+        for(unsigned i = 0; i < AUDIT_OPENERS; ++i) {
+            auditor->openers[i].hits /= 2;
+        }
+    }
+    auditor->opener_words[slot] = guess;
+    opener->hits = 1;
+    partition_split(&opener->part, guess);
+    bucket_sums(auditor, &opener->part, &opener->sum, &opener->sum2);
+    return opener;
+}
+
+void audit_score(auditor_t *auditor, const audit_game_t *game, audit_score_t *out) {
+    assert(auditor);
+    assert(game);
+    assert(out);
+    partition_t *part = &auditor->part;
+    
+    out->valid = true;
+    out->won = false;
+    out->player = game->player;
+    out->luck = 0;
+    out->variance = 0;
+    out->expected_wins = 0;
+    out->wins_variance = 0;
+    out->win_candidates = 0;
+    out->inconsistent = 0;
+    
+    // Each guess splits the candidates left into one bucket per pattern. With fair play the answer
+    // is in any of them with probability size/total, so its bucket says how surprising the
+    // feedback was, and the bucket sizes how surprising it was expected to be.
+    for(unsigned i = 0; i < game->guess_count; ++i) {
+        word_t guess = game->guesses[i];
+        pattern_t pattern = score_word(guess, game->answer);
+        
+        const partition_t *split = part;
+        double sum, sum2;
+        if(i == 0) {
+            const audit_opener_t *opener = split_opener(auditor, guess);
+            split = &opener->part;
+            sum = opener->sum;
+            sum2 = opener->sum2;
+        } else {
+            partition_split(part, guess);
+            bucket_sums(auditor, part, &sum, &sum2);
+        }
+        unsigned total = split->count;
+        unsigned size = partition_bucket_size(split, pattern);
+        // The answer is always in its own bucket, unless it isn't in the answer list.
+        if(!size) {
+            out->valid = false;
+            return;
+        }
+        
+        // With L = log2(total) and s = L - log2(size), the mean of s is L - sum/total and its mean
+        // square is L^2 - 2L sum/total + sum2/total.
+        double bits = log2(total);
+        double entropy = bits - sum / total;
+        double square = bits * bits - 2 * bits * sum / total + sum2 / total;
+        out->luck += bits - auditor->clogc[size] / size - entropy;
+        out->variance += square - entropy * entropy;
+        
+        // Only a guess that could still be the answer has a bucket for the win.
+        unsigned winning = partition_bucket_size(split, PATTERN_WON);
+        if(!winning) out->inconsistent += 1;
+        double p = (double)winning / total;
+        out->expected_wins += p;
+        out->wins_variance += p * (1 - p);
+        
+        if(pattern == PATTERN_WON) {
+            out->won = true;
+            out->win_candidates = total;
+            break;
+        }
+        if(i == 0) {
+            partition_copy_bucket(part, split, pattern);
+        } else {
+            partition_keep(part, pattern);
+        }
+    }
+    // Its bucket can also hold other words without it, though: only a win proves the answer was a
+    // candidate all along, so lost games are checked against what's left.
+    if(!out->won) out->valid = game->guess_count > 0 && has_answer(part, game->answer);
+    out->flagged = out->luck >= AUDIT_GAME_BITS;
+}
+
+typedef struct {
+    const lexicon_t *lex;
+    const char *const *lines;
+    audit_score_t   *scores;
+    auditor_t       *auditors;      // One per worker, made on the worker's first task.
+    bool            *ready;
+} audit_job_t;
+
+static void audit_range(void *ctx, unsigned worker, unsigned begin, unsigned end) {
+    audit_job_t *job = ctx;
+    auditor_t *auditor = &job->auditors[worker];
+    if(!job->ready[worker]) {
+        auditor_init(auditor, job->lex);
+        job->ready[worker] = true;
+    }
+    
+    for(unsigned i = begin; i < end; ++i) {
+        audit_game_t game;
+        if(audit_parse(job->lex, job->lines[i], &game)) {
+            audit_score(auditor, &game, &job->scores[i]);
+        } else {
+            job->scores[i].valid = false;
+        }
+    }
+}
+
+void audit_run(const lexicon_t *lex, const char *const *lines, unsigned count, unsigned threads,
+               audit_score_t *scores) {
+    assert(lex);
+    assert(lines || !count);
+    assert(scores || !count);
+    lexicon_wait(lex);
+    
+    pool_t pool;
+    pool_init(&pool, threads);
+    audit_job_t job = {
+        .lex = lex,
+        .lines = lines,
+        .scores = scores,
+        .auditors = safe_malloc(pool.thread_count * sizeof(auditor_t)),
+        .ready = safe_calloc(pool.thread_count, sizeof(bool)),
+    };
+    pool_for(&pool, count, AUDIT_GRAIN, audit_range, &job);
+    
+    for(unsigned w = 0; w < pool.thread_count; ++w) {
+        if(job.ready[w]) auditor_fini(&job.auditors[w]);
+    }
+    safe_free(job.auditors);
+    safe_free(job.ready);
+    pool_fini(&pool);
+}
+
+typedef struct {
+    uint64_t        player;
+    unsigned        idx;
+} keyed_t;
+
+static int compare_keyed(const void *a, const void *b) {
+    const keyed_t *lhs = a, *rhs = b;
+    if(lhs->player != rhs->player) return lhs->player < rhs->player ? -1 : 1;
+    return lhs->idx < rhs->idx ? -1 : lhs->idx > rhs->idx;
+}
+
+static int compare_first(const void *a, const void *b) {
+    const audit_player_t *lhs = a, *rhs = b;
+    return lhs->first < rhs->first ? -1 : lhs->first > rhs->first;
+}
+
+unsigned audit_players(const audit_score_t *scores, unsigned count, audit_player_t *out) {
+    assert(scores || !count);
+    assert(out || !count);
+    
+    // Sorting on the hash groups each player's games without a table keyed on names.
+    keyed_t *keys = safe_malloc(count * sizeof(keyed_t));
+    unsigned valid = 0;
+    for(unsigned i = 0; i < count; ++i) {
+        if(scores[i].valid) keys[valid++] = (keyed_t){scores[i].player, i};
+    }
+    qsort(keys, valid, sizeof(keyed_t), compare_keyed);
+    
+    unsigned players = 0;
+    double variance = 0, wins_variance = 0;
+    for(unsigned i = 0; i < valid; ++i) {
+        const audit_score_t *score = &scores[keys[i].idx];
+        if(!i || keys[i].player != keys[i-1].player) {
+            out[players++] = (audit_player_t){.player = keys[i].player, .first = keys[i].idx};
+            variance = wins_variance = 0;
+        }
+        audit_player_t *player = &out[players-1];
+        player->games += 1;
+        player->won += score->won;
+        player->luck += score->luck;
+        player->expected_wins += score->expected_wins;
+        variance += score->variance;
+        wins_variance += score->wins_variance;
+        
+        player->z = variance > 0 ? player->luck / sqrt(variance) : 0;
+        double excess = player->won - player->expected_wins;
+        player->wins_z = wins_variance > 0 ? excess / sqrt(wins_variance) : 0;
+        player->flagged = player->games >= AUDIT_PLAYER_GAMES
+                       && (player->z >= AUDIT_PLAYER_Z || player->wins_z >= AUDIT_PLAYER_Z);
+    }
+    safe_free(keys);
+    
+    qsort(out, players, sizeof(audit_player_t), compare_first);
+    return players;
+}
@@ -0,0 +1,103 @@
+//===--------------------------------------------------------------------------------------------===
+// audit.h - Suspicious-play detection over recorded games
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef AUDIT_H
+#define AUDIT_H
+
+#include "game.h"
+#include "partition.h"
+
+// A single game is flagged when it was this many bits luckier than expected. One lucky win isn't
+// proof of anything, so this only catches the blatant ones; cheating shows up over many games.
+#define AUDIT_GAME_BITS     (10.0)
+// A player is flagged when their summed luck, or their wins beyond chance, are this many standard
+// deviations above what fair play would give, over at least AUDIT_PLAYER_GAMES games.
+#define AUDIT_PLAYER_Z      (4.0)
+#define AUDIT_PLAYER_GAMES  (5)
+// Openers whose split of the whole answer list each auditor keeps. Most players stick to a few
+// openers, and the first split is most of the cost of a replay.
+#define AUDIT_OPENERS       (64)
+
+// A recorded single-board game: the answer, then the guesses in order. The feedback isn't stored,
+// since the answer determines it.
+typedef struct {
+    uint64_t        player;         // Hash of the player's name.
+    word_t          answer;
+    unsigned        guess_count;
+    word_t          guesses[MAX_GUESSES];
+} audit_game_t;
+
+typedef struct {
+    bool            valid;          // False if the line didn't parse, and nothing else is set.
+    bool            won;
+    bool            flagged;
+    uint64_t        player;
+    // Bits of information the feedback gave, beyond what each guess was expected to give against
+    // the candidates left at the time. 0 on average for fair play, whatever the player's skill: a
+    // strong player picks guesses that are expected to tell more, not ones that tell more than
+    // expected. Someone steering towards an answer they already know keeps being lucky.
+    double          luck;
+    double          variance;       // Of `luck` under fair play, given the guesses played.
+    // How many wins fair play would have got with the same guesses: each guess that could still
+    // be the answer wins with probability 1 / candidates. `won` can only exceed it by a little,
+    // unless the player keeps winning from many candidates.
+    double          expected_wins;
+    double          wins_variance;
+    unsigned        win_candidates; // Candidates left before the winning guess; 0 if lost.
+    unsigned        inconsistent;   // Guesses that the feedback so far had already ruled out.
+} audit_score_t;
+
+typedef struct {
+    uint64_t        player;
+    unsigned        first;          // Index of the player's first game.
+    unsigned        games;
+    unsigned        won;
+    double          luck;
+    double          z;              // Summed luck over its standard deviation.
+    double          expected_wins;
+    double          wins_z;         // Wins beyond expected_wins, over their standard deviation.
+    bool            flagged;
+} audit_player_t;
+
+typedef struct {
+    unsigned        hits;           // Since the last eviction, halved at each one.
+    partition_t     part;           // Split on the opener.
+    double          sum;            // Of c * log2(c) over the buckets.
+    double          sum2;           // Of c * log2(c)^2.
+} audit_opener_t;
+
+// Replays games against one lexicon. Not thread-safe: audit_run() makes one per worker.
+typedef struct {
+    const lexicon_t *lex;
+    partition_t     part;
+    double          *clogc;         // c * log2(c), for bucket sizes up to answer_count.
+    double          *clog2c;        // c * log2(c)^2.
+    word_t          opener_words[AUDIT_OPENERS];    // WORD_NONE for empty slots.
+    audit_opener_t  openers[AUDIT_OPENERS];
+} auditor_t;
+
+void auditor_init(auditor_t *auditor, const lexicon_t *lex);
+void auditor_fini(auditor_t *auditor);
+
+// Reads "PLAYER ANSWER GUESS GUESS...", with words in the lexicon's language. Fails if a guess
+// isn't valid, there are more than MAX_GUESSES of them, or the game goes on after a win.
+bool audit_parse(const lexicon_t *lex, const char *line, audit_game_t *out);
+
+// Replays a game. Games whose answer isn't in the answer list come out invalid.
+void audit_score(auditor_t *auditor, const audit_game_t *game, audit_score_t *out);
+
+// Parses and scores every line in parallel (`threads` 0 for one per CPU): one audit_score_t per
+// line in `scores`.
+void audit_run(const lexicon_t *lex, const char *const *lines, unsigned count, unsigned threads,
+               audit_score_t *scores);
+
+// Sums the valid scores per player. `out` must hold `count` entries; players come out in order of
+// their first game. Returns how many there are.
+unsigned audit_players(const audit_score_t *scores, unsigned count, audit_player_t *out);
+
+#endif /* end of include guard: AUDIT_H */
@@ -0,0 +1,223 @@
+//===--------------------------------------------------------------------------------------------===
+// book.c - Opening book search and file format
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "book.h"
+#include "memory.h"
+#include "partition.h"
+#include "pool.h"
+#include "profile.h"
+#include "tile.h"
+#include <assert.h>
+#include <limits.h>
+#include <string.h>
+
+#define BOOK_MAGIC      "JWCB"
+#define BOOK_VERSION    (1)
+
+// On-disk layout, in host byte order: the book is a cache, rebuilt rather than shared.
+typedef struct {
+    char            magic[4];
+    uint32_t        version;
+    book_t          book;
+} book_file_t;
+
+typedef struct {
+    double          score;
+    unsigned        guess;
+} choice_t;
+
+typedef struct {
+    pattern_t       pattern;
+    unsigned        start;
+    unsigned        size;
+} bucket_t;
+
+// One search scores every guess against each bucket of candidates. Index i of the parallel loop is
+// guess (i % guess_count) against bucket (i / guess_count), so small and large buckets share the
+// same work queue.
+typedef struct {
+    const lexicon_t *lex;
+    const word_t    *words;
+    // Pattern of each answer under the opener, to tell whether a guess is still a candidate in a
+    // bucket.
+    const pattern_t *keys;
+    unsigned        bucket_count;
+    bucket_t        buckets[PATTERN_COUNT];
+    
+    pattern_t       *scratch;       // answer_count per worker.
+    choice_t        *best;          // bucket_count per worker.
+} search_t;
+
+static bool is_better(choice_t a, choice_t b) {
+    // Ties go to the lowest guess index, so the result doesn't depend on the thread count.
+    return a.score > b.score || (a.score == b.score && a.guess < b.guess);
+}
+
+static void search_range(void *ctx, unsigned worker, unsigned begin, unsigned end) {
+    search_t *search = ctx;
+    const lexicon_t *lex = search->lex;
+    pattern_t *patterns = search->scratch + worker * lex->answer_count;
+    choice_t *best = search->best + worker * search->bucket_count;
+    unsigned hist[PATTERN_COUNT];
+    
+    for(unsigned i = begin; i < end; ++i) {
+        unsigned b = i / lex->guess_count;
+        unsigned g = i % lex->guess_count;
+        const bucket_t *bucket = &search->buckets[b];
+        
+        score_batch(lex->guesses[g], search->words + bucket->start, bucket->size, patterns);
+        memset(hist, 0, sizeof(hist));
+        for(unsigned j = 0; j < bucket->size; ++j) {
+            hist[patterns[j]] += 1;
+        }
+        
+        // Same objective as solver_hint() on a single board.
+        choice_t choice = {pattern_entropy(hist, bucket->size), g};
+        if(g < lex->answer_count && search->keys[g] == bucket->pattern) {
+            choice.score += 1.0 / bucket->size;
+        }
+        if(is_better(choice, best[b])) best[b] = choice;
+    }
+}
+
+// Best guess for each of the search's buckets, into `out` (indices into lex->guesses).
+static void search_run(search_t *search, pool_t *pool, unsigned grain, unsigned *out) {
+    const lexicon_t *lex = search->lex;
+    unsigned workers = pool->thread_count;
+    search->scratch = safe_malloc(workers * lex->answer_count * sizeof(pattern_t));
+    search->best = safe_malloc(workers * search->bucket_count * sizeof(choice_t));
+    for(unsigned i = 0; i < workers * search->bucket_count; ++i) {
+        search->best[i] = (choice_t){-1, UINT_MAX};
+    }
+    
+    pool_for(pool, search->bucket_count * lex->guess_count, grain, search_range, search);
+    
+    for(unsigned b = 0; b < search->bucket_count; ++b) {
+        choice_t best = search->best[b];
+        for(unsigned w = 1; w < workers; ++w) {
+            if(is_better(search->best[w * search->bucket_count + b], best)) {
+                best = search->best[w * search->bucket_count + b];
+            }
+        }
+        out[b] = best.guess;
+    }
+    safe_free(search->scratch);
+    safe_free(search->best);
+}
+
+void book_build(book_t *book, const lexicon_t *lex, unsigned threads) {
+    assert(book);
+    assert(lex);
+    lexicon_wait(lex);
+    uint64_t start = prof_begin();
+    
+    // The opener is the one search over the whole answer list, which the tiled engine is built for.
+    double *entropy = safe_malloc(lex->guess_count * sizeof(double));
+    tile_options_t options = {.threads = threads, .spill_path = NULL};
+    tile_entropy(lex, lex->answers, lex->answer_count, &options, entropy);
+    choice_t opener = {-1, UINT_MAX};
+    for(unsigned g = 0; g < lex->guess_count; ++g) {
+        choice_t choice = {entropy[g], g};
+        if(g < lex->answer_count) choice.score += 1.0 / lex->answer_count;
+        if(is_better(choice, opener)) opener = choice;
+    }
+    safe_free(entropy);
+    book->opener = lex->guesses[opener.guess];
+    
+    pool_t pool;
+    pool_init(&pool, threads);
+    for(unsigned p = 0; p < PATTERN_COUNT; ++p) {
+        book->replies[p] = WORD_NONE;
+    }
+    
+    partition_t part;
+    partition_init(&part, lex);
+    partition_split(&part, book->opener);
+    pattern_t *keys = safe_malloc(lex->answer_count);
+    score_batch(book->opener, lex->answers, lex->answer_count, keys);
+    
+    search_t search = {.lex = lex, .words = part.words, .keys = keys, .bucket_count = 0};
+    for(unsigned p = 0; p < PATTERN_WON; ++p) {
+        unsigned size = partition_bucket_size(&part, p);
+        if(!size) continue;
+        // One candidate left: nothing beats guessing it.
+        if(size == 1) {
+            book->replies[p] = part.words[part.bucket_start[p]];
+            continue;
+        }
+        search.buckets[search.bucket_count++] = (bucket_t){p, part.bucket_start[p], size};
+    }
+    
+    unsigned replies[PATTERN_COUNT];
+    search_run(&search, &pool, 64, replies);
+    for(unsigned b = 0; b < search.bucket_count; ++b) {
+        book->replies[search.buckets[b].pattern] = lex->guesses[replies[b]];
+    }
+    
+    safe_free(keys);
+    partition_fini(&part);
+    pool_fini(&pool);
+    book->lexicon_hash = lexicon_hash(lex);
+    prof_end(PROF_BOOK_BUILD, start);
+}
+
+bool book_save(const book_t *book, const char *path) {
+    assert(book);
+    assert(path);
+    FILE *out = fopen(path, "wb");
+    if(!out) return false;
+    
+    book_file_t file = {.version = BOOK_VERSION, .book = *book};
+    memcpy(file.magic, BOOK_MAGIC, sizeof(file.magic));
+    bool ok = fwrite(&file, sizeof(file), 1, out) == 1;
+    return fclose(out) == 0 && ok;
+}
+
+bool book_load(book_t *book, const lexicon_t *lex, const char *path) {
+    assert(book);
+    assert(lex);
+    assert(path);
+    FILE *in = fopen(path, "rb");
+    if(!in) return false;
+    
+    book_file_t file;
+    bool ok = fread(&file, sizeof(file), 1, in) == 1;
+    fclose(in);
+    if(!ok) return false;
+    if(memcmp(file.magic, BOOK_MAGIC, sizeof(file.magic))) return false;
+    if(file.version != BOOK_VERSION) return false;
+    
+    if(!book_check(&file.book, lex)) return false;
+    *book = file.book;
+    return true;
+}
+
+bool book_check(const book_t *book, const lexicon_t *lex) {
+    assert(book);
+    assert(lex);
+    lexicon_wait(lex);
+    if(book->lexicon_hash != lexicon_hash(lex)) return false;
+    // The hash only says which lists the book was built for: a damaged file can still hold words
+    // that aren't in them, which would go straight to the player as hints.
+    if(!lexicon_contains(lex, book->opener)) return false;
+    for(unsigned p = 0; p < PATTERN_COUNT; ++p) {
+        if(book->replies[p] != WORD_NONE && !lexicon_contains(lex, book->replies[p])) return false;
+    }
+    return true;
+}
+
+word_t book_hint(const book_t *book, const game_t *game) {
+    assert(book);
+    assert(game);
+    if(game->board_count != 1) return WORD_NONE;
+    if(game->guess_count == 0) return book->opener;
+    if(game->guess_count == 1 && game->guesses[0].word == book->opener) {
+        return book->replies[game->guesses[0].patterns[0]];
+    }
+    return WORD_NONE;
+}
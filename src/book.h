@@ -0,0 +1,37 @@
+//===--------------------------------------------------------------------------------------------===
+// book.h - Precomputed opening moves
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef BOOK_H
+#define BOOK_H
+
+#include "game.h"
+
+// The first two moves of a single-board game are the most expensive hints to compute (every guess
+// against every answer), and always the same for a given lexicon. A book stores them: the best
+// opener, and the best reply to each pattern the opener can get back.
+typedef struct {
+    uint32_t        lexicon_hash;   // Which word lists the book was built for.
+    word_t          opener;
+    word_t          replies[PATTERN_COUNT]; // WORD_NONE where the opener can't get that pattern.
+} book_t;
+
+// Scores every allowed guess as an opener, then every allowed guess again as a reply to each
+// pattern of the best one, on `threads` workers (0 for one per CPU). Uses the same objective as
+// solver_hint(), but over the whole guess list.
+void book_build(book_t *book, const lexicon_t *lex, unsigned threads);
+
+bool book_save(const book_t *book, const char *path);
+// Fails if the file is missing, corrupt, or was built for different word lists.
+bool book_load(book_t *book, const lexicon_t *lex, const char *path);
+// Whether `book` was built for `lex`, and only ever hints words `lex` accepts.
+bool book_check(const book_t *book, const lexicon_t *lex);
+
+// The book move for `game`, or WORD_NONE once it is out of book (or has more than one board).
+word_t book_hint(const book_t *book, const game_t *game);
+
+#endif /* end of include guard: BOOK_H */
@@ -0,0 +1,236 @@
+//===--------------------------------------------------------------------------------------------===
+// bulk.c - Streaming word validation and scoring, for scripts
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "bulk.h"
+#include "memory.h"
+#include "pool.h"
+#include <assert.h>
+#include <string.h>
+
+static const char *skip_spaces(const char *str) {
+    while(*str == ' ' || *str == '\t') str += 1;
+    return str;
+}
+
+static const char *skip_word(const char *str) {
+    while(*str != ' ' && *str != '\t' && *str != '\n' && *str != '\r') str += 1;
+    return str;
+}
+
+// lang_index() searches the alphabet letter by letter, which is most of the cost of a line: ASCII
+// letters are looked up in a table instead, and anything else goes through lang_encode().
+typedef struct {
+    int8_t          ascii[128];
+} bulk_letters_t;
+
+static void build_letters(const lang_t *lang, bulk_letters_t *letters) {
+    for(unsigned c = 0; c < 128; ++c) {
+        letters->ascii[c] = lang_index(lang, c);
+    }
+}
+
+static bool encode_word(const lang_t *lang, const bulk_letters_t *letters, const char *str,
+                        const char *end, word_t *out) {
+    for(const char *c = str; c < end; ++c) {
+        if((unsigned char)*c >= 128) return lang_encode(lang, str, out);
+    }
+    if(end - str != WORD_SIZE) return false;
+    
+    letter_t word[WORD_SIZE];
+    for(unsigned i = 0; i < WORD_SIZE; ++i) {
+        int letter = letters->ascii[(unsigned char)str[i]];
+        if(letter < 0) return false;
+        word[i] = letter;
+    }
+    *out = word_pack(word);
+    return true;
+}
+
+static bool read_word(const lexicon_t *lex, const bulk_letters_t *letters, const char **line,
+                      word_t *out) {
+    const char *start = skip_spaces(*line);
+    const char *end = skip_word(start);
+    *line = skip_spaces(end);
+    return encode_word(lex->lang, letters, start, end, out) && lexicon_contains(lex, *out);
+}
+
+size_t bulk_chunk(const lexicon_t *lex, bulk_mode_t mode, const char *in, size_t length,
+                  char *out) {
+    assert(lex);
+    assert(in || !length);
+    assert(out || !length);
+    assert(!length || in[length-1] == '\n');
+    lexicon_wait(lex);
+    bulk_letters_t letters;
+    build_letters(lex->lang, &letters);
+    
+    const char *end = in + length;
+    char *cursor = out;
+    // An output line is never longer than its input line, except for the "?" or "0" that an empty
+    // one gets: hence 2 * length.
+    while(in < end) {
+        const char *line = in;
+        word_t guess, answer;
+        bool valid = read_word(lex, &letters, &line, &guess);
+        if(mode == BULK_SCORE) valid = read_word(lex, &letters, &line, &answer) && valid;
+        valid = valid && (*line == '\n' || (line[0] == '\r' && line[1] == '\n'));
+        in = (const char *)memchr(line, '\n', end - line) + 1;
+        
+        if(mode == BULK_CHECK) {
+            *cursor++ = valid ? '1' : '0';
+        } else if(!valid) {
+            *cursor++ = '?';
+        } else {
+            letter_state_t check[WORD_SIZE];
+            pattern_decode(score_word(guess, answer), check);
+            for(unsigned i = 0; i < WORD_SIZE; ++i) {
+                *cursor++ = check[i] == GAME_LETTER_RIGHT ? 'G'
+                          : check[i] == GAME_LETTER_MISPLACED ? 'Y' : '.';
+            }
+        }
+        *cursor++ = '\n';
+    }
+    return cursor - out;
+}
+
+typedef struct {
+    char            *in;            // BULK_CHUNK + 1 bytes, for the '\n' a last line may lack.
+    size_t          start;          // Where this chunk's first whole line starts.
+    size_t          length;         // Bytes of whole lines from there.
+    size_t          tail;           // Bytes of a partial line after them, for the next chunk.
+    char            *out;           // 2 * (BULK_CHUNK + 1) bytes.
+    size_t          written;
+    unsigned        lines;
+} bulk_slot_t;
+
+typedef struct {
+    const lexicon_t *lex;
+    bulk_mode_t     mode;
+    bulk_slot_t     *slots;
+} bulk_job_t;
+
+static void bulk_range(void *ctx, unsigned worker, unsigned begin, unsigned end) {
+    (void)worker;
+    bulk_job_t *job = ctx;
+    for(unsigned i = begin; i < end; ++i) {
+        bulk_slot_t *slot = &job->slots[i];
+        slot->written = bulk_chunk(job->lex, job->mode, slot->in + slot->start, slot->length,
+                                   slot->out);
+        slot->lines = 0;
+        for(const char *c = slot->out; (c = memchr(c, '\n', slot->out + slot->written - c)); ++c) {
+            slot->lines += 1;
+        }
+    }
+}
+
+// Fills a slot with whatever the previous one didn't finish, then as much input as fits, and
+// leaves the partial line at the end for the next slot. `skipping` is set while the rest of a line
+// too long for a chunk is being thrown away.
+static bool fill_slot(bulk_slot_t *slot, const char *carry, size_t carry_size, FILE *in,
+                      bool *skipping, bool *eof) {
+    if(carry_size) memmove(slot->in, carry, carry_size);
+    size_t size = carry_size + fread(slot->in + carry_size, 1, BULK_CHUNK - carry_size, in);
+    if(size < BULK_CHUNK) {
+        if(ferror(in)) return false;
+        *eof = true;
+    }
+    
+    slot->start = 0;
+    slot->tail = 0;
+    if(*skipping) {
+        const char *newline = memchr(slot->in, '\n', size);
+        if(newline) {
+            slot->start = newline - slot->in + 1;
+            *skipping = false;
+        } else {
+            slot->start = size;
+        }
+    }
+    
+    // The last line of the input may not end in a newline.
+    if(*eof && size > slot->start && slot->in[size-1] != '\n') slot->in[size++] = '\n';
+    
+    const char *last = NULL;
+    for(size_t i = size; i > slot->start; --i) {
+        if(slot->in[i-1] == '\n') {
+            last = slot->in + i - 1;
+            break;
+        }
+    }
+    if(last) {
+        slot->length = last + 1 - (slot->in + slot->start);
+        slot->tail = size - (last + 1 - slot->in);
+    } else if(*eof || *skipping || slot->start) {
+        // Nothing left, or the end of a skipped line took up the chunk: what's left of the chunk
+        // goes on in the next one.
+        slot->length = 0;
+        slot->tail = size - slot->start;
+    } else {
+        // A whole chunk without a newline: the line gets an empty one's result, and the rest of it
+        // is skipped.
+        slot->in[0] = '\n';
+        slot->length = 1;
+        *skipping = true;
+    }
+    return true;
+}
+
+bool bulk_run(const lexicon_t *lex, bulk_mode_t mode, FILE *in, FILE *out, unsigned threads,
+              uint64_t *lines) {
+    assert(lex);
+    assert(in && out);
+    lexicon_wait(lex);
+    
+    pool_t pool;
+    pool_init(&pool, threads);
+    unsigned slot_count = pool.thread_count * BULK_CHUNKS_PER_THREAD;
+    bulk_job_t job = {
+        .lex = lex,
+        .mode = mode,
+        .slots = safe_malloc(slot_count * sizeof(bulk_slot_t)),
+    };
+    for(unsigned i = 0; i < slot_count; ++i) {
+        job.slots[i].in = safe_malloc(BULK_CHUNK + 1);
+        job.slots[i].out = safe_malloc(2 * (BULK_CHUNK + 1));
+    }
+    
+    uint64_t done = 0;
+    bool ok = true, eof = false, skipping = false;
+    const char *carry = NULL;
+    size_t carry_size = 0;
+    while(ok && !eof) {
+        unsigned used = 0;
+        while(used < slot_count && !eof) {
+            bulk_slot_t *slot = &job.slots[used++];
+            if(!fill_slot(slot, carry, carry_size, in, &skipping, &eof)) {
+                ok = false;
+                break;
+            }
+            carry = slot->in + slot->start + slot->length;
+            carry_size = slot->tail;
+        }
+        if(!ok) break;
+        
+        pool_for(&pool, used, 1, bulk_range, &job);
+        for(unsigned i = 0; i < used && ok; ++i) {
+            const bulk_slot_t *slot = &job.slots[i];
+            ok = fwrite(slot->out, 1, slot->written, out) == slot->written;
+            if(ok) done += slot->lines;
+        }
+    }
+    ok = fflush(out) == 0 && ok;
+    
+    for(unsigned i = 0; i < slot_count; ++i) {
+        safe_free(job.slots[i].in);
+        safe_free(job.slots[i].out);
+    }
+    safe_free(job.slots);
+    pool_fini(&pool);
+    if(lines) *lines = done;
+    return ok;
+}
@@ -0,0 +1,40 @@
+//===--------------------------------------------------------------------------------------------===
+// bulk.h - Streaming word validation and scoring, for scripts
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef BULK_H
+#define BULK_H
+
+#include "lexicon.h"
+#include "score.h"
+#include <stdio.h>
+
+// Bytes of input per chunk. Each worker gets BULK_CHUNKS_PER_THREAD of them per batch, so a slow
+// chunk doesn't leave the others idle, and the batch is written in order once it's all done.
+#define BULK_CHUNK              (256 * 1024)
+#define BULK_CHUNKS_PER_THREAD  (2)
+
+typedef enum {
+    // "WORD" gives "1" if the word is a valid guess, "0" if not.
+    BULK_CHECK,
+    // "GUESS ANSWER" gives the feedback, one of G (right), Y (misplaced) or . (no) per letter, or
+    // "?" if either isn't a valid guess.
+    BULK_SCORE,
+} bulk_mode_t;
+
+// Processes `length` bytes of lines, each ending in '\n', and writes one line of output per line of
+// input to `out`, which must hold 2 * length bytes. Returns the number of bytes written.
+size_t bulk_chunk(const lexicon_t *lex, bulk_mode_t mode, const char *in, size_t length,
+                  char *out);
+
+// Reads `in` to the end, on `threads` threads (0 for one per CPU), and writes the results to `out`
+// in the order of the input. Lines longer than BULK_CHUNK are invalid. Returns false if reading or
+// writing failed; `lines` gets the number of lines done until then.
+bool bulk_run(const lexicon_t *lex, bulk_mode_t mode, FILE *in, FILE *out, unsigned threads,
+              uint64_t *lines);
+
+#endif /* end of include guard: BULK_H */
@@ -0,0 +1,283 @@
+//===--------------------------------------------------------------------------------------------===
+// bundle.c - Precomputed data for the built-in lists, mapped straight from a file
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "bundle.h"
+#include "dict.h"
+#include "memory.h"
+#include "pool.h"
+#include <assert.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define BUNDLE_MAGIC    "JWCD"
+#define BUNDLE_VERSION  (1)
+// Sections start on a cache line, so the rows of the matrix line up the way they would in memory.
+#define BUNDLE_ALIGN    (64)
+// Guesses per task when scoring the matrix.
+#define BUNDLE_GRAIN    (256)
+
+typedef enum {
+    SECTION_ANSWERS,
+    SECTION_GUESSES,
+    SECTION_VALID,
+    SECTION_PATTERNS,
+    SECTION_BOOK,
+    SECTION_DIFFICULTY,
+    SECTION_COUNT,
+} section_id_t;
+
+typedef struct {
+    uint32_t        id;
+    uint32_t        reserved;
+    uint64_t        offset;         // From the start of the file, BUNDLE_ALIGN aligned.
+    uint64_t        size;
+} section_t;
+
+// The header, then each section in the order of the table. Any change to the layout or to what a
+// section holds bumps BUNDLE_VERSION.
+typedef struct {
+    char            magic[4];
+    uint32_t        version;
+    uint32_t        dict_hash;
+    uint32_t        answer_count;
+    uint32_t        guess_count;
+    uint32_t        section_count;
+    uint64_t        size;           // Of the whole file, to catch a truncated one.
+    section_t       sections[SECTION_COUNT];
+} header_t;
+
+uint32_t bundle_dict_hash(void) {
+    uint32_t hash = jawc_hash_word(dict_answers_size) ^ dict_words_size;
+    for(unsigned i = 0; i < dict_answers_size; ++i) {
+        hash = jawc_hash_word(hash ^ dict_answers[i]);
+    }
+    for(unsigned i = 0; i < dict_words_size; ++i) {
+        hash = jawc_hash_word(hash ^ dict_words[i]);
+    }
+    return hash;
+}
+
+static void score_range(void *ctx, unsigned worker, unsigned begin, unsigned end) {
+    (void)worker;
+    const lexicon_t *lex = ctx;
+    pattern_t *patterns = (pattern_t *)lex->patterns;
+    for(unsigned g = begin; g < end; ++g) {
+        score_batch(lex->guesses[g], lex->answers, lex->answer_count,
+                    patterns + (size_t)g * lex->answer_count);
+    }
+}
+
+// Every answer gets the pair of patterns the book's two guesses give it, and answers with the same
+// pair can't be told apart by then.
+static void rate_answers(const lexicon_t *lex, const book_t *book, uint16_t *difficulty) {
+    unsigned count = lex->answer_count;
+    pattern_t *first = safe_malloc(count * sizeof(pattern_t));
+    unsigned *pairs = safe_calloc(PATTERN_COUNT * PATTERN_COUNT, sizeof(unsigned));
+    unsigned *keys = safe_malloc(count * sizeof(unsigned));
+    
+    score_batch(book->opener, lex->answers, count, first);
+    for(unsigned a = 0; a < count; ++a) {
+        pattern_t second = first[a] == PATTERN_WON
+            ? PATTERN_WON : score_word(book->replies[first[a]], lex->answers[a]);
+        keys[a] = first[a] * PATTERN_COUNT + second;
+        pairs[keys[a]] += 1;
+    }
+    for(unsigned a = 0; a < count; ++a) {
+        bool solved = first[a] == PATTERN_WON || keys[a] % PATTERN_COUNT == PATTERN_WON;
+        unsigned left = solved ? 0 : pairs[keys[a]];
+        difficulty[a] = left > UINT16_MAX ? UINT16_MAX : left;
+    }
+    safe_free(first);
+    safe_free(pairs);
+    safe_free(keys);
+}
+
+static size_t align(size_t offset) {
+    return (offset + BUNDLE_ALIGN - 1) & ~(size_t)(BUNDLE_ALIGN - 1);
+}
+
+static bool write_bundle(FILE *out, header_t *header, const void *data[SECTION_COUNT]) {
+    static const uint8_t zeros[BUNDLE_ALIGN] = {0};
+    size_t offset = align(sizeof(header_t));
+    for(unsigned i = 0; i < SECTION_COUNT; ++i) {
+        header->sections[i].id = i;
+        header->sections[i].reserved = 0;
+        header->sections[i].offset = offset;
+        offset = align(offset + header->sections[i].size);
+    }
+    header->size = offset;
+    
+    if(fwrite(header, sizeof(*header), 1, out) != 1) return false;
+    size_t written = sizeof(*header);
+    for(unsigned i = 0; i < SECTION_COUNT; ++i) {
+        const section_t *section = &header->sections[i];
+        size_t padding = section->offset - written;
+        if(fwrite(zeros, 1, padding, out) != padding) return false;
+        if(fwrite(data[i], 1, section->size, out) != section->size) return false;
+        written = section->offset + section->size;
+    }
+    size_t padding = header->size - written;
+    return fwrite(zeros, 1, padding, out) == padding;
+}
+
+bool bundle_build(const char *path, unsigned threads) {
+    assert(path);
+    lexicon_t lex;
+    lexicon_init(&lex);
+    
+    pattern_t *patterns = safe_malloc((size_t)lex.guess_count * lex.answer_count);
+    lex.patterns = patterns;
+    pool_t pool;
+    pool_init(&pool, threads);
+    pool_for(&pool, lex.guess_count, BUNDLE_GRAIN, score_range, &lex);
+    pool_fini(&pool);
+    
+    book_t book;
+    book_build(&book, &lex, threads);
+    uint16_t *difficulty = safe_malloc(lex.answer_count * sizeof(uint16_t));
+    rate_answers(&lex, &book, difficulty);
+    
+    header_t header = {
+        .magic = BUNDLE_MAGIC,
+        .version = BUNDLE_VERSION,
+        .dict_hash = bundle_dict_hash(),
+        .answer_count = lex.answer_count,
+        .guess_count = lex.guess_count,
+        .section_count = SECTION_COUNT,
+    };
+    header.sections[SECTION_ANSWERS].size = lex.answer_count * sizeof(word_t);
+    header.sections[SECTION_GUESSES].size = lex.guess_count * sizeof(word_t);
+    header.sections[SECTION_VALID].size = lex.valid.capacity * sizeof(word_t);
+    header.sections[SECTION_PATTERNS].size = (size_t)lex.guess_count * lex.answer_count;
+    header.sections[SECTION_BOOK].size = sizeof(book_t);
+    header.sections[SECTION_DIFFICULTY].size = lex.answer_count * sizeof(uint16_t);
+    const void *data[SECTION_COUNT] = {
+        [SECTION_ANSWERS] = lex.answers,
+        [SECTION_GUESSES] = lex.guesses,
+        [SECTION_VALID] = lex.valid.entries,
+        [SECTION_PATTERNS] = patterns,
+        [SECTION_BOOK] = &book,
+        [SECTION_DIFFICULTY] = difficulty,
+    };
+    
+    // Each builder writes its own file, so two processes rebuilding at once don't mix their output.
+    char temp[4096];
+    bool ok = snprintf(temp, sizeof(temp), "%s.%ld.tmp", path, (long)getpid()) < (int)sizeof(temp);
+    FILE *out = ok ? fopen(temp, "wb") : NULL;
+    if(out) {
+        ok = write_bundle(out, &header, data);
+        ok = fclose(out) == 0 && ok;
+        ok = ok && rename(temp, path) == 0;
+        if(!ok) remove(temp);
+    } else {
+        ok = false;
+    }
+    
+    safe_free(patterns);
+    safe_free(difficulty);
+    lexicon_fini(&lex);
+    return ok;
+}
+
+static const void *section(const bundle_t *bundle, const header_t *header, section_id_t id,
+                           size_t size) {
+    const section_t *section = &header->sections[id];
+    if(section->id != id || section->size != size) return NULL;
+    if(section->offset % BUNDLE_ALIGN || section->offset > bundle->size) return NULL;
+    if(section->size > bundle->size - section->offset) return NULL;
+    return (const uint8_t *)bundle->map + section->offset;
+}
+
+// Checks the header and section table against the file and the built-in lists. The contents of the
+// sections are trusted: hashing 30MB would cost more than the bundle saves.
+static bool check_bundle(bundle_t *bundle) {
+    const header_t *header = bundle->map;
+    if(header->version != BUNDLE_VERSION) return false;
+    if(header->dict_hash != bundle_dict_hash()) return false;
+    if(header->size != bundle->size || header->section_count != SECTION_COUNT) return false;
+    
+    size_t answers = header->answer_count, guesses = header->guess_count;
+    bundle->answer_count = answers;
+    bundle->guess_count = guesses;
+    bundle->answers = section(bundle, header, SECTION_ANSWERS, answers * sizeof(word_t));
+    bundle->guesses = section(bundle, header, SECTION_GUESSES, guesses * sizeof(word_t));
+    bundle->valid_capacity = header->sections[SECTION_VALID].size / sizeof(word_t);
+    bundle->valid = section(bundle, header, SECTION_VALID, bundle->valid_capacity * sizeof(word_t));
+    bundle->patterns = section(bundle, header, SECTION_PATTERNS, guesses * answers);
+    bundle->book = section(bundle, header, SECTION_BOOK, sizeof(book_t));
+    bundle->difficulty = section(bundle, header, SECTION_DIFFICULTY, answers * sizeof(uint16_t));
+    return bundle->answers && bundle->guesses && bundle->valid && bundle->valid_capacity
+        && bundle->patterns && bundle->book && bundle->difficulty;
+}
+
+bundle_status_t bundle_map(bundle_t *bundle, const char *path) {
+    assert(bundle);
+    assert(path);
+    memset(bundle, 0, sizeof(*bundle));
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) return BUNDLE_STALE;
+    
+    struct stat info;
+    char magic[4];
+    bundle_status_t status = BUNDLE_FOREIGN;
+    if(fstat(fd, &info) != 0) goto done;
+    if(info.st_size == 0) {
+        status = BUNDLE_STALE;
+        goto done;
+    }
+    if(pread(fd, magic, sizeof(magic), 0) != sizeof(magic)) goto done;
+    if(memcmp(magic, BUNDLE_MAGIC, sizeof(magic))) goto done;
+    
+    status = BUNDLE_STALE;
+    if((size_t)info.st_size < sizeof(header_t)) goto done;
+    bundle->size = info.st_size;
+    bundle->map = mmap(NULL, bundle->size, PROT_READ, MAP_SHARED, fd, 0);
+    if(bundle->map == MAP_FAILED) {
+        bundle->map = NULL;
+        status = BUNDLE_FOREIGN;
+        goto done;
+    }
+    if(check_bundle(bundle)) {
+        status = BUNDLE_OK;
+    } else {
+        bundle_unmap(bundle);
+    }
+
+done:
+    close(fd);
+    return status;
+}
+
+void bundle_unmap(bundle_t *bundle) {
+    assert(bundle);
+    if(bundle->map) munmap(bundle->map, bundle->size);
+    memset(bundle, 0, sizeof(*bundle));
+}
+
+void bundle_lexicon(const bundle_t *bundle, lexicon_t *lex) {
+    assert(bundle && bundle->map);
+    assert(lex);
+    // The mapping is read-only: none of this is ever written once a lexicon is loaded.
+    lex->lang = &lang_english;
+    lex->valid.size = bundle->guess_count;
+    lex->valid.capacity = bundle->valid_capacity;
+    lex->valid.entries = (word_t *)bundle->valid;
+    lex->answers = (word_t *)bundle->answers;
+    lex->answer_count = bundle->answer_count;
+    lex->guesses = (word_t *)bundle->guesses;
+    lex->guess_count = bundle->guess_count;
+    lex->targets = dict_targets;
+    lex->target_count = dict_target_count;
+    lex->patterns = bundle->patterns;
+    lex->mapped = true;
+    lex->loader = NULL;
+}
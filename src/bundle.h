@@ -0,0 +1,60 @@
+//===--------------------------------------------------------------------------------------------===
+// bundle.h - Precomputed data for the built-in lists, mapped straight from a file
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef BUNDLE_H
+#define BUNDLE_H
+
+#include "book.h"
+
+// Everything jawc would otherwise build from src/dict.c at startup, or compute on first use: the
+// decoded lists, the validation set, the guess x answer pattern matrix (about 30MB), the opening
+// book and the difficulty of each answer. The file is mapped read-only and used in place, so
+// processes that open the same bundle share its pages, and opening one costs no more than checking
+// its header. It is a cache in host byte order, rebuilt rather than shared between machines.
+typedef struct {
+    void            *map;
+    size_t          size;
+    
+    const word_t    *answers;
+    unsigned        answer_count;
+    const word_t    *guesses;       // The answers first, like lexicon_t.
+    unsigned        guess_count;
+    const word_t    *valid;         // The entries of an hset_t holding every guess.
+    size_t          valid_capacity;
+    const pattern_t *patterns;      // guess_count rows of answer_count.
+    const book_t    *book;
+    // Candidates an answer is still confused with (itself included) after the book's first two
+    // guesses, or 0 if one of those is the answer.
+    const uint16_t  *difficulty;
+} bundle_t;
+
+typedef enum {
+    BUNDLE_OK,
+    // Missing, truncated, from another version of jawc, or built from other lists than the ones in
+    // this binary: building it again fixes it.
+    BUNDLE_STALE,
+    // Not a bundle at all, or unreadable: left alone.
+    BUNDLE_FOREIGN,
+} bundle_status_t;
+
+// Fingerprint of the lists compiled in from src/dict.c, which a bundle must have been built from.
+uint32_t bundle_dict_hash(void);
+
+// Computes a bundle for the built-in lists on `threads` workers (0 for one per CPU), and replaces
+// `path` with it. The new file is written next to it and renamed into place, so processes still
+// using the old one keep a consistent copy.
+bool bundle_build(const char *path, unsigned threads);
+
+bundle_status_t bundle_map(bundle_t *bundle, const char *path);
+void bundle_unmap(bundle_t *bundle);
+
+// Points `lex` at the bundle's lists, with no copies: the bundle must outlive it. lexicon_fini()
+// leaves the bundle alone.
+void bundle_lexicon(const bundle_t *bundle, lexicon_t *lex);
+
+#endif /* end of include guard: BUNDLE_H */
@@ -0,0 +1,113 @@
+//===--------------------------------------------------------------------------------------------===
+// cset.c - Candidate answer set implementation
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "cset.h"
+#include "memory.h"
+#include <assert.h>
+#include <string.h>
+
+static unsigned count_bits(const uint64_t *bits, unsigned blocks) {
+    unsigned count = 0;
+    for(unsigned i = 0; i < blocks; ++i) {
+        count += __builtin_popcountll(bits[i]);
+    }
+    return count;
+}
+
+void cset_init(cset_t *set, unsigned capacity, bool full) {
+    assert(set);
+    unsigned blocks = CSET_BLOCKS(capacity);
+    set->capacity = capacity;
+    set->size = full ? capacity : 0;
+    set->bits = safe_calloc(blocks ? blocks : 1, sizeof(uint64_t));
+    if(full) cset_fill(set);
+}
+
+void cset_fill(cset_t *set) {
+    assert(set);
+    unsigned blocks = CSET_BLOCKS(set->capacity);
+    set->size = set->capacity;
+    memset(set->bits, 0xff, blocks * sizeof(uint64_t));
+    if(set->capacity % 64) {
+        set->bits[blocks-1] = (1ull << (set->capacity % 64)) - 1;
+    }
+}
+
+void cset_fini(cset_t *set) {
+    assert(set);
+    safe_free(set->bits);
+    set->bits = NULL;
+    set->capacity = set->size = 0;
+}
+
+void cset_copy(cset_t *dst, const cset_t *src) {
+    assert(dst && src);
+    assert(dst->capacity == src->capacity);
+    memcpy(dst->bits, src->bits, CSET_BLOCKS(src->capacity) * sizeof(uint64_t));
+    dst->size = src->size;
+}
+
+void cset_filter(cset_t *set, const word_t *answers, word_t guess, pattern_t pattern) {
+    assert(set);
+    assert(answers);
+    
+    // Score a whole block of candidates at once, so the guess is only unpacked once per block.
+    word_t words[64];
+    pattern_t patterns[64];
+    unsigned idx[64];
+    
+    for(unsigned b = 0; b < CSET_BLOCKS(set->capacity); ++b) {
+        uint64_t block = set->bits[b];
+        unsigned count = 0;
+        while(block) {
+            unsigned bit = __builtin_ctzll(block);
+            block &= block - 1;
+            idx[count] = bit;
+            words[count++] = answers[b * 64 + bit];
+        }
+        if(!count) continue;
+        
+        score_batch(guess, words, count, patterns);
+        for(unsigned i = 0; i < count; ++i) {
+            if(patterns[i] != pattern) set->bits[b] &= ~(1ull << idx[i]);
+        }
+    }
+    set->size = count_bits(set->bits, CSET_BLOCKS(set->capacity));
+}
+
+void cset_union(cset_t *dst, const cset_t *src) {
+    assert(dst && src);
+    assert(dst->capacity == src->capacity);
+    for(unsigned i = 0; i < CSET_BLOCKS(dst->capacity); ++i) {
+        dst->bits[i] |= src->bits[i];
+    }
+    dst->size = count_bits(dst->bits, CSET_BLOCKS(dst->capacity));
+}
+
+void cset_intersect(cset_t *dst, const cset_t *src) {
+    assert(dst && src);
+    assert(dst->capacity == src->capacity);
+    for(unsigned i = 0; i < CSET_BLOCKS(dst->capacity); ++i) {
+        dst->bits[i] &= src->bits[i];
+    }
+    dst->size = count_bits(dst->bits, CSET_BLOCKS(dst->capacity));
+}
+
+unsigned cset_list(const cset_t *set, unsigned *out) {
+    assert(set);
+    assert(out);
+    unsigned count = 0;
+    for(unsigned b = 0; b < CSET_BLOCKS(set->capacity); ++b) {
+        uint64_t block = set->bits[b];
+        while(block) {
+            out[count++] = b * 64 + __builtin_ctzll(block);
+            block &= block - 1;
+        }
+    }
+    return count;
+}
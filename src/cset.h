@@ -0,0 +1,43 @@
+//===--------------------------------------------------------------------------------------------===
+// cset.h - Candidate answer sets
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef CSET_H
+#define CSET_H
+
+#include "score.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// A bitset over the answer list of a lexicon, with a cached population count.
+typedef struct {
+    unsigned        capacity;
+    unsigned        size;
+    uint64_t        *bits;
+} cset_t;
+
+#define CSET_BLOCKS(capacity) (((capacity) + 63) / 64)
+
+void cset_init(cset_t *set, unsigned capacity, bool full);
+void cset_fini(cset_t *set);
+void cset_copy(cset_t *dst, const cset_t *src);
+// Puts every answer back in the set.
+void cset_fill(cset_t *set);
+
+// Removes every candidate that wouldn't have produced `pattern` for `guess`.
+void cset_filter(cset_t *set, const word_t *answers, word_t guess, pattern_t pattern);
+void cset_union(cset_t *dst, const cset_t *src);
+void cset_intersect(cset_t *dst, const cset_t *src);
+
+// Writes the index of every candidate to `out`, which must hold at least `set->size` entries.
+unsigned cset_list(const cset_t *set, unsigned *out);
+
+static inline bool cset_has(const cset_t *set, unsigned idx) {
+    return idx < set->capacity && (set->bits[idx / 64] >> (idx % 64)) & 1;
+}
+
+#endif /* end of include guard: CSET_H */
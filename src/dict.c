@@ -1,12957 +1,1630 @@
 // jawc dictionary data
 
-const char *answers[] = {
-   " 54;6",
-   " \?).#",
-   " \?8(;",
-   "#3\?6>",
-   "#5/.2",
-   "#5/4=",
-   "#;92.",
-   "#\?;(4",
-   "#\?;).",
-   "(/(;6",
-   "(/).#",
-   "(/*\?\?",
-   "(/6\?(",
-   "(/75(",
-   "(/78;",
-   "(/=8#",
-   "(/>>#",
-   "(/>\?(",
-   "(2#7\?",
-   "(2345",
-   "(3)1#",
-   "(3)\?(",
-   "(3)\?4",
-   "(3*\?(",
-   "(3*\?4",
-   "(3,;6",
-   "(3,\?(",
-   "(3,\?.",
-   "(34)\?",
-   "(3<6\?",
-   "(3=2.",
-   "(3=3>",
-   "(3=5(",
-   "(3>=\?",
-   "(3>\?(",
-   "(5#;6",
-   "(5,\?(",
-   "(5->#",
-   "(5-\?(",
-   "(5.5(",
-   "(5/)\?",
-   "(5/.\?",
-   "(5/4>",
-   "(5/=2",
-   "(5/=\?",
-   "(55).",
-   "(557#",
-   "(5834",
-   "(585.",
-   "(591#",
-   "(5;).",
-   "(5;92",
-   "(5=/\?",
-   "(5=\?(",
-   "(5>\?5",
-   "(; 5(",
-   "(;#54",
-   "(;(\?(",
-   "(;)*#",
-   "(;*3>",
-   "(;,\?4",
-   "(;..#",
-   "(;.35",
-   "(;0;2",
-   "(;3)\?",
-   "(;34#",
-   "(;492",
-   "(;4=\?",
-   "(;4>#",
-   "(;6*2",
-   "(;66#",
-   "(;7\?4",
-   "(;83>",
-   "(;883",
-   "(;9\?(",
-   "(;>33",
-   "(;>35",
-   "(;>;(",
-   "(\?(/4",
-   "(\?)34",
-   "(\?)\?.",
-   "(\?*6#",
-   "(\?*;#",
-   "(\?*\?6",
-   "(\?,/\?",
-   "(\?,\?6",
-   "(\?.(#",
-   "(\?.(5",
-   "(\?.92",
-   "(\?/)\?",
-   "(\?2;8",
-   "(\?3=4",
-   "(\?4;6",
-   "(\?4\?-",
-   "(\?639",
-   "(\?6;\"",
-   "(\?6;#",
-   "(\?73.",
-   "(\?8/)",
-   "(\?8/.",
-   "(\?8;(",
-   "(\?8\?6",
-   "(\?9/(",
-   "(\?9/.",
-   "(\?9;*",
-   "(\?;(7",
-   "(\?;67",
-   "(\?;9.",
-   "(\?;92",
-   "(\?;>#",
-   "(\?<3.",
-   "(\?<\?(",
-   "(\?=;6",
-   "(\?\?>#",
-   ")#(/*",
-   ")#45>",
-   ")*(3=",
-   ")*(;#",
-   ")*(\?\?",
-   ")*/(.",
-   ")*/(4",
-   ")*/41",
-   ")*3(\?",
-   ")*3.\?",
-   ")*31#",
-   ")*31\?",
-   ")*34#",
-   ")*34\?",
-   ")*36.",
-   ")*366",
-   ")*39#",
-   ")*39\?",
-   ")*3\?6",
-   ")*3\?>",
-   ")*5(.",
-   ")*5(\?",
-   ")*5/.",
-   ")*51\?",
-   ")*536",
-   ")*551",
-   ")*554",
-   ")*556",
-   ")*55<",
-   ")*63.",
-   ")*6;.",
-   ")*;(1",
-   ")*;(\?",
-   ")*;)7",
-   ")*;-4",
-   ")*;41",
-   ")*;9\?",
-   ")*;>\?",
-   ")*\?(7",
-   ")*\?4.",
-   ")*\?4>",
-   ")*\?6.",
-   ")*\?66",
-   ")*\?91",
-   ")*\?;(",
-   ")*\?;1",
-   ")*\?\?>",
-   ")+/38",
-   ")+/;.",
-   ")+/;>",
-   ")-/4=",
-   ")-3(6",
-   ")-3)2",
-   ")-34=",
-   ")-34\?",
-   ")-366",
-   ")-3<.",
-   ")-5(4",
-   ")-5(>",
-   ")-5(\?",
-   ")-55*",
-   ")-554",
-   ")-;(7",
-   ")-;)2",
-   ")-;.2",
-   ")-;7*",
-   ")-;73",
-   ")-\?*.",
-   ")-\?66",
-   ")-\?;(",
-   ")-\?;.",
-   ")-\?\?*",
-   ")-\?\?.",
-   ").#6\?",
-   ").(/.",
-   ").(3*",
-   ").(;#",
-   ").(;*",
-   ").(;-",
-   ")./4.",
-   ")./41",
-   ")./4=",
-   ")./7*",
-   ")./91",
-   ")./<<",
-   ")./>#",
-   ").34.",
-   ").341",
-   ").34=",
-   ").36.",
-   ").366",
-   ").391",
-   ").3<<",
-   ").5(#",
-   ").5(1",
-   ").5(7",
-   ").5(\?",
-   ").5,\?",
-   ").5/.",
-   ").51\?",
-   ").539",
-   ").54#",
-   ").54\?",
-   ").55*",
-   ").556",
-   ").55>",
-   ").56\?",
-   ").57*",
-   ").591",
-   ").;(.",
-   ").;(1",
-   ").;(\?",
-   ").;)2",
-   ").;,\?",
-   ").;.\?",
-   ").;1\?",
-   ").;3(",
-   ").;34",
-   ").;3>",
-   ").;41",
-   ").;4>",
-   ").;61",
-   ").;66",
-   ").;6\?",
-   ").;7*",
-   ").;91",
-   ").;<<",
-   ").;=\?",
-   ").\?(4",
-   ").\?34",
-   ").\?;1",
-   ").\?;6",
-   ").\?;7",
-   ").\?;>",
-   ").\?\?(",
-   ").\?\?*",
-   ").\?\?6",
-   ").\?\?>",
-   ")/(6#",
-   ")/(=\?",
-   ")/(\?(",
-   ")/)23",
-   ")/*\?(",
-   ")/3.\?",
-   ")/34=",
-   ")/44#",
-   ")/61#",
-   ")/66#",
-   ")/7;9",
-   ")/;,\?",
-   ")/=;(",
-   ")1/41",
-   ")1/61",
-   ")1/66",
-   ")13(.",
-   ")1366",
-   ")137*",
-   ")13<<",
-   ")13\?(",
-   ")1;.\?",
-   ")2#6#",
-   ")2(/8",
-   ")2(/=",
-   ")2(\?-",
-   ")2/)2",
-   ")2/4.",
-   ")2/91",
-   ")23(.",
-   ")23(1",
-   ")23(\?",
-   ")234#",
-   ")234\?",
-   ")23<.",
-   ")23\?>",
-   ")25(.",
-   ")25(4",
-   ")25(\?",
-   ")25,\?",
-   ")25-#",
-   ")25-4",
-   ")25/.",
-   ")254\?",
-   ")255.",
-   ")2551",
-   ")2591",
-   ")25;6",
-   ")2;(*",
-   ")2;(1",
-   ")2;(>",
-   ")2;(\?",
-   ")2;*\?",
-   ")2;,\?",
-   ")2;-6",
-   ")2;1#",
-   ")2;1\?",
-   ")2;41",
-   ")2;6.",
-   ")2;66",
-   ")2;6\?",
-   ")2;7\?",
-   ")2;91",
-   ")2;<.",
-   ")2;>#",
-   ")2;>\?",
-   ")2\?31",
-   ")2\?66",
-   ")2\?6<",
-   ")2\?;(",
-   ")2\?\?(",
-   ")2\?\?*",
-   ")2\?\?.",
-   ")2\?\?4",
-   ")3\".#",
-   ")3\".2",
-   ")3(\?4",
-   ")3))#",
-   ")349\?",
-   ")34=\?",
-   ")34\?-",
-   ")361#",
-   ")366#",
-   ")3=2.",
-   ")3=7;",
-   ")3\?,\?",
-   ")3\?=\?",
-   ")4/91",
-   ")4/<<",
-   ")43*\?",
-   ")43<<",
-   ")43>\?",
-   ")45(.",
-   ")45(\?",
-   ")45-#",
-   ")45/.",
-   ")455*",
-   ")4;(6",
-   ")4;(\?",
-   ")4;1#",
-   ")4;1\?",
-   ")4;36",
-   ")4;91",
-   ")4\?;1",
-   ")4\?\?(",
-   ")5((#",
-   ")5-\?(",
-   ")5/.2",
-   ")5/4>",
-   ")5439",
-   ")54;(",
-   ")55.#",
-   ")55.2",
-   ")56,\?",
-   ")563>",
-   ")56;(",
-   ")58\?(",
-   ")5;*#",
-   ")5==#",
-   ")6#6#",
-   ")6/(*",
-   ")6/)2",
-   ")6/41",
-   ")6/4=",
-   ")6/7*",
-   ")6341",
-   ")634=",
-   ")637#",
-   ")637\?",
-   ")6391",
-   ")639\?",
-   ")63>\?",
-   ")65)2",
-   ")65*\?",
-   ")65.2",
-   ")655*",
-   ")6;)2",
-   ")6;.\?",
-   ")6;34",
-   ")6;4.",
-   ")6;4=",
-   ")6;91",
-   ")6\?*.",
-   ")6\?\?*",
-   ")6\?\?.",
-   ")6\?\?1",
-   ")73(1",
-   ")73.2",
-   ")73.\?",
-   ")736\?",
-   ")75.\?",
-   ")751#",
-   ")751\?",
-   ")7591",
-   ")7;(.",
-   ")7;)2",
-   ")7;66",
-   ")7;91",
-   ")7\?6.",
-   ")7\?66",
-   ")7\?;(",
-   ")9(/7",
-   ")9(/8",
-   ")9(;*",
-   ")9(;7",
-   ")9(\?-",
-   ")9(\?\?",
-   ")9/8;",
-   ")9354",
-   ")95(4",
-   ")95(\?",
-   ")95*\?",
-   ")95-6",
-   ")95/(",
-   ")95/.",
-   ")954\?",
-   ")955*",
-   ")956>",
-   ")95<<",
-   ")9;(#",
-   ")9;(<",
-   ")9;(\?",
-   ")9;4.",
-   ")9;6#",
-   ")9;6*",
-   ")9;6>",
-   ")9;6\?",
-   ")9;7*",
-   ")9\?4.",
-   ")9\?4\?",
-   ");))#",
-   ");**#",
-   ");,,#",
-   ");,5#",
-   ");,5(",
-   ");.#(",
-   ");.34",
-   ");/.\?",
-   ");/4;",
-   ");/9#",
-   ");/9\?",
-   ");34.",
-   ");4>#",
-   ");4\?(",
-   ");6);",
-   ");6,5",
-   ");6,\?",
-   ");6.#",
-   ");654",
-   ");66#",
-   ");6;>",
-   ");<\?(",
-   ");>6#",
-   ")\?(,\?",
-   ")\?(/7",
-   ")\?(3<",
-   ")\?*3;",
-   ")\?,\?(",
-   ")\?,\?4",
-   ")\?-\?(",
-   ")\?./*",
-   ")\?3 \?",
-   ")\?4)\?",
-   ")\?7\?4",
-   ")\?=/\?",
-   ")\?>;4",
-   ")\?\?>#",
-   "*#=7#",
-   "*(/4\?",
-   "*(/>\?",
-   "*(3 \?",
-   "*(3)7",
-   "*(3,#",
-   "*(34.",
-   "*(35(",
-   "*(375",
-   "*(37\?",
-   "*(391",
-   "*(39\?",
-   "*(3>\?",
-   "*(3\?>",
-   "*(5\"#",
-   "*(5)\?",
-   "*(5,\?",
-   "*(5-6",
-   "*(5/>",
-   "*(54=",
-   "*(54\?",
-   "*(55<",
-   "*(58\?",
-   "*(;-4",
-   "*(;41",
-   "*(\?))",
-   "*(\?\?4",
-   "*);67",
-   "*/()\?",
-   "*/(=\?",
-   "*/(\?(",
-   "*/(\?\?",
-   "*/)2#",
-   "*/**#",
-   "*/*36",
-   "*/..#",
-   "*/492",
-   "*/6)\?",
-   "*/6*#",
-   "*/839",
-   "*/<<#",
-   "*/>=#",
-   "*25.5",
-   "*254#",
-   "*254\?",
-   "*2;)\?",
-   "*3  ;",
-   "*3\"3\?",
-   "*3\"\?6",
-   "*3*\?(",
-   "*3+/\?",
-   "*3,5.",
-   "*3.2#",
-   "*3.92",
-   "*34.5",
-   "*341#",
-   "*3492",
-   "*34\?#",
-   "*365.",
-   "*391#",
-   "*3;45",
-   "*3==#",
-   "*3\?.#",
-   "*3\?9\?",
-   "*5(92",
-   "*5))\?",
-   "*5)3.",
-   "*5)\?(",
-   "*5**#",
-   "*5-\?(",
-   "*5/.#",
-   "*5/4>",
-   "*5/92",
-   "*51\?(",
-   "*53)\?",
-   "*534.",
-   "*5592",
-   "*56#*",
-   "*561;",
-   "*56;(",
-   "*5\?)#",
-   "*6/)2",
-   "*6/41",
-   "*6/7*",
-   "*6/78",
-   "*6/7\?",
-   "*6/91",
-   "*63\?(",
-   "*63\?>",
-   "*6; ;",
-   "*6;.\?",
-   "*6;3.",
-   "*6;34",
-   "*6;3>",
-   "*6;4.",
-   "*6;41",
-   "*6;4\?",
-   "*6;9\?",
-   "*6\?;.",
-   "*6\?;>",
-   "*;#\?(",
-   "*;#\?\?",
-   "*;((#",
-   "*;()\?",
-   "*;(.#",
-   "*;(1;",
-   "*;(\?(",
-   "*;).#",
-   "*;).;",
-   "*;).\?",
-   "*;*;6",
-   "*;*\?(",
-   "*;.)#",
-   "*;..#",
-   "*;.35",
-   "*;.92",
-   "*;/)\?",
-   "*;34.",
-   "*;4)#",
-   "*;439",
-   "*;4\?6",
-   "*;6)#",
-   "*;6\?(",
-   "*;=;4",
-   "*;>>#",
-   "*\?(1#",
-   "*\?(36",
-   "*\?(92",
-   "*\?).5",
-   "*\?)1#",
-   "*\?..#",
-   "*\?.;6",
-   "*\?44#",
-   "*\?44\?",
-   "*\?49\?",
-   "*\?4;6",
-   "*\?9;4",
-   "*\?;(6",
-   "*\?;92",
-   "*\?;9\?",
-   "*\?>;6",
-   "+/3(1",
-   "+/3.\?",
-   "+/36.",
-   "+/366",
-   "+/391",
-   "+/3\?.",
-   "+/5.2",
-   "+/5.;",
-   "+/5.\?",
-   "+/;(.",
-   "+/;(1",
-   "+/;)2",
-   "+/;)3",
-   "+/;1\?",
-   "+/;36",
-   "+/;67",
-   "+/;91",
-   "+/\?(#",
-   "+/\?).",
-   "+/\?/\?",
-   "+/\?66",
-   "+/\?\?(",
-   "+/\?\?4",
-   ",#34=",
-   ",3\"\?4",
-   ",3(/)",
-   ",3(;6",
-   ",3).;",
-   ",3)3.",
-   ",3)5(",
-   ",3*\?(",
-   ",3,3>",
-   ",3.;6",
-   ",34#6",
-   ",356;",
-   ",366;",
-   ",39;(",
-   ",3=36",
-   ",3=5(",
-   ",3>\?5",
-   ",5-\?6",
-   ",5.\?(",
-   ",5/92",
-   ",536;",
-   ",539\?",
-   ",573.",
-   ",59;6",
-   ",5=/\?",
-   ",5>1;",
-   ",;*3>",
-   ",;*5(",
-   ",;/4.",
-   ",;/6.",
-   ",;6,\?",
-   ",;6/\?",
-   ",;63>",
-   ",;65(",
-   ",;6\?.",
-   ",;=/\?",
-   ",\?()5",
-   ",\?()\?",
-   ",\?(,\?",
-   ",\?(=\?",
-   ",\?4/\?",
-   ",\?457",
-   ",\?=;4",
-   "-(#6#",
-   "-(/4=",
-   "-(3).",
-   "-(3.\?",
-   "-(34=",
-   "-(5.\?",
-   "-(54=",
-   "-(;.2",
-   "-(;91",
-   "-(\?).",
-   "-(\?91",
-   "-(\?;1",
-   "-23(6",
-   "-23)1",
-   "-23.\?",
-   "-234#",
-   "-234\?",
-   "-236\?",
-   "-2392",
-   "-23<<",
-   "-25)\?",
-   "-255*",
-   "-256\?",
-   "-2;(<",
-   "-2;6\?",
-   "-2;91",
-   "-2\?(\?",
-   "-2\?6*",
-   "-2\?;.",
-   "-2\?\?6",
-   "-3)*#",
-   "-3)\?(",
-   "-3..#",
-   "-3.92",
-   "-3492",
-   "-349\?",
-   "-34>#",
-   "-366#",
-   "-37*#",
-   "-3=2.",
-   "-3>.2",
-   "-3>5-",
-   "-3>\?(",
-   "-3>\?4",
-   "-3\?6>",
-   "-5((#",
-   "-5().",
-   "-5()\?",
-   "-5(.2",
-   "-5(6>",
-   "-5(>#",
-   "-5,\?4",
-   "-5/4>",
-   "-5/6>",
-   "-51\?4",
-   "-55 #",
-   "-556#",
-   "-55>#",
-   "-55\?(",
-   "-57;4",
-   "-57\?4",
-   "-;\"\?4",
-   "-;(.#",
-   "-;).\?",
-   "-;,\?(",
-   "-;.92",
-   "-;.\?(",
-   "-;3).",
-   "-;3,\?",
-   "-;6. ",
-   "-;91#",
-   "-;<\?(",
-   "-;=54",
-   "-;=\?(",
-   "-\?3(>",
-   "-\?3=2",
-   "-\?6)2",
-   "-\?692",
-   "-\?;(#",
-   "-\?;,\?",
-   "-\?>=\?",
-   "-\?\?>#",
-   ".#34=",
-   ".(#).",
-   ".(/))",
-   ".(/).",
-   ".(/.2",
-   ".(/41",
-   ".(/6#",
-   ".(/7*",
-   ".(/91",
-   ".(/9\?",
-   ".(/\?(",
-   ".(3*\?",
-   ".(3.\?",
-   ".(38\?",
-   ".(391",
-   ".(39\?",
-   ".(3;6",
-   ".(3;>",
-   ".(3\?>",
-   ".(5*\?",
-   ".(5,\?",
-   ".(5/.",
-   ".(55*",
-   ".(566",
-   ".(;)2",
-   ".(;-6",
-   ".(;3.",
-   ".(;34",
-   ".(;36",
-   ".(;7*",
-   ".(;9.",
-   ".(;91",
-   ".(;9\?",
-   ".(;>\?",
-   ".(\?4>",
-   ".(\?;.",
-   ".(\?;>",
-   ".-3\".",
-   ".-3(6",
-   ".-3).",
-   ".-34\?",
-   ".-39\?",
-   ".-;4=",
-   ".-\?;1",
-   ".-\?\?.",
-   ".-\?\?>",
-   "./(85",
-   "./.5(",
-   "./439",
-   "./63*",
-   "./66\?",
-   "./75(",
-   "./8;6",
-   "./8\?(",
-   ".2#7\?",
-   ".2(/7",
-   ".2(5-",
-   ".2(58",
-   ".2(\?-",
-   ".2(\?\?",
-   ".2/7*",
-   ".2/78",
-   ".23(>",
-   ".2341",
-   ".234=",
-   ".2391",
-   ".23=2",
-   ".23\?<",
-   ".25(4",
-   ".25)\?",
-   ".254=",
-   ".2;41",
-   ".2\?(\?",
-   ".2\?)\?",
-   ".2\?.;",
-   ".2\?3(",
-   ".2\?7\?",
-   ".2\?<.",
-   ".3*)#",
-   ".3.2\?",
-   ".3.6\?",
-   ".3.;4",
-   ".36>\?",
-   ".373>",
-   ".37\?(",
-   ".383;",
-   ".3;(;",
-   ".3=2.",
-   ".3=\?(",
-   ".3>;6",
-   ".5\"34",
-   ".5\"39",
-   ".5()5",
-   ".5(/)",
-   ".5(92",
-   ".5*39",
-   ".5*; ",
-   ".5-\?(",
-   ".5-\?6",
-   ".5.;6",
-   ".5.\?7",
-   ".5/92",
-   ".5/=2",
-   ".51\?4",
-   ".5439",
-   ".54;6",
-   ".54=;",
-   ".55.2",
-   ".5;).",
-   ".5>;#",
-   ".5>>#",
-   ".;(5.",
-   ".;(>#",
-   ".;).#",
-   ".;).\?",
-   ".;*3(",
-   ".;*\?(",
-   ".;-4#",
-   ".;..#",
-   ".;/4.",
-   ".;1\?(",
-   ".;1\?4",
-   ".;34.",
-   ".;4=#",
-   ".;4=5",
-   ".;654",
-   ".;66#",
-   ".;7\?(",
-   ".;855",
-   ".;86\?",
-   ".;88#",
-   ".;91#",
-   ".;93.",
-   ".;<<#",
-   ".\?((;",
-   ".\?()\?",
-   ".\?).#",
-   ".\?*3>",
-   ".\?*\?\?",
-   ".\?4)\?",
-   ".\?4.2",
-   ".\?45(",
-   ".\?4\?.",
-   ".\?7*5",
-   ".\?;(#",
-   ".\?;)\?",
-   ".\?;92",
-   ".\?>>#",
-   ".\?\?.2",
-   "/(34\?",
-   "/(8;4",
-   "/)/(*",
-   "/)/;6",
-   "/)2\?(",
-   "/)34=",
-   "/);=\?",
-   "/*)\?.",
-   "/**\?(",
-   "/..\?(",
-   "/.36\?",
-   "/4 3*",
-   "/4)\?.",
-   "/4-\?>",
-   "/4.36",
-   "/4.3\?",
-   "/43.#",
-   "/43.\?",
-   "/4354",
-   "/43<#",
-   "/463.",
-   "/47\?.",
-   "/49/.",
-   "/496\?",
-   "/4<3.",
-   "/4<\?>",
-   "/4>/\?",
-   "/4>3>",
-   "/4>\?(",
-   "/6.(;",
-   "/69\?(",
-   "/78(;",
-   "/>>\?(",
-   "0/(5(",
-   "0/39#",
-   "0/39\?",
-   "0/4.5",
-   "0/4.;",
-   "0/7*#",
-   "0/785",
-   "0/>=\?",
-   "03<<#",
-   "05/).",
-   "051\?(",
-   "053).",
-   "0534.",
-   "0566#",
-   "0;  #",
-   "0;/4.",
-   "0\?(1#",
-   "0\?-\?6",
-   "0\?..#",
-   "0\?66#",
-   "1(366",
-   "12;13",
-   "13..#",
-   "1341#",
-   "135)1",
-   "143<\?",
-   "145-4",
-   "14566",
-   "14591",
-   "14;,\?",
-   "14;91",
-   "14\?6.",
-   "14\?;>",
-   "14\?\?6",
-   "14\?\?>",
-   "15;6;",
-   "1;#;1",
-   "1;(7;",
-   "1;**;",
-   "1\?8;8",
-   "2#*\?(",
-   "2#7\?4",
-   "2#>(5",
-   "2#\?4;",
-   "2/((#",
-   "2/))#",
-   "2/)1#",
-   "2/.92",
-   "2/41#",
-   "2/492",
-   "2/7*2",
-   "2/7/)",
-   "2/73>",
-   "2/75(",
-   "2/7;4",
-   "23**#",
-   "23**5",
-   "23.92",
-   "234=\?",
-   "2366#",
-   "25()\?",
-   "25(4#",
-   "25(>\?",
-   "25,\?(",
-   "25,\?6",
-   "25->#",
-   "25.6#",
-   "25.\?6",
-   "25/)\?",
-   "25/4>",
-   "253).",
-   "2545(",
-   "254\?#",
-   "2566#",
-   "257\?(",
-   "2588#",
-   "25;(>",
-   "2; \?6",
-   "2;((#",
-   "2;()2",
-   "2;(*#",
-   "2;(>#",
-   "2;(\?7",
-   "2;).#",
-   "2;).\?",
-   "2;**#",
-   "2;,59",
-   "2;,\?4",
-   "2;.92",
-   "2;.\?(",
-   "2;/.\?",
-   "2;/4.",
-   "2;3(#",
-   "2;4>#",
-   "2;6,\?",
-   "2;83.",
-   "2\?(54",
-   "2\?3).",
-   "2\?49\?",
-   "2\?63\"",
-   "2\?665",
-   "2\?;(.",
-   "2\?;(>",
-   "2\?;,#",
-   "2\?;,\?",
-   "2\?;.2",
-   "2\?;>#",
-   "2\?<.#",
-   "2\?>=\?",
-   "3(54#",
-   "3(;.\?",
-   "3))/\?",
-   "3)6\?.",
-   "3,5(#",
-   "3.92#",
-   "34*/.",
-   "34.(5",
-   "34.\?(",
-   "344\?(",
-   "346;#",
-   "346\?.",
-   "3485\"",
-   "349/(",
-   "34;4\?",
-   "34<\?(",
-   "34=5.",
-   "34>\?\"",
-   "34\?(.",
-   "34\?*.",
-   "35439",
-   "363;9",
-   "37*6#",
-   "37*\?6",
-   "378/\?",
-   "37;=\?",
-   "3934=",
-   "3936#",
-   "3=655",
-   "3>#66",
-   "3>35.",
-   "3>357",
-   "3>6\?(",
-   "3>\?;6",
-   "4#654",
-   "4#7*2",
-   "4/()\?",
-   "4/..#",
-   "4/>=\?",
-   "434.2",
-   "4340;",
-   "4344#",
-   "4392\?",
-   "439\?(",
-   "43=2.",
-   "43\?9\?",
-   "45(.2",
-   "45)\?#",
-   "45,\?6",
-   "45.92",
-   "453)#",
-   "453)\?",
-   "455)\?",
-   "457;>",
-   "4586#",
-   "4586\?",
-   "4;).#",
-   "4;);6",
-   "4;,;6",
-   "4;,\?6",
-   "4;.;6",
-   "4;3,\?",
-   "4;44#",
-   "4;>3(",
-   "4\?(,\?",
-   "4\?(>#",
-   "4\?,\?(",
-   "4\?-6#",
-   "4\?-\?(",
-   "4\?3=2",
-   "4\?\?>#",
-   "5 54\?",
-   "5\"3>\?",
-   "5(83.",
-   "5(=;4",
-   "5(>\?(",
-   "5*.39",
-   "5*3/7",
-   "5*34\?",
-   "5*\?(;",
-   "5,34\?",
-   "5,53>",
-   "5,;(#",
-   "5,;.\?",
-   "5,\?(.",
-   "5-34=",
-   "5-4\?(",
-   "5..\?(",
-   "5.2\?(",
-   "5/.=5",
-   "5/.>5",
-   "5/.\?(",
-   "5/49\?",
-   "5/=2.",
-   "54)\?.",
-   "54354",
-   "563,\?",
-   "56>\?(",
-   "56>\?4",
-   "578(\?",
-   "57\?=;",
-   "58\?)\?",
-   "59.;6",
-   "59.\?.",
-   "599/(",
-   "59\?;4",
-   "5;1\?4",
-   "5<.\?4",
-   "5<<;6",
-   "5<<\?(",
-   "5>>6#",
-   "5>>\?(",
-   "6#(39",
-   "6#34=",
-   "6#7*2",
-   "6/(3>",
-   "6/(92",
-   "6/).#",
-   "6/*/)",
-   "6/492",
-   "6/4;(",
-   "6/4=\?",
-   "6/7*#",
-   "6/7\?4",
-   "6/91#",
-   "6/93>",
-   "63*3>",
-   "63,3>",
-   "63,\?(",
-   "63.2\?",
-   "631\?4",
-   "634=5",
-   "634\?(",
-   "634\?4",
-   "636;9",
-   "6373.",
-   "63785",
-   "638\?6",
-   "63=2.",
-   "63\?=\?",
-   "65#;6",
-   "65((#",
-   "65)\?(",
-   "65,\?(",
-   "65-6#",
-   "65-\?(",
-   "65/)#",
-   "65/)\?",
-   "655)\?",
-   "655*#",
-   "6588#",
-   "659/)",
-   "659;6",
-   "65;.2",
-   "65;7#",
-   "65<.#",
-   "65=34",
-   "65=39",
-   "65>=\?",
-   "66;7;",
-   "6;#\?(",
-   "6;(,;",
-   "6;(=\?",
-   "6;))5",
-   "6;*)\?",
-   "6;*\?6",
-   "6;..\?",
-   "6;.2\?",
-   "6;.92",
-   "6;.\?(",
-   "6;/=2",
-   "6;41#",
-   "6;49\?",
-   "6;85(",
-   "6;8\?6",
-   "6;=\?(",
-   "6;>6\?",
-   "6;>\?4",
-   "6\?*\?(",
-   "6\?,\?(",
-   "6\?,\?6",
-   "6\?7/(",
-   "6\?754",
-   "6\?;(4",
-   "6\?;).",
-   "6\?;)2",
-   "6\?;)\?",
-   "6\?;*.",
-   "6\?;,\?",
-   "6\?;1#",
-   "6\?;4.",
-   "6\?;92",
-   "6\?;<#",
-   "6\?<.#",
-   "6\?=;6",
-   "6\?==#",
-   "6\?>=\?",
-   "6\?\?(#",
-   "6\?\?92",
-   "7#((2",
-   "7/(1#",
-   "7/(;6",
-   "7/).#",
-   "7/)1#",
-   "7/)2#",
-   "7/)39",
-   "7/492",
-   "7/692",
-   "7/77#",
-   "7/9/)",
-   "7/91#",
-   "7/>>#",
-   "73(.2",
-   "73))#",
-   "73)\?(",
-   "734.#",
-   "734/)",
-   "73437",
-   "7345(",
-   "7349\?",
-   "734\?(",
-   "7361#",
-   "73739",
-   "739(5",
-   "73=2.",
-   "73>).",
-   "73>=\?",
-   "75(*2",
-   "75(54",
-   "75(;6",
-   "75))#",
-   "75,3\?",
-   "75,\?(",
-   "75-\?(",
-   "75..5",
-   "75.3<",
-   "75.5(",
-   "75.\?6",
-   "75/(4",
-   "75/)\?",
-   "75/.2",
-   "75/4.",
-   "75/4>",
-   "75/6.",
-   "753).",
-   "754.2",
-   "754\?#",
-   "755)\?",
-   "755>#",
-   "756;(",
-   "756>#",
-   "7592;",
-   "75=/6",
-   "75>;6",
-   "75>\?6",
-   "75>\?7",
-   "7;\"37",
-   "7;#5(",
-   "7;#8\?",
-   "7;((#",
-   "7;()2",
-   "7;(92",
-   "7;))\?",
-   "7;)54",
-   "7;*6\?",
-   "7;.92",
-   "7;.\?#",
-   "7;/,\?",
-   "7;05(",
-   "7;1\?(",
-   "7;3 \?",
-   "7;439",
-   "7;43;",
-   "7;45(",
-   "7;46#",
-   "7;4=#",
-   "7;4=5",
-   "7;4=;",
-   "7;4=\?",
-   "7;77#",
-   "7;77;",
-   "7;785",
-   "7;9(5",
-   "7;925",
-   "7;9;-",
-   "7;<3;",
-   "7;=39",
-   "7;=7;",
-   "7;>6#",
-   "7;>;7",
-   "7\?((#",
-   "7\?(3.",
-   "7\?(9#",
-   "7\?(=\?",
-   "7\?.(5",
-   "7\?.;6",
-   "7\?.\?(",
-   "7\?654",
-   "7\?6\?\?",
-   "7\?99;",
-   "7\?;.#",
-   "7\?;4.",
-   "7\?;6#",
-   "7\?>39",
-   "7\?>3;",
-   "7\?>;6",
-   "8#6;-",
-   "8(/)2",
-   "8(/.\?",
-   "8(/4.",
-   "8(3)1",
-   "8(34#",
-   "8(341",
-   "8(34=",
-   "8(34\?",
-   "8(38\?",
-   "8(391",
-   "8(3;(",
-   "8(3>\?",
-   "8(3\?<",
-   "8(5-4",
-   "8(5.2",
-   "8(51\?",
-   "8(536",
-   "8(551",
-   "8(557",
-   "8(55>",
-   "8(5;>",
-   "8(;))",
-   "8(;)2",
-   "8(;,5",
-   "8(;,\?",
-   "8(;-4",
-   "8(;-6",
-   "8(;1\?",
-   "8(;34",
-   "8(;3>",
-   "8(;4>",
-   "8(;9\?",
-   "8(\?;1",
-   "8(\?;>",
-   "8(\?\?>",
-   "8/\"57",
-   "8/#\?(",
-   "8/().",
-   "8/(4.",
-   "8/(6#",
-   "8/)2#",
-   "8/)\?>",
-   "8/..\?",
-   "8/.92",
-   "8/36.",
-   "8/36>",
-   "8/44#",
-   "8/492",
-   "8/61#",
-   "8/66#",
-   "8/6=\?",
-   "8/=6\?",
-   "8/==#",
-   "8/>=\?",
-   "8/>>#",
-   "83(.2",
-   "83(92",
-   "83)54",
-   "83..#",
-   "834=5",
-   "834=\?",
-   "8357\?",
-   "8366#",
-   "836=\?",
-   "8386\?",
-   "839\?*",
-   "83=5.",
-   "83>>#",
-   "85\"\?(",
-   "85(4\?",
-   "85(;\"",
-   "85))#",
-   "85)57",
-   "85-\?6",
-   "85.92",
-   "85/4>",
-   "85/6\?",
-   "85/=2",
-   "854/)",
-   "854=5",
-   "854\?#",
-   "855 #",
-   "855 \?",
-   "855).",
-   "855.#",
-   "855.2",
-   "8558#",
-   "8588#",
-   "85;(>",
-   "85;).",
-   "86/(.",
-   "86/(8",
-   "86/)2",
-   "86/4.",
-   "86/<<",
-   "86/\?(",
-   "863))",
-   "863. ",
-   "86341",
-   "8634>",
-   "8637*",
-   "865-4",
-   "8651\?",
-   "8654>",
-   "86557",
-   "8655>",
-   "86591",
-   "865;.",
-   "86; \?",
-   "86;(\?",
-   "86;).",
-   "86;41",
-   "86;4>",
-   "86;7\?",
-   "86;91",
-   "86;>\?",
-   "86\?))",
-   "86\?4>",
-   "86\?;.",
-   "86\?;1",
-   "86\?\?*",
-   "86\?\?>",
-   "8;#5/",
-   "8;(54",
-   "8;(=\?",
-   "8;).\?",
-   "8;)3)",
-   "8;)34",
-   "8;)36",
-   "8;)39",
-   "8;);6",
-   "8;->#",
-   "8;..#",
-   "8;.2\?",
-   "8;.54",
-   "8;.92",
-   "8;1\?(",
-   "8;405",
-   "8;4;6",
-   "8;67#",
-   "8;6\?(",
-   "8;954",
-   "8;==#",
-   "8;=\?6",
-   "8;>6#",
-   "8;>=\?",
-   "8\? \?6",
-   "8\?((#",
-   "8\?(.2",
-   "8\?(\?.",
-   "8\?)\?.",
-   "8\?,\?6",
-   "8\?.\?6",
-   "8\?34=",
-   "8\?492",
-   "8\?63\?",
-   "8\?65-",
-   "8\?66#",
-   "8\?66\?",
-   "8\?692",
-   "8\?;(>",
-   "8\?;).",
-   "8\?;92",
-   "8\?;>#",
-   "8\?<3.",
-   "8\?=/4",
-   "8\?=34",
-   "8\?=;.",
-   "8\?=;4",
-   "8\?=\?.",
-   "8\?\?92",
-   "8\?\?<#",
-   "9#439",
-   "9#8\?(",
-   "9#96\?",
-   "9(#*.",
-   "9(/).",
-   "9(/)2",
-   "9(/7*",
-   "9(/78",
-   "9(/>\?",
-   "9(/\?6",
-   "9(3)*",
-   "9(37*",
-   "9(37\?",
-   "9(391",
-   "9(3\?(",
-   "9(3\?>",
-   "9(5))",
-   "9(5-4",
-   "9(5->",
-   "9(5/*",
-   "9(54#",
-   "9(54\?",
-   "9(551",
-   "9(591",
-   "9(5;1",
-   "9(; #",
-   "9(; \?",
-   "9(;))",
-   "9(;)2",
-   "9(;,\?",
-   "9(;-6",
-   "9(;.\?",
-   "9(;41",
-   "9(;4\?",
-   "9(;7*",
-   "9(;91",
-   "9(;<.",
-   "9(\?))",
-   "9(\?).",
-   "9(\?*.",
-   "9(\?*\?",
-   "9(\?7\?",
-   "9(\?;1",
-   "9(\?;7",
-   "9(\?>5",
-   "9(\?\?*",
-   "9(\?\?1",
-   "9(\?\?>",
-   "9/((#",
-   "9/()\?",
-   "9/(,#",
-   "9/(,\?",
-   "9/(35",
-   "9/(6#",
-   "9/.3\?",
-   "9/734",
-   "9/839",
-   "92/(4",
-   "92/.\?",
-   "92/41",
-   "92/7*",
-   "92/91",
-   "923(*",
-   "9234;",
-   "92363",
-   "92366",
-   "9236>",
-   "9237\?",
-   "92391",
-   "923>\?",
-   "923\?<",
-   "925(>",
-   "925(\?",
-   "925)\?",
-   "9251\?",
-   "9253(",
-   "92591",
-   "92;(.",
-   "92;(7",
-   "92;(>",
-   "92;)7",
-   "92;)\?",
-   "92;3(",
-   "92;34",
-   "92;4.",
-   "92;5)",
-   "92;61",
-   "92;7*",
-   "92;<<",
-   "92;<\?",
-   "92\?))",
-   "92\?).",
-   "92\?91",
-   "92\?;*",
-   "92\?;.",
-   "92\?\?(",
-   "92\?\?1",
-   "93(9;",
-   "93,36",
-   "93,39",
-   "93492",
-   "93=;(",
-   "93>\?(",
-   "95#6#",
-   "95(4#",
-   "95(;6",
-   "95(\?(",
-   "95*)\?",
-   "95,\?#",
-   "95,\?(",
-   "95,\?.",
-   "95,\?4",
-   "95-\?(",
-   "95/(.",
-   "95/*\?",
-   "95/4.",
-   "95/6>",
-   "95/92",
-   "95/=2",
-   "95439",
-   "95492",
-   "954>5",
-   "9565(",
-   "95654",
-   "95739",
-   "9577;",
-   "957<#",
-   "957\?.",
-   "958(;",
-   "9595;",
-   "95;).",
-   "95;92",
-   "96/4=",
-   "96/7*",
-   "96/91",
-   "96/\?>",
-   "96341",
-   "9634=",
-   "96378",
-   "96391",
-   "963<<",
-   "965)\?",
-   "965,\?",
-   "965-4",
-   "965.2",
-   "965/.",
-   "965/>",
-   "9654\?",
-   "96591",
-   "965;1",
-   "96;))",
-   "96;)*",
-   "96;)2",
-   "96;37",
-   "96;41",
-   "96;4=",
-   "96;7*",
-   "96;91",
-   "96\?(1",
-   "96\?;(",
-   "96\?;.",
-   "96\?;4",
-   "96\?<.",
-   "9;((#",
-   "9;(,\?",
-   "9;(56",
-   "9;(;.",
-   "9;(=5",
-   "9;).\?",
-   "9;*/.",
-   "9;*\?(",
-   "9;,36",
-   "9;..#",
-   "9;.92",
-   "9;.\?(",
-   "9;/)\?",
-   "9;/61",
-   "9;3(4",
-   "9;44#",
-   "9;454",
-   "9;45\?",
-   "9;4;6",
-   "9;4>#",
-   "9;7\?5",
-   "9;7\?6",
-   "9;834",
-   "9;86\?",
-   "9;88#",
-   "9;8;6",
-   "9;9.3",
-   "9;92\?",
-   "9;9;5",
-   "9;=\?#",
-   "9;>>#",
-   "9;>\?.",
-   "9\?665",
-   "9\?;)\?",
-   "9\?>;(",
-   "; /(\?",
-   ";\"354",
-   ";\"357",
-   ";\"3;6",
-   ";((5-",
-   ";((;#",
-   ";()54",
-   ";(.)#",
-   ";(3)\?",
-   ";(5)\?",
-   ";(57;",
-   ";(75(",
-   ";(85(",
-   ";(=/\?",
-   ";(>5(",
-   ";(\?4;",
-   ";));#",
-   ";))\?.",
-   ";)1\?-",
-   ";)2\?4",
-   ";)3>\?",
-   ";)95.",
-   ";*(54",
-   ";**6#",
-   ";**6\?",
-   ";*.6#",
-   ";*23>",
-   ";*34=",
-   ";*4\?;",
-   ";*;(.",
-   ";,3;4",
-   ";,53>",
-   ";,;36",
-   ";,\?(.",
-   ";-51\?",
-   ";-;(>",
-   ";-;(\?",
-   ";-;)2",
-   ";-;1\?",
-   ";-;3.",
-   ";-</6",
-   ";..39",
-   ";.54\?",
-   ";.566",
-   ";/4.#",
-   ";/=/(",
-   ";/>3.",
-   ";/>35",
-   ";2\?;>",
-   ";3)6\?",
-   ";3>\?(",
-   ";4,36",
-   ";4.39",
-   ";416\?",
-   ";437\?",
-   ";44/6",
-   ";445#",
-   ";44\?\"",
-   ";45>\?",
-   ";4=(#",
-   ";4=).",
-   ";4=6\?",
-   ";4=\?(",
-   ";4=\?6",
-   ";5(.;",
-   ";6*2;",
-   ";6.;(",
-   ";6.\?(",
-   ";63,\?",
-   ";631\?",
-   ";6383",
-   ";63=4",
-   ";63\?4",
-   ";65/>",
-   ";654=",
-   ";654\?",
-   ";655<",
-   ";65<.",
-   ";665#",
-   ";665-",
-   ";665.",
-   ";66;#",
-   ";66\?#",
-   ";68/7",
-   ";6;(7",
-   ";6=;\?",
-   ";6\?(.",
-   ";7*6#",
-   ";7*6\?",
-   ";7/)\?",
-   ";73))",
-   ";73.#",
-   ";754=",
-   ";786\?",
-   ";78\?(",
-   ";7; \?",
-   ";7;))",
-   ";7\?4>",
-   ";8#))",
-   ";8/)\?",
-   ";825(",
-   ";83>\?",
-   ";85(.",
-   ";85,\?",
-   ";85/.",
-   ";85>\?",
-   ";86\?>",
-   ";885.",
-   ";88\?#",
-   ";8;)\?",
-   ";8;.\?",
-   ";8;91",
-   ";9(3>",
-   ";9.5(",
-   ";9/.\?",
-   ";95(4",
-   ";<.\?(",
-   ";<3(\?",
-   ";<5/6",
-   ";<55.",
-   ";<<3\"",
-   ";=(\?\?",
-   ";=34=",
-   ";=36\?",
-   ";=54#",
-   ";=65-",
-   ";=;*\?",
-   ";=;.\?",
-   ";=;34",
-   ";=\?4.",
-   ";>/6.",
-   ";>5(4",
-   ";>5(\?",
-   ";>5*.",
-   ";>58\?",
-   ";>73.",
-   ";>734",
-   ";>;*.",
-   ";>;=\?",
-   ";>\?*.",
-   "<(/3.",
-   "<(3)1",
-   "<(3. ",
-   "<(366",
-   "<(3;(",
-   "<(3\?>",
-   "<(5 \?",
-   "<(5).",
-   "<(5-4",
-   "<(5.2",
-   "<(54.",
-   "<(54>",
-   "<(591",
-   "<(;/>",
-   "<(;36",
-   "<(;41",
-   "<(;7\?",
-   "<(\?)2",
-   "<(\?;1",
-   "<(\?\?(",
-   "<(\?\?>",
-   "</  #",
-   "</((#",
-   "</(5(",
-   "</))#",
-   "</41#",
-   "</44#",
-   "</4=3",
-   "</66#",
-   "</=/\?",
-   "</>=\?",
-   "<05(>",
-   "<3  #",
-   "<3\"\?(",
-   "<3().",
-   "<3)2#",
-   "<3492",
-   "<34;6",
-   "<34\?(",
-   "<36.2",
-   "<366#",
-   "<367#",
-   "<36\?(",
-   "<36\?.",
-   "<38\?(",
-   "<39/)",
-   "<3<.#",
-   "<3<.2",
-   "<3=2.",
-   "<3\?(#",
-   "<3\?4>",
-   "<3\?6>",
-   "<5#\?(",
-   "<5(.#",
-   "<5(.2",
-   "<5(.\?",
-   "<5(/7",
-   "<5(9\?",
-   "<5(;#",
-   "<5(=5",
-   "<5(=\?",
-   "<5/4>",
-   "<53).",
-   "<5635",
-   "<566#",
-   "<59/)",
-   "<59;6",
-   "<5;7#",
-   "<5==#",
-   "<6#\?(",
-   "<6/)2",
-   "<6/.\?",
-   "<6/1\?",
-   "<6/3>",
-   "<6/41",
-   "<6/4=",
-   "<6/7\?",
-   "<6/<<",
-   "<63(.",
-   "<634.",
-   "<634=",
-   "<6391",
-   "<63\?(",
-   "<65(;",
-   "<65))",
-   "<65-4",
-   "<65/(",
-   "<65/.",
-   "<655(",
-   "<655>",
-   "<6591",
-   "<65;.",
-   "<6;(\?",
-   "<6;)1",
-   "<6;)2",
-   "<6;1#",
-   "<6;1\?",
-   "<6;3(",
-   "<6;36",
-   "<6;41",
-   "<6;7\?",
-   "<6;91",
-   "<6\?)2",
-   "<6\?91",
-   "<6\?\?.",
-   "<;(9\?",
-   "<;,5(",
-   "<;..#",
-   "<;.;6",
-   "<;/4;",
-   "<;/6.",
-   "<;3(#",
-   "<;3.2",
-   "<;34.",
-   "<;44#",
-   "<;49#",
-   "<;6)\?",
-   "<;86\?",
-   "<;9\?.",
-   "<\?((#",
-   "<\?(;6",
-   "<\?,\?(",
-   "<\?-\?(",
-   "<\?./)",
-   "<\?.3>",
-   "<\?.92",
-   "<\?.;6",
-   "<\?3=4",
-   "<\?49\?",
-   "<\?654",
-   "<\?66;",
-   "<\?7/(",
-   "<\?77\?",
-   "<\?9;6",
-   "<\?;).",
-   "=#*)#",
-   "=(/4.",
-   "=(/<<",
-   "=(/\?6",
-   "=(3*\?",
-   "=(34>",
-   "=(366",
-   "=(37#",
-   "=(37\?",
-   "=(3\?<",
-   "=(5))",
-   "=(5*\?",
-   "=(5,\?",
-   "=(5-4",
-   "=(5-6",
-   "=(5/*",
-   "=(5/.",
-   "=(534",
-   "=(557",
-   "=(5;4",
-   "=(; \?",
-   "=(;))",
-   "=(;)*",
-   "=(;*2",
-   "=(;*\?",
-   "=(;,#",
-   "=(;,\?",
-   "=(;.\?",
-   "=(;34",
-   "=(;36",
-   "=(;4.",
-   "=(;4>",
-   "=(;9\?",
-   "=(;<.",
-   "=(;>\?",
-   "=(\?;.",
-   "=(\?\?.",
-   "=(\?\?4",
-   "=(\?\?>",
-   "=/).#",
-   "=/).5",
-   "=/**#",
-   "=/3)\?",
-   "=/36.",
-   "=/36>",
-   "=/36\?",
-   "=/3>\?",
-   "=/66#",
-   "=/692",
-   "=/77#",
-   "=/785",
-   "=/;(>",
-   "=/;,;",
-   "=/\?))",
-   "=/\?).",
-   "=25).",
-   "=25/6",
-   "=3(.2",
-   "=3(6#",
-   "=3*)#",
-   "=3,\?(",
-   "=3,\?4",
-   "=3;4.",
-   "=3>>#",
-   "=457\?",
-   "=4;)2",
-   "=5(=\?",
-   "=5/(>",
-   "=5/=\?",
-   "=534=",
-   "=54;>",
-   "=54\?(",
-   "=55)\?",
-   "=55<#",
-   "=55>#",
-   "=55\?#",
-   "=566#",
-   "=56\?7",
-   "=5>6#",
-   "=6#*2",
-   "=634.",
-   "=63>\?",
-   "=65(#",
-   "=65))",
-   "=65,\?",
-   "=6557",
-   "=658\?",
-   "=65;.",
-   "=6; \?",
-   "=6;(\?",
-   "=6;))",
-   "=6;4>",
-   "=6;>\?",
-   "=6\?;4",
-   "=6\?;7",
-   "=; \?(",
-   "=;#6#",
-   "=;#\?(",
-   "=;))#",
-   "=;,\?6",
-   "=;-1#",
-   "=;/ \?",
-   "=;/4.",
-   "=;/=\?",
-   "=;/>#",
-   "=;36#",
-   "=;7/.",
-   "=;77;",
-   "=;7\?(",
-   "=;<<\?",
-   "=\?4(\?",
-   "=\?43\?",
-   "=\?915",
-   "=\?\?)\?",
-   "=\?\?1#",
-   ">#34=",
-   ">(#6#",
-   ">(#\?(",
-   ">(/3>",
-   ">(/41",
-   ">(3,\?",
-   ">(341",
-   ">(366",
-   ">(3<.",
-   ">(3\?(",
-   ">(3\?>",
-   ">(5))",
-   ">(5,\?",
-   ">(5-4",
-   ">(53.",
-   ">(54\?",
-   ">(55*",
-   ">(556",
-   ">(566",
-   ">(;*\?",
-   ">(;-4",
-   ">(;-6",
-   ">(;1\?",
-   ">(;34",
-   ">(;41",
-   ">(;7;",
-   ">(;<.",
-   ">(\?))",
-   ">(\?;7",
-   ">(\?;>",
-   ">-;(<",
-   ">-\?6.",
-   ">-\?66",
-   ">/).#",
-   ">/)1#",
-   ">/,\?.",
-   ">/.92",
-   ">/49\?",
-   ">/66#",
-   ">/7*#",
-   ">/77#",
-   ">/92#",
-   ">3  #",
-   ">3(.#",
-   ">3(=\?",
-   ">3)95",
-   ">3,\?(",
-   ">3..#",
-   ">3..5",
-   ">3.92",
-   ">34=#",
-   ">34=5",
-   ">34\?(",
-   ">35>\?",
-   ">366#",
-   ">376#",
-   ">39\?#",
-   ">3;(#",
-   ">3=3.",
-   ">5 \?4",
-   ">5*\?#",
-   ">5-(#",
-   ">5-4#",
-   ">5->#",
-   ">5-\?6",
-   ">5/8.",
-   ">5/=2",
-   ">534=",
-   ">54/.",
-   ">545(",
-   ">566#",
-   ">5=7;",
-   ">5>=#",
-   ">5>=\?",
-   ">;./7",
-   ">;/4.",
-   ">;3(#",
-   ">;3)#",
-   ">;36#",
-   ">;49\?",
-   ">;4>#",
-   ">;66#",
-   ">;>>#",
-   ">\?(8#",
-   ">\?*.2",
-   ">\?*5.",
-   ">\?,36",
-   ">\?.5\"",
-   ">\?.\?(",
-   ">\?/9\?",
-   ">\?3.#",
-   ">\?3=4",
-   ">\?4)\?",
-   ">\?437",
-   ">\?6,\?",
-   ">\?6.;",
-   ">\?6;#",
-   ">\?7/(",
-   ">\?754",
-   ">\?8/.",
-   ">\?8/=",
-   ">\?83.",
-   ">\?8;(",
-   ">\?9(#",
-   ">\?95#",
-   ">\?95(",
-   ">\?9;#",
-   ">\?9;6",
-   ">\?;.2",
-   ">\?;6.",
-   ">\?<\?(",
-   "\?\"*\?6",
-   "\?\".(;",
-   "\?\".56",
-   "\?\"/6.",
-   "\?\"3).",
-   "\?\"36\?",
-   "\?\"9\?6",
-   "\?\";6.",
-   "\?\";9.",
-   "\?\"\?(.",
-   "\?#34=",
-   "\?((5(",
-   "\?(/*.",
-   "\?(5>\?",
-   "\?(;)\?",
-   "\?(\?9.",
-   "\?));#",
-   "\?).\?(",
-   "\?*5\"#",
-   "\?*592",
-   "\?+/3*",
-   "\?+/;6",
-   "\?,39.",
-   "\?,51\?",
-   "\?,;>\?",
-   "\?,\?(#",
-   "\?,\?4.",
-   "\?./>\?",
-   "\?.239",
-   "\?.25)",
-   "\?.2\?(",
-   "\?0\?9.",
-   "\?134=",
-   "\?3=2.",
-   "\?4)/\?",
-   "\?4,5#",
-   "\?4.(#",
-   "\?4.\?(",
-   "\?405#",
-   "\?44/3",
-   "\?4;9.",
-   "\?4>5-",
-   "\?4\?7#",
-   "\?4\?7;",
-   "\?6/>\?",
-   "\?63.\?",
-   "\?63>\?",
-   "\?65*\?",
-   "\?685-",
-   "\?6;.\?",
-   "\?6<34",
-   "\?6>\?(",
-   "\?6\?9.",
-   "\?6\?=#",
-   "\?7*.#",
-   "\?78\?(",
-   "\?78\?>",
-   "\?79\?\?",
-   "\?7;36",
-   "\?854#",
-   "\?96;.",
-   "\?;(.2",
-   "\?;(6#",
-   "\?;)\?6",
-   "\?;.\?(",
-   "\?;.\?4",
-   "\?;=6\?",
-   "\?;=\?(",
-   "\?=(\?.",
-   "\?>39.",
-   "\?>3<#",
-   "\?\?(3\?",
-};
-const unsigned answers_size = 2309;
+#include "dict.h"
 
-const char *words[] = {
-   "aahed",
-   "aalii",
-   "aargh",
-   "aarti",
-   "abaca",
-   "abaci",
-   "abacs",
-   "abaft",
-   "abaka",
-   "abamp",
-   "aband",
-   "abash",
-   "abask",
-   "abaya",
-   "abbas",
-   "abbed",
-   "abbes",
-   "abcee",
-   "abeam",
-   "abear",
-   "abele",
-   "abers",
-   "abets",
-   "abies",
-   "abler",
-   "ables",
-   "ablet",
-   "ablow",
-   "abmho",
-   "abohm",
-   "aboil",
-   "aboma",
-   "aboon",
-   "abord",
-   "abore",
-   "abram",
-   "abray",
-   "abrim",
-   "abrin",
-   "abris",
-   "absey",
-   "absit",
-   "abuna",
-   "abune",
-   "abuts",
-   "abuzz",
-   "abyes",
-   "abysm",
-   "acais",
-   "acari",
-   "accas",
-   "accoy",
-   "acerb",
-   "acers",
-   "aceta",
-   "achar",
-   "ached",
-   "aches",
-   "achoo",
-   "acids",
-   "acidy",
-   "acing",
-   "acini",
-   "ackee",
-   "acker",
-   "acmes",
-   "acmic",
-   "acned",
-   "acnes",
-   "acock",
-   "acold",
-   "acred",
-   "acres",
-   "acros",
-   "acted",
-   "actin",
-   "acton",
-   "acyls",
-   "adaws",
-   "adays",
-   "adbot",
-   "addax",
-   "added",
-   "adder",
-   "addio",
-   "addle",
-   "adeem",
-   "adhan",
-   "adieu",
-   "adios",
-   "adits",
-   "adman",
-   "admen",
-   "admix",
-   "adobo",
-   "adown",
-   "adoze",
-   "adrad",
-   "adred",
-   "adsum",
-   "aduki",
-   "adunc",
-   "adust",
-   "advew",
-   "adyta",
-   "adzed",
-   "adzes",
-   "aecia",
-   "aedes",
-   "aegis",
-   "aeons",
-   "aerie",
-   "aeros",
-   "aesir",
-   "afald",
-   "afara",
-   "afars",
-   "afear",
-   "aflaj",
-   "afore",
-   "afrit",
-   "afros",
-   "agama",
-   "agami",
-   "agars",
-   "agast",
-   "agave",
-   "agaze",
-   "agene",
-   "agers",
-   "agger",
-   "aggie",
-   "aggri",
-   "aggro",
-   "aggry",
-   "aghas",
-   "agila",
-   "agios",
-   "agism",
-   "agist",
-   "agita",
-   "aglee",
-   "aglet",
-   "agley",
-   "agloo",
-   "aglus",
-   "agmas",
-   "agoge",
-   "agone",
-   "agons",
-   "agood",
-   "agria",
-   "agrin",
-   "agros",
-   "agued",
-   "agues",
-   "aguna",
-   "aguti",
-   "aheap",
-   "ahent",
-   "ahigh",
-   "ahind",
-   "ahing",
-   "ahint",
-   "ahold",
-   "ahull",
-   "ahuru",
-   "aidas",
-   "aided",
-   "aides",
-   "aidoi",
-   "aidos",
-   "aiery",
-   "aigas",
-   "aight",
-   "ailed",
-   "aimed",
-   "aimer",
-   "ainee",
-   "ainga",
-   "aioli",
-   "aired",
-   "airer",
-   "airns",
-   "airth",
-   "airts",
-   "aitch",
-   "aitus",
-   "aiver",
-   "aiyee",
-   "aizle",
-   "ajies",
-   "ajiva",
-   "ajuga",
-   "ajwan",
-   "akees",
-   "akela",
-   "akene",
-   "aking",
-   "akita",
-   "akkas",
-   "alaap",
-   "alack",
-   "alamo",
-   "aland",
-   "alane",
-   "alang",
-   "alans",
-   "alant",
-   "alapa",
-   "alaps",
-   "alary",
-   "alate",
-   "alays",
-   "albas",
-   "albee",
-   "alcid",
-   "alcos",
-   "aldea",
-   "alder",
-   "aldol",
-   "aleck",
-   "alecs",
-   "alefs",
-   "aleft",
-   "aleph",
-   "alews",
-   "aleye",
-   "alfas",
-   "algal",
-   "algas",
-   "algid",
-   "algin",
-   "algor",
-   "algum",
-   "alias",
-   "alifs",
-   "aline",
-   "alist",
-   "aliya",
-   "alkie",
-   "alkos",
-   "alkyd",
-   "alkyl",
-   "allee",
-   "allel",
-   "allis",
-   "allod",
-   "allyl",
-   "almah",
-   "almas",
-   "almeh",
-   "almes",
-   "almud",
-   "almug",
-   "alods",
-   "aloed",
-   "aloes",
-   "aloha",
-   "aloin",
-   "aloos",
-   "alowe",
-   "altho",
-   "altos",
-   "alula",
-   "alums",
-   "alure",
-   "alvar",
-   "alway",
-   "amahs",
-   "amain",
-   "amate",
-   "amaut",
-   "amban",
-   "ambit",
-   "ambos",
-   "ambry",
-   "ameba",
-   "ameer",
-   "amene",
-   "amens",
-   "ament",
-   "amias",
-   "amice",
-   "amici",
-   "amide",
-   "amido",
-   "amids",
-   "amies",
-   "amiga",
-   "amigo",
-   "amine",
-   "amino",
-   "amins",
-   "amirs",
-   "amlas",
-   "amman",
-   "ammon",
-   "ammos",
-   "amnia",
-   "amnic",
-   "amnio",
-   "amoks",
-   "amole",
-   "amort",
-   "amour",
-   "amove",
-   "amowt",
-   "amped",
-   "ampul",
-   "amrit",
-   "amuck",
-   "amyls",
-   "anana",
-   "anata",
-   "ancho",
-   "ancle",
-   "ancon",
-   "andro",
-   "anear",
-   "anele",
-   "anent",
-   "angas",
-   "anglo",
-   "anigh",
-   "anile",
-   "anils",
-   "anima",
-   "animi",
-   "anion",
-   "anise",
-   "anker",
-   "ankhs",
-   "ankus",
-   "anlas",
-   "annal",
-   "annas",
-   "annat",
-   "anoas",
-   "anole",
-   "anomy",
-   "ansae",
-   "antae",
-   "antar",
-   "antas",
-   "anted",
-   "antes",
-   "antis",
-   "antra",
-   "antre",
-   "antsy",
-   "anura",
-   "anyon",
-   "apace",
-   "apage",
-   "apaid",
-   "apayd",
-   "apays",
-   "apeak",
-   "apeek",
-   "apers",
-   "apert",
-   "apery",
-   "apgar",
-   "aphis",
-   "apian",
-   "apiol",
-   "apish",
-   "apism",
-   "apode",
-   "apods",
-   "apoop",
-   "aport",
-   "appal",
-   "appay",
-   "appel",
-   "appro",
-   "appui",
-   "appuy",
-   "apres",
-   "apses",
-   "apsis",
-   "apsos",
-   "apted",
-   "apter",
-   "aquae",
-   "aquas",
-   "araba",
-   "araks",
-   "arame",
-   "arars",
-   "arbas",
-   "arced",
-   "archi",
-   "arcos",
-   "arcus",
-   "ardeb",
-   "ardri",
-   "aread",
-   "areae",
-   "areal",
-   "arear",
-   "areas",
-   "areca",
-   "aredd",
-   "arede",
-   "arefy",
-   "areic",
-   "arene",
-   "arepa",
-   "arere",
-   "arete",
-   "arets",
-   "arett",
-   "argal",
-   "argan",
-   "argil",
-   "argle",
-   "argol",
-   "argon",
-   "argot",
-   "argus",
-   "arhat",
-   "arias",
-   "ariel",
-   "ariki",
-   "arils",
-   "ariot",
-   "arish",
-   "arked",
-   "arled",
-   "arles",
-   "armed",
-   "armer",
-   "armet",
-   "armil",
-   "arnas",
-   "arnut",
-   "aroba",
-   "aroha",
-   "aroid",
-   "arpas",
-   "arpen",
-   "arrah",
-   "arras",
-   "arret",
-   "arris",
-   "arroz",
-   "arsed",
-   "arses",
-   "arsey",
-   "arsis",
-   "artal",
-   "artel",
-   "artic",
-   "artis",
-   "aruhe",
-   "arums",
-   "arval",
-   "arvee",
-   "arvos",
-   "aryls",
-   "asana",
-   "ascon",
-   "ascus",
-   "asdic",
-   "ashed",
-   "ashes",
-   "ashet",
-   "asked",
-   "asker",
-   "askoi",
-   "askos",
-   "aspen",
-   "asper",
-   "aspic",
-   "aspie",
-   "aspis",
-   "aspro",
-   "assai",
-   "assam",
-   "asses",
-   "assez",
-   "assot",
-   "aster",
-   "astir",
-   "astun",
-   "asura",
-   "asway",
-   "aswim",
-   "asyla",
-   "ataps",
-   "ataxy",
-   "atigi",
-   "atilt",
-   "atimy",
-   "atlas",
-   "atman",
-   "atmas",
-   "atmos",
-   "atocs",
-   "atoke",
-   "atoks",
-   "atoms",
-   "atomy",
-   "atony",
-   "atopy",
-   "atria",
-   "atrip",
-   "attap",
-   "attar",
-   "atuas",
-   "audad",
-   "auger",
-   "aught",
-   "aulas",
-   "aulic",
-   "auloi",
-   "aulos",
-   "aumil",
-   "aunes",
-   "aunts",
-   "aurae",
-   "aural",
-   "aurar",
-   "auras",
-   "aurei",
-   "aures",
-   "auric",
-   "auris",
-   "aurum",
-   "autos",
-   "auxin",
-   "avale",
-   "avant",
-   "avast",
-   "avels",
-   "avens",
-   "avers",
-   "avgas",
-   "avine",
-   "avion",
-   "avise",
-   "aviso",
-   "avize",
-   "avows",
-   "avyze",
-   "awarn",
-   "awato",
-   "awave",
-   "aways",
-   "awdls",
-   "aweel",
-   "aweto",
-   "awing",
-   "awmry",
-   "awned",
-   "awner",
-   "awols",
-   "awork",
-   "axels",
-   "axile",
-   "axils",
-   "axing",
-   "axite",
-   "axled",
-   "axles",
-   "axman",
-   "axmen",
-   "axoid",
-   "axone",
-   "axons",
-   "ayahs",
-   "ayaya",
-   "ayelp",
-   "aygre",
-   "ayins",
-   "ayont",
-   "ayres",
-   "ayrie",
-   "azans",
-   "azide",
-   "azido",
-   "azine",
-   "azlon",
-   "azoic",
-   "azole",
-   "azons",
-   "azote",
-   "azoth",
-   "azuki",
-   "azurn",
-   "azury",
-   "azygy",
-   "azyme",
-   "azyms",
-   "baaed",
-   "baals",
-   "babas",
-   "babel",
-   "babes",
-   "babka",
-   "baboo",
-   "babul",
-   "babus",
-   "bacca",
-   "bacco",
-   "baccy",
-   "bacha",
-   "bachs",
-   "backs",
-   "baddy",
-   "baels",
-   "baffs",
-   "baffy",
-   "bafts",
-   "baghs",
-   "bagie",
-   "bahts",
-   "bahus",
-   "bahut",
-   "bails",
-   "bairn",
-   "baisa",
-   "baith",
-   "baits",
-   "baiza",
-   "baize",
-   "bajan",
-   "bajra",
-   "bajri",
-   "bajus",
-   "baked",
-   "baken",
-   "bakes",
-   "bakra",
-   "balas",
-   "balds",
-   "baldy",
-   "baled",
-   "bales",
-   "balks",
-   "balky",
-   "balls",
-   "bally",
-   "balms",
-   "baloo",
-   "balsa",
-   "balti",
-   "balun",
-   "balus",
-   "bambi",
-   "banak",
-   "banco",
-   "bancs",
-   "banda",
-   "bandh",
-   "bands",
-   "bandy",
-   "baned",
-   "banes",
-   "bangs",
-   "bania",
-   "banks",
-   "banns",
-   "bants",
-   "bantu",
-   "banty",
-   "banya",
-   "bapus",
-   "barbe",
-   "barbs",
-   "barby",
-   "barca",
-   "barde",
-   "bardo",
-   "bards",
-   "bardy",
-   "bared",
-   "barer",
-   "bares",
-   "barfi",
-   "barfs",
-   "baric",
-   "barks",
-   "barky",
-   "barms",
-   "barmy",
-   "barns",
-   "barny",
-   "barps",
-   "barra",
-   "barre",
-   "barro",
-   "barry",
-   "barye",
-   "basan",
-   "based",
-   "basen",
-   "baser",
-   "bases",
-   "basho",
-   "basij",
-   "basks",
-   "bason",
-   "basse",
-   "bassi",
-   "basso",
-   "bassy",
-   "basta",
-   "basti",
-   "basto",
-   "basts",
-   "bated",
-   "bates",
-   "baths",
-   "batik",
-   "batta",
-   "batts",
-   "battu",
-   "bauds",
-   "bauks",
-   "baulk",
-   "baurs",
-   "bavin",
-   "bawds",
-   "bawks",
-   "bawls",
-   "bawns",
-   "bawrs",
-   "bawty",
-   "bayed",
-   "bayer",
-   "bayes",
-   "bayle",
-   "bayts",
-   "bazar",
-   "bazoo",
-   "beads",
-   "beaks",
-   "beaky",
-   "beals",
-   "beams",
-   "beamy",
-   "beano",
-   "beans",
-   "beany",
-   "beare",
-   "bears",
-   "beath",
-   "beats",
-   "beaty",
-   "beaus",
-   "beaut",
-   "beaux",
-   "bebop",
-   "becap",
-   "becke",
-   "becks",
-   "bedad",
-   "bedel",
-   "bedes",
-   "bedew",
-   "bedim",
-   "bedye",
-   "beedi",
-   "beefs",
-   "beeps",
-   "beers",
-   "beery",
-   "beets",
-   "befog",
-   "begad",
-   "begar",
-   "begem",
-   "begot",
-   "begum",
-   "beige",
-   "beigy",
-   "beins",
-   "bekah",
-   "belah",
-   "belar",
-   "belay",
-   "belee",
-   "belga",
-   "bells",
-   "belon",
-   "belts",
-   "bemad",
-   "bemas",
-   "bemix",
-   "bemud",
-   "bends",
-   "bendy",
-   "benes",
-   "benet",
-   "benga",
-   "benis",
-   "benne",
-   "benni",
-   "benny",
-   "bento",
-   "bents",
-   "benty",
-   "bepat",
-   "beray",
-   "beres",
-   "bergs",
-   "berko",
-   "berks",
-   "berme",
-   "berms",
-   "berob",
-   "beryl",
-   "besat",
-   "besaw",
-   "besee",
-   "beses",
-   "besit",
-   "besom",
-   "besot",
-   "besti",
-   "bests",
-   "betas",
-   "beted",
-   "betes",
-   "beths",
-   "betid",
-   "beton",
-   "betta",
-   "betty",
-   "bever",
-   "bevor",
-   "bevue",
-   "bevvy",
-   "bewet",
-   "bewig",
-   "bezes",
-   "bezil",
-   "bezzy",
-   "bhais",
-   "bhaji",
-   "bhang",
-   "bhats",
-   "bhels",
-   "bhoot",
-   "bhuna",
-   "bhuts",
-   "biach",
-   "biali",
-   "bialy",
-   "bibbs",
-   "bibes",
-   "biccy",
-   "bices",
-   "bided",
-   "bider",
-   "bides",
-   "bidet",
-   "bidis",
-   "bidon",
-   "bield",
-   "biers",
-   "biffo",
-   "biffs",
-   "biffy",
-   "bifid",
-   "bigae",
-   "biggs",
-   "biggy",
-   "bigha",
-   "bight",
-   "bigly",
-   "bigos",
-   "bijou",
-   "biked",
-   "biker",
-   "bikes",
-   "bikie",
-   "bilbo",
-   "bilby",
-   "biled",
-   "biles",
-   "bilgy",
-   "bilks",
-   "bills",
-   "bimah",
-   "bimas",
-   "bimbo",
-   "binal",
-   "bindi",
-   "binds",
-   "biner",
-   "bines",
-   "bings",
-   "bingy",
-   "binit",
-   "binks",
-   "bints",
-   "biogs",
-   "biont",
-   "biota",
-   "biped",
-   "bipod",
-   "birds",
-   "birks",
-   "birle",
-   "birls",
-   "biros",
-   "birrs",
-   "birse",
-   "birsy",
-   "bises",
-   "bisks",
-   "bisom",
-   "biter",
-   "bites",
-   "bitos",
-   "bitou",
-   "bitsy",
-   "bitte",
-   "bitts",
-   "bivia",
-   "bivvy",
-   "bizes",
-   "bizzo",
-   "bizzy",
-   "blabs",
-   "blads",
-   "blady",
-   "blaer",
-   "blaes",
-   "blaff",
-   "blags",
-   "blahs",
-   "blain",
-   "blams",
-   "blart",
-   "blase",
-   "blash",
-   "blate",
-   "blats",
-   "blatt",
-   "blaud",
-   "blawn",
-   "blaws",
-   "blays",
-   "blear",
-   "blebs",
-   "blech",
-   "blees",
-   "blent",
-   "blert",
-   "blest",
-   "blets",
-   "bleys",
-   "blimy",
-   "bling",
-   "blini",
-   "blins",
-   "bliny",
-   "blips",
-   "blist",
-   "blite",
-   "blits",
-   "blive",
-   "blobs",
-   "blocs",
-   "blogs",
-   "blook",
-   "bloop",
-   "blore",
-   "blots",
-   "blows",
-   "blowy",
-   "blubs",
-   "blude",
-   "bluds",
-   "bludy",
-   "blued",
-   "blues",
-   "bluet",
-   "bluey",
-   "bluid",
-   "blume",
-   "blunk",
-   "blurs",
-   "blype",
-   "boabs",
-   "boaks",
-   "boars",
-   "boart",
-   "boats",
-   "bobac",
-   "bobak",
-   "bobas",
-   "bobol",
-   "bobos",
-   "bocca",
-   "bocce",
-   "bocci",
-   "boche",
-   "bocks",
-   "boded",
-   "bodes",
-   "bodge",
-   "bodhi",
-   "bodle",
-   "boeps",
-   "boets",
-   "boeuf",
-   "boffo",
-   "boffs",
-   "bogan",
-   "bogey",
-   "boggy",
-   "bogie",
-   "bogle",
-   "bogue",
-   "bogus",
-   "bohea",
-   "bohos",
-   "boils",
-   "boing",
-   "boink",
-   "boite",
-   "boked",
-   "bokeh",
-   "bokes",
-   "bokos",
-   "bolar",
-   "bolas",
-   "bolds",
-   "boles",
-   "bolix",
-   "bolls",
-   "bolos",
-   "bolts",
-   "bolus",
-   "bomas",
-   "bombe",
-   "bombo",
-   "bombs",
-   "bonce",
-   "bonds",
-   "boned",
-   "boner",
-   "bones",
-   "bongs",
-   "bonie",
-   "bonks",
-   "bonne",
-   "bonny",
-   "bonza",
-   "bonze",
-   "booai",
-   "booay",
-   "boobs",
-   "boody",
-   "booed",
-   "boofy",
-   "boogy",
-   "boohs",
-   "books",
-   "booky",
-   "bools",
-   "booms",
-   "boomy",
-   "boong",
-   "boons",
-   "boord",
-   "boors",
-   "boose",
-   "boots",
-   "boppy",
-   "borak",
-   "boral",
-   "boras",
-   "borde",
-   "bords",
-   "bored",
-   "boree",
-   "borel",
-   "borer",
-   "bores",
-   "borgo",
-   "boric",
-   "borks",
-   "borms",
-   "borna",
-   "boron",
-   "borts",
-   "borty",
-   "bortz",
-   "bosie",
-   "bosks",
-   "bosky",
-   "boson",
-   "bosun",
-   "botas",
-   "botel",
-   "botes",
-   "bothy",
-   "botte",
-   "botts",
-   "botty",
-   "bouge",
-   "bouks",
-   "boult",
-   "bouns",
-   "bourd",
-   "bourg",
-   "bourn",
-   "bouse",
-   "bousy",
-   "bouts",
-   "bovid",
-   "bowat",
-   "bowed",
-   "bower",
-   "bowes",
-   "bowet",
-   "bowie",
-   "bowls",
-   "bowne",
-   "bowrs",
-   "bowse",
-   "boxed",
-   "boxen",
-   "boxes",
-   "boxla",
-   "boxty",
-   "boyar",
-   "boyau",
-   "boyed",
-   "boyfs",
-   "boygs",
-   "boyla",
-   "boyos",
-   "boysy",
-   "bozos",
-   "braai",
-   "brach",
-   "brack",
-   "bract",
-   "brads",
-   "braes",
-   "brags",
-   "brail",
-   "braks",
-   "braky",
-   "brame",
-   "brane",
-   "brank",
-   "brans",
-   "brant",
-   "brast",
-   "brats",
-   "brava",
-   "bravi",
-   "braws",
-   "braxy",
-   "brays",
-   "braza",
-   "braze",
-   "bream",
-   "brede",
-   "breds",
-   "breem",
-   "breer",
-   "brees",
-   "breid",
-   "breis",
-   "breme",
-   "brens",
-   "brent",
-   "brere",
-   "brers",
-   "breve",
-   "brews",
-   "breys",
-   "brier",
-   "bries",
-   "brigs",
-   "briki",
-   "briks",
-   "brill",
-   "brims",
-   "brins",
-   "brios",
-   "brise",
-   "briss",
-   "brith",
-   "brits",
-   "britt",
-   "brize",
-   "broch",
-   "brock",
-   "brods",
-   "brogh",
-   "brogs",
-   "brome",
-   "bromo",
-   "bronc",
-   "brond",
-   "brool",
-   "broos",
-   "brose",
-   "brosy",
-   "brows",
-   "brugh",
-   "bruin",
-   "bruit",
-   "brule",
-   "brume",
-   "brung",
-   "brusk",
-   "brust",
-   "bruts",
-   "buats",
-   "buaze",
-   "bubal",
-   "bubas",
-   "bubba",
-   "bubbe",
-   "bubby",
-   "bubus",
-   "buchu",
-   "bucko",
-   "bucks",
-   "bucku",
-   "budas",
-   "budis",
-   "budos",
-   "buffa",
-   "buffe",
-   "buffi",
-   "buffo",
-   "buffs",
-   "buffy",
-   "bufos",
-   "bufty",
-   "buhls",
-   "buhrs",
-   "buiks",
-   "buist",
-   "bukes",
-   "bulbs",
-   "bulgy",
-   "bulks",
-   "bulla",
-   "bulls",
-   "bulse",
-   "bumbo",
-   "bumfs",
-   "bumph",
-   "bumps",
-   "bumpy",
-   "bunas",
-   "bunce",
-   "bunco",
-   "bunde",
-   "bundh",
-   "bunds",
-   "bundt",
-   "bundu",
-   "bundy",
-   "bungs",
-   "bungy",
-   "bunia",
-   "bunje",
-   "bunjy",
-   "bunko",
-   "bunks",
-   "bunns",
-   "bunts",
-   "bunty",
-   "bunya",
-   "buoys",
-   "buppy",
-   "buran",
-   "buras",
-   "burbs",
-   "burds",
-   "buret",
-   "burfi",
-   "burgh",
-   "burgs",
-   "burin",
-   "burka",
-   "burke",
-   "burks",
-   "burls",
-   "burns",
-   "buroo",
-   "burps",
-   "burqa",
-   "burro",
-   "burrs",
-   "burry",
-   "bursa",
-   "burse",
-   "busby",
-   "buses",
-   "busks",
-   "busky",
-   "bussu",
-   "busti",
-   "busts",
-   "busty",
-   "buteo",
-   "butes",
-   "butle",
-   "butoh",
-   "butts",
-   "butty",
-   "butut",
-   "butyl",
-   "buzzy",
-   "bwana",
-   "bwazi",
-   "byded",
-   "bydes",
-   "byked",
-   "bykes",
-   "byres",
-   "byrls",
-   "byssi",
-   "bytes",
-   "byway",
-   "caaed",
-   "cabas",
-   "caber",
-   "cabob",
-   "caboc",
-   "cabre",
-   "cacas",
-   "cacks",
-   "cacky",
-   "cadee",
-   "cades",
-   "cadge",
-   "cadgy",
-   "cadie",
-   "cadis",
-   "cadre",
-   "caeca",
-   "caese",
-   "cafes",
-   "caffs",
-   "caged",
-   "cager",
-   "cages",
-   "cagot",
-   "cahow",
-   "caids",
-   "cains",
-   "caird",
-   "cajon",
-   "cajun",
-   "caked",
-   "cakes",
-   "cakey",
-   "calfs",
-   "calid",
-   "calif",
-   "calix",
-   "calks",
-   "calla",
-   "calls",
-   "calms",
-   "calmy",
-   "calos",
-   "calpa",
-   "calps",
-   "calve",
-   "calyx",
-   "caman",
-   "camas",
-   "cames",
-   "camis",
-   "camos",
-   "campi",
-   "campo",
-   "camps",
-   "campy",
-   "camus",
-   "caned",
-   "caneh",
-   "caner",
-   "canes",
-   "cangs",
-   "canid",
-   "canna",
-   "canns",
-   "canso",
-   "canst",
-   "canto",
-   "cants",
-   "canty",
-   "capas",
-   "caped",
-   "capes",
-   "capex",
-   "caphs",
-   "capiz",
-   "caple",
-   "capon",
-   "capos",
-   "capot",
-   "capri",
-   "capul",
-   "carap",
-   "carbo",
-   "carbs",
-   "carby",
-   "cardi",
-   "cards",
-   "cardy",
-   "cared",
-   "carer",
-   "cares",
-   "caret",
-   "carex",
-   "carks",
-   "carle",
-   "carls",
-   "carns",
-   "carny",
-   "carob",
-   "carom",
-   "caron",
-   "carpi",
-   "carps",
-   "carrs",
-   "carse",
-   "carta",
-   "carte",
-   "carts",
-   "carvy",
-   "casas",
-   "casco",
-   "cased",
-   "cases",
-   "casks",
-   "casky",
-   "casts",
-   "casus",
-   "cates",
-   "cauda",
-   "cauks",
-   "cauld",
-   "cauls",
-   "caums",
-   "caups",
-   "cauri",
-   "causa",
-   "cavas",
-   "caved",
-   "cavel",
-   "caver",
-   "caves",
-   "cavie",
-   "cawed",
-   "cawks",
-   "caxon",
-   "ceaze",
-   "cebid",
-   "cecal",
-   "cecum",
-   "ceded",
-   "ceder",
-   "cedes",
-   "cedis",
-   "ceiba",
-   "ceili",
-   "ceils",
-   "celeb",
-   "cella",
-   "celli",
-   "cells",
-   "celom",
-   "celts",
-   "cense",
-   "cento",
-   "cents",
-   "centu",
-   "ceorl",
-   "cepes",
-   "cerci",
-   "cered",
-   "ceres",
-   "cerge",
-   "ceria",
-   "ceric",
-   "cerne",
-   "ceroc",
-   "ceros",
-   "certs",
-   "certy",
-   "cesse",
-   "cesta",
-   "cesti",
-   "cetes",
-   "cetyl",
-   "cezve",
-   "chace",
-   "chack",
-   "chaco",
-   "chado",
-   "chads",
-   "chaft",
-   "chais",
-   "chals",
-   "chams",
-   "chana",
-   "chang",
-   "chank",
-   "chape",
-   "chaps",
-   "chapt",
-   "chara",
-   "chare",
-   "chark",
-   "charr",
-   "chars",
-   "chary",
-   "chats",
-   "chave",
-   "chavs",
-   "chawk",
-   "chaws",
-   "chaya",
-   "chays",
-   "cheep",
-   "chefs",
-   "cheka",
-   "chela",
-   "chelp",
-   "chemo",
-   "chems",
-   "chere",
-   "chert",
-   "cheth",
-   "chevy",
-   "chews",
-   "chewy",
-   "chiao",
-   "chias",
-   "chibs",
-   "chica",
-   "chich",
-   "chico",
-   "chics",
-   "chiel",
-   "chiks",
-   "chile",
-   "chimb",
-   "chimo",
-   "chimp",
-   "chine",
-   "ching",
-   "chino",
-   "chins",
-   "chips",
-   "chirk",
-   "chirl",
-   "chirm",
-   "chiro",
-   "chirr",
-   "chirt",
-   "chiru",
-   "chits",
-   "chive",
-   "chivs",
-   "chivy",
-   "chizz",
-   "choco",
-   "chocs",
-   "chode",
-   "chogs",
-   "choil",
-   "choko",
-   "choky",
-   "chola",
-   "choli",
-   "cholo",
-   "chomp",
-   "chons",
-   "choof",
-   "chook",
-   "choom",
-   "choon",
-   "chops",
-   "chota",
-   "chott",
-   "chout",
-   "choux",
-   "chowk",
-   "chows",
-   "chubs",
-   "chufa",
-   "chuff",
-   "chugs",
-   "chums",
-   "churl",
-   "churr",
-   "chuse",
-   "chuts",
-   "chyle",
-   "chyme",
-   "chynd",
-   "cibol",
-   "cided",
-   "cides",
-   "ciels",
-   "ciggy",
-   "cilia",
-   "cills",
-   "cimar",
-   "cimex",
-   "cinct",
-   "cines",
-   "cinqs",
-   "cions",
-   "cippi",
-   "circs",
-   "cires",
-   "cirls",
-   "cirri",
-   "cisco",
-   "cissy",
-   "cists",
-   "cital",
-   "cited",
-   "citer",
-   "cites",
-   "cives",
-   "civet",
-   "civie",
-   "civvy",
-   "clach",
-   "clade",
-   "clads",
-   "claes",
-   "clags",
-   "clame",
-   "clams",
-   "clans",
-   "claps",
-   "clapt",
-   "claro",
-   "clart",
-   "clary",
-   "clast",
-   "clats",
-   "claut",
-   "clave",
-   "clavi",
-   "claws",
-   "clays",
-   "cleck",
-   "cleek",
-   "cleep",
-   "clefs",
-   "clegs",
-   "cleik",
-   "clems",
-   "clepe",
-   "clept",
-   "cleve",
-   "clews",
-   "clied",
-   "clies",
-   "clift",
-   "clime",
-   "cline",
-   "clint",
-   "clipe",
-   "clips",
-   "clipt",
-   "clits",
-   "cloam",
-   "clods",
-   "cloff",
-   "clogs",
-   "cloke",
-   "clomb",
-   "clomp",
-   "clonk",
-   "clons",
-   "cloop",
-   "cloot",
-   "clops",
-   "clote",
-   "clots",
-   "clour",
-   "clous",
-   "clows",
-   "cloye",
-   "cloys",
-   "cloze",
-   "clubs",
-   "clues",
-   "cluey",
-   "clunk",
-   "clype",
-   "cnida",
-   "coact",
-   "coady",
-   "coala",
-   "coals",
-   "coaly",
-   "coapt",
-   "coarb",
-   "coate",
-   "coati",
-   "coats",
-   "cobbs",
-   "cobby",
-   "cobia",
-   "coble",
-   "cobza",
-   "cocas",
-   "cocci",
-   "cocco",
-   "cocks",
-   "cocky",
-   "cocos",
-   "codas",
-   "codec",
-   "coded",
-   "coden",
-   "coder",
-   "codes",
-   "codex",
-   "codon",
-   "coeds",
-   "coffs",
-   "cogie",
-   "cogon",
-   "cogue",
-   "cohab",
-   "cohen",
-   "cohoe",
-   "cohog",
-   "cohos",
-   "coifs",
-   "coign",
-   "coils",
-   "coins",
-   "coirs",
-   "coits",
-   "coked",
-   "cokes",
-   "colas",
-   "colby",
-   "colds",
-   "coled",
-   "coles",
-   "coley",
-   "colic",
-   "colin",
-   "colls",
-   "colly",
-   "colog",
-   "colts",
-   "colza",
-   "comae",
-   "comal",
-   "comas",
-   "combe",
-   "combi",
-   "combo",
-   "combs",
-   "comby",
-   "comer",
-   "comes",
-   "comix",
-   "commo",
-   "comms",
-   "commy",
-   "compo",
-   "comps",
-   "compt",
-   "comte",
-   "comus",
-   "coned",
-   "cones",
-   "coney",
-   "confs",
-   "conga",
-   "conge",
-   "congo",
-   "conia",
-   "conin",
-   "conks",
-   "conky",
-   "conne",
-   "conns",
-   "conte",
-   "conto",
-   "conus",
-   "convo",
-   "cooch",
-   "cooed",
-   "cooee",
-   "cooer",
-   "cooey",
-   "coofs",
-   "cooks",
-   "cooky",
-   "cools",
-   "cooly",
-   "coomb",
-   "cooms",
-   "coomy",
-   "coops",
-   "coopt",
-   "coost",
-   "coots",
-   "cooze",
-   "copal",
-   "copay",
-   "coped",
-   "copen",
-   "coper",
-   "copes",
-   "coppy",
-   "copra",
-   "copsy",
-   "coqui",
-   "coram",
-   "corbe",
-   "corby",
-   "cords",
-   "cored",
-   "cores",
-   "corey",
-   "corgi",
-   "coria",
-   "corks",
-   "corky",
-   "corms",
-   "corni",
-   "corno",
-   "corns",
-   "cornu",
-   "corps",
-   "corse",
-   "corso",
-   "cosec",
-   "cosed",
-   "coses",
-   "coset",
-   "cosey",
-   "cosie",
-   "costa",
-   "coste",
-   "costs",
-   "cotan",
-   "coted",
-   "cotes",
-   "coths",
-   "cotta",
-   "cotts",
-   "coude",
-   "coups",
-   "courb",
-   "courd",
-   "coure",
-   "cours",
-   "couta",
-   "couth",
-   "coved",
-   "coves",
-   "covin",
-   "cowal",
-   "cowan",
-   "cowed",
-   "cowks",
-   "cowls",
-   "cowps",
-   "cowry",
-   "coxae",
-   "coxal",
-   "coxed",
-   "coxes",
-   "coxib",
-   "coyau",
-   "coyed",
-   "coyer",
-   "coypu",
-   "cozed",
-   "cozen",
-   "cozes",
-   "cozey",
-   "cozie",
-   "craal",
-   "crabs",
-   "crags",
-   "craic",
-   "craig",
-   "crake",
-   "crame",
-   "crams",
-   "crans",
-   "crape",
-   "craps",
-   "crapy",
-   "crare",
-   "craws",
-   "crays",
-   "creds",
-   "creel",
-   "crees",
-   "crems",
-   "crena",
-   "creps",
-   "crepy",
-   "crewe",
-   "crews",
-   "crias",
-   "cribs",
-   "cries",
-   "crims",
-   "crine",
-   "crios",
-   "cripe",
-   "crips",
-   "crise",
-   "crith",
-   "crits",
-   "croci",
-   "crocs",
-   "croft",
-   "crogs",
-   "cromb",
-   "crome",
-   "cronk",
-   "crons",
-   "crool",
-   "croon",
-   "crops",
-   "crore",
-   "crost",
-   "crout",
-   "crows",
-   "croze",
-   "cruck",
-   "crudo",
-   "cruds",
-   "crudy",
-   "crues",
-   "cruet",
-   "cruft",
-   "crunk",
-   "cruor",
-   "crura",
-   "cruse",
-   "crusy",
-   "cruve",
-   "crwth",
-   "cryer",
-   "ctene",
-   "cubby",
-   "cubeb",
-   "cubed",
-   "cuber",
-   "cubes",
-   "cubit",
-   "cuddy",
-   "cuffo",
-   "cuffs",
-   "cuifs",
-   "cuing",
-   "cuish",
-   "cuits",
-   "cukes",
-   "culch",
-   "culet",
-   "culex",
-   "culls",
-   "cully",
-   "culms",
-   "culpa",
-   "culti",
-   "cults",
-   "culty",
-   "cumec",
-   "cundy",
-   "cunei",
-   "cunit",
-   "cunts",
-   "cupel",
-   "cupid",
-   "cuppa",
-   "cuppy",
-   "curat",
-   "curbs",
-   "curch",
-   "curds",
-   "curdy",
-   "cured",
-   "curer",
-   "cures",
-   "curet",
-   "curfs",
-   "curia",
-   "curie",
-   "curli",
-   "curls",
-   "curns",
-   "curny",
-   "currs",
-   "cursi",
-   "curst",
-   "cusec",
-   "cushy",
-   "cusks",
-   "cusps",
-   "cuspy",
-   "cusso",
-   "cusum",
-   "cutch",
-   "cuter",
-   "cutes",
-   "cutey",
-   "cutin",
-   "cutis",
-   "cutto",
-   "cutty",
-   "cutup",
-   "cuvee",
-   "cuzes",
-   "cwtch",
-   "cyano",
-   "cyans",
-   "cycad",
-   "cycas",
-   "cyclo",
-   "cyder",
-   "cylix",
-   "cymae",
-   "cymar",
-   "cymas",
-   "cymes",
-   "cymol",
-   "cysts",
-   "cytes",
-   "cyton",
-   "czars",
-   "daals",
-   "dabba",
-   "daces",
-   "dacha",
-   "dacks",
-   "dadah",
-   "dadas",
-   "dados",
-   "daffs",
-   "daffy",
-   "dagga",
-   "daggy",
-   "dagos",
-   "dahls",
-   "daiko",
-   "daine",
-   "daint",
-   "daker",
-   "daled",
-   "dales",
-   "dalis",
-   "dalle",
-   "dalts",
-   "daman",
-   "damar",
-   "dames",
-   "damme",
-   "damns",
-   "damps",
-   "dampy",
-   "dancy",
-   "dangs",
-   "danio",
-   "danks",
-   "danny",
-   "dants",
-   "daraf",
-   "darbs",
-   "darcy",
-   "dared",
-   "darer",
-   "dares",
-   "darga",
-   "dargs",
-   "daric",
-   "daris",
-   "darks",
-   "darns",
-   "darre",
-   "darts",
-   "darzi",
-   "dashi",
-   "dashy",
-   "datal",
-   "dated",
-   "dater",
-   "dates",
-   "datos",
-   "datto",
-   "daube",
-   "daubs",
-   "dauby",
-   "dauds",
-   "dault",
-   "daurs",
-   "dauts",
-   "daven",
-   "davit",
-   "dawah",
-   "dawds",
-   "dawed",
-   "dawen",
-   "dawks",
-   "dawns",
-   "dawts",
-   "dayan",
-   "daych",
-   "daynt",
-   "dazed",
-   "dazer",
-   "dazes",
-   "deads",
-   "deair",
-   "deals",
-   "deans",
-   "deare",
-   "dearn",
-   "dears",
-   "deary",
-   "deash",
-   "deave",
-   "deaws",
-   "deawy",
-   "debag",
-   "debby",
-   "debel",
-   "debes",
-   "debts",
-   "debud",
-   "debur",
-   "debus",
-   "debye",
-   "decad",
-   "decaf",
-   "decan",
-   "decko",
-   "decks",
-   "decos",
-   "dedal",
-   "deeds",
-   "deedy",
-   "deely",
-   "deems",
-   "deens",
-   "deeps",
-   "deere",
-   "deers",
-   "deets",
-   "deeve",
-   "deevs",
-   "defat",
-   "deffo",
-   "defis",
-   "defog",
-   "degas",
-   "degum",
-   "degus",
-   "deice",
-   "deids",
-   "deify",
-   "deils",
-   "deism",
-   "deist",
-   "deked",
-   "dekes",
-   "dekko",
-   "deled",
-   "deles",
-   "delfs",
-   "delft",
-   "delis",
-   "dells",
-   "delly",
-   "delos",
-   "delph",
-   "delts",
-   "deman",
-   "demes",
-   "demic",
-   "demit",
-   "demob",
-   "demoi",
-   "demos",
-   "dempt",
-   "denar",
-   "denay",
-   "dench",
-   "denes",
-   "denet",
-   "denis",
-   "dents",
-   "deoxy",
-   "derat",
-   "deray",
-   "dered",
-   "deres",
-   "derig",
-   "derma",
-   "derms",
-   "derns",
-   "derny",
-   "deros",
-   "derro",
-   "derry",
-   "derth",
-   "dervs",
-   "desex",
-   "deshi",
-   "desis",
-   "desks",
-   "desse",
-   "devas",
-   "devel",
-   "devis",
-   "devon",
-   "devos",
-   "devot",
-   "dewan",
-   "dewar",
-   "dewax",
-   "dewed",
-   "dexes",
-   "dexie",
-   "dhaba",
-   "dhaks",
-   "dhals",
-   "dhikr",
-   "dhobi",
-   "dhole",
-   "dholl",
-   "dhols",
-   "dhoti",
-   "dhows",
-   "dhuti",
-   "diact",
-   "dials",
-   "diane",
-   "diazo",
-   "dibbs",
-   "diced",
-   "dicer",
-   "dices",
-   "dicht",
-   "dicks",
-   "dicky",
-   "dicot",
-   "dicta",
-   "dicts",
-   "dicty",
-   "diddy",
-   "didie",
-   "didos",
-   "didst",
-   "diebs",
-   "diels",
-   "diene",
-   "diets",
-   "diffs",
-   "dight",
-   "dikas",
-   "diked",
-   "diker",
-   "dikes",
-   "dikey",
-   "dildo",
-   "dilli",
-   "dills",
-   "dimbo",
-   "dimer",
-   "dimes",
-   "dimps",
-   "dinar",
-   "dined",
-   "dines",
-   "dinge",
-   "dings",
-   "dinic",
-   "dinks",
-   "dinky",
-   "dinna",
-   "dinos",
-   "dints",
-   "diols",
-   "diota",
-   "dippy",
-   "dipso",
-   "diram",
-   "direr",
-   "dirke",
-   "dirks",
-   "dirls",
-   "dirts",
-   "disas",
-   "disci",
-   "discs",
-   "dishy",
-   "disks",
-   "disme",
-   "dital",
-   "ditas",
-   "dited",
-   "dites",
-   "ditsy",
-   "ditts",
-   "ditzy",
-   "divan",
-   "divas",
-   "dived",
-   "dives",
-   "divis",
-   "divna",
-   "divos",
-   "divot",
-   "divvy",
-   "diwan",
-   "dixie",
-   "dixit",
-   "diyas",
-   "dizen",
-   "djinn",
-   "djins",
-   "doabs",
-   "doats",
-   "dobby",
-   "dobes",
-   "dobie",
-   "dobla",
-   "dobra",
-   "dobro",
-   "docht",
-   "docks",
-   "docos",
-   "docus",
-   "doddy",
-   "dodos",
-   "doeks",
-   "doers",
-   "doest",
-   "doeth",
-   "doffs",
-   "dogan",
-   "doges",
-   "dogey",
-   "doggo",
-   "doggy",
-   "dogie",
-   "dohyo",
-   "doilt",
-   "doily",
-   "doits",
-   "dojos",
-   "dolce",
-   "dolci",
-   "doled",
-   "doles",
-   "dolia",
-   "dolls",
-   "dolma",
-   "dolor",
-   "dolos",
-   "dolts",
-   "domal",
-   "domed",
-   "domes",
-   "domic",
-   "donah",
-   "donas",
-   "donee",
-   "doner",
-   "donga",
-   "dongs",
-   "donko",
-   "donna",
-   "donne",
-   "donny",
-   "donsy",
-   "doobs",
-   "dooce",
-   "doody",
-   "dooks",
-   "doole",
-   "dools",
-   "dooly",
-   "dooms",
-   "doomy",
-   "doona",
-   "doorn",
-   "doors",
-   "doozy",
-   "dopas",
-   "doped",
-   "doper",
-   "dopes",
-   "dorad",
-   "dorba",
-   "dorbs",
-   "doree",
-   "dores",
-   "doric",
-   "doris",
-   "dorks",
-   "dorky",
-   "dorms",
-   "dormy",
-   "dorps",
-   "dorrs",
-   "dorsa",
-   "dorse",
-   "dorts",
-   "dorty",
-   "dosai",
-   "dosas",
-   "dosed",
-   "doseh",
-   "doser",
-   "doses",
-   "dosha",
-   "dotal",
-   "doted",
-   "doter",
-   "dotes",
-   "dotty",
-   "douar",
-   "douce",
-   "doucs",
-   "douks",
-   "doula",
-   "douma",
-   "doums",
-   "doups",
-   "doura",
-   "douse",
-   "douts",
-   "doved",
-   "doven",
-   "dover",
-   "doves",
-   "dovie",
-   "dowar",
-   "dowds",
-   "dowed",
-   "dower",
-   "dowie",
-   "dowle",
-   "dowls",
-   "dowly",
-   "downa",
-   "downs",
-   "dowps",
-   "dowse",
-   "dowts",
-   "doxed",
-   "doxes",
-   "doxie",
-   "doyen",
-   "doyly",
-   "dozed",
-   "dozer",
-   "dozes",
-   "drabs",
-   "drack",
-   "draco",
-   "draff",
-   "drags",
-   "drail",
-   "drams",
-   "drant",
-   "draps",
-   "drats",
-   "drave",
-   "draws",
-   "drays",
-   "drear",
-   "dreck",
-   "dreed",
-   "dreer",
-   "drees",
-   "dregs",
-   "dreks",
-   "drent",
-   "drere",
-   "drest",
-   "dreys",
-   "dribs",
-   "drice",
-   "dries",
-   "drily",
-   "drips",
-   "dript",
-   "droid",
-   "droil",
-   "droke",
-   "drole",
-   "drome",
-   "drony",
-   "droob",
-   "droog",
-   "drook",
-   "drops",
-   "dropt",
-   "drouk",
-   "drows",
-   "drubs",
-   "drugs",
-   "drums",
-   "drupe",
-   "druse",
-   "drusy",
-   "druxy",
-   "dryad",
-   "dryas",
-   "dsobo",
-   "dsomo",
-   "duads",
-   "duals",
-   "duans",
-   "duars",
-   "dubbo",
-   "ducal",
-   "ducat",
-   "duces",
-   "ducks",
-   "ducky",
-   "ducts",
-   "duddy",
-   "duded",
-   "dudes",
-   "duels",
-   "duets",
-   "duett",
-   "duffs",
-   "dufus",
-   "duing",
-   "duits",
-   "dukas",
-   "duked",
-   "dukes",
-   "dukka",
-   "dulce",
-   "dules",
-   "dulia",
-   "dulls",
-   "dulse",
-   "dumas",
-   "dumbo",
-   "dumbs",
-   "dumka",
-   "dumky",
-   "dumps",
-   "dunam",
-   "dunch",
-   "dunes",
-   "dungs",
-   "dungy",
-   "dunks",
-   "dunno",
-   "dunny",
-   "dunsh",
-   "dunts",
-   "duomi",
-   "duomo",
-   "duped",
-   "duper",
-   "dupes",
-   "duple",
-   "duply",
-   "duppy",
-   "dural",
-   "duras",
-   "dured",
-   "dures",
-   "durgy",
-   "durns",
-   "duroc",
-   "duros",
-   "duroy",
-   "durra",
-   "durrs",
-   "durry",
-   "durst",
-   "durum",
-   "durzi",
-   "dusks",
-   "dusts",
-   "duxes",
-   "dwaal",
-   "dwale",
-   "dwalm",
-   "dwams",
-   "dwang",
-   "dwaum",
-   "dweeb",
-   "dwile",
-   "dwine",
-   "dyads",
-   "dyers",
-   "dykon",
-   "dynel",
-   "dynes",
-   "dzhos",
-   "eagre",
-   "ealed",
-   "eales",
-   "eaned",
-   "eards",
-   "eared",
-   "earls",
-   "earns",
-   "earnt",
-   "earst",
-   "eased",
-   "easer",
-   "eases",
-   "easle",
-   "easts",
-   "eathe",
-   "eaved",
-   "eaves",
-   "ebbed",
-   "ebbet",
-   "ebons",
-   "ebook",
-   "ecads",
-   "eched",
-   "eches",
-   "echos",
-   "ecrus",
-   "edema",
-   "edged",
-   "edger",
-   "edges",
-   "edile",
-   "edits",
-   "educe",
-   "educt",
-   "eejit",
-   "eensy",
-   "eeven",
-   "eevns",
-   "effed",
-   "egads",
-   "egers",
-   "egest",
-   "eggar",
-   "egged",
-   "egger",
-   "egmas",
-   "ehing",
-   "eider",
-   "eidos",
-   "eigne",
-   "eiked",
-   "eikon",
-   "eilds",
-   "eisel",
-   "ejido",
-   "ekkas",
-   "elain",
-   "eland",
-   "elans",
-   "elchi",
-   "eldin",
-   "elemi",
-   "elfed",
-   "eliad",
-   "elint",
-   "elmen",
-   "eloge",
-   "elogy",
-   "eloin",
-   "elops",
-   "elpee",
-   "elsin",
-   "elute",
-   "elvan",
-   "elven",
-   "elver",
-   "elves",
-   "emacs",
-   "embar",
-   "embay",
-   "embog",
-   "embow",
-   "embox",
-   "embus",
-   "emeer",
-   "emend",
-   "emerg",
-   "emery",
-   "emeus",
-   "emics",
-   "emirs",
-   "emits",
-   "emmas",
-   "emmer",
-   "emmet",
-   "emmew",
-   "emmys",
-   "emoji",
-   "emong",
-   "emote",
-   "emove",
-   "empts",
-   "emule",
-   "emure",
-   "emyde",
-   "emyds",
-   "enarm",
-   "enate",
-   "ended",
-   "ender",
-   "endew",
-   "endue",
-   "enews",
-   "enfix",
-   "eniac",
-   "enlit",
-   "enmew",
-   "ennog",
-   "enoki",
-   "enols",
-   "enorm",
-   "enows",
-   "enrol",
-   "ensew",
-   "ensky",
-   "entia",
-   "enure",
-   "enurn",
-   "envoi",
-   "enzym",
-   "eorls",
-   "eosin",
-   "epact",
-   "epees",
-   "ephah",
-   "ephas",
-   "ephod",
-   "ephor",
-   "epics",
-   "epode",
-   "epopt",
-   "epris",
-   "eques",
-   "equid",
-   "erbia",
-   "erevs",
-   "ergon",
-   "ergos",
-   "ergot",
-   "erhus",
-   "erica",
-   "erick",
-   "erics",
-   "ering",
-   "erned",
-   "ernes",
-   "erose",
-   "erred",
-   "erses",
-   "eruct",
-   "erugo",
-   "eruvs",
-   "erven",
-   "ervil",
-   "escar",
-   "escot",
-   "esile",
-   "eskar",
-   "esker",
-   "esnes",
-   "esses",
-   "estoc",
-   "estop",
-   "estro",
-   "etage",
-   "etape",
-   "etats",
-   "etens",
-   "ethal",
-   "ethne",
-   "ethyl",
-   "etics",
-   "etnas",
-   "ettin",
-   "ettle",
-   "etuis",
-   "etwee",
-   "etyma",
-   "eughs",
-   "euked",
-   "eupad",
-   "euros",
-   "eusol",
-   "evens",
-   "evert",
-   "evets",
-   "evhoe",
-   "evils",
-   "evite",
-   "evohe",
-   "ewers",
-   "ewest",
-   "ewhow",
-   "ewked",
-   "exams",
-   "exeat",
-   "execs",
-   "exeem",
-   "exeme",
-   "exfil",
-   "exies",
-   "exine",
-   "exing",
-   "exits",
-   "exode",
-   "exome",
-   "exons",
-   "expat",
-   "expos",
-   "exude",
-   "exuls",
-   "exurb",
-   "eyass",
-   "eyers",
-   "eyots",
-   "eyras",
-   "eyres",
-   "eyrie",
-   "eyrir",
-   "ezine",
-   "fabby",
-   "faced",
-   "facer",
-   "faces",
-   "facia",
-   "facta",
-   "facts",
-   "faddy",
-   "faded",
-   "fader",
-   "fades",
-   "fadge",
-   "fados",
-   "faena",
-   "faery",
-   "faffs",
-   "faffy",
-   "fagin",
-   "faiks",
-   "fails",
-   "faine",
-   "fains",
-   "fairs",
-   "faked",
-   "faker",
-   "fakes",
-   "fakey",
-   "fakie",
-   "fakir",
-   "falaj",
-   "falls",
-   "famed",
-   "fames",
-   "fanal",
-   "fands",
-   "fanes",
-   "fanga",
-   "fango",
-   "fangs",
-   "fanks",
-   "fanon",
-   "fanos",
-   "fanum",
-   "faqir",
-   "farad",
-   "farci",
-   "farcy",
-   "fards",
-   "fared",
-   "farer",
-   "fares",
-   "farle",
-   "farls",
-   "farms",
-   "faros",
-   "farro",
-   "farse",
-   "farts",
-   "fasci",
-   "fasti",
-   "fasts",
-   "fated",
-   "fates",
-   "fatly",
-   "fatso",
-   "fatwa",
-   "faugh",
-   "fauld",
-   "fauns",
-   "faurd",
-   "fauts",
-   "fauve",
-   "favas",
-   "favel",
-   "faver",
-   "faves",
-   "favus",
-   "fawns",
-   "fawny",
-   "faxed",
-   "faxes",
-   "fayed",
-   "fayer",
-   "fayne",
-   "fayre",
-   "fazed",
-   "fazes",
-   "feals",
-   "feare",
-   "fears",
-   "feart",
-   "fease",
-   "feats",
-   "feaze",
-   "feces",
-   "fecht",
-   "fecit",
-   "fecks",
-   "fedex",
-   "feebs",
-   "feeds",
-   "feels",
-   "feens",
-   "feers",
-   "feese",
-   "feeze",
-   "fehme",
-   "feint",
-   "feist",
-   "felch",
-   "felid",
-   "fells",
-   "felly",
-   "felts",
-   "felty",
-   "femal",
-   "femes",
-   "femmy",
-   "fends",
-   "fendy",
-   "fenis",
-   "fenks",
-   "fenny",
-   "fents",
-   "feods",
-   "feoff",
-   "ferer",
-   "feres",
-   "feria",
-   "ferly",
-   "fermi",
-   "ferms",
-   "ferns",
-   "ferny",
-   "fesse",
-   "festa",
-   "fests",
-   "festy",
-   "fetas",
-   "feted",
-   "fetes",
-   "fetor",
-   "fetta",
-   "fetts",
-   "fetwa",
-   "feuar",
-   "feuds",
-   "feued",
-   "feyed",
-   "feyer",
-   "feyly",
-   "fezes",
-   "fezzy",
-   "fiars",
-   "fiats",
-   "fibro",
-   "fices",
-   "fiche",
-   "fichu",
-   "ficin",
-   "ficos",
-   "fides",
-   "fidge",
-   "fidos",
-   "fiefs",
-   "fient",
-   "fiere",
-   "fiers",
-   "fiest",
-   "fifed",
-   "fifer",
-   "fifes",
-   "fifis",
-   "figgy",
-   "figos",
-   "fiked",
-   "fikes",
-   "filar",
-   "filch",
-   "filed",
-   "files",
-   "filii",
-   "filks",
-   "fille",
-   "fillo",
-   "fills",
-   "filmi",
-   "films",
-   "filos",
-   "filum",
-   "finca",
-   "finds",
-   "fined",
-   "fines",
-   "finis",
-   "finks",
-   "finny",
-   "finos",
-   "fiord",
-   "fiqhs",
-   "fique",
-   "fired",
-   "firer",
-   "fires",
-   "firie",
-   "firks",
-   "firms",
-   "firns",
-   "firry",
-   "firth",
-   "fiscs",
-   "fisks",
-   "fists",
-   "fisty",
-   "fitch",
-   "fitly",
-   "fitna",
-   "fitte",
-   "fitts",
-   "fiver",
-   "fives",
-   "fixed",
-   "fixes",
-   "fixit",
-   "fjeld",
-   "flabs",
-   "flaff",
-   "flags",
-   "flaks",
-   "flamm",
-   "flams",
-   "flamy",
-   "flane",
-   "flans",
-   "flaps",
-   "flary",
-   "flats",
-   "flava",
-   "flawn",
-   "flaws",
-   "flawy",
-   "flaxy",
-   "flays",
-   "fleam",
-   "fleas",
-   "fleek",
-   "fleer",
-   "flees",
-   "flegs",
-   "fleme",
-   "fleur",
-   "flews",
-   "flexi",
-   "flexo",
-   "fleys",
-   "flics",
-   "flied",
-   "flies",
-   "flimp",
-   "flims",
-   "flips",
-   "flirs",
-   "flisk",
-   "flite",
-   "flits",
-   "flitt",
-   "flobs",
-   "flocs",
-   "floes",
-   "flogs",
-   "flong",
-   "flops",
-   "flors",
-   "flory",
-   "flosh",
-   "flota",
-   "flote",
-   "flows",
-   "flubs",
-   "flued",
-   "flues",
-   "fluey",
-   "fluky",
-   "flump",
-   "fluor",
-   "flurr",
-   "fluty",
-   "fluyt",
-   "flyby",
-   "flype",
-   "flyte",
-   "foals",
-   "foams",
-   "foehn",
-   "fogey",
-   "fogie",
-   "fogle",
-   "fogou",
-   "fohns",
-   "foids",
-   "foils",
-   "foins",
-   "folds",
-   "foley",
-   "folia",
-   "folic",
-   "folie",
-   "folks",
-   "folky",
-   "fomes",
-   "fonda",
-   "fonds",
-   "fondu",
-   "fones",
-   "fonly",
-   "fonts",
-   "foods",
-   "foody",
-   "fools",
-   "foots",
-   "footy",
-   "foram",
-   "forbs",
-   "forby",
-   "fordo",
-   "fords",
-   "forel",
-   "fores",
-   "forex",
-   "forks",
-   "forky",
-   "forme",
-   "forms",
-   "forts",
-   "forza",
-   "forze",
-   "fossa",
-   "fosse",
-   "fouat",
-   "fouds",
-   "fouer",
-   "fouet",
-   "foule",
-   "fouls",
-   "fount",
-   "fours",
-   "fouth",
-   "fovea",
-   "fowls",
-   "fowth",
-   "foxed",
-   "foxes",
-   "foxie",
-   "foyle",
-   "foyne",
-   "frabs",
-   "frack",
-   "fract",
-   "frags",
-   "fraim",
-   "franc",
-   "frape",
-   "fraps",
-   "frass",
-   "frate",
-   "frati",
-   "frats",
-   "fraus",
-   "frays",
-   "frees",
-   "freet",
-   "freit",
-   "fremd",
-   "frena",
-   "freon",
-   "frere",
-   "frets",
-   "fribs",
-   "frier",
-   "fries",
-   "frigs",
-   "frise",
-   "frist",
-   "frith",
-   "frits",
-   "fritt",
-   "frize",
-   "frizz",
-   "froes",
-   "frogs",
-   "frons",
-   "frore",
-   "frorn",
-   "frory",
-   "frosh",
-   "frows",
-   "frowy",
-   "frugs",
-   "frump",
-   "frush",
-   "frust",
-   "fryer",
-   "fubar",
-   "fubby",
-   "fubsy",
-   "fucks",
-   "fucus",
-   "fuddy",
-   "fudgy",
-   "fuels",
-   "fuero",
-   "fuffs",
-   "fuffy",
-   "fugal",
-   "fuggy",
-   "fugie",
-   "fugio",
-   "fugle",
-   "fugly",
-   "fugus",
-   "fujis",
-   "fulls",
-   "fumed",
-   "fumer",
-   "fumes",
-   "fumet",
-   "fundi",
-   "funds",
-   "fundy",
-   "fungo",
-   "fungs",
-   "funks",
-   "fural",
-   "furan",
-   "furca",
-   "furls",
-   "furol",
-   "furrs",
-   "furth",
-   "furze",
-   "furzy",
-   "fused",
-   "fusee",
-   "fusel",
-   "fuses",
-   "fusil",
-   "fusks",
-   "fusts",
-   "fusty",
-   "futon",
-   "fuzed",
-   "fuzee",
-   "fuzes",
-   "fuzil",
-   "fyces",
-   "fyked",
-   "fykes",
-   "fyles",
-   "fyrds",
-   "fytte",
-   "gabba",
-   "gabby",
-   "gable",
-   "gaddi",
-   "gades",
-   "gadge",
-   "gadid",
-   "gadis",
-   "gadje",
-   "gadjo",
-   "gadso",
-   "gaffs",
-   "gaged",
-   "gager",
-   "gages",
-   "gaids",
-   "gains",
-   "gairs",
-   "gaita",
-   "gaits",
-   "gaitt",
-   "gajos",
-   "galah",
-   "galas",
-   "galax",
-   "galea",
-   "galed",
-   "gales",
-   "galls",
-   "gally",
-   "galop",
-   "galut",
-   "galvo",
-   "gamas",
-   "gamay",
-   "gamba",
-   "gambe",
-   "gambo",
-   "gambs",
-   "gamed",
-   "games",
-   "gamey",
-   "gamic",
-   "gamin",
-   "gamme",
-   "gammy",
-   "gamps",
-   "ganch",
-   "gandy",
-   "ganef",
-   "ganev",
-   "gangs",
-   "ganja",
-   "ganof",
-   "gants",
-   "gaols",
-   "gaped",
-   "gaper",
-   "gapes",
-   "gapos",
-   "gappy",
-   "garbe",
-   "garbo",
-   "garbs",
-   "garda",
-   "gares",
-   "garis",
-   "garms",
-   "garni",
-   "garre",
-   "garth",
-   "garum",
-   "gases",
-   "gasps",
-   "gaspy",
-   "gasts",
-   "gatch",
-   "gated",
-   "gater",
-   "gates",
-   "gaths",
-   "gator",
-   "gauch",
-   "gaucy",
-   "gauds",
-   "gauje",
-   "gault",
-   "gaums",
-   "gaumy",
-   "gaups",
-   "gaurs",
-   "gauss",
-   "gauzy",
-   "gavot",
-   "gawcy",
-   "gawds",
-   "gawks",
-   "gawps",
-   "gawsy",
-   "gayal",
-   "gazal",
-   "gazar",
-   "gazed",
-   "gazes",
-   "gazon",
-   "gazoo",
-   "geals",
-   "geans",
-   "geare",
-   "gears",
-   "geats",
-   "gebur",
-   "gecks",
-   "geeks",
-   "geeps",
-   "geest",
-   "geist",
-   "geits",
-   "gelds",
-   "gelee",
-   "gelid",
-   "gelly",
-   "gelts",
-   "gemel",
-   "gemma",
-   "gemmy",
-   "gemot",
-   "genal",
-   "genas",
-   "genes",
-   "genet",
-   "genic",
-   "genii",
-   "genip",
-   "genny",
-   "genoa",
-   "genom",
-   "genro",
-   "gents",
-   "genty",
-   "genua",
-   "genus",
-   "geode",
-   "geoid",
-   "gerah",
-   "gerbe",
-   "geres",
-   "gerle",
-   "germs",
-   "germy",
-   "gerne",
-   "gesse",
-   "gesso",
-   "geste",
-   "gests",
-   "getas",
-   "getup",
-   "geums",
-   "geyan",
-   "geyer",
-   "ghast",
-   "ghats",
-   "ghaut",
-   "ghazi",
-   "ghees",
-   "ghest",
-   "ghyll",
-   "gibed",
-   "gibel",
-   "giber",
-   "gibes",
-   "gibli",
-   "gibus",
-   "gifts",
-   "gigas",
-   "gighe",
-   "gigot",
-   "gigue",
-   "gilas",
-   "gilds",
-   "gilet",
-   "gills",
-   "gilly",
-   "gilpy",
-   "gilts",
-   "gimel",
-   "gimme",
-   "gimps",
-   "gimpy",
-   "ginch",
-   "ginge",
-   "gings",
-   "ginks",
-   "ginny",
-   "ginzo",
-   "gipon",
-   "gippo",
-   "gippy",
-   "girds",
-   "girls",
-   "girns",
-   "giron",
-   "giros",
-   "girrs",
-   "girsh",
-   "girts",
-   "gismo",
-   "gisms",
-   "gists",
-   "gitch",
-   "gites",
-   "giust",
-   "gived",
-   "gives",
-   "gizmo",
-   "glace",
-   "glads",
-   "glady",
-   "glaik",
-   "glair",
-   "glams",
-   "glans",
-   "glary",
-   "glaum",
-   "glaur",
-   "glazy",
-   "gleba",
-   "glebe",
-   "gleby",
-   "glede",
-   "gleds",
-   "gleed",
-   "gleek",
-   "glees",
-   "gleet",
-   "gleis",
-   "glens",
-   "glent",
-   "gleys",
-   "glial",
-   "glias",
-   "glibs",
-   "gliff",
-   "glift",
-   "glike",
-   "glime",
-   "glims",
-   "glisk",
-   "glits",
-   "glitz",
-   "gloam",
-   "globi",
-   "globs",
-   "globy",
-   "glode",
-   "glogg",
-   "gloms",
-   "gloop",
-   "glops",
-   "glost",
-   "glout",
-   "glows",
-   "gloze",
-   "glued",
-   "gluer",
-   "glues",
-   "gluey",
-   "glugs",
-   "glume",
-   "glums",
-   "gluon",
-   "glute",
-   "gluts",
-   "gnarl",
-   "gnarr",
-   "gnars",
-   "gnats",
-   "gnawn",
-   "gnaws",
-   "gnows",
-   "goads",
-   "goafs",
-   "goals",
-   "goary",
-   "goats",
-   "goaty",
-   "goban",
-   "gobar",
-   "gobbi",
-   "gobbo",
-   "gobby",
-   "gobis",
-   "gobos",
-   "godet",
-   "godso",
-   "goels",
-   "goers",
-   "goest",
-   "goeth",
-   "goety",
-   "gofer",
-   "goffs",
-   "gogga",
-   "gogos",
-   "goier",
-   "gojis",
-   "golds",
-   "goldy",
-   "goles",
-   "golfs",
-   "golpe",
-   "golps",
-   "gombo",
-   "gomer",
-   "gompa",
-   "gonch",
-   "gonef",
-   "gongs",
-   "gonia",
-   "gonif",
-   "gonks",
-   "gonna",
-   "gonof",
-   "gonys",
-   "gonzo",
-   "gooby",
-   "goods",
-   "goofs",
-   "googs",
-   "gooky",
-   "goold",
-   "gools",
-   "gooly",
-   "goons",
-   "goony",
-   "goops",
-   "goopy",
-   "goors",
-   "goory",
-   "goosy",
-   "gopak",
-   "gopik",
-   "goral",
-   "goras",
-   "gored",
-   "gores",
-   "goris",
-   "gorms",
-   "gormy",
-   "gorps",
-   "gorse",
-   "gorsy",
-   "gosht",
-   "gosse",
-   "gotch",
-   "goths",
-   "gothy",
-   "gotta",
-   "gouch",
-   "gouks",
-   "goura",
-   "gouts",
-   "gouty",
-   "gowan",
-   "gowds",
-   "gowfs",
-   "gowks",
-   "gowls",
-   "gowns",
-   "goxes",
-   "goyim",
-   "goyle",
-   "graal",
-   "grabs",
-   "grads",
-   "graff",
-   "graip",
-   "grama",
-   "grame",
-   "gramp",
-   "grams",
-   "grana",
-   "grans",
-   "grapy",
-   "gravs",
-   "grays",
-   "grebe",
-   "grebo",
-   "grece",
-   "greek",
-   "grees",
-   "grege",
-   "grego",
-   "grein",
-   "grens",
-   "grese",
-   "greve",
-   "grews",
-   "greys",
-   "grice",
-   "gride",
-   "grids",
-   "griff",
-   "grift",
-   "grigs",
-   "grike",
-   "grins",
-   "griot",
-   "grips",
-   "gript",
-   "gripy",
-   "grise",
-   "grist",
-   "grisy",
-   "grith",
-   "grits",
-   "grize",
-   "groat",
-   "grody",
-   "grogs",
-   "groks",
-   "groma",
-   "grone",
-   "groof",
-   "grosz",
-   "grots",
-   "grouf",
-   "grovy",
-   "grows",
-   "grrls",
-   "grrrl",
-   "grubs",
-   "grued",
-   "grues",
-   "grufe",
-   "grume",
-   "grump",
-   "grund",
-   "gryce",
-   "gryde",
-   "gryke",
-   "grype",
-   "grypt",
-   "guaco",
-   "guana",
-   "guano",
-   "guans",
-   "guars",
-   "gucks",
-   "gucky",
-   "gudes",
-   "guffs",
-   "gugas",
-   "guids",
-   "guimp",
-   "guiro",
-   "gulag",
-   "gular",
-   "gulas",
-   "gules",
-   "gulet",
-   "gulfs",
-   "gulfy",
-   "gulls",
-   "gulph",
-   "gulps",
-   "gulpy",
-   "gumma",
-   "gummi",
-   "gumps",
-   "gundy",
-   "gunge",
-   "gungy",
-   "gunks",
-   "gunky",
-   "gunny",
-   "guqin",
-   "gurdy",
-   "gurge",
-   "gurls",
-   "gurly",
-   "gurns",
-   "gurry",
-   "gursh",
-   "gurus",
-   "gushy",
-   "gusla",
-   "gusle",
-   "gusli",
-   "gussy",
-   "gusts",
-   "gutsy",
-   "gutta",
-   "gutty",
-   "guyed",
-   "guyle",
-   "guyot",
-   "guyse",
-   "gwine",
-   "gyals",
-   "gyans",
-   "gybed",
-   "gybes",
-   "gyeld",
-   "gymps",
-   "gynae",
-   "gynie",
-   "gynny",
-   "gynos",
-   "gyoza",
-   "gypos",
-   "gyppo",
-   "gyppy",
-   "gyral",
-   "gyred",
-   "gyres",
-   "gyron",
-   "gyros",
-   "gyrus",
-   "gytes",
-   "gyved",
-   "gyves",
-   "haafs",
-   "haars",
-   "hable",
-   "habus",
-   "hacek",
-   "hacks",
-   "hadal",
-   "haded",
-   "hades",
-   "hadji",
-   "hadst",
-   "haems",
-   "haets",
-   "haffs",
-   "hafiz",
-   "hafts",
-   "haggs",
-   "hahas",
-   "haick",
-   "haika",
-   "haiks",
-   "haiku",
-   "hails",
-   "haily",
-   "hains",
-   "haint",
-   "hairs",
-   "haith",
-   "hajes",
-   "hajis",
-   "hajji",
-   "hakam",
-   "hakas",
-   "hakea",
-   "hakes",
-   "hakim",
-   "hakus",
-   "halal",
-   "haled",
-   "haler",
-   "hales",
-   "halfa",
-   "halfs",
-   "halid",
-   "hallo",
-   "halls",
-   "halma",
-   "halms",
-   "halon",
-   "halos",
-   "halse",
-   "halts",
-   "halva",
-   "halwa",
-   "hamal",
-   "hamba",
-   "hamed",
-   "hames",
-   "hammy",
-   "hamza",
-   "hanap",
-   "hance",
-   "hanch",
-   "hands",
-   "hangi",
-   "hangs",
-   "hanks",
-   "hanky",
-   "hansa",
-   "hanse",
-   "hants",
-   "haole",
-   "haoma",
-   "hapax",
-   "haply",
-   "happi",
-   "hapus",
-   "haram",
-   "hards",
-   "hared",
-   "hares",
-   "harim",
-   "harks",
-   "harls",
-   "harms",
-   "harns",
-   "haros",
-   "harps",
-   "harts",
-   "hashy",
-   "hasks",
-   "hasps",
-   "hasta",
-   "hated",
-   "hates",
-   "hatha",
-   "hauds",
-   "haufs",
-   "haugh",
-   "hauld",
-   "haulm",
-   "hauls",
-   "hault",
-   "hauns",
-   "hause",
-   "haver",
-   "haves",
-   "hawed",
-   "hawks",
-   "hawms",
-   "hawse",
-   "hayed",
-   "hayer",
-   "hayey",
-   "hayle",
-   "hazan",
-   "hazed",
-   "hazer",
-   "hazes",
-   "heads",
-   "heald",
-   "heals",
-   "heame",
-   "heaps",
-   "heapy",
-   "heare",
-   "hears",
-   "heast",
-   "heats",
-   "heben",
-   "hebes",
-   "hecht",
-   "hecks",
-   "heder",
-   "hedgy",
-   "heeds",
-   "heedy",
-   "heels",
-   "heeze",
-   "hefte",
-   "hefts",
-   "heids",
-   "heigh",
-   "heils",
-   "heirs",
-   "hejab",
-   "hejra",
-   "heled",
-   "heles",
-   "helio",
-   "hells",
-   "helms",
-   "helos",
-   "helot",
-   "helps",
-   "helve",
-   "hemal",
-   "hemes",
-   "hemic",
-   "hemin",
-   "hemps",
-   "hempy",
-   "hench",
-   "hends",
-   "henge",
-   "henna",
-   "henny",
-   "henry",
-   "hents",
-   "hepar",
-   "herbs",
-   "herby",
-   "herds",
-   "heres",
-   "herls",
-   "herma",
-   "herms",
-   "herns",
-   "heros",
-   "herry",
-   "herse",
-   "hertz",
-   "herye",
-   "hesps",
-   "hests",
-   "hetes",
-   "heths",
-   "heuch",
-   "heugh",
-   "hevea",
-   "hewed",
-   "hewer",
-   "hewgh",
-   "hexad",
-   "hexed",
-   "hexer",
-   "hexes",
-   "hexyl",
-   "heyed",
-   "hiant",
-   "hicks",
-   "hided",
-   "hider",
-   "hides",
-   "hiems",
-   "highs",
-   "hight",
-   "hijab",
-   "hijra",
-   "hiked",
-   "hiker",
-   "hikes",
-   "hikoi",
-   "hilar",
-   "hilch",
-   "hillo",
-   "hills",
-   "hilts",
-   "hilum",
-   "hilus",
-   "himbo",
-   "hinau",
-   "hinds",
-   "hings",
-   "hinky",
-   "hinny",
-   "hints",
-   "hiois",
-   "hiply",
-   "hired",
-   "hiree",
-   "hirer",
-   "hires",
-   "hissy",
-   "hists",
-   "hithe",
-   "hived",
-   "hiver",
-   "hives",
-   "hizen",
-   "hoaed",
-   "hoagy",
-   "hoars",
-   "hoary",
-   "hoast",
-   "hobos",
-   "hocks",
-   "hocus",
-   "hodad",
-   "hodja",
-   "hoers",
-   "hogan",
-   "hogen",
-   "hoggs",
-   "hoghs",
-   "hohed",
-   "hoick",
-   "hoied",
-   "hoiks",
-   "hoing",
-   "hoise",
-   "hokas",
-   "hoked",
-   "hokes",
-   "hokey",
-   "hokis",
-   "hokku",
-   "hokum",
-   "holds",
-   "holed",
-   "holes",
-   "holey",
-   "holks",
-   "holla",
-   "hollo",
-   "holme",
-   "holms",
-   "holon",
-   "holos",
-   "holts",
-   "homas",
-   "homed",
-   "homes",
-   "homey",
-   "homie",
-   "homme",
-   "honan",
-   "honda",
-   "honds",
-   "honed",
-   "honer",
-   "hones",
-   "hongi",
-   "hongs",
-   "honks",
-   "honky",
-   "hooch",
-   "hoods",
-   "hoody",
-   "hooey",
-   "hoofs",
-   "hooka",
-   "hooks",
-   "hooky",
-   "hooly",
-   "hoons",
-   "hoops",
-   "hoord",
-   "hoors",
-   "hoosh",
-   "hoots",
-   "hooty",
-   "hoove",
-   "hopak",
-   "hoped",
-   "hoper",
-   "hopes",
-   "hoppy",
-   "horah",
-   "horal",
-   "horas",
-   "horis",
-   "horks",
-   "horme",
-   "horns",
-   "horst",
-   "horsy",
-   "hosed",
-   "hosel",
-   "hosen",
-   "hoser",
-   "hoses",
-   "hosey",
-   "hosta",
-   "hosts",
-   "hotch",
-   "hoten",
-   "hotty",
-   "houff",
-   "houfs",
-   "hough",
-   "houri",
-   "hours",
-   "houts",
-   "hovea",
-   "hoved",
-   "hoven",
-   "hoves",
-   "howbe",
-   "howes",
-   "howff",
-   "howfs",
-   "howks",
-   "howls",
-   "howre",
-   "howso",
-   "hoxed",
-   "hoxes",
-   "hoyas",
-   "hoyed",
-   "hoyle",
-   "hubby",
-   "hucks",
-   "hudna",
-   "hudud",
-   "huers",
-   "huffs",
-   "huffy",
-   "huger",
-   "huggy",
-   "huhus",
-   "huias",
-   "hulas",
-   "hules",
-   "hulks",
-   "hulky",
-   "hullo",
-   "hulls",
-   "hully",
-   "humas",
-   "humfs",
-   "humic",
-   "humps",
-   "humpy",
-   "hunks",
-   "hunts",
-   "hurds",
-   "hurls",
-   "hurly",
-   "hurra",
-   "hurst",
-   "hurts",
-   "hushy",
-   "husks",
-   "husos",
-   "hutia",
-   "huzza",
-   "huzzy",
-   "hwyls",
-   "hydra",
-   "hyens",
-   "hygge",
-   "hying",
-   "hykes",
-   "hylas",
-   "hyleg",
-   "hyles",
-   "hylic",
-   "hymns",
-   "hynde",
-   "hyoid",
-   "hyped",
-   "hypes",
-   "hypha",
-   "hyphy",
-   "hypos",
-   "hyrax",
-   "hyson",
-   "hythe",
-   "iambi",
-   "iambs",
-   "ibrik",
-   "icers",
-   "iched",
-   "iches",
-   "ichor",
-   "icier",
-   "icker",
-   "ickle",
-   "icons",
-   "ictal",
-   "ictic",
-   "ictus",
-   "idant",
-   "ideas",
-   "idees",
-   "ident",
-   "idled",
-   "idles",
-   "idola",
-   "idols",
-   "idyls",
-   "iftar",
-   "igapo",
-   "igged",
-   "iglus",
-   "ihram",
-   "ikans",
-   "ikats",
-   "ikons",
-   "ileac",
-   "ileal",
-   "ileum",
-   "ileus",
-   "iliad",
-   "ilial",
-   "ilium",
-   "iller",
-   "illth",
-   "imago",
-   "imams",
-   "imari",
-   "imaum",
-   "imbar",
-   "imbed",
-   "imide",
-   "imido",
-   "imids",
-   "imine",
-   "imino",
-   "immew",
-   "immit",
-   "immix",
-   "imped",
-   "impis",
-   "impot",
-   "impro",
-   "imshi",
-   "imshy",
-   "inapt",
-   "inarm",
-   "inbye",
-   "incel",
-   "incle",
-   "incog",
-   "incus",
-   "incut",
-   "indew",
-   "india",
-   "indie",
-   "indol",
-   "indow",
-   "indri",
-   "indue",
-   "inerm",
-   "infix",
-   "infos",
-   "infra",
-   "ingan",
-   "ingle",
-   "inion",
-   "inked",
-   "inker",
-   "inkle",
-   "inned",
-   "innit",
-   "inorb",
-   "inrun",
-   "inset",
-   "inspo",
-   "intel",
-   "intil",
-   "intis",
-   "intra",
-   "inula",
-   "inure",
-   "inurn",
-   "inust",
-   "invar",
-   "inwit",
-   "iodic",
-   "iodid",
-   "iodin",
-   "iotas",
-   "ippon",
-   "irade",
-   "irids",
-   "iring",
-   "irked",
-   "iroko",
-   "irone",
-   "irons",
-   "isbas",
-   "ishes",
-   "isled",
-   "isles",
-   "isnae",
-   "issei",
-   "istle",
-   "items",
-   "ither",
-   "ivied",
-   "ivies",
-   "ixias",
-   "ixnay",
-   "ixora",
-   "ixtle",
-   "izard",
-   "izars",
-   "izzat",
-   "jaaps",
-   "jabot",
-   "jacal",
-   "jacks",
-   "jacky",
-   "jaded",
-   "jades",
-   "jafas",
-   "jaffa",
-   "jagas",
-   "jager",
-   "jaggs",
-   "jaggy",
-   "jagir",
-   "jagra",
-   "jails",
-   "jaker",
-   "jakes",
-   "jakey",
-   "jalap",
-   "jalop",
-   "jambe",
-   "jambo",
-   "jambs",
-   "jambu",
-   "james",
-   "jammy",
-   "jamon",
-   "janes",
-   "janns",
-   "janny",
-   "janty",
-   "japan",
-   "japed",
-   "japer",
-   "japes",
-   "jarks",
-   "jarls",
-   "jarps",
-   "jarta",
-   "jarul",
-   "jasey",
-   "jaspe",
-   "jasps",
-   "jatos",
-   "jauks",
-   "jaups",
-   "javas",
-   "javel",
-   "jawan",
-   "jawed",
-   "jaxie",
-   "jeans",
-   "jeats",
-   "jebel",
-   "jedis",
-   "jeels",
-   "jeely",
-   "jeeps",
-   "jeers",
-   "jeeze",
-   "jefes",
-   "jeffs",
-   "jehad",
-   "jehus",
-   "jelab",
-   "jello",
-   "jells",
-   "jembe",
-   "jemmy",
-   "jenny",
-   "jeons",
-   "jerid",
-   "jerks",
-   "jerry",
-   "jesse",
-   "jests",
-   "jesus",
-   "jetes",
-   "jeton",
-   "jeune",
-   "jewed",
-   "jewie",
-   "jhala",
-   "jiaos",
-   "jibba",
-   "jibbs",
-   "jibed",
-   "jiber",
-   "jibes",
-   "jiffs",
-   "jiggy",
-   "jigot",
-   "jihad",
-   "jills",
-   "jilts",
-   "jimmy",
-   "jimpy",
-   "jingo",
-   "jinks",
-   "jinne",
-   "jinni",
-   "jinns",
-   "jirds",
-   "jirga",
-   "jirre",
-   "jisms",
-   "jived",
-   "jiver",
-   "jives",
-   "jivey",
-   "jnana",
-   "jobed",
-   "jobes",
-   "jocko",
-   "jocks",
-   "jocky",
-   "jocos",
-   "jodel",
-   "joeys",
-   "johns",
-   "joins",
-   "joked",
-   "jokes",
-   "jokey",
-   "jokol",
-   "joled",
-   "joles",
-   "jolls",
-   "jolts",
-   "jolty",
-   "jomon",
-   "jomos",
-   "jones",
-   "jongs",
-   "jonty",
-   "jooks",
-   "joram",
-   "jorum",
-   "jotas",
-   "jotty",
-   "jotun",
-   "joual",
-   "jougs",
-   "jouks",
-   "joule",
-   "jours",
-   "jowar",
-   "jowed",
-   "jowls",
-   "jowly",
-   "joyed",
-   "jubas",
-   "jubes",
-   "jucos",
-   "judas",
-   "judgy",
-   "judos",
-   "jugal",
-   "jugum",
-   "jujus",
-   "juked",
-   "jukes",
-   "jukus",
-   "julep",
-   "jumar",
-   "jumby",
-   "jumps",
-   "junco",
-   "junks",
-   "junky",
-   "jupes",
-   "jupon",
-   "jural",
-   "jurat",
-   "jurel",
-   "jures",
-   "justs",
-   "jutes",
-   "jutty",
-   "juves",
-   "juvie",
-   "kaama",
-   "kabab",
-   "kabar",
-   "kabob",
-   "kacha",
-   "kacks",
-   "kadai",
-   "kades",
-   "kadis",
-   "kafir",
-   "kagos",
-   "kagus",
-   "kahal",
-   "kaiak",
-   "kaids",
-   "kaies",
-   "kaifs",
-   "kaika",
-   "kaiks",
-   "kails",
-   "kaims",
-   "kaing",
-   "kains",
-   "kakas",
-   "kakis",
-   "kalam",
-   "kales",
-   "kalif",
-   "kalis",
-   "kalpa",
-   "kamas",
-   "kames",
-   "kamik",
-   "kamis",
-   "kamme",
-   "kanae",
-   "kanas",
-   "kandy",
-   "kaneh",
-   "kanes",
-   "kanga",
-   "kangs",
-   "kanji",
-   "kants",
-   "kanzu",
-   "kaons",
-   "kapas",
-   "kaphs",
-   "kapok",
-   "kapow",
-   "kapus",
-   "kaput",
-   "karas",
-   "karat",
-   "karks",
-   "karns",
-   "karoo",
-   "karos",
-   "karri",
-   "karst",
-   "karsy",
-   "karts",
-   "karzy",
-   "kasha",
-   "kasme",
-   "katal",
-   "katas",
-   "katis",
-   "katti",
-   "kaugh",
-   "kauri",
-   "kauru",
-   "kaury",
-   "kaval",
-   "kavas",
-   "kawas",
-   "kawau",
-   "kawed",
-   "kayle",
-   "kayos",
-   "kazis",
-   "kazoo",
-   "kbars",
-   "kebar",
-   "kebob",
-   "kecks",
-   "kedge",
-   "kedgy",
-   "keech",
-   "keefs",
-   "keeks",
-   "keels",
-   "keema",
-   "keeno",
-   "keens",
-   "keeps",
-   "keets",
-   "keeve",
-   "kefir",
-   "kehua",
-   "keirs",
-   "kelep",
-   "kelim",
-   "kells",
-   "kelly",
-   "kelps",
-   "kelpy",
-   "kelts",
-   "kelty",
-   "kembo",
-   "kembs",
-   "kemps",
-   "kempt",
-   "kempy",
-   "kenaf",
-   "kench",
-   "kendo",
-   "kenos",
-   "kente",
-   "kents",
-   "kepis",
-   "kerbs",
-   "kerel",
-   "kerfs",
-   "kerky",
-   "kerma",
-   "kerne",
-   "kerns",
-   "keros",
-   "kerry",
-   "kerve",
-   "kesar",
-   "kests",
-   "ketas",
-   "ketch",
-   "ketes",
-   "ketol",
-   "kevel",
-   "kevil",
-   "kexes",
-   "keyed",
-   "keyer",
-   "khadi",
-   "khafs",
-   "khans",
-   "khaph",
-   "khats",
-   "khaya",
-   "khazi",
-   "kheda",
-   "kheth",
-   "khets",
-   "khoja",
-   "khors",
-   "khoum",
-   "khuds",
-   "kiaat",
-   "kiack",
-   "kiang",
-   "kibbe",
-   "kibbi",
-   "kibei",
-   "kibes",
-   "kibla",
-   "kicks",
-   "kicky",
-   "kiddo",
-   "kiddy",
-   "kidel",
-   "kidge",
-   "kiefs",
-   "kiers",
-   "kieve",
-   "kievs",
-   "kight",
-   "kikoi",
-   "kiley",
-   "kilim",
-   "kills",
-   "kilns",
-   "kilos",
-   "kilps",
-   "kilts",
-   "kilty",
-   "kimbo",
-   "kinas",
-   "kinda",
-   "kinds",
-   "kindy",
-   "kines",
-   "kings",
-   "kinin",
-   "kinks",
-   "kinos",
-   "kiore",
-   "kipes",
-   "kippa",
-   "kipps",
-   "kirby",
-   "kirks",
-   "kirns",
-   "kirri",
-   "kisan",
-   "kissy",
-   "kists",
-   "kited",
-   "kiter",
-   "kites",
-   "kithe",
-   "kiths",
-   "kitul",
-   "kivas",
-   "kiwis",
-   "klang",
-   "klaps",
-   "klett",
-   "klick",
-   "klieg",
-   "kliks",
-   "klong",
-   "kloof",
-   "kluge",
-   "klutz",
-   "knags",
-   "knaps",
-   "knarl",
-   "knars",
-   "knaur",
-   "knawe",
-   "knees",
-   "knell",
-   "knish",
-   "knits",
-   "knive",
-   "knobs",
-   "knops",
-   "knosp",
-   "knots",
-   "knout",
-   "knowe",
-   "knows",
-   "knubs",
-   "knurl",
-   "knurr",
-   "knurs",
-   "knuts",
-   "koans",
-   "koaps",
-   "koban",
-   "kobos",
-   "koels",
-   "koffs",
-   "kofta",
-   "kogal",
-   "kohas",
-   "kohen",
-   "kohls",
-   "koine",
-   "kojis",
-   "kokam",
-   "kokas",
-   "koker",
-   "kokra",
-   "kokum",
-   "kolas",
-   "kolos",
-   "kombu",
-   "konbu",
-   "kondo",
-   "konks",
-   "kooks",
-   "kooky",
-   "koori",
-   "kopek",
-   "kophs",
-   "kopje",
-   "koppa",
-   "korai",
-   "koras",
-   "korat",
-   "kores",
-   "korma",
-   "koros",
-   "korun",
-   "korus",
-   "koses",
-   "kotch",
-   "kotos",
-   "kotow",
-   "koura",
-   "kraal",
-   "krabs",
-   "kraft",
-   "krais",
-   "krait",
-   "krang",
-   "krans",
-   "kranz",
-   "kraut",
-   "krays",
-   "kreep",
-   "kreng",
-   "krewe",
-   "krona",
-   "krone",
-   "kroon",
-   "krubi",
-   "krunk",
-   "ksars",
-   "kubie",
-   "kudos",
-   "kudus",
-   "kudzu",
-   "kufis",
-   "kugel",
-   "kuias",
-   "kukri",
-   "kukus",
-   "kulak",
-   "kulan",
-   "kulas",
-   "kulfi",
-   "kumis",
-   "kumys",
-   "kuris",
-   "kurre",
-   "kurta",
-   "kurus",
-   "kusso",
-   "kutas",
-   "kutch",
-   "kutis",
-   "kutus",
-   "kuzus",
-   "kvass",
-   "kvell",
-   "kwela",
-   "kyack",
-   "kyaks",
-   "kyang",
-   "kyars",
-   "kyats",
-   "kybos",
-   "kydst",
-   "kyles",
-   "kylie",
-   "kylin",
-   "kylix",
-   "kyloe",
-   "kynde",
-   "kynds",
-   "kypes",
-   "kyrie",
-   "kytes",
-   "kythe",
-   "laari",
-   "labda",
-   "labia",
-   "labis",
-   "labra",
-   "laced",
-   "lacer",
-   "laces",
-   "lacet",
-   "lacey",
-   "lacks",
-   "laddy",
-   "laded",
-   "lader",
-   "lades",
-   "laers",
-   "laevo",
-   "lagan",
-   "lahal",
-   "lahar",
-   "laich",
-   "laics",
-   "laids",
-   "laigh",
-   "laika",
-   "laiks",
-   "laird",
-   "lairs",
-   "lairy",
-   "laith",
-   "laity",
-   "laked",
-   "laker",
-   "lakes",
-   "lakhs",
-   "lakin",
-   "laksa",
-   "laldy",
-   "lalls",
-   "lamas",
-   "lambs",
-   "lamby",
-   "lamed",
-   "lamer",
-   "lames",
-   "lamia",
-   "lammy",
-   "lamps",
-   "lanai",
-   "lanas",
-   "lanch",
-   "lande",
-   "lands",
-   "lanes",
-   "lanks",
-   "lants",
-   "lapin",
-   "lapis",
-   "lapje",
-   "larch",
-   "lards",
-   "lardy",
-   "laree",
-   "lares",
-   "largo",
-   "laris",
-   "larks",
-   "larky",
-   "larns",
-   "larnt",
-   "larum",
-   "lased",
-   "laser",
-   "lases",
-   "lassi",
-   "lassu",
-   "lassy",
-   "lasts",
-   "latah",
-   "lated",
-   "laten",
-   "latex",
-   "lathi",
-   "laths",
-   "lathy",
-   "latke",
-   "latus",
-   "lauan",
-   "lauch",
-   "lauds",
-   "laufs",
-   "laund",
-   "laura",
-   "laval",
-   "lavas",
-   "laved",
-   "laver",
-   "laves",
-   "lavra",
-   "lavvy",
-   "lawed",
-   "lawer",
-   "lawin",
-   "lawks",
-   "lawns",
-   "lawny",
-   "laxed",
-   "laxer",
-   "laxes",
-   "laxly",
-   "layed",
-   "layin",
-   "layup",
-   "lazar",
-   "lazed",
-   "lazes",
-   "lazos",
-   "lazzi",
-   "lazzo",
-   "leads",
-   "leady",
-   "leafs",
-   "leaks",
-   "leams",
-   "leans",
-   "leany",
-   "leaps",
-   "leare",
-   "lears",
-   "leary",
-   "leats",
-   "leavy",
-   "leaze",
-   "leben",
-   "leccy",
-   "ledes",
-   "ledgy",
-   "ledum",
-   "leear",
-   "leeks",
-   "leeps",
-   "leers",
-   "leese",
-   "leets",
-   "leeze",
-   "lefte",
-   "lefts",
-   "leger",
-   "leges",
-   "legge",
-   "leggo",
-   "legit",
-   "lehrs",
-   "lehua",
-   "leirs",
-   "leish",
-   "leman",
-   "lemed",
-   "lemel",
-   "lemes",
-   "lemma",
-   "lemme",
-   "lends",
-   "lenes",
-   "lengs",
-   "lenis",
-   "lenos",
-   "lense",
-   "lenti",
-   "lento",
-   "leone",
-   "lepid",
-   "lepra",
-   "lepta",
-   "lered",
-   "leres",
-   "lerps",
-   "leses",
-   "lests",
-   "letch",
-   "lethe",
-   "letup",
-   "leuch",
-   "leuco",
-   "leuds",
-   "leugh",
-   "levas",
-   "levee",
-   "leves",
-   "levin",
-   "levis",
-   "lewis",
-   "lexes",
-   "lexis",
-   "lezes",
-   "lezza",
-   "lezzy",
-   "liana",
-   "liane",
-   "liang",
-   "liard",
-   "liars",
-   "liart",
-   "liber",
-   "libra",
-   "libri",
-   "lichi",
-   "licht",
-   "licit",
-   "licks",
-   "lidar",
-   "lidos",
-   "liefs",
-   "liens",
-   "liers",
-   "lieus",
-   "lieve",
-   "lifer",
-   "lifes",
-   "lifts",
-   "ligan",
-   "liger",
-   "ligge",
-   "ligne",
-   "liked",
-   "liker",
-   "likes",
-   "likin",
-   "lills",
-   "lilos",
-   "lilts",
-   "liman",
-   "limas",
-   "limax",
-   "limba",
-   "limbi",
-   "limbs",
-   "limby",
-   "limed",
-   "limen",
-   "limes",
-   "limey",
-   "limma",
-   "limns",
-   "limos",
-   "limpa",
-   "limps",
-   "linac",
-   "linch",
-   "linds",
-   "lindy",
-   "lined",
-   "lines",
-   "liney",
-   "linga",
-   "lings",
-   "lingy",
-   "linin",
-   "links",
-   "linky",
-   "linns",
-   "linny",
-   "linos",
-   "lints",
-   "linty",
-   "linum",
-   "linux",
-   "lions",
-   "lipas",
-   "lipes",
-   "lipin",
-   "lipos",
-   "lippy",
-   "liras",
-   "lirks",
-   "lirot",
-   "lisks",
-   "lisle",
-   "lisps",
-   "lists",
-   "litai",
-   "litas",
-   "lited",
-   "liter",
-   "lites",
-   "litho",
-   "liths",
-   "litre",
-   "lived",
-   "liven",
-   "lives",
-   "livor",
-   "livre",
-   "llano",
-   "loach",
-   "loads",
-   "loafs",
-   "loams",
-   "loans",
-   "loast",
-   "loave",
-   "lobar",
-   "lobed",
-   "lobes",
-   "lobos",
-   "lobus",
-   "loche",
-   "lochs",
-   "locie",
-   "locis",
-   "locks",
-   "locos",
-   "locum",
-   "loden",
-   "lodes",
-   "loess",
-   "lofts",
-   "logan",
-   "loges",
-   "loggy",
-   "logia",
-   "logie",
-   "logoi",
-   "logon",
-   "logos",
-   "lohan",
-   "loids",
-   "loins",
-   "loipe",
-   "loirs",
-   "lokes",
-   "lolls",
-   "lolly",
-   "lolog",
-   "lomas",
-   "lomed",
-   "lomes",
-   "loner",
-   "longa",
-   "longe",
-   "longs",
-   "looby",
-   "looed",
-   "looey",
-   "loofa",
-   "loofs",
-   "looie",
-   "looks",
-   "looky",
-   "looms",
-   "loons",
-   "loony",
-   "loops",
-   "loord",
-   "loots",
-   "loped",
-   "loper",
-   "lopes",
-   "loppy",
-   "loral",
-   "loran",
-   "lords",
-   "lordy",
-   "lorel",
-   "lores",
-   "loric",
-   "loris",
-   "losed",
-   "losel",
-   "losen",
-   "loses",
-   "lossy",
-   "lotah",
-   "lotas",
-   "lotes",
-   "lotic",
-   "lotos",
-   "lotsa",
-   "lotta",
-   "lotte",
-   "lotto",
-   "lotus",
-   "loued",
-   "lough",
-   "louie",
-   "louis",
-   "louma",
-   "lound",
-   "louns",
-   "loupe",
-   "loups",
-   "loure",
-   "lours",
-   "loury",
-   "louts",
-   "lovat",
-   "loved",
-   "loves",
-   "lovey",
-   "lovie",
-   "lowan",
-   "lowed",
-   "lowes",
-   "lownd",
-   "lowne",
-   "lowns",
-   "lowps",
-   "lowry",
-   "lowse",
-   "lowts",
-   "loxed",
-   "loxes",
-   "lozen",
-   "luach",
-   "luaus",
-   "lubed",
-   "lubes",
-   "lubra",
-   "luces",
-   "lucks",
-   "lucre",
-   "ludes",
-   "ludic",
-   "ludos",
-   "luffa",
-   "luffs",
-   "luged",
-   "luger",
-   "luges",
-   "lulls",
-   "lulus",
-   "lumas",
-   "lumbi",
-   "lumme",
-   "lummy",
-   "lumps",
-   "lunas",
-   "lunes",
-   "lunet",
-   "lungi",
-   "lungs",
-   "lunks",
-   "lunts",
-   "lupin",
-   "lured",
-   "lurer",
-   "lures",
-   "lurex",
-   "lurgi",
-   "lurgy",
-   "lurks",
-   "lurry",
-   "lurve",
-   "luser",
-   "lushy",
-   "lusks",
-   "lusts",
-   "lusus",
-   "lutea",
-   "luted",
-   "luter",
-   "lutes",
-   "luvvy",
-   "luxed",
-   "luxer",
-   "luxes",
-   "lweis",
-   "lyams",
-   "lyard",
-   "lyart",
-   "lyase",
-   "lycea",
-   "lycee",
-   "lycra",
-   "lymes",
-   "lynes",
-   "lyres",
-   "lysed",
-   "lyses",
-   "lysin",
-   "lysis",
-   "lysol",
-   "lyssa",
-   "lyted",
-   "lytes",
-   "lythe",
-   "lytic",
-   "lytta",
-   "maaed",
-   "maare",
-   "maars",
-   "mabes",
-   "macas",
-   "maced",
-   "macer",
-   "maces",
-   "mache",
-   "machi",
-   "machs",
-   "macks",
-   "macle",
-   "macon",
-   "madge",
-   "madid",
-   "madre",
-   "maerl",
-   "mafic",
-   "mages",
-   "maggs",
-   "magot",
-   "magus",
-   "mahoe",
-   "mahua",
-   "mahwa",
-   "maids",
-   "maiko",
-   "maiks",
-   "maile",
-   "maill",
-   "mails",
-   "maims",
-   "mains",
-   "maire",
-   "mairs",
-   "maise",
-   "maist",
-   "makar",
-   "makes",
-   "makis",
-   "makos",
-   "malam",
-   "malar",
-   "malas",
-   "malax",
-   "males",
-   "malic",
-   "malik",
-   "malis",
-   "malls",
-   "malms",
-   "malmy",
-   "malts",
-   "malty",
-   "malus",
-   "malva",
-   "malwa",
-   "mamas",
-   "mamba",
-   "mamee",
-   "mamey",
-   "mamie",
-   "manas",
-   "manat",
-   "mandi",
-   "maneb",
-   "maned",
-   "maneh",
-   "manes",
-   "manet",
-   "mangs",
-   "manis",
-   "manky",
-   "manna",
-   "manos",
-   "manse",
-   "manta",
-   "manto",
-   "manty",
-   "manul",
-   "manus",
-   "mapau",
-   "maqui",
-   "marae",
-   "marah",
-   "maras",
-   "marcs",
-   "mardy",
-   "mares",
-   "marge",
-   "margs",
-   "maria",
-   "marid",
-   "marka",
-   "marks",
-   "marle",
-   "marls",
-   "marly",
-   "marms",
-   "maron",
-   "maror",
-   "marra",
-   "marri",
-   "marse",
-   "marts",
-   "marvy",
-   "masas",
-   "mased",
-   "maser",
-   "mases",
-   "mashy",
-   "masks",
-   "massa",
-   "massy",
-   "masts",
-   "masty",
-   "masus",
-   "matai",
-   "mated",
-   "mater",
-   "mates",
-   "maths",
-   "matin",
-   "matlo",
-   "matte",
-   "matts",
-   "matza",
-   "matzo",
-   "mauby",
-   "mauds",
-   "mauls",
-   "maund",
-   "mauri",
-   "mausy",
-   "mauts",
-   "mauzy",
-   "maven",
-   "mavie",
-   "mavin",
-   "mavis",
-   "mawed",
-   "mawks",
-   "mawky",
-   "mawns",
-   "mawrs",
-   "maxed",
-   "maxes",
-   "maxis",
-   "mayan",
-   "mayas",
-   "mayed",
-   "mayos",
-   "mayst",
-   "mazed",
-   "mazer",
-   "mazes",
-   "mazey",
-   "mazut",
-   "mbira",
-   "meads",
-   "meals",
-   "meane",
-   "means",
-   "meany",
-   "meare",
-   "mease",
-   "meath",
-   "meats",
-   "mebos",
-   "mechs",
-   "mecks",
-   "medii",
-   "medle",
-   "meeds",
-   "meers",
-   "meets",
-   "meffs",
-   "meins",
-   "meint",
-   "meiny",
-   "meith",
-   "mekka",
-   "melas",
-   "melba",
-   "melds",
-   "melic",
-   "melik",
-   "mells",
-   "melts",
-   "melty",
-   "memes",
-   "memos",
-   "menad",
-   "mends",
-   "mened",
-   "menes",
-   "menge",
-   "mengs",
-   "mensa",
-   "mense",
-   "mensh",
-   "menta",
-   "mento",
-   "menus",
-   "meous",
-   "meows",
-   "merch",
-   "mercs",
-   "merde",
-   "mered",
-   "merel",
-   "merer",
-   "meres",
-   "meril",
-   "meris",
-   "merks",
-   "merle",
-   "merls",
-   "merse",
-   "mesal",
-   "mesas",
-   "mesel",
-   "meses",
-   "meshy",
-   "mesic",
-   "mesne",
-   "meson",
-   "messy",
-   "mesto",
-   "meted",
-   "metes",
-   "metho",
-   "meths",
-   "metic",
-   "metif",
-   "metis",
-   "metol",
-   "metre",
-   "meuse",
-   "meved",
-   "meves",
-   "mewed",
-   "mewls",
-   "meynt",
-   "mezes",
-   "mezze",
-   "mezzo",
-   "mhorr",
-   "miaou",
-   "miaow",
-   "miasm",
-   "miaul",
-   "micas",
-   "miche",
-   "micht",
-   "micks",
-   "micky",
-   "micos",
-   "micra",
-   "middy",
-   "midgy",
-   "midis",
-   "miens",
-   "mieve",
-   "miffs",
-   "miffy",
-   "mifty",
-   "miggs",
-   "mihas",
-   "mihis",
-   "miked",
-   "mikes",
-   "mikra",
-   "mikva",
-   "milch",
-   "milds",
-   "miler",
-   "miles",
-   "milfs",
-   "milia",
-   "milko",
-   "milks",
-   "mille",
-   "mills",
-   "milor",
-   "milos",
-   "milpa",
-   "milts",
-   "milty",
-   "miltz",
-   "mimed",
-   "mimeo",
-   "mimer",
-   "mimes",
-   "mimsy",
-   "minae",
-   "minar",
-   "minas",
-   "mincy",
-   "minds",
-   "mined",
-   "mines",
-   "minge",
-   "mings",
-   "mingy",
-   "minis",
-   "minke",
-   "minks",
-   "minny",
-   "minos",
-   "mints",
-   "mired",
-   "mires",
-   "mirex",
-   "mirid",
-   "mirin",
-   "mirks",
-   "mirky",
-   "mirly",
-   "miros",
-   "mirvs",
-   "mirza",
-   "misch",
-   "misdo",
-   "mises",
-   "misgo",
-   "misos",
-   "missa",
-   "mists",
-   "misty",
-   "mitch",
-   "miter",
-   "mites",
-   "mitis",
-   "mitre",
-   "mitts",
-   "mixed",
-   "mixen",
-   "mixer",
-   "mixes",
-   "mixte",
-   "mixup",
-   "mizen",
-   "mizzy",
-   "mneme",
-   "moans",
-   "moats",
-   "mobby",
-   "mobes",
-   "mobey",
-   "mobie",
-   "moble",
-   "mochi",
-   "mochs",
-   "mochy",
-   "mocks",
-   "moder",
-   "modes",
-   "modge",
-   "modii",
-   "modus",
-   "moers",
-   "mofos",
-   "moggy",
-   "mohel",
-   "mohos",
-   "mohrs",
-   "mohua",
-   "mohur",
-   "moile",
-   "moils",
-   "moira",
-   "moire",
-   "moits",
-   "mojos",
-   "mokes",
-   "mokis",
-   "mokos",
-   "molal",
-   "molas",
-   "molds",
-   "moled",
-   "moles",
-   "molla",
-   "molls",
-   "molly",
-   "molto",
-   "molts",
-   "molys",
-   "momes",
-   "momma",
-   "mommy",
-   "momus",
-   "monad",
-   "monal",
-   "monas",
-   "monde",
-   "mondo",
-   "moner",
-   "mongo",
-   "mongs",
-   "monic",
-   "monie",
-   "monks",
-   "monos",
-   "monte",
-   "monty",
-   "moobs",
-   "mooch",
-   "moods",
-   "mooed",
-   "mooks",
-   "moola",
-   "mooli",
-   "mools",
-   "mooly",
-   "moong",
-   "moons",
-   "moony",
-   "moops",
-   "moors",
-   "moory",
-   "moots",
-   "moove",
-   "moped",
-   "moper",
-   "mopes",
-   "mopey",
-   "moppy",
-   "mopsy",
-   "mopus",
-   "morae",
-   "moras",
-   "morat",
-   "moray",
-   "morel",
-   "mores",
-   "moria",
-   "morne",
-   "morns",
-   "morra",
-   "morro",
-   "morse",
-   "morts",
-   "mosed",
-   "moses",
-   "mosey",
-   "mosks",
-   "mosso",
-   "moste",
-   "mosts",
-   "moted",
-   "moten",
-   "motes",
-   "motet",
-   "motey",
-   "moths",
-   "mothy",
-   "motis",
-   "motte",
-   "motts",
-   "motty",
-   "motus",
-   "motza",
-   "mouch",
-   "moues",
-   "mould",
-   "mouls",
-   "moups",
-   "moust",
-   "mousy",
-   "moved",
-   "moves",
-   "mowas",
-   "mowed",
-   "mowra",
-   "moxas",
-   "moxie",
-   "moyas",
-   "moyle",
-   "moyls",
-   "mozed",
-   "mozes",
-   "mozos",
-   "mpret",
-   "mucho",
-   "mucic",
-   "mucid",
-   "mucin",
-   "mucks",
-   "mucor",
-   "mucro",
-   "mudge",
-   "mudir",
-   "mudra",
-   "muffs",
-   "mufti",
-   "mugga",
-   "muggs",
-   "muggy",
-   "muhly",
-   "muids",
-   "muils",
-   "muirs",
-   "muist",
-   "mujik",
-   "mulct",
-   "muled",
-   "mules",
-   "muley",
-   "mulga",
-   "mulie",
-   "mulla",
-   "mulls",
-   "mulse",
-   "mulsh",
-   "mumms",
-   "mumps",
-   "mumsy",
-   "mumus",
-   "munga",
-   "munge",
-   "mungo",
-   "mungs",
-   "munis",
-   "munts",
-   "muntu",
-   "muons",
-   "muras",
-   "mured",
-   "mures",
-   "murex",
-   "murid",
-   "murks",
-   "murls",
-   "murly",
-   "murra",
-   "murre",
-   "murri",
-   "murrs",
-   "murry",
-   "murti",
-   "murva",
-   "musar",
-   "musca",
-   "mused",
-   "muser",
-   "muses",
-   "muset",
-   "musha",
-   "musit",
-   "musks",
-   "musos",
-   "musse",
-   "mussy",
-   "musth",
-   "musts",
-   "mutch",
-   "muted",
-   "muter",
-   "mutes",
-   "mutha",
-   "mutis",
-   "muton",
-   "mutts",
-   "muxed",
-   "muxes",
-   "muzak",
-   "muzzy",
-   "mvule",
-   "myall",
-   "mylar",
-   "mynah",
-   "mynas",
-   "myoid",
-   "myoma",
-   "myope",
-   "myops",
-   "myopy",
-   "mysid",
-   "mythi",
-   "myths",
-   "mythy",
-   "myxos",
-   "mzees",
-   "naams",
-   "naans",
-   "nabes",
-   "nabis",
-   "nabks",
-   "nabla",
-   "nabob",
-   "nache",
-   "nacho",
-   "nacre",
-   "nadas",
-   "naeve",
-   "naevi",
-   "naffs",
-   "nagas",
-   "naggy",
-   "nagor",
-   "nahal",
-   "naiad",
-   "naifs",
-   "naiks",
-   "nails",
-   "naira",
-   "nairu",
-   "naked",
-   "naker",
-   "nakfa",
-   "nalas",
-   "naled",
-   "nalla",
-   "named",
-   "namer",
-   "names",
-   "namma",
-   "namus",
-   "nanas",
-   "nance",
-   "nancy",
-   "nandu",
-   "nanna",
-   "nanos",
-   "nanua",
-   "napas",
-   "naped",
-   "napes",
-   "napoo",
-   "nappa",
-   "nappe",
-   "nappy",
-   "naras",
-   "narco",
-   "narcs",
-   "nards",
-   "nares",
-   "naric",
-   "naris",
-   "narks",
-   "narky",
-   "narre",
-   "nashi",
-   "natch",
-   "nates",
-   "natis",
-   "natty",
-   "nauch",
-   "naunt",
-   "navar",
-   "naves",
-   "navew",
-   "navvy",
-   "nawab",
-   "nazes",
-   "nazir",
-   "nazis",
-   "nduja",
-   "neafe",
-   "neals",
-   "neaps",
-   "nears",
-   "neath",
-   "neats",
-   "nebek",
-   "nebel",
-   "necks",
-   "neddy",
-   "needs",
-   "neeld",
-   "neele",
-   "neemb",
-   "neems",
-   "neeps",
-   "neese",
-   "neeze",
-   "negro",
-   "negus",
-   "neifs",
-   "neist",
-   "neive",
-   "nelis",
-   "nelly",
-   "nemas",
-   "nemns",
-   "nempt",
-   "nenes",
-   "neons",
-   "neper",
-   "nepit",
-   "neral",
-   "nerds",
-   "nerka",
-   "nerks",
-   "nerol",
-   "nerts",
-   "nertz",
-   "nervy",
-   "nests",
-   "netes",
-   "netop",
-   "netts",
-   "netty",
-   "neuks",
-   "neume",
-   "neums",
-   "nevel",
-   "neves",
-   "nevus",
-   "newbs",
-   "newed",
-   "newel",
-   "newie",
-   "newsy",
-   "newts",
-   "nexts",
-   "nexus",
-   "ngaio",
-   "ngana",
-   "ngati",
-   "ngoma",
-   "ngwee",
-   "nicad",
-   "nicht",
-   "nicks",
-   "nicol",
-   "nidal",
-   "nided",
-   "nides",
-   "nidor",
-   "nidus",
-   "niefs",
-   "nieve",
-   "nifes",
-   "niffs",
-   "niffy",
-   "nifty",
-   "niger",
-   "nighs",
-   "nihil",
-   "nikab",
-   "nikah",
-   "nikau",
-   "nills",
-   "nimbi",
-   "nimbs",
-   "nimps",
-   "niner",
-   "nines",
-   "ninon",
-   "nipas",
-   "nippy",
-   "niqab",
-   "nirls",
-   "nirly",
-   "nisei",
-   "nisse",
-   "nisus",
-   "niter",
-   "nites",
-   "nitid",
-   "niton",
-   "nitre",
-   "nitro",
-   "nitry",
-   "nitty",
-   "nival",
-   "nixed",
-   "nixer",
-   "nixes",
-   "nixie",
-   "nizam",
-   "nkosi",
-   "noahs",
-   "nobby",
-   "nocks",
-   "nodal",
-   "noddy",
-   "nodes",
-   "nodus",
-   "noels",
-   "noggs",
-   "nohow",
-   "noils",
-   "noily",
-   "noint",
-   "noirs",
-   "noles",
-   "nolls",
-   "nolos",
-   "nomas",
-   "nomen",
-   "nomes",
-   "nomic",
-   "nomoi",
-   "nomos",
-   "nonas",
-   "nonce",
-   "nones",
-   "nonet",
-   "nongs",
-   "nonis",
-   "nonny",
-   "nonyl",
-   "noobs",
-   "nooit",
-   "nooks",
-   "nooky",
-   "noons",
-   "noops",
-   "nopal",
-   "noria",
-   "noris",
-   "norks",
-   "norma",
-   "norms",
-   "nosed",
-   "noser",
-   "noses",
-   "notal",
-   "noted",
-   "noter",
-   "notes",
-   "notum",
-   "nould",
-   "noule",
-   "nouls",
-   "nouns",
-   "nouny",
-   "noups",
-   "novae",
-   "novas",
-   "novum",
-   "noway",
-   "nowed",
-   "nowls",
-   "nowts",
-   "nowty",
-   "noxal",
-   "noxes",
-   "noyau",
-   "noyed",
-   "noyes",
-   "nubby",
-   "nubia",
-   "nucha",
-   "nuddy",
-   "nuder",
-   "nudes",
-   "nudie",
-   "nudzh",
-   "nuffs",
-   "nugae",
-   "nuked",
-   "nukes",
-   "nulla",
-   "nulls",
-   "numbs",
-   "numen",
-   "nummy",
-   "nunny",
-   "nurds",
-   "nurdy",
-   "nurls",
-   "nurrs",
-   "nutso",
-   "nutsy",
-   "nyaff",
-   "nyala",
-   "nying",
-   "nyssa",
-   "oaked",
-   "oaker",
-   "oakum",
-   "oared",
-   "oases",
-   "oasis",
-   "oasts",
-   "oaten",
-   "oater",
-   "oaths",
-   "oaves",
-   "obang",
-   "obeah",
-   "obeli",
-   "obeys",
-   "obias",
-   "obied",
-   "obiit",
-   "obits",
-   "objet",
-   "oboes",
-   "obole",
-   "oboli",
-   "obols",
-   "occam",
-   "ocher",
-   "oches",
-   "ochre",
-   "ochry",
-   "ocker",
-   "ocrea",
-   "octad",
-   "octan",
-   "octas",
-   "octyl",
-   "oculi",
-   "odahs",
-   "odals",
-   "odeon",
-   "odeum",
-   "odism",
-   "odist",
-   "odium",
-   "odors",
-   "odour",
-   "odyle",
-   "odyls",
-   "ofays",
-   "offed",
-   "offie",
-   "oflag",
-   "ofter",
-   "ogams",
-   "ogeed",
-   "ogees",
-   "oggin",
-   "ogham",
-   "ogive",
-   "ogled",
-   "ogler",
-   "ogles",
-   "ogmic",
-   "ogres",
-   "ohias",
-   "ohing",
-   "ohmic",
-   "ohone",
-   "oidia",
-   "oiled",
-   "oiler",
-   "oinks",
-   "oints",
-   "ojime",
-   "okapi",
-   "okays",
-   "okehs",
-   "okras",
-   "oktas",
-   "oldie",
-   "oleic",
-   "olein",
-   "olent",
-   "oleos",
-   "oleum",
-   "olios",
-   "ollas",
-   "ollav",
-   "oller",
-   "ollie",
-   "ology",
-   "olpae",
-   "olpes",
-   "omasa",
-   "omber",
-   "ombus",
-   "omens",
-   "omers",
-   "omits",
-   "omlah",
-   "omovs",
-   "omrah",
-   "oncer",
-   "onces",
-   "oncet",
-   "oncus",
-   "onely",
-   "oners",
-   "onery",
-   "onium",
-   "onkus",
-   "onlay",
-   "onned",
-   "ontic",
-   "oobit",
-   "oohed",
-   "oomph",
-   "oonts",
-   "ooped",
-   "oorie",
-   "ooses",
-   "ootid",
-   "oozed",
-   "oozes",
-   "opahs",
-   "opals",
-   "opens",
-   "opepe",
-   "oping",
-   "oppos",
-   "opsin",
-   "opted",
-   "opter",
-   "orach",
-   "oracy",
-   "orals",
-   "orang",
-   "orant",
-   "orate",
-   "orbed",
-   "orcas",
-   "orcin",
-   "ordos",
-   "oread",
-   "orfes",
-   "orgia",
-   "orgic",
-   "orgue",
-   "oribi",
-   "oriel",
-   "orixa",
-   "orles",
-   "orlon",
-   "orlop",
-   "ormer",
-   "ornis",
-   "orpin",
-   "orris",
-   "ortho",
-   "orval",
-   "orzos",
-   "oscar",
-   "oshac",
-   "osier",
-   "osmic",
-   "osmol",
-   "ossia",
-   "ostia",
-   "otaku",
-   "otary",
-   "ottar",
-   "ottos",
-   "oubit",
-   "oucht",
-   "ouens",
-   "ouija",
-   "oulks",
-   "oumas",
-   "oundy",
-   "oupas",
-   "ouped",
-   "ouphe",
-   "ouphs",
-   "ourie",
-   "ousel",
-   "ousts",
-   "outby",
-   "outed",
-   "outre",
-   "outro",
-   "outta",
-   "ouzel",
-   "ouzos",
-   "ovals",
-   "ovels",
-   "ovens",
-   "overs",
-   "ovist",
-   "ovoli",
-   "ovolo",
-   "ovule",
-   "owche",
-   "owies",
-   "owled",
-   "owler",
-   "owlet",
-   "owned",
-   "owres",
-   "owrie",
-   "owsen",
-   "oxbow",
-   "oxers",
-   "oxeye",
-   "oxids",
-   "oxies",
-   "oxime",
-   "oxims",
-   "oxlip",
-   "oxter",
-   "oyers",
-   "ozeki",
-   "ozzie",
-   "paals",
-   "paans",
-   "pacas",
-   "paced",
-   "pacer",
-   "paces",
-   "pacey",
-   "pacha",
-   "packs",
-   "pacos",
-   "pacta",
-   "pacts",
-   "padis",
-   "padle",
-   "padma",
-   "padre",
-   "padri",
-   "paean",
-   "paedo",
-   "paeon",
-   "paged",
-   "pager",
-   "pages",
-   "pagle",
-   "pagod",
-   "pagri",
-   "paiks",
-   "pails",
-   "pains",
-   "paire",
-   "pairs",
-   "paisa",
-   "paise",
-   "pakka",
-   "palas",
-   "palay",
-   "palea",
-   "paled",
-   "pales",
-   "palet",
-   "palis",
-   "palki",
-   "palla",
-   "palls",
-   "pally",
-   "palms",
-   "palmy",
-   "palpi",
-   "palps",
-   "palsa",
-   "pampa",
-   "panax",
-   "pance",
-   "panda",
-   "pands",
-   "pandy",
-   "paned",
-   "panes",
-   "panga",
-   "pangs",
-   "panim",
-   "panko",
-   "panne",
-   "panni",
-   "panto",
-   "pants",
-   "panty",
-   "paoli",
-   "paolo",
-   "papas",
-   "papaw",
-   "papes",
-   "pappi",
-   "pappy",
-   "parae",
-   "paras",
-   "parch",
-   "pardi",
-   "pards",
-   "pardy",
-   "pared",
-   "paren",
-   "pareo",
-   "pares",
-   "pareu",
-   "parev",
-   "parge",
-   "pargo",
-   "paris",
-   "parki",
-   "parks",
-   "parky",
-   "parle",
-   "parly",
-   "parma",
-   "parol",
-   "parps",
-   "parra",
-   "parrs",
-   "parti",
-   "parts",
-   "parve",
-   "parvo",
-   "paseo",
-   "pases",
-   "pasha",
-   "pashm",
-   "paska",
-   "paspy",
-   "passe",
-   "pasts",
-   "pated",
-   "paten",
-   "pater",
-   "pates",
-   "paths",
-   "patin",
-   "patka",
-   "patly",
-   "patte",
-   "patus",
-   "pauas",
-   "pauls",
-   "pavan",
-   "paved",
-   "paven",
-   "paver",
-   "paves",
-   "pavid",
-   "pavin",
-   "pavis",
-   "pawas",
-   "pawaw",
-   "pawed",
-   "pawer",
-   "pawks",
-   "pawky",
-   "pawls",
-   "pawns",
-   "paxes",
-   "payed",
-   "payor",
-   "paysd",
-   "peage",
-   "peags",
-   "peaks",
-   "peaky",
-   "peals",
-   "peans",
-   "peare",
-   "pears",
-   "peart",
-   "pease",
-   "peats",
-   "peaty",
-   "peavy",
-   "peaze",
-   "pebas",
-   "pechs",
-   "pecke",
-   "pecks",
-   "pecky",
-   "pedes",
-   "pedis",
-   "pedro",
-   "peece",
-   "peeks",
-   "peels",
-   "peens",
-   "peeoy",
-   "peepe",
-   "peeps",
-   "peers",
-   "peery",
-   "peeve",
-   "peggy",
-   "peghs",
-   "peins",
-   "peise",
-   "peize",
-   "pekan",
-   "pekes",
-   "pekin",
-   "pekoe",
-   "pelas",
-   "pelau",
-   "peles",
-   "pelfs",
-   "pells",
-   "pelma",
-   "pelon",
-   "pelta",
-   "pelts",
-   "pends",
-   "pendu",
-   "pened",
-   "penes",
-   "pengo",
-   "penie",
-   "penis",
-   "penks",
-   "penna",
-   "penni",
-   "pents",
-   "peons",
-   "peony",
-   "pepla",
-   "pepos",
-   "peppy",
-   "pepsi",
-   "perai",
-   "perce",
-   "percs",
-   "perdu",
-   "perdy",
-   "perea",
-   "peres",
-   "peris",
-   "perks",
-   "perms",
-   "perns",
-   "perog",
-   "perps",
-   "perry",
-   "perse",
-   "perst",
-   "perts",
-   "perve",
-   "pervo",
-   "pervs",
-   "pervy",
-   "pesos",
-   "pests",
-   "pesty",
-   "petar",
-   "peter",
-   "petit",
-   "petre",
-   "petri",
-   "petti",
-   "petto",
-   "pewee",
-   "pewit",
-   "peyse",
-   "phage",
-   "phang",
-   "phare",
-   "pharm",
-   "pheer",
-   "phene",
-   "pheon",
-   "phese",
-   "phial",
-   "phish",
-   "phizz",
-   "phlox",
-   "phoca",
-   "phono",
-   "phons",
-   "phots",
-   "phpht",
-   "phuts",
-   "phyla",
-   "phyle",
-   "piani",
-   "pians",
-   "pibal",
-   "pical",
-   "picas",
-   "piccy",
-   "picks",
-   "picot",
-   "picra",
-   "picul",
-   "piend",
-   "piers",
-   "piert",
-   "pieta",
-   "piets",
-   "piezo",
-   "pight",
-   "pigmy",
-   "piing",
-   "pikas",
-   "pikau",
-   "piked",
-   "piker",
-   "pikes",
-   "pikey",
-   "pikis",
-   "pikul",
-   "pilae",
-   "pilaf",
-   "pilao",
-   "pilar",
-   "pilau",
-   "pilaw",
-   "pilch",
-   "pilea",
-   "piled",
-   "pilei",
-   "piler",
-   "piles",
-   "pilis",
-   "pills",
-   "pilow",
-   "pilum",
-   "pilus",
-   "pimas",
-   "pimps",
-   "pinas",
-   "pined",
-   "pines",
-   "pingo",
-   "pings",
-   "pinko",
-   "pinks",
-   "pinna",
-   "pinny",
-   "pinon",
-   "pinot",
-   "pinta",
-   "pints",
-   "pinup",
-   "pions",
-   "piony",
-   "pious",
-   "pioye",
-   "pioys",
-   "pipal",
-   "pipas",
-   "piped",
-   "pipes",
-   "pipet",
-   "pipis",
-   "pipit",
-   "pippy",
-   "pipul",
-   "pirai",
-   "pirls",
-   "pirns",
-   "pirog",
-   "pisco",
-   "pises",
-   "pisky",
-   "pisos",
-   "pissy",
-   "piste",
-   "pitas",
-   "piths",
-   "piton",
-   "pitot",
-   "pitta",
-   "piums",
-   "pixes",
-   "pized",
-   "pizes",
-   "plaas",
-   "plack",
-   "plage",
-   "plans",
-   "plaps",
-   "plash",
-   "plasm",
-   "plast",
-   "plats",
-   "platt",
-   "platy",
-   "playa",
-   "plays",
-   "pleas",
-   "plebe",
-   "plebs",
-   "plena",
-   "pleon",
-   "plesh",
-   "plews",
-   "plica",
-   "plies",
-   "plims",
-   "pling",
-   "plink",
-   "ploat",
-   "plods",
-   "plong",
-   "plonk",
-   "plook",
-   "plops",
-   "plots",
-   "plotz",
-   "plouk",
-   "plows",
-   "ploye",
-   "ploys",
-   "plues",
-   "pluff",
-   "plugs",
-   "plums",
-   "plumy",
-   "pluot",
-   "pluto",
-   "plyer",
-   "poach",
-   "poaka",
-   "poake",
-   "poboy",
-   "pocks",
-   "pocky",
-   "podal",
-   "poddy",
-   "podex",
-   "podge",
-   "podgy",
-   "podia",
-   "poems",
-   "poeps",
-   "poets",
-   "pogey",
-   "pogge",
-   "pogos",
-   "pohed",
-   "poilu",
-   "poind",
-   "pokal",
-   "poked",
-   "pokes",
-   "pokey",
-   "pokie",
-   "poled",
-   "poler",
-   "poles",
-   "poley",
-   "polio",
-   "polis",
-   "polje",
-   "polks",
-   "polls",
-   "polly",
-   "polos",
-   "polts",
-   "polys",
-   "pombe",
-   "pomes",
-   "pommy",
-   "pomos",
-   "pomps",
-   "ponce",
-   "poncy",
-   "ponds",
-   "pones",
-   "poney",
-   "ponga",
-   "pongo",
-   "pongs",
-   "pongy",
-   "ponks",
-   "ponts",
-   "ponty",
-   "ponzu",
-   "poods",
-   "pooed",
-   "poofs",
-   "poofy",
-   "poohs",
-   "pooja",
-   "pooka",
-   "pooks",
-   "pools",
-   "poons",
-   "poops",
-   "poopy",
-   "poori",
-   "poort",
-   "poots",
-   "poove",
-   "poovy",
-   "popes",
-   "poppa",
-   "popsy",
-   "porae",
-   "poral",
-   "pored",
-   "porer",
-   "pores",
-   "porge",
-   "porgy",
-   "porin",
-   "porks",
-   "porky",
-   "porno",
-   "porns",
-   "porny",
-   "porta",
-   "ports",
-   "porty",
-   "posed",
-   "poses",
-   "posey",
-   "posho",
-   "posts",
-   "potae",
-   "potch",
-   "poted",
-   "potes",
-   "potin",
-   "potoo",
-   "potsy",
-   "potto",
-   "potts",
-   "potty",
-   "pouff",
-   "poufs",
-   "pouke",
-   "pouks",
-   "poule",
-   "poulp",
-   "poult",
-   "poupe",
-   "poupt",
-   "pours",
-   "pouts",
-   "powan",
-   "powin",
-   "pownd",
-   "powns",
-   "powny",
-   "powre",
-   "poxed",
-   "poxes",
-   "poynt",
-   "poyou",
-   "poyse",
-   "pozzy",
-   "praam",
-   "prads",
-   "prahu",
-   "prams",
-   "prana",
-   "prang",
-   "praos",
-   "prase",
-   "prate",
-   "prats",
-   "pratt",
-   "praty",
-   "praus",
-   "prays",
-   "predy",
-   "preed",
-   "prees",
-   "preif",
-   "prems",
-   "premy",
-   "prent",
-   "preon",
-   "preop",
-   "preps",
-   "presa",
-   "prese",
-   "prest",
-   "preve",
-   "prexy",
-   "preys",
-   "prial",
-   "pricy",
-   "prief",
-   "prier",
-   "pries",
-   "prigs",
-   "prill",
-   "prima",
-   "primi",
-   "primp",
-   "prims",
-   "primy",
-   "prink",
-   "prion",
-   "prise",
-   "priss",
-   "proas",
-   "probs",
-   "prods",
-   "proem",
-   "profs",
-   "progs",
-   "proin",
-   "proke",
-   "prole",
-   "proll",
-   "promo",
-   "proms",
-   "pronk",
-   "props",
-   "prore",
-   "proso",
-   "pross",
-   "prost",
-   "prosy",
-   "proto",
-   "proul",
-   "prows",
-   "proyn",
-   "prunt",
-   "pruta",
-   "pryer",
-   "pryse",
-   "pseud",
-   "pshaw",
-   "psion",
-   "psoae",
-   "psoai",
-   "psoas",
-   "psora",
-   "psych",
-   "psyop",
-   "pubco",
-   "pubes",
-   "pubis",
-   "pucan",
-   "pucer",
-   "puces",
-   "pucka",
-   "pucks",
-   "puddy",
-   "pudge",
-   "pudic",
-   "pudor",
-   "pudsy",
-   "pudus",
-   "puers",
-   "puffa",
-   "puffs",
-   "puggy",
-   "pugil",
-   "puhas",
-   "pujah",
-   "pujas",
-   "pukas",
-   "puked",
-   "puker",
-   "pukes",
-   "pukey",
-   "pukka",
-   "pukus",
-   "pulao",
-   "pulas",
-   "puled",
-   "puler",
-   "pules",
-   "pulik",
-   "pulis",
-   "pulka",
-   "pulks",
-   "pulli",
-   "pulls",
-   "pully",
-   "pulmo",
-   "pulps",
-   "pulus",
-   "pumas",
-   "pumie",
-   "pumps",
-   "punas",
-   "punce",
-   "punga",
-   "pungs",
-   "punji",
-   "punka",
-   "punks",
-   "punky",
-   "punny",
-   "punto",
-   "punts",
-   "punty",
-   "pupae",
-   "pupas",
-   "pupus",
-   "purda",
-   "pured",
-   "pures",
-   "purin",
-   "puris",
-   "purls",
-   "purpy",
-   "purrs",
-   "pursy",
-   "purty",
-   "puses",
-   "pusle",
-   "putid",
-   "puton",
-   "putti",
-   "putto",
-   "putts",
-   "puzel",
-   "pwned",
-   "pyats",
-   "pyets",
-   "pygal",
-   "pyins",
-   "pylon",
-   "pyned",
-   "pynes",
-   "pyoid",
-   "pyots",
-   "pyral",
-   "pyran",
-   "pyres",
-   "pyrex",
-   "pyric",
-   "pyros",
-   "pyxed",
-   "pyxes",
-   "pyxie",
-   "pyxis",
-   "pzazz",
-   "qadis",
-   "qaids",
-   "qajaq",
-   "qanat",
-   "qapik",
-   "qibla",
-   "qophs",
-   "qorma",
-   "quads",
-   "quaff",
-   "quags",
-   "quair",
-   "quais",
-   "quaky",
-   "quale",
-   "quant",
-   "quare",
-   "quass",
-   "quate",
-   "quats",
-   "quayd",
-   "quays",
-   "qubit",
-   "quean",
-   "queme",
-   "quena",
-   "quern",
-   "queyn",
-   "queys",
-   "quich",
-   "quids",
-   "quiff",
-   "quims",
-   "quina",
-   "quine",
-   "quino",
-   "quins",
-   "quint",
-   "quipo",
-   "quips",
-   "quipu",
-   "quire",
-   "quirt",
-   "quist",
-   "quits",
-   "quoad",
-   "quods",
-   "quoif",
-   "quoin",
-   "quoit",
-   "quoll",
-   "quonk",
-   "quops",
-   "qursh",
-   "quyte",
-   "rabat",
-   "rabic",
-   "rabis",
-   "raced",
-   "races",
-   "rache",
-   "racks",
-   "racon",
-   "radge",
-   "radix",
-   "radon",
-   "raffs",
-   "rafts",
-   "ragas",
-   "ragde",
-   "raged",
-   "ragee",
-   "rager",
-   "rages",
-   "ragga",
-   "raggs",
-   "raggy",
-   "ragis",
-   "ragus",
-   "rahed",
-   "rahui",
-   "raias",
-   "raids",
-   "raiks",
-   "raile",
-   "rails",
-   "raine",
-   "rains",
-   "raird",
-   "raita",
-   "raits",
-   "rajas",
-   "rajes",
-   "raked",
-   "rakee",
-   "raker",
-   "rakes",
-   "rakia",
-   "rakis",
-   "rakus",
-   "rales",
-   "ramal",
-   "ramee",
-   "ramet",
-   "ramie",
-   "ramin",
-   "ramis",
-   "rammy",
-   "ramps",
-   "ramus",
-   "ranas",
-   "rance",
-   "rands",
-   "ranee",
-   "ranga",
-   "rangi",
-   "rangs",
-   "rangy",
-   "ranid",
-   "ranis",
-   "ranke",
-   "ranks",
-   "rants",
-   "raped",
-   "raper",
-   "rapes",
-   "raphe",
-   "rappe",
-   "rared",
-   "raree",
-   "rares",
-   "rarks",
-   "rased",
-   "raser",
-   "rases",
-   "rasps",
-   "rasse",
-   "rasta",
-   "ratal",
-   "ratan",
-   "ratas",
-   "ratch",
-   "rated",
-   "ratel",
-   "rater",
-   "rates",
-   "ratha",
-   "rathe",
-   "raths",
-   "ratoo",
-   "ratos",
-   "ratus",
-   "rauns",
-   "raupo",
-   "raved",
-   "ravel",
-   "raver",
-   "raves",
-   "ravey",
-   "ravin",
-   "rawer",
-   "rawin",
-   "rawly",
-   "rawns",
-   "raxed",
-   "raxes",
-   "rayah",
-   "rayas",
-   "rayed",
-   "rayle",
-   "rayne",
-   "razed",
-   "razee",
-   "razer",
-   "razes",
-   "razoo",
-   "readd",
-   "reads",
-   "reais",
-   "reaks",
-   "realo",
-   "reals",
-   "reame",
-   "reams",
-   "reamy",
-   "reans",
-   "reaps",
-   "rears",
-   "reast",
-   "reata",
-   "reate",
-   "reave",
-   "rebbe",
-   "rebec",
-   "rebid",
-   "rebit",
-   "rebop",
-   "rebuy",
-   "recal",
-   "recce",
-   "recco",
-   "reccy",
-   "recit",
-   "recks",
-   "recon",
-   "recta",
-   "recti",
-   "recto",
-   "redan",
-   "redds",
-   "reddy",
-   "reded",
-   "redes",
-   "redia",
-   "redid",
-   "redip",
-   "redly",
-   "redon",
-   "redos",
-   "redox",
-   "redry",
-   "redub",
-   "redux",
-   "redye",
-   "reech",
-   "reede",
-   "reeds",
-   "reefs",
-   "reefy",
-   "reeks",
-   "reeky",
-   "reels",
-   "reens",
-   "reest",
-   "reeve",
-   "refed",
-   "refel",
-   "reffo",
-   "refis",
-   "refix",
-   "refly",
-   "refry",
-   "regar",
-   "reges",
-   "reggo",
-   "regie",
-   "regma",
-   "regna",
-   "regos",
-   "regur",
-   "rehem",
-   "reifs",
-   "reify",
-   "reiki",
-   "reiks",
-   "reink",
-   "reins",
-   "reird",
-   "reist",
-   "reive",
-   "rejig",
-   "rejon",
-   "reked",
-   "rekes",
-   "rekey",
-   "relet",
-   "relie",
-   "relit",
-   "rello",
-   "reman",
-   "remap",
-   "remen",
-   "remet",
-   "remex",
-   "remix",
-   "renay",
-   "rends",
-   "reney",
-   "renga",
-   "renig",
-   "renin",
-   "renne",
-   "renos",
-   "rente",
-   "rents",
-   "reoil",
-   "reorg",
-   "repeg",
-   "repin",
-   "repla",
-   "repos",
-   "repot",
-   "repps",
-   "repro",
-   "reran",
-   "rerig",
-   "resat",
-   "resaw",
-   "resay",
-   "resee",
-   "reses",
-   "resew",
-   "resid",
-   "resit",
-   "resod",
-   "resow",
-   "resto",
-   "rests",
-   "resty",
-   "resus",
-   "retag",
-   "retax",
-   "retem",
-   "retia",
-   "retie",
-   "retox",
-   "revet",
-   "revie",
-   "rewan",
-   "rewax",
-   "rewed",
-   "rewet",
-   "rewin",
-   "rewon",
-   "rewth",
-   "rexes",
-   "rezes",
-   "rheas",
-   "rheme",
-   "rheum",
-   "rhies",
-   "rhime",
-   "rhine",
-   "rhody",
-   "rhomb",
-   "rhone",
-   "rhumb",
-   "rhyne",
-   "rhyta",
-   "riads",
-   "rials",
-   "riant",
-   "riata",
-   "ribas",
-   "ribby",
-   "ribes",
-   "riced",
-   "ricer",
-   "rices",
-   "ricey",
-   "richt",
-   "ricin",
-   "ricks",
-   "rides",
-   "ridgy",
-   "ridic",
-   "riels",
-   "riems",
-   "rieve",
-   "rifer",
-   "riffs",
-   "rifte",
-   "rifts",
-   "rifty",
-   "riggs",
-   "rigol",
-   "riled",
-   "riles",
-   "riley",
-   "rille",
-   "rills",
-   "rimae",
-   "rimed",
-   "rimer",
-   "rimes",
-   "rimus",
-   "rinds",
-   "rindy",
-   "rines",
-   "rings",
-   "rinks",
-   "rioja",
-   "riots",
-   "riped",
-   "ripes",
-   "ripps",
-   "rises",
-   "rishi",
-   "risks",
-   "risps",
-   "risus",
-   "rites",
-   "ritts",
-   "ritzy",
-   "rivas",
-   "rived",
-   "rivel",
-   "riven",
-   "rives",
-   "riyal",
-   "rizas",
-   "roads",
-   "roams",
-   "roans",
-   "roars",
-   "roary",
-   "roate",
-   "robed",
-   "robes",
-   "roble",
-   "rocks",
-   "roded",
-   "rodes",
-   "roguy",
-   "rohes",
-   "roids",
-   "roils",
-   "roily",
-   "roins",
-   "roist",
-   "rojak",
-   "rojis",
-   "roked",
-   "roker",
-   "rokes",
-   "rolag",
-   "roles",
-   "rolfs",
-   "rolls",
-   "romal",
-   "roman",
-   "romeo",
-   "romps",
-   "ronde",
-   "rondo",
-   "roneo",
-   "rones",
-   "ronin",
-   "ronne",
-   "ronte",
-   "ronts",
-   "roods",
-   "roofs",
-   "roofy",
-   "rooks",
-   "rooky",
-   "rooms",
-   "roons",
-   "roops",
-   "roopy",
-   "roosa",
-   "roose",
-   "roots",
-   "rooty",
-   "roped",
-   "roper",
-   "ropes",
-   "ropey",
-   "roque",
-   "roral",
-   "rores",
-   "roric",
-   "rorid",
-   "rorie",
-   "rorts",
-   "rorty",
-   "rosed",
-   "roses",
-   "roset",
-   "roshi",
-   "rosin",
-   "rosit",
-   "rosti",
-   "rosts",
-   "rotal",
-   "rotan",
-   "rotas",
-   "rotch",
-   "roted",
-   "rotes",
-   "rotis",
-   "rotls",
-   "roton",
-   "rotos",
-   "rotte",
-   "rouen",
-   "roues",
-   "roule",
-   "rouls",
-   "roums",
-   "roups",
-   "roupy",
-   "roust",
-   "routh",
-   "routs",
-   "roved",
-   "roven",
-   "roves",
-   "rowan",
-   "rowed",
-   "rowel",
-   "rowen",
-   "rowie",
-   "rowme",
-   "rownd",
-   "rowth",
-   "rowts",
-   "royne",
-   "royst",
-   "rozet",
-   "rozit",
-   "ruana",
-   "rubai",
-   "rubby",
-   "rubel",
-   "rubes",
-   "rubin",
-   "ruble",
-   "rubli",
-   "rubus",
-   "ruche",
-   "rucks",
-   "rudas",
-   "rudds",
-   "rudes",
-   "rudie",
-   "rudis",
-   "rueda",
-   "ruers",
-   "ruffe",
-   "ruffs",
-   "rugae",
-   "rugal",
-   "ruggy",
-   "ruing",
-   "ruins",
-   "rukhs",
-   "ruled",
-   "rules",
-   "rumal",
-   "rumbo",
-   "rumen",
-   "rumes",
-   "rumly",
-   "rummy",
-   "rumpo",
-   "rumps",
-   "rumpy",
-   "runch",
-   "runds",
-   "runed",
-   "runes",
-   "rungs",
-   "runic",
-   "runny",
-   "runts",
-   "runty",
-   "rupia",
-   "rurps",
-   "rurus",
-   "rusas",
-   "ruses",
-   "rushy",
-   "rusks",
-   "rusma",
-   "russe",
-   "rusts",
-   "ruths",
-   "rutin",
-   "rutty",
-   "ryals",
-   "rybat",
-   "ryked",
-   "rykes",
-   "rymme",
-   "rynds",
-   "ryots",
-   "ryper",
-   "saags",
-   "sabal",
-   "sabed",
-   "saber",
-   "sabes",
-   "sabha",
-   "sabin",
-   "sabir",
-   "sable",
-   "sabot",
-   "sabra",
-   "sabre",
-   "sacks",
-   "sacra",
-   "saddo",
-   "sades",
-   "sadhe",
-   "sadhu",
-   "sadis",
-   "sados",
-   "sadza",
-   "safed",
-   "safes",
-   "sagas",
-   "sager",
-   "sages",
-   "saggy",
-   "sagos",
-   "sagum",
-   "saheb",
-   "sahib",
-   "saice",
-   "saick",
-   "saics",
-   "saids",
-   "saiga",
-   "sails",
-   "saims",
-   "saine",
-   "sains",
-   "sairs",
-   "saist",
-   "saith",
-   "sajou",
-   "sakai",
-   "saker",
-   "sakes",
-   "sakia",
-   "sakis",
-   "sakti",
-   "salal",
-   "salat",
-   "salep",
-   "sales",
-   "salet",
-   "salic",
-   "salix",
-   "salle",
-   "salmi",
-   "salol",
-   "salop",
-   "salpa",
-   "salps",
-   "salse",
-   "salto",
-   "salts",
-   "salue",
-   "salut",
-   "saman",
-   "samas",
-   "samba",
-   "sambo",
-   "samek",
-   "samel",
-   "samen",
-   "sames",
-   "samey",
-   "samfu",
-   "sammy",
-   "sampi",
-   "samps",
-   "sands",
-   "saned",
-   "sanes",
-   "sanga",
-   "sangh",
-   "sango",
-   "sangs",
-   "sanko",
-   "sansa",
-   "santo",
-   "sants",
-   "saola",
-   "sapan",
-   "sapid",
-   "sapor",
-   "saran",
-   "sards",
-   "sared",
-   "saree",
-   "sarge",
-   "sargo",
-   "sarin",
-   "saris",
-   "sarks",
-   "sarky",
-   "sarod",
-   "saros",
-   "sarus",
-   "saser",
-   "sasin",
-   "sasse",
-   "satai",
-   "satay",
-   "sated",
-   "satem",
-   "sates",
-   "satis",
-   "sauba",
-   "sauch",
-   "saugh",
-   "sauls",
-   "sault",
-   "saunt",
-   "saury",
-   "sauts",
-   "saved",
-   "saver",
-   "saves",
-   "savey",
-   "savin",
-   "sawah",
-   "sawed",
-   "sawer",
-   "saxes",
-   "sayed",
-   "sayer",
-   "sayid",
-   "sayne",
-   "sayon",
-   "sayst",
-   "sazes",
-   "scabs",
-   "scads",
-   "scaff",
-   "scags",
-   "scail",
-   "scala",
-   "scall",
-   "scams",
-   "scand",
-   "scans",
-   "scapa",
-   "scape",
-   "scapi",
-   "scarp",
-   "scars",
-   "scart",
-   "scath",
-   "scats",
-   "scatt",
-   "scaud",
-   "scaup",
-   "scaur",
-   "scaws",
-   "sceat",
-   "scena",
-   "scend",
-   "schav",
-   "schmo",
-   "schul",
-   "schwa",
-   "sclim",
-   "scody",
-   "scogs",
-   "scoog",
-   "scoot",
-   "scopa",
-   "scops",
-   "scots",
-   "scoug",
-   "scoup",
-   "scowp",
-   "scows",
-   "scrab",
-   "scrae",
-   "scrag",
-   "scran",
-   "scrat",
-   "scraw",
-   "scray",
-   "scrim",
-   "scrip",
-   "scrob",
-   "scrod",
-   "scrog",
-   "scrow",
-   "scudi",
-   "scudo",
-   "scuds",
-   "scuff",
-   "scuft",
-   "scugs",
-   "sculk",
-   "scull",
-   "sculp",
-   "sculs",
-   "scums",
-   "scups",
-   "scurf",
-   "scurs",
-   "scuse",
-   "scuta",
-   "scute",
-   "scuts",
-   "scuzz",
-   "scyes",
-   "sdayn",
-   "sdein",
-   "seals",
-   "seame",
-   "seams",
-   "seamy",
-   "seans",
-   "seare",
-   "sears",
-   "sease",
-   "seats",
-   "seaze",
-   "sebum",
-   "secco",
-   "sechs",
-   "sects",
-   "seder",
-   "sedes",
-   "sedge",
-   "sedgy",
-   "sedum",
-   "seeds",
-   "seeks",
-   "seeld",
-   "seels",
-   "seely",
-   "seems",
-   "seeps",
-   "seepy",
-   "seers",
-   "sefer",
-   "segar",
-   "segni",
-   "segno",
-   "segol",
-   "segos",
-   "sehri",
-   "seifs",
-   "seils",
-   "seine",
-   "seirs",
-   "seise",
-   "seism",
-   "seity",
-   "seiza",
-   "sekos",
-   "sekts",
-   "selah",
-   "seles",
-   "selfs",
-   "sella",
-   "selle",
-   "sells",
-   "selva",
-   "semee",
-   "semes",
-   "semie",
-   "semis",
-   "senas",
-   "sends",
-   "senes",
-   "sengi",
-   "senna",
-   "senor",
-   "sensa",
-   "sensi",
-   "sente",
-   "senti",
-   "sents",
-   "senvy",
-   "senza",
-   "sepad",
-   "sepal",
-   "sepic",
-   "sepoy",
-   "septa",
-   "septs",
-   "serac",
-   "serai",
-   "seral",
-   "sered",
-   "serer",
-   "seres",
-   "serfs",
-   "serge",
-   "seric",
-   "serin",
-   "serks",
-   "seron",
-   "serow",
-   "serra",
-   "serre",
-   "serrs",
-   "serry",
-   "servo",
-   "sesey",
-   "sessa",
-   "setae",
-   "setal",
-   "seton",
-   "setts",
-   "sewan",
-   "sewar",
-   "sewed",
-   "sewel",
-   "sewen",
-   "sewin",
-   "sexed",
-   "sexer",
-   "sexes",
-   "sexto",
-   "sexts",
-   "seyen",
-   "shads",
-   "shags",
-   "shahs",
-   "shako",
-   "shakt",
-   "shalm",
-   "shaly",
-   "shama",
-   "shams",
-   "shand",
-   "shans",
-   "shaps",
-   "sharn",
-   "shash",
-   "shaul",
-   "shawm",
-   "shawn",
-   "shaws",
-   "shaya",
-   "shays",
-   "shchi",
-   "sheaf",
-   "sheal",
-   "sheas",
-   "sheds",
-   "sheel",
-   "shend",
-   "shent",
-   "sheol",
-   "sherd",
-   "shere",
-   "shero",
-   "shets",
-   "sheva",
-   "shewn",
-   "shews",
-   "shiai",
-   "shiel",
-   "shier",
-   "shies",
-   "shill",
-   "shily",
-   "shims",
-   "shins",
-   "ships",
-   "shirr",
-   "shirs",
-   "shish",
-   "shiso",
-   "shist",
-   "shite",
-   "shits",
-   "shiur",
-   "shiva",
-   "shive",
-   "shivs",
-   "shlep",
-   "shlub",
-   "shmek",
-   "shmoe",
-   "shoat",
-   "shoed",
-   "shoer",
-   "shoes",
-   "shogi",
-   "shogs",
-   "shoji",
-   "shojo",
-   "shola",
-   "shool",
-   "shoon",
-   "shoos",
-   "shope",
-   "shops",
-   "shorl",
-   "shote",
-   "shots",
-   "shott",
-   "showd",
-   "shows",
-   "shoyu",
-   "shred",
-   "shris",
-   "shrow",
-   "shtik",
-   "shtum",
-   "shtup",
-   "shule",
-   "shuln",
-   "shuls",
-   "shuns",
-   "shura",
-   "shute",
-   "shuts",
-   "shwas",
-   "shyer",
-   "sials",
-   "sibbs",
-   "sibyl",
-   "sices",
-   "sicht",
-   "sicko",
-   "sicks",
-   "sicky",
-   "sidas",
-   "sided",
-   "sider",
-   "sides",
-   "sidha",
-   "sidhe",
-   "sidle",
-   "sield",
-   "siens",
-   "sient",
-   "sieth",
-   "sieur",
-   "sifts",
-   "sighs",
-   "sigil",
-   "sigla",
-   "signa",
-   "signs",
-   "sijos",
-   "sikas",
-   "siker",
-   "sikes",
-   "silds",
-   "siled",
-   "silen",
-   "siler",
-   "siles",
-   "silex",
-   "silks",
-   "sills",
-   "silos",
-   "silts",
-   "silty",
-   "silva",
-   "simar",
-   "simas",
-   "simba",
-   "simis",
-   "simps",
-   "simul",
-   "sinds",
-   "sined",
-   "sines",
-   "sings",
-   "sinhs",
-   "sinks",
-   "sinky",
-   "sinus",
-   "siped",
-   "sipes",
-   "sippy",
-   "sired",
-   "siree",
-   "sires",
-   "sirih",
-   "siris",
-   "siroc",
-   "sirra",
-   "sirup",
-   "sisal",
-   "sises",
-   "sista",
-   "sists",
-   "sitar",
-   "sited",
-   "sites",
-   "sithe",
-   "sitka",
-   "situp",
-   "situs",
-   "siver",
-   "sixer",
-   "sixes",
-   "sixmo",
-   "sixte",
-   "sizar",
-   "sized",
-   "sizel",
-   "sizer",
-   "sizes",
-   "skags",
-   "skail",
-   "skald",
-   "skank",
-   "skart",
-   "skats",
-   "skatt",
-   "skaws",
-   "skean",
-   "skear",
-   "skeds",
-   "skeed",
-   "skeef",
-   "skeen",
-   "skeer",
-   "skees",
-   "skeet",
-   "skegg",
-   "skegs",
-   "skein",
-   "skelf",
-   "skell",
-   "skelm",
-   "skelp",
-   "skene",
-   "skens",
-   "skeos",
-   "skeps",
-   "skers",
-   "skets",
-   "skews",
-   "skids",
-   "skied",
-   "skies",
-   "skiey",
-   "skimo",
-   "skims",
-   "skink",
-   "skins",
-   "skint",
-   "skios",
-   "skips",
-   "skirl",
-   "skirr",
-   "skite",
-   "skits",
-   "skive",
-   "skivy",
-   "sklim",
-   "skoal",
-   "skody",
-   "skoff",
-   "skogs",
-   "skols",
-   "skool",
-   "skort",
-   "skosh",
-   "skran",
-   "skrik",
-   "skuas",
-   "skugs",
-   "skyed",
-   "skyer",
-   "skyey",
-   "skyfs",
-   "skyre",
-   "skyrs",
-   "skyte",
-   "slabs",
-   "slade",
-   "slaes",
-   "slags",
-   "slaid",
-   "slake",
-   "slams",
-   "slane",
-   "slank",
-   "slaps",
-   "slart",
-   "slats",
-   "slaty",
-   "slaws",
-   "slays",
-   "slebs",
-   "sleds",
-   "sleer",
-   "slews",
-   "sleys",
-   "slier",
-   "slily",
-   "slims",
-   "slipe",
-   "slips",
-   "slipt",
-   "slish",
-   "slits",
-   "slive",
-   "sloan",
-   "slobs",
-   "sloes",
-   "slogs",
-   "sloid",
-   "slojd",
-   "slomo",
-   "sloom",
-   "sloot",
-   "slops",
-   "slopy",
-   "slorm",
-   "slots",
-   "slove",
-   "slows",
-   "sloyd",
-   "slubb",
-   "slubs",
-   "slued",
-   "slues",
-   "sluff",
-   "slugs",
-   "sluit",
-   "slums",
-   "slurb",
-   "slurs",
-   "sluse",
-   "slyer",
-   "slype",
-   "smaak",
-   "smaik",
-   "smalm",
-   "smalt",
-   "smarm",
-   "smaze",
-   "smeek",
-   "smees",
-   "smeik",
-   "smeke",
-   "smerk",
-   "smews",
-   "smirr",
-   "smirs",
-   "smits",
-   "smogs",
-   "smoko",
-   "smolt",
-   "smoor",
-   "smoot",
-   "smore",
-   "smorg",
-   "smout",
-   "smowt",
-   "smugs",
-   "smurs",
-   "smush",
-   "smuts",
-   "snabs",
-   "snafu",
-   "snags",
-   "snaps",
-   "snarf",
-   "snark",
-   "snars",
-   "snary",
-   "snash",
-   "snath",
-   "snaws",
-   "snead",
-   "sneap",
-   "snebs",
-   "sneck",
-   "sneds",
-   "sneed",
-   "snees",
-   "snell",
-   "snibs",
-   "snick",
-   "snies",
-   "snift",
-   "snigs",
-   "snips",
-   "snipy",
-   "snirt",
-   "snits",
-   "snobs",
-   "snods",
-   "snoek",
-   "snoep",
-   "snogs",
-   "snoke",
-   "snood",
-   "snook",
-   "snool",
-   "snoot",
-   "snots",
-   "snowk",
-   "snows",
-   "snubs",
-   "snugs",
-   "snush",
-   "snyes",
-   "soaks",
-   "soaps",
-   "soare",
-   "soars",
-   "soave",
-   "sobas",
-   "socas",
-   "soces",
-   "socko",
-   "socks",
-   "socle",
-   "sodas",
-   "soddy",
-   "sodic",
-   "sodom",
-   "sofar",
-   "sofas",
-   "softa",
-   "softs",
-   "softy",
-   "soger",
-   "sohur",
-   "soils",
-   "soily",
-   "sojas",
-   "sojus",
-   "sokah",
-   "soken",
-   "sokes",
-   "sokol",
-   "solah",
-   "solan",
-   "solas",
-   "solde",
-   "soldi",
-   "soldo",
-   "solds",
-   "soled",
-   "solei",
-   "soler",
-   "soles",
-   "solon",
-   "solos",
-   "solum",
-   "solus",
-   "soman",
-   "somas",
-   "sonce",
-   "sonde",
-   "sones",
-   "songs",
-   "sonly",
-   "sonne",
-   "sonny",
-   "sonse",
-   "sonsy",
-   "sooey",
-   "sooks",
-   "sooky",
-   "soole",
-   "sools",
-   "sooms",
-   "soops",
-   "soote",
-   "soots",
-   "sophs",
-   "sophy",
-   "sopor",
-   "soppy",
-   "sopra",
-   "soral",
-   "soras",
-   "sorbo",
-   "sorbs",
-   "sorda",
-   "sordo",
-   "sords",
-   "sored",
-   "soree",
-   "sorel",
-   "sorer",
-   "sores",
-   "sorex",
-   "sorgo",
-   "sorns",
-   "sorra",
-   "sorta",
-   "sorts",
-   "sorus",
-   "soths",
-   "sotol",
-   "souce",
-   "souct",
-   "sough",
-   "souks",
-   "souls",
-   "soums",
-   "soups",
-   "soupy",
-   "sours",
-   "souse",
-   "souts",
-   "sowar",
-   "sowce",
-   "sowed",
-   "sowff",
-   "sowfs",
-   "sowle",
-   "sowls",
-   "sowms",
-   "sownd",
-   "sowne",
-   "sowps",
-   "sowse",
-   "sowth",
-   "soyas",
-   "soyle",
-   "soyuz",
-   "sozin",
-   "spacy",
-   "spado",
-   "spaed",
-   "spaer",
-   "spaes",
-   "spags",
-   "spahi",
-   "spail",
-   "spain",
-   "spait",
-   "spake",
-   "spald",
-   "spale",
-   "spall",
-   "spalt",
-   "spams",
-   "spane",
-   "spang",
-   "spans",
-   "spard",
-   "spars",
-   "spart",
-   "spate",
-   "spats",
-   "spaul",
-   "spawl",
-   "spaws",
-   "spayd",
-   "spays",
-   "spaza",
-   "spazz",
-   "speal",
-   "spean",
-   "speat",
-   "specs",
-   "spect",
-   "speel",
-   "speer",
-   "speil",
-   "speir",
-   "speks",
-   "speld",
-   "spelk",
-   "speos",
-   "spets",
-   "speug",
-   "spews",
-   "spewy",
-   "spial",
-   "spica",
-   "spide",
-   "spier",
-   "spies",
-   "spiff",
-   "spifs",
-   "spile",
-   "spims",
-   "spina",
-   "spink",
-   "spins",
-   "spirt",
-   "spiry",
-   "spits",
-   "spitz",
-   "spivs",
-   "splay",
-   "splog",
-   "spode",
-   "spods",
-   "spoom",
-   "spoor",
-   "spoot",
-   "spork",
-   "sposh",
-   "spots",
-   "sprad",
-   "sprag",
-   "sprat",
-   "spred",
-   "sprew",
-   "sprit",
-   "sprod",
-   "sprog",
-   "sprue",
-   "sprug",
-   "spuds",
-   "spued",
-   "spuer",
-   "spues",
-   "spugs",
-   "spule",
-   "spume",
-   "spumy",
-   "spurs",
-   "sputa",
-   "spyal",
-   "spyre",
-   "squab",
-   "squaw",
-   "squeg",
-   "squid",
-   "squit",
-   "squiz",
-   "stabs",
-   "stade",
-   "stags",
-   "stagy",
-   "staig",
-   "stane",
-   "stang",
-   "staph",
-   "staps",
-   "starn",
-   "starr",
-   "stars",
-   "stats",
-   "staun",
-   "staws",
-   "stays",
-   "stean",
-   "stear",
-   "stedd",
-   "stede",
-   "steds",
-   "steek",
-   "steem",
-   "steen",
-   "steil",
-   "stela",
-   "stele",
-   "stell",
-   "steme",
-   "stems",
-   "stend",
-   "steno",
-   "stens",
-   "stent",
-   "steps",
-   "stept",
-   "stere",
-   "stets",
-   "stews",
-   "stewy",
-   "steys",
-   "stich",
-   "stied",
-   "sties",
-   "stilb",
-   "stile",
-   "stime",
-   "stims",
-   "stimy",
-   "stipa",
-   "stipe",
-   "stire",
-   "stirk",
-   "stirp",
-   "stirs",
-   "stive",
-   "stivy",
-   "stoae",
-   "stoai",
-   "stoas",
-   "stoat",
-   "stobs",
-   "stoep",
-   "stogy",
-   "stoit",
-   "stoln",
-   "stoma",
-   "stond",
-   "stong",
-   "stonk",
-   "stonn",
-   "stook",
-   "stoor",
-   "stope",
-   "stops",
-   "stopt",
-   "stoss",
-   "stots",
-   "stott",
-   "stoun",
-   "stoup",
-   "stour",
-   "stown",
-   "stowp",
-   "stows",
-   "strad",
-   "strae",
-   "strag",
-   "strak",
-   "strep",
-   "strew",
-   "stria",
-   "strig",
-   "strim",
-   "strop",
-   "strow",
-   "stroy",
-   "strum",
-   "stubs",
-   "stude",
-   "studs",
-   "stull",
-   "stulm",
-   "stumm",
-   "stums",
-   "stuns",
-   "stupa",
-   "stupe",
-   "sture",
-   "sturt",
-   "styed",
-   "styes",
-   "styli",
-   "stylo",
-   "styme",
-   "stymy",
-   "styre",
-   "styte",
-   "subah",
-   "subas",
-   "subby",
-   "suber",
-   "subha",
-   "succi",
-   "sucks",
-   "sucky",
-   "sucre",
-   "sudds",
-   "sudor",
-   "sudsy",
-   "suede",
-   "suent",
-   "suers",
-   "suete",
-   "suets",
-   "suety",
-   "sugan",
-   "sughs",
-   "sugos",
-   "suhur",
-   "suids",
-   "suint",
-   "suits",
-   "sujee",
-   "sukhs",
-   "sukuk",
-   "sulci",
-   "sulfa",
-   "sulfo",
-   "sulks",
-   "sulph",
-   "sulus",
-   "sumis",
-   "summa",
-   "sumos",
-   "sumph",
-   "sumps",
-   "sunis",
-   "sunks",
-   "sunna",
-   "sunns",
-   "sunup",
-   "supes",
-   "supra",
-   "surah",
-   "sural",
-   "suras",
-   "surat",
-   "surds",
-   "sured",
-   "sures",
-   "surfs",
-   "surfy",
-   "surgy",
-   "surra",
-   "sused",
-   "suses",
-   "susus",
-   "sutor",
-   "sutra",
-   "sutta",
-   "swabs",
-   "swack",
-   "swads",
-   "swage",
-   "swags",
-   "swail",
-   "swain",
-   "swale",
-   "swaly",
-   "swamy",
-   "swang",
-   "swank",
-   "swans",
-   "swaps",
-   "swapt",
-   "sward",
-   "sware",
-   "swarf",
-   "swart",
-   "swats",
-   "swayl",
-   "sways",
-   "sweal",
-   "swede",
-   "sweed",
-   "sweel",
-   "sweer",
-   "swees",
-   "sweir",
-   "swelt",
-   "swerf",
-   "sweys",
-   "swies",
-   "swigs",
-   "swile",
-   "swims",
-   "swink",
-   "swipe",
-   "swire",
-   "swiss",
-   "swith",
-   "swits",
-   "swive",
-   "swizz",
-   "swobs",
-   "swole",
-   "swoln",
-   "swops",
-   "swopt",
-   "swots",
-   "swoun",
-   "sybbe",
-   "sybil",
-   "syboe",
-   "sybow",
-   "sycee",
-   "syces",
-   "sycon",
-   "syens",
-   "syker",
-   "sykes",
-   "sylis",
-   "sylph",
-   "sylva",
-   "symar",
-   "synch",
-   "syncs",
-   "synds",
-   "syned",
-   "synes",
-   "synth",
-   "syped",
-   "sypes",
-   "syphs",
-   "syrah",
-   "syren",
-   "sysop",
-   "sythe",
-   "syver",
-   "taals",
-   "taata",
-   "taber",
-   "tabes",
-   "tabid",
-   "tabis",
-   "tabla",
-   "tabor",
-   "tabun",
-   "tabus",
-   "tacan",
-   "taces",
-   "tacet",
-   "tache",
-   "tacho",
-   "tachs",
-   "tacks",
-   "tacos",
-   "tacts",
-   "taels",
-   "tafia",
-   "taggy",
-   "tagma",
-   "tahas",
-   "tahrs",
-   "taiga",
-   "taigs",
-   "taiko",
-   "tails",
-   "tains",
-   "taira",
-   "taish",
-   "taits",
-   "tajes",
-   "takas",
-   "takes",
-   "takhi",
-   "takin",
-   "takis",
-   "takky",
-   "talak",
-   "talaq",
-   "talar",
-   "talas",
-   "talcs",
-   "talcy",
-   "talea",
-   "taler",
-   "tales",
-   "talks",
-   "talky",
-   "talls",
-   "talma",
-   "talpa",
-   "taluk",
-   "talus",
-   "tamal",
-   "tamed",
-   "tames",
-   "tamin",
-   "tamis",
-   "tammy",
-   "tamps",
-   "tanas",
-   "tanga",
-   "tangi",
-   "tangs",
-   "tanhs",
-   "tanka",
-   "tanks",
-   "tanky",
-   "tanna",
-   "tansy",
-   "tanti",
-   "tanto",
-   "tanty",
-   "tapas",
-   "taped",
-   "tapen",
-   "tapes",
-   "tapet",
-   "tapis",
-   "tappa",
-   "tapus",
-   "taras",
-   "tardo",
-   "tared",
-   "tares",
-   "targa",
-   "targe",
-   "tarns",
-   "taroc",
-   "tarok",
-   "taros",
-   "tarps",
-   "tarre",
-   "tarry",
-   "tarsi",
-   "tarts",
-   "tarty",
-   "tasar",
-   "tased",
-   "taser",
-   "tases",
-   "tasks",
-   "tassa",
-   "tasse",
-   "tasso",
-   "tatar",
-   "tater",
-   "tates",
-   "taths",
-   "tatie",
-   "tatou",
-   "tatts",
-   "tatus",
-   "taube",
-   "tauld",
-   "tauon",
-   "taupe",
-   "tauts",
-   "tavah",
-   "tavas",
-   "taver",
-   "tawai",
-   "tawas",
-   "tawed",
-   "tawer",
-   "tawie",
-   "tawse",
-   "tawts",
-   "taxed",
-   "taxer",
-   "taxes",
-   "taxis",
-   "taxol",
-   "taxon",
-   "taxor",
-   "taxus",
-   "tayra",
-   "tazza",
-   "tazze",
-   "teade",
-   "teads",
-   "teaed",
-   "teaks",
-   "teals",
-   "teams",
-   "tears",
-   "teats",
-   "teaze",
-   "techs",
-   "techy",
-   "tecta",
-   "teels",
-   "teems",
-   "teend",
-   "teene",
-   "teens",
-   "teeny",
-   "teers",
-   "teffs",
-   "teggs",
-   "tegua",
-   "tegus",
-   "tehrs",
-   "teiid",
-   "teils",
-   "teind",
-   "teins",
-   "telae",
-   "telco",
-   "teles",
-   "telex",
-   "telia",
-   "telic",
-   "tells",
-   "telly",
-   "teloi",
-   "telos",
-   "temed",
-   "temes",
-   "tempi",
-   "temps",
-   "tempt",
-   "temse",
-   "tench",
-   "tends",
-   "tendu",
-   "tenes",
-   "tenge",
-   "tenia",
-   "tenne",
-   "tenno",
-   "tenny",
-   "tenon",
-   "tents",
-   "tenty",
-   "tenue",
-   "tepal",
-   "tepas",
-   "tepoy",
-   "terai",
-   "teras",
-   "terce",
-   "terek",
-   "teres",
-   "terfe",
-   "terfs",
-   "terga",
-   "terms",
-   "terne",
-   "terns",
-   "terry",
-   "terts",
-   "tesla",
-   "testa",
-   "teste",
-   "tests",
-   "tetes",
-   "teths",
-   "tetra",
-   "tetri",
-   "teuch",
-   "teugh",
-   "tewed",
-   "tewel",
-   "tewit",
-   "texas",
-   "texes",
-   "texts",
-   "thack",
-   "thagi",
-   "thaim",
-   "thale",
-   "thali",
-   "thana",
-   "thane",
-   "thang",
-   "thans",
-   "thanx",
-   "tharm",
-   "thars",
-   "thaws",
-   "thawy",
-   "thebe",
-   "theca",
-   "theed",
-   "theek",
-   "thees",
-   "thegn",
-   "theic",
-   "thein",
-   "thelf",
-   "thema",
-   "thens",
-   "theow",
-   "therm",
-   "thesp",
-   "thete",
-   "thews",
-   "thewy",
-   "thigs",
-   "thilk",
-   "thill",
-   "thine",
-   "thins",
-   "thiol",
-   "thirl",
-   "thoft",
-   "thole",
-   "tholi",
-   "thoro",
-   "thorp",
-   "thous",
-   "thowl",
-   "thrae",
-   "thraw",
-   "thrid",
-   "thrip",
-   "throe",
-   "thuds",
-   "thugs",
-   "thuja",
-   "thunk",
-   "thurl",
-   "thuya",
-   "thymi",
-   "thymy",
-   "tians",
-   "tiars",
-   "tical",
-   "ticca",
-   "ticed",
-   "tices",
-   "tichy",
-   "ticks",
-   "ticky",
-   "tiddy",
-   "tided",
-   "tides",
-   "tiers",
-   "tiffs",
-   "tifos",
-   "tifts",
-   "tiges",
-   "tigon",
-   "tikas",
-   "tikes",
-   "tikis",
-   "tikka",
-   "tilak",
-   "tiled",
-   "tiler",
-   "tiles",
-   "tills",
-   "tilly",
-   "tilth",
-   "tilts",
-   "timbo",
-   "timed",
-   "times",
-   "timon",
-   "timps",
-   "tinas",
-   "tinct",
-   "tinds",
-   "tinea",
-   "tined",
-   "tines",
-   "tinge",
-   "tings",
-   "tinks",
-   "tinny",
-   "tints",
-   "tinty",
-   "tipis",
-   "tippy",
-   "tired",
-   "tires",
-   "tirls",
-   "tiros",
-   "tirrs",
-   "titch",
-   "titer",
-   "titis",
-   "titre",
-   "titty",
-   "titup",
-   "tiyin",
-   "tiyns",
-   "tizes",
-   "tizzy",
-   "toads",
-   "toady",
-   "toaze",
-   "tocks",
-   "tocky",
-   "tocos",
-   "todde",
-   "toeas",
-   "toffs",
-   "toffy",
-   "tofts",
-   "tofus",
-   "togae",
-   "togas",
-   "toged",
-   "toges",
-   "togue",
-   "tohos",
-   "toile",
-   "toils",
-   "toing",
-   "toise",
-   "toits",
-   "tokay",
-   "toked",
-   "toker",
-   "tokes",
-   "tokos",
-   "tolan",
-   "tolar",
-   "tolas",
-   "toled",
-   "toles",
-   "tolls",
-   "tolly",
-   "tolts",
-   "tolus",
-   "tolyl",
-   "toman",
-   "tombs",
-   "tomes",
-   "tomia",
-   "tommy",
-   "tomos",
-   "tondi",
-   "tondo",
-   "toned",
-   "toner",
-   "tones",
-   "toney",
-   "tongs",
-   "tonka",
-   "tonks",
-   "tonne",
-   "tonus",
-   "tools",
-   "tooms",
-   "toons",
-   "toots",
-   "toped",
-   "topee",
-   "topek",
-   "toper",
-   "topes",
-   "tophe",
-   "tophi",
-   "tophs",
-   "topis",
-   "topoi",
-   "topos",
-   "toppy",
-   "toque",
-   "torah",
-   "toran",
-   "toras",
-   "torcs",
-   "tores",
-   "toric",
-   "torii",
-   "toros",
-   "torot",
-   "torrs",
-   "torse",
-   "torsi",
-   "torsk",
-   "torta",
-   "torte",
-   "torts",
-   "tosas",
-   "tosed",
-   "toses",
-   "toshy",
-   "tossy",
-   "toted",
-   "toter",
-   "totes",
-   "totty",
-   "touks",
-   "touns",
-   "tours",
-   "touse",
-   "tousy",
-   "touts",
-   "touze",
-   "touzy",
-   "towed",
-   "towie",
-   "towns",
-   "towny",
-   "towse",
-   "towsy",
-   "towts",
-   "towze",
-   "towzy",
-   "toyed",
-   "toyer",
-   "toyon",
-   "toyos",
-   "tozed",
-   "tozes",
-   "tozie",
-   "trabs",
-   "trads",
-   "tragi",
-   "traik",
-   "trams",
-   "trank",
-   "tranq",
-   "trans",
-   "trant",
-   "trape",
-   "traps",
-   "trapt",
-   "trass",
-   "trats",
-   "tratt",
-   "trave",
-   "trayf",
-   "trays",
-   "treck",
-   "treed",
-   "treen",
-   "trees",
-   "trefa",
-   "treif",
-   "treks",
-   "trema",
-   "trems",
-   "tress",
-   "trest",
-   "trets",
-   "trews",
-   "treyf",
-   "treys",
-   "triac",
-   "tride",
-   "trier",
-   "tries",
-   "triff",
-   "trigo",
-   "trigs",
-   "trike",
-   "trild",
-   "trill",
-   "trims",
-   "trine",
-   "trins",
-   "triol",
-   "trior",
-   "trios",
-   "trips",
-   "tripy",
-   "trist",
-   "troad",
-   "troak",
-   "troat",
-   "trock",
-   "trode",
-   "trods",
-   "trogs",
-   "trois",
-   "troke",
-   "tromp",
-   "trona",
-   "tronc",
-   "trone",
-   "tronk",
-   "trons",
-   "trooz",
-   "troth",
-   "trots",
-   "trows",
-   "troys",
-   "trued",
-   "trues",
-   "trugo",
-   "trugs",
-   "trull",
-   "tryer",
-   "tryke",
-   "tryma",
-   "tryps",
-   "tsade",
-   "tsadi",
-   "tsars",
-   "tsked",
-   "tsuba",
-   "tsubo",
-   "tuans",
-   "tuart",
-   "tuath",
-   "tubae",
-   "tubar",
-   "tubas",
-   "tubby",
-   "tubed",
-   "tubes",
-   "tucks",
-   "tufas",
-   "tuffe",
-   "tuffs",
-   "tufts",
-   "tufty",
-   "tugra",
-   "tuile",
-   "tuina",
-   "tuism",
-   "tuktu",
-   "tules",
-   "tulpa",
-   "tulsi",
-   "tumid",
-   "tummy",
-   "tumps",
-   "tumpy",
-   "tunas",
-   "tunds",
-   "tuned",
-   "tuner",
-   "tunes",
-   "tungs",
-   "tunny",
-   "tupek",
-   "tupik",
-   "tuple",
-   "tuque",
-   "turds",
-   "turfs",
-   "turfy",
-   "turks",
-   "turme",
-   "turms",
-   "turns",
-   "turnt",
-   "turps",
-   "turrs",
-   "tushy",
-   "tusks",
-   "tusky",
-   "tutee",
-   "tutti",
-   "tutty",
-   "tutus",
-   "tuxes",
-   "tuyer",
-   "twaes",
-   "twain",
-   "twals",
-   "twank",
-   "twats",
-   "tways",
-   "tweel",
-   "tween",
-   "tweep",
-   "tweer",
-   "twerk",
-   "twerp",
-   "twier",
-   "twigs",
-   "twill",
-   "twilt",
-   "twink",
-   "twins",
-   "twiny",
-   "twire",
-   "twirp",
-   "twite",
-   "twits",
-   "twoer",
-   "twyer",
-   "tyees",
-   "tyers",
-   "tyiyn",
-   "tykes",
-   "tyler",
-   "tymps",
-   "tynde",
-   "tyned",
-   "tynes",
-   "typal",
-   "typed",
-   "types",
-   "typey",
-   "typic",
-   "typos",
-   "typps",
-   "typto",
-   "tyran",
-   "tyred",
-   "tyres",
-   "tyros",
-   "tythe",
-   "tzars",
-   "udals",
-   "udons",
-   "ugali",
-   "ugged",
-   "uhlan",
-   "uhuru",
-   "ukase",
-   "ulama",
-   "ulans",
-   "ulema",
-   "ulmin",
-   "ulnad",
-   "ulnae",
-   "ulnar",
-   "ulnas",
-   "ulpan",
-   "ulvas",
-   "ulyie",
-   "ulzie",
-   "umami",
-   "umbel",
-   "umber",
-   "umble",
-   "umbos",
-   "umbre",
-   "umiac",
-   "umiak",
-   "umiaq",
-   "ummah",
-   "ummas",
-   "ummed",
-   "umped",
-   "umphs",
-   "umpie",
-   "umpty",
-   "umrah",
-   "umras",
-   "unais",
-   "unapt",
-   "unarm",
-   "unary",
-   "unaus",
-   "unbag",
-   "unban",
-   "unbar",
-   "unbed",
-   "unbid",
-   "unbox",
-   "uncap",
-   "unces",
-   "uncia",
-   "uncos",
-   "uncoy",
-   "uncus",
-   "undam",
-   "undee",
-   "undos",
-   "undug",
-   "uneth",
-   "unfix",
-   "ungag",
-   "unget",
-   "ungod",
-   "ungot",
-   "ungum",
-   "unhat",
-   "unhip",
-   "unica",
-   "units",
-   "unjam",
-   "unked",
-   "unket",
-   "unkid",
-   "unlaw",
-   "unlay",
-   "unled",
-   "unlet",
-   "unlid",
-   "unman",
-   "unmew",
-   "unmix",
-   "unpay",
-   "unpeg",
-   "unpen",
-   "unpin",
-   "unred",
-   "unrid",
-   "unrig",
-   "unrip",
-   "unsaw",
-   "unsay",
-   "unsee",
-   "unsew",
-   "unsex",
-   "unsod",
-   "untax",
-   "untin",
-   "unwet",
-   "unwit",
-   "unwon",
-   "upbow",
-   "upbye",
-   "updos",
-   "updry",
-   "upend",
-   "upjet",
-   "uplay",
-   "upled",
-   "uplit",
-   "upped",
-   "upran",
-   "uprun",
-   "upsee",
-   "upsey",
-   "uptak",
-   "upter",
-   "uptie",
-   "uraei",
-   "urali",
-   "uraos",
-   "urare",
-   "urari",
-   "urase",
-   "urate",
-   "urbex",
-   "urbia",
-   "urdee",
-   "ureal",
-   "ureas",
-   "uredo",
-   "ureic",
-   "urena",
-   "urent",
-   "urged",
-   "urger",
-   "urges",
-   "urial",
-   "urite",
-   "urman",
-   "urnal",
-   "urned",
-   "urped",
-   "ursae",
-   "ursid",
-   "urson",
-   "urubu",
-   "urvas",
-   "users",
-   "usnea",
-   "usque",
-   "usure",
-   "usury",
-   "uteri",
-   "uveal",
-   "uveas",
-   "uvula",
-   "vacua",
-   "vaded",
-   "vades",
-   "vagal",
-   "vagus",
-   "vails",
-   "vaire",
-   "vairs",
-   "vairy",
-   "vakas",
-   "vakil",
-   "vales",
-   "valis",
-   "valse",
-   "vamps",
-   "vampy",
-   "vanda",
-   "vaned",
-   "vanes",
-   "vangs",
-   "vants",
-   "vaped",
-   "vaper",
-   "vapes",
-   "varan",
-   "varas",
-   "vardy",
-   "varec",
-   "vares",
-   "varia",
-   "varix",
-   "varna",
-   "varus",
-   "varve",
-   "vasal",
-   "vases",
-   "vasts",
-   "vasty",
-   "vatic",
-   "vatus",
-   "vauch",
-   "vaute",
-   "vauts",
-   "vawte",
-   "vaxes",
-   "veale",
-   "veals",
-   "vealy",
-   "veena",
-   "veeps",
-   "veers",
-   "veery",
-   "vegas",
-   "veges",
-   "vegie",
-   "vegos",
-   "vehme",
-   "veils",
-   "veily",
-   "veins",
-   "veiny",
-   "velar",
-   "velds",
-   "veldt",
-   "veles",
-   "vells",
-   "velum",
-   "venae",
-   "venal",
-   "vends",
-   "vendu",
-   "veney",
-   "venge",
-   "venin",
-   "vents",
-   "venus",
-   "verbs",
-   "verra",
-   "verry",
-   "verst",
-   "verts",
-   "vertu",
-   "vespa",
-   "vesta",
-   "vests",
-   "vetch",
-   "vexed",
-   "vexer",
-   "vexes",
-   "vexil",
-   "vezir",
-   "vials",
-   "viand",
-   "vibes",
-   "vibex",
-   "vibey",
-   "viced",
-   "vices",
-   "vichy",
-   "viers",
-   "views",
-   "viewy",
-   "vifda",
-   "viffs",
-   "vigas",
-   "vigia",
-   "vilde",
-   "viler",
-   "villi",
-   "vills",
-   "vimen",
-   "vinal",
-   "vinas",
-   "vinca",
-   "vined",
-   "viner",
-   "vines",
-   "vinew",
-   "vinic",
-   "vinos",
-   "vints",
-   "viold",
-   "viols",
-   "vired",
-   "vireo",
-   "vires",
-   "virga",
-   "virge",
-   "virid",
-   "virls",
-   "virtu",
-   "visas",
-   "vised",
-   "vises",
-   "visie",
-   "visne",
-   "vison",
-   "visto",
-   "vitae",
-   "vitas",
-   "vitex",
-   "vitro",
-   "vitta",
-   "vivas",
-   "vivat",
-   "vivda",
-   "viver",
-   "vives",
-   "vizir",
-   "vizor",
-   "vleis",
-   "vlies",
-   "vlogs",
-   "voars",
-   "vocab",
-   "voces",
-   "voddy",
-   "vodou",
-   "vodun",
-   "voema",
-   "vogie",
-   "voids",
-   "voile",
-   "voips",
-   "volae",
-   "volar",
-   "voled",
-   "voles",
-   "volet",
-   "volks",
-   "volta",
-   "volte",
-   "volti",
-   "volts",
-   "volva",
-   "volve",
-   "vomer",
-   "voted",
-   "votes",
-   "vouge",
-   "voulu",
-   "vowed",
-   "vower",
-   "voxel",
-   "vozhd",
-   "vraic",
-   "vrils",
-   "vroom",
-   "vrous",
-   "vrouw",
-   "vrows",
-   "vuggs",
-   "vuggy",
-   "vughs",
-   "vughy",
-   "vulgo",
-   "vulns",
-   "vulva",
-   "vutty",
-   "waacs",
-   "wacke",
-   "wacko",
-   "wacks",
-   "wadds",
-   "waddy",
-   "waded",
-   "wader",
-   "wades",
-   "wadge",
-   "wadis",
-   "wadts",
-   "waffs",
-   "wafts",
-   "waged",
-   "wages",
-   "wagga",
-   "wagyu",
-   "wahoo",
-   "waide",
-   "waifs",
-   "waift",
-   "wails",
-   "wains",
-   "wairs",
-   "waite",
-   "waits",
-   "wakas",
-   "waked",
-   "waken",
-   "waker",
-   "wakes",
-   "wakfs",
-   "waldo",
-   "walds",
-   "waled",
-   "waler",
-   "wales",
-   "walie",
-   "walis",
-   "walks",
-   "walla",
-   "walls",
-   "wally",
-   "walty",
-   "wamed",
-   "wames",
-   "wamus",
-   "wands",
-   "waned",
-   "wanes",
-   "waney",
-   "wangs",
-   "wanks",
-   "wanky",
-   "wanle",
-   "wanly",
-   "wanna",
-   "wants",
-   "wanty",
-   "wanze",
-   "waqfs",
-   "warbs",
-   "warby",
-   "wards",
-   "wared",
-   "wares",
-   "warez",
-   "warks",
-   "warms",
-   "warns",
-   "warps",
-   "warre",
-   "warst",
-   "warts",
-   "wases",
-   "washy",
-   "wasms",
-   "wasps",
-   "waspy",
-   "wasts",
-   "watap",
-   "watts",
-   "wauff",
-   "waugh",
-   "wauks",
-   "waulk",
-   "wauls",
-   "waurs",
-   "waved",
-   "waves",
-   "wavey",
-   "wawas",
-   "wawes",
-   "wawls",
-   "waxed",
-   "waxer",
-   "waxes",
-   "wayed",
-   "wazir",
-   "wazoo",
-   "weald",
-   "weals",
-   "weamb",
-   "weans",
-   "wears",
-   "webby",
-   "weber",
-   "wecht",
-   "wedel",
-   "wedgy",
-   "weeds",
-   "weeke",
-   "weeks",
-   "weels",
-   "weems",
-   "weens",
-   "weeny",
-   "weeps",
-   "weepy",
-   "weest",
-   "weete",
-   "weets",
-   "wefte",
-   "wefts",
-   "weids",
-   "weils",
-   "weirs",
-   "weise",
-   "weize",
-   "wekas",
-   "welds",
-   "welke",
-   "welks",
-   "welkt",
-   "wells",
-   "welly",
-   "welts",
-   "wembs",
-   "wends",
-   "wenge",
-   "wenny",
-   "wents",
-   "weros",
-   "wersh",
-   "wests",
-   "wetas",
-   "wetly",
-   "wexed",
-   "wexes",
-   "whamo",
-   "whams",
-   "whang",
-   "whaps",
-   "whare",
-   "whata",
-   "whats",
-   "whaup",
-   "whaur",
-   "wheal",
-   "whear",
-   "wheen",
-   "wheep",
-   "wheft",
-   "whelk",
-   "whelm",
-   "whens",
-   "whets",
-   "whews",
-   "wheys",
-   "whids",
-   "whift",
-   "whigs",
-   "whilk",
-   "whims",
-   "whins",
-   "whios",
-   "whips",
-   "whipt",
-   "whirr",
-   "whirs",
-   "whish",
-   "whiss",
-   "whist",
-   "whits",
-   "whity",
-   "whizz",
-   "whomp",
-   "whoof",
-   "whoot",
-   "whops",
-   "whorl",
-   "whort",
-   "whoso",
-   "whows",
-   "whump",
-   "whups",
-   "whyda",
-   "wicca",
-   "wicks",
-   "wicky",
-   "widdy",
-   "wides",
-   "wiels",
-   "wifed",
-   "wifes",
-   "wifey",
-   "wifie",
-   "wifty",
-   "wigan",
-   "wigga",
-   "wiggy",
-   "wikis",
-   "wilco",
-   "wilds",
-   "wiled",
-   "wiles",
-   "wilga",
-   "wilis",
-   "wilja",
-   "wills",
-   "wilts",
-   "wimps",
-   "winds",
-   "wined",
-   "wines",
-   "winey",
-   "winge",
-   "wings",
-   "wingy",
-   "winks",
-   "winna",
-   "winns",
-   "winos",
-   "winze",
-   "wiped",
-   "wiper",
-   "wipes",
-   "wired",
-   "wirer",
-   "wires",
-   "wirra",
-   "wised",
-   "wises",
-   "wisha",
-   "wisht",
-   "wisps",
-   "wists",
-   "witan",
-   "wited",
-   "wites",
-   "withe",
-   "withs",
-   "withy",
-   "wived",
-   "wiver",
-   "wives",
-   "wizen",
-   "wizes",
-   "woads",
-   "woald",
-   "wocks",
-   "wodge",
-   "woful",
-   "wojus",
-   "woker",
-   "wokka",
-   "wolds",
-   "wolfs",
-   "wolly",
-   "wolve",
-   "wombs",
-   "womby",
-   "womyn",
-   "wonga",
-   "wongi",
-   "wonks",
-   "wonky",
-   "wonts",
-   "woods",
-   "wooed",
-   "woofs",
-   "woofy",
-   "woold",
-   "wools",
-   "woons",
-   "woops",
-   "woopy",
-   "woose",
-   "woosh",
-   "wootz",
-   "words",
-   "works",
-   "worms",
-   "wormy",
-   "worts",
-   "wowed",
-   "wowee",
-   "woxen",
-   "wrang",
-   "wraps",
-   "wrapt",
-   "wrast",
-   "wrate",
-   "wrawl",
-   "wrens",
-   "wrick",
-   "wried",
-   "wrier",
-   "wries",
-   "writs",
-   "wroke",
-   "wroot",
-   "wroth",
-   "wryer",
-   "wuddy",
-   "wudus",
-   "wulls",
-   "wurst",
-   "wuses",
-   "wushu",
-   "wussy",
-   "wuxia",
-   "wyled",
-   "wyles",
-   "wynds",
-   "wynns",
-   "wyted",
-   "wytes",
-   "xebec",
-   "xenia",
-   "xenic",
-   "xenon",
-   "xeric",
-   "xerox",
-   "xerus",
-   "xoana",
-   "xrays",
-   "xylan",
-   "xylem",
-   "xylic",
-   "xylol",
-   "xylyl",
-   "xysti",
-   "xysts",
-   "yaars",
-   "yabas",
-   "yabba",
-   "yabby",
-   "yacca",
-   "yacka",
-   "yacks",
-   "yaffs",
-   "yager",
-   "yages",
-   "yagis",
-   "yahoo",
-   "yaird",
-   "yakka",
-   "yakow",
-   "yales",
-   "yamen",
-   "yampy",
-   "yamun",
-   "yangs",
-   "yanks",
-   "yapok",
-   "yapon",
-   "yapps",
-   "yappy",
-   "yarak",
-   "yarco",
-   "yards",
-   "yarer",
-   "yarfa",
-   "yarks",
-   "yarns",
-   "yarrs",
-   "yarta",
-   "yarto",
-   "yates",
-   "yauds",
-   "yauld",
-   "yaups",
-   "yawed",
-   "yawey",
-   "yawls",
-   "yawns",
-   "yawny",
-   "yawps",
-   "ybore",
-   "yclad",
-   "ycled",
-   "ycond",
-   "ydrad",
-   "ydred",
-   "yeads",
-   "yeahs",
-   "yealm",
-   "yeans",
-   "yeard",
-   "years",
-   "yecch",
-   "yechs",
-   "yechy",
-   "yedes",
-   "yeeds",
-   "yeesh",
-   "yeggs",
-   "yelks",
-   "yells",
-   "yelms",
-   "yelps",
-   "yelts",
-   "yenta",
-   "yente",
-   "yerba",
-   "yerds",
-   "yerks",
-   "yeses",
-   "yesks",
-   "yests",
-   "yesty",
-   "yetis",
-   "yetts",
-   "yeuks",
-   "yeuky",
-   "yeven",
-   "yeves",
-   "yewen",
-   "yexed",
-   "yexes",
-   "yfere",
-   "yiked",
-   "yikes",
-   "yills",
-   "yince",
-   "yipes",
-   "yippy",
-   "yirds",
-   "yirks",
-   "yirrs",
-   "yirth",
-   "yites",
-   "yitie",
-   "ylems",
-   "ylike",
-   "ylkes",
-   "ymolt",
-   "ympes",
-   "yobbo",
-   "yobby",
-   "yocks",
-   "yodel",
-   "yodhs",
-   "yodle",
-   "yogas",
-   "yogee",
-   "yoghs",
-   "yogic",
-   "yogin",
-   "yogis",
-   "yoick",
-   "yojan",
-   "yoked",
-   "yokel",
-   "yoker",
-   "yokes",
-   "yokul",
-   "yolks",
-   "yolky",
-   "yomim",
-   "yomps",
-   "yonic",
-   "yonis",
-   "yonks",
-   "yoofs",
-   "yoops",
-   "yores",
-   "yorks",
-   "yorps",
-   "youks",
-   "yourn",
-   "yours",
-   "yourt",
-   "youse",
-   "yowed",
-   "yowes",
-   "yowie",
-   "yowls",
-   "yowza",
-   "yrapt",
-   "yrent",
-   "yrivd",
-   "yrneh",
-   "ysame",
-   "ytost",
-   "yuans",
-   "yucas",
-   "yucca",
-   "yucch",
-   "yucko",
-   "yucks",
-   "yucky",
-   "yufts",
-   "yugas",
-   "yuked",
-   "yukes",
-   "yukky",
-   "yukos",
-   "yulan",
-   "yules",
-   "yummo",
-   "yummy",
-   "yumps",
-   "yupon",
-   "yuppy",
-   "yurta",
-   "yurts",
-   "yuzus",
-   "zabra",
-   "zacks",
-   "zaida",
-   "zaidy",
-   "zaire",
-   "zakat",
-   "zaman",
-   "zambo",
-   "zamia",
-   "zanja",
-   "zante",
-   "zanza",
-   "zanze",
-   "zappy",
-   "zarfs",
-   "zaris",
-   "zatis",
-   "zaxes",
-   "zayin",
-   "zazen",
-   "zeals",
-   "zebec",
-   "zebub",
-   "zebus",
-   "zedas",
-   "zeins",
-   "zendo",
-   "zerda",
-   "zerks",
-   "zeros",
-   "zests",
-   "zetas",
-   "zexes",
-   "zezes",
-   "zhomo",
-   "zibet",
-   "ziffs",
-   "zigan",
-   "zilas",
-   "zilch",
-   "zilla",
-   "zills",
-   "zimbi",
-   "zimbs",
-   "zinco",
-   "zincs",
-   "zincy",
-   "zineb",
-   "zines",
-   "zings",
-   "zingy",
-   "zinke",
-   "zinky",
-   "zippo",
-   "zippy",
-   "ziram",
-   "zitis",
-   "zizel",
-   "zizit",
-   "zlote",
-   "zloty",
-   "zoaea",
-   "zobos",
-   "zobus",
-   "zocco",
-   "zoeae",
-   "zoeal",
-   "zoeas",
-   "zoism",
-   "zoist",
-   "zombi",
-   "zonae",
-   "zonda",
-   "zoned",
-   "zoner",
-   "zones",
-   "zonks",
-   "zooea",
-   "zooey",
-   "zooid",
-   "zooks",
-   "zooms",
-   "zoons",
-   "zooty",
-   "zoppa",
-   "zoppo",
-   "zoril",
-   "zoris",
-   "zorro",
-   "zouks",
-   "zowee",
-   "zowie",
-   "zulus",
-   "zupan",
-   "zupas",
-   "zuppa",
-   "zurfs",
-   "zuzim",
-   "zygal",
-   "zygon",
-   "zymes",
-   "zymic",
+const uint32_t dict_answers[] = {
+    0x01d3a5b, 0x02857f2, 0x0286ffa, 0x02a1f9b, 0x02a76cb, 0x02d16d9, 0x02d5ff2, 0x02e4efa,
+    0x02e76dd, 0x0381e08, 0x0381ea8, 0x0381ea9, 0x0386ecb, 0x0386f48, 0x038701a, 0x03a1c28,
+    0x03a5256, 0x03a755b, 0x03d1c7a, 0x03d1ea9, 0x03d574c, 0x03d57fe, 0x03d5f3e, 0x03d769a,
+    0x03d76db, 0x03d773a, 0x04040da, 0x0405214, 0x04052cb, 0x04053f2, 0x0406208, 0x040633f,
+    0x0406ad1, 0x0406ad9, 0x0406adf, 0x0461648, 0x04802c8, 0x04802d7, 0x04802df, 0x0480388,
+    0x0480389, 0x048038b, 0x0480391, 0x0480395, 0x0480396, 0x0480398, 0x048075f, 0x048079b,
+    0x0480869, 0x0480b3b, 0x0480e4c, 0x0480ec8, 0x0480ed1, 0x0480ed7, 0x0480edf, 0x0480f4b,
+    0x0480f51, 0x0480f59, 0x0480f5c, 0x0480f8b, 0x0480f91, 0x0480f96, 0x0480f98, 0x0480f9d,
+    0x048134b, 0x048134c, 0x0481356, 0x0481391, 0x0481395, 0x048141e, 0x048142e, 0x0481434,
+    0x04814d4, 0x048164c, 0x0481651, 0x0481658, 0x048165d, 0x048165e, 0x04816d6, 0x04816d9,
+    0x04816fa, 0x048173a, 0x048178f, 0x04817f2, 0x04817fe, 0x0481cc8, 0x0481cd5, 0x0481e4b,
+    0x0481e55, 0x0481f98, 0x0483879, 0x04838db, 0x0483a51, 0x0483a55, 0x0483a5c, 0x0483b3f,
+    0x0483b9f, 0x0483e5c, 0x048424c, 0x0484251, 0x048425e, 0x0484349, 0x048438b, 0x04843fa,
+    0x048440e, 0x0484434, 0x048443e, 0x0484828, 0x048487f, 0x04848ca, 0x0484aa8, 0x0484ab8,
+    0x0484be8, 0x0484e48, 0x0484e4c, 0x0484ecb, 0x0484ed9, 0x0484ef4, 0x0484ff2, 0x048524b,
+    0x048532e, 0x0485357, 0x0485474, 0x04854cb, 0x048562e, 0x0485634, 0x0485734, 0x048573e,
+    0x048574b, 0x048574c, 0x0485758, 0x048575a, 0x04857ee, 0x0485cc9, 0x0485d58, 0x0485f5f,
+    0x0485f88, 0x0485fda, 0x0485fde, 0x048638c, 0x04864c8, 0x048655d, 0x0486649, 0x0486655,
+    0x0486658, 0x04866d1, 0x048674b, 0x048674f, 0x0486755, 0x04867ae, 0x0486a49, 0x0486a5c,
+    0x0486b49, 0x0486b9d, 0x0486c94, 0x0486e48, 0x0486f51, 0x0486f56, 0x0486f59, 0x0486f5f,
+    0x0486f9c, 0x0486ff2, 0x0487249, 0x0487256, 0x048725b, 0x0487393, 0x0487395, 0x04874cb,
+    0x0487632, 0x0487655, 0x048765b, 0x048775f, 0x0487878, 0x0487879, 0x0487b08, 0x0487b35,
+    0x0487b3f, 0x04a173a, 0x04a40c8, 0x04a4358, 0x04a4888, 0x04a4aa8, 0x04a4b38, 0x04a4ba8,
+    0x04a4bc8, 0x04a534f, 0x04a564b, 0x04a56d8, 0x04a5ecb, 0x04a5ed9, 0x04a6cd1, 0x04a6f88,
+    0x04a7788, 0x04a7795, 0x04a7796, 0x04a787b, 0x04a787f, 0x04d0e48, 0x04d0e5f, 0x04d134f,
+    0x04d14c9, 0x04d161a, 0x04d178b, 0x04d1796, 0x04d1c7e, 0x04d1cd3, 0x04d1cdf, 0x04d3a56,
+    0x04d3e4b, 0x04d434b, 0x04d434f, 0x04d467a, 0x04d52d9, 0x04d547a, 0x04d5c7a, 0x04d5e51,
+    0x04d633f, 0x04d664f, 0x04d687a, 0x04d68c9, 0x04d68cb, 0x04d68dd, 0x04d6e56, 0x04d6ec9,
+    0x04d6f56, 0x04d6f99, 0x04d6f9d, 0x04d764f, 0x04d7798, 0x04d7875, 0x04d7e56, 0x04e4aa9,
+    0x04e5657, 0x04e5828, 0x04e5ab8, 0x04e5b3f, 0x04e62b8, 0x04e6649, 0x0601c28, 0x06052cb,
+    0x06053ee, 0x0605ecb, 0x0605ed9, 0x0606028, 0x0606069, 0x060607c, 0x0606208, 0x060627a,
+    0x06062a8, 0x0606338, 0x060633f, 0x06063a8, 0x06063e8, 0x0606658, 0x06067f2, 0x0606a5c,
+    0x0606f99, 0x061f889, 0x0628b3b, 0x0628b98, 0x0628ba8, 0x062c8be, 0x062c8f4, 0x062c8fa,
+    0x062cb3a, 0x062cbf2, 0x062d828, 0x062d8ca, 0x062dab8, 0x062dadd, 0x062dbba, 0x062dbc8,
+    0x062e27a, 0x062e2a8, 0x062e3a8, 0x062e3e8, 0x062faa8, 0x062fb08, 0x062fb3f, 0x0630869,
+    0x0630878, 0x0630b93, 0x0631cdb, 0x0631f5f, 0x0631f8c, 0x0633869, 0x06343fa, 0x063486c,
+    0x0634878, 0x06348ca, 0x06348dc, 0x0634ab8, 0x0635756, 0x0635ac2, 0x0635ad1, 0x0635adb,
+    0x0635adf, 0x0635b3b, 0x0635b89, 0x0635b8b, 0x0635b98, 0x0635b9b, 0x063607f, 0x06362bc,
+    0x063638b, 0x063639b, 0x063786c, 0x0637889, 0x06378be, 0x0637a4c, 0x0637add, 0x0637b93,
+    0x0637b96, 0x0637b9d, 0x0637b9f, 0x0680cd9, 0x0680f4b, 0x0680f98, 0x068101a, 0x06812cb,
+    0x06812db, 0x06813ae, 0x06813ee, 0x06813f4, 0x0681614, 0x0681e9e, 0x0681edb, 0x06842db,
+    0x068487c, 0x0684888, 0x0684889, 0x0684aa8, 0x0684b28, 0x0684b3f, 0x068525f, 0x0685658,
+    0x0686b98, 0x0686bee, 0x0686ec9, 0x0687412, 0x068764f, 0x068775f, 0x06877f2, 0x06878ca,
+    0x068caa9, 0x068cb38, 0x068d878, 0x068d879, 0x068d87c, 0x068daa8, 0x068e33a, 0x068f879,
+    0x068f888, 0x068faa8, 0x069c0d4, 0x069c348, 0x069c349, 0x069c34b, 0x069c34c, 0x069c351,
+    0x069c356, 0x069c357, 0x069c35e, 0x069c35f, 0x069d242, 0x06a0848, 0x06a1e58, 0x06a42db,
+    0x06a4869, 0x06a487c, 0x06a4888, 0x06a4aac, 0x06a4ab8, 0x06a4b35, 0x06a4b38, 0x06a4b3b,
+    0x06a633b, 0x06a633c, 0x06a633f, 0x06a761e, 0x06a77a8, 0x06a8b99, 0x06b487e, 0x06b4b3e,
+    0x06b4b7e, 0x06b5869, 0x06b58be, 0x06b5acb, 0x06b5bfe, 0x06b78fe, 0x06b7a3e, 0x06c8828,
+    0x06c887b, 0x06c887c, 0x06c8a49, 0x06c8a4f, 0x06c8a53, 0x06c8a59, 0x06c8a5c, 0x06c8a5d,
+    0x06c8aa8, 0x06c8b3b, 0x06c8b96, 0x06c8b98, 0x06c9cdb, 0x06cc8fe, 0x06cca08, 0x06cca9a,
+    0x06ccba8, 0x06cd87c, 0x06cda08, 0x06cdab8, 0x06cdad1, 0x06cdad6, 0x06cdb28, 0x06cdb35,
+    0x06cdb5c, 0x06ce07f, 0x06cf828, 0x06cf875, 0x06cfa48, 0x06cfa49, 0x06cfa55, 0x06cfa5f,
+    0x06cfb3c, 0x06cfb3f, 0x06cfb93, 0x06cfb95, 0x06d0f55, 0x06d1e49, 0x06d435b, 0x06d43f2,
+    0x06d501a, 0x06d5e7a, 0x06d5f8b, 0x06d62a8, 0x06d62fa, 0x06d66d9, 0x06d773a, 0x06d7755,
+    0x06d7a32, 0x06d887e, 0x06db878, 0x06dc878, 0x06dc888, 0x06dca3a, 0x06dcb28, 0x06dcbf2,
+    0x06dda3a, 0x06ddad1, 0x06de23a, 0x06e087f, 0x06e134f, 0x06e1395, 0x06e1ed6, 0x06e4359,
+    0x06e4ecb, 0x06e4edb, 0x06e4fee, 0x06e5249, 0x06e54da, 0x06e5869, 0x06e589a, 0x06e5b35,
+    0x06e5c74, 0x06e5e5d, 0x06e5ed9, 0x06e6079, 0x06e6a3a, 0x06e6acb, 0x06e6b51, 0x06e6b8f,
+    0x06e77a8, 0x06e77ee, 0x06f88be, 0x06f8a3a, 0x06f8a4f, 0x06f8a5f, 0x06f8b96, 0x06fc899,
+    0x06fcba8, 0x06fcbc8, 0x06fcbf0, 0x06fd8be, 0x06fdaa8, 0x06fdad9, 0x06ff828, 0x06ff8ca,
+    0x06ff8db, 0x06ff8dc, 0x06ffba8, 0x07016df, 0x0701f4f, 0x0701f89, 0x07050d6, 0x070535f,
+    0x0705391, 0x070539f, 0x0705ecb, 0x07064d1, 0x07068dd, 0x0706f56, 0x0706f9b, 0x0730869,
+    0x0733a7a, 0x0734875, 0x0734878, 0x0734879, 0x07348dc, 0x0734ab8, 0x0734b3b, 0x0735878,
+    0x073587b, 0x073587c, 0x0735b38, 0x0735b3c, 0x0735bda, 0x0736078, 0x0736079, 0x073607c,
+    0x073633c, 0x073633f, 0x0737b3b, 0x0737bda, 0x07d443e, 0x07d5ab8, 0x07e125b, 0x0c3f64c,
+    0x0c3f87f, 0x0c3fb3b, 0x0ca6789, 0x0d08e48, 0x0d09cd8, 0x0d0d87c, 0x0d0dadd, 0x0d0f875,
+    0x0d162a8, 0x0d163e8, 0x0d1e075, 0x0d1e3be, 0x0d28399, 0x0d296cb, 0x0d297fe, 0x0d29cd8,
+    0x0d29cdd, 0x0d29cdf, 0x0d29e55, 0x0d29e56, 0x0d29e58, 0x0d29e5d, 0x0d29ed6, 0x0d29edb,
+    0x0d29edf, 0x0d29f88, 0x0d29f8c, 0x0d29f91, 0x0d2c3fa, 0x0d2c8ca, 0x0d2c8fe, 0x0d2cad1,
+    0x0d2cb5f, 0x0d2d2d9, 0x0d2d8f4, 0x0d2da08, 0x0d2dac9, 0x0d2dacc, 0x0d2db59, 0x0d2e028,
+    0x0d2e0f2, 0x0d2e33c, 0x0d2fa59, 0x0d2fa5d, 0x0d2fa5f, 0x0d30b91, 0x0d310dd, 0x0d310df,
+    0x0d31248, 0x0d3125c, 0x0d31348, 0x0d31356, 0x0d31396, 0x0d3139b, 0x0d3147a, 0x0d31655,
+    0x0d34b95, 0x0d3655c, 0x0d36749, 0x0d3675c, 0x0d36e55, 0x0d37655, 0x0d37a59, 0x0d37b97,
+    0x0d38748, 0x0d38b95, 0x0d390cb, 0x0d390d1, 0x0d390d6, 0x0d390d9, 0x0d390dc, 0x0d39249,
+    0x0d39255, 0x0d39257, 0x0d3925d, 0x0d392c3, 0x0d392c9, 0x0d394d5, 0x0d394d7, 0x0d39649,
+    0x0d3964b, 0x0d39655, 0x0d39658, 0x0d3965b, 0x0d3965f, 0x0d396d3, 0x0d396d5, 0x0d3974c,
+    0x0d39750, 0x0d39759, 0x0d3975b, 0x0d39e4c, 0x0d39e55, 0x0d39f59, 0x0d39f9f, 0x0d3cb55,
+    0x0d3ced1, 0x0d3cedd, 0x0d3cf5f, 0x0d3cf91, 0x0d3dad6, 0x0d3e388, 0x0d3e39b, 0x0d3e7de,
+    0x0d3ecda, 0x0d3ef56, 0x0d3f648, 0x0d3fad9, 0x0d3fbda, 0x0d3fbee, 0x0d6bcdf, 0x0d6be53,
+    0x0d6bf59, 0x0d6bf5f, 0x0d6d878, 0x0d6e38c, 0x0d6e39b, 0x0d80f98, 0x0d81397, 0x0d81656,
+    0x0d84258, 0x0d85359, 0x0d85e7a, 0x0d8639c, 0x0d86799, 0x0d86f55, 0x0d86f96, 0x0d86f9b,
+    0x0d86f9d, 0x0d8773a, 0x0d8cadb, 0x0d8ccd5, 0x0d8ce49, 0x0d8cf53, 0x0d8dad1, 0x0d8e39c,
+    0x0d8eb98, 0x0d8fa3e, 0x0d8fbee, 0x0d940db, 0x0d9425b, 0x0d942d1, 0x0d94355, 0x0d94388,
+    0x0d9439f, 0x0d94b3e, 0x0d954d5, 0x0d95799, 0x0d96e49, 0x0d96e56, 0x0d96f59, 0x0d990d5,
+    0x0d990d6, 0x0d990db, 0x0d9935f, 0x0d99755, 0x0d9d032, 0x0d9d0d9, 0x0da101a, 0x0da101e,
+    0x0da1c28, 0x0da1c7a, 0x0da1f9f, 0x0da1fa8, 0x0da52d9, 0x0da5789, 0x0da66cb, 0x0da76cb,
+    0x0da76d9, 0x0da773a, 0x0da77f2, 0x0da9ed9, 0x0dac0cb, 0x0dade49, 0x0dade58, 0x0dadf91,
+    0x0dadf9b, 0x0dadf9d, 0x0dae39b, 0x0db0a48, 0x0db1ed6, 0x0db6e5f, 0x0db78d3, 0x0db7ba8,
+    0x0db825b, 0x0db838b, 0x0db8399, 0x0db839d, 0x0db8828, 0x0db8a5c, 0x0db9e49, 0x0db9e5d,
+    0x0db9ed7, 0x0db9f8c, 0x0dbcac8, 0x0dbcacb, 0x0dbcacc, 0x0dbcad7, 0x0dbd4cb, 0x0dbd4d6,
+    0x0dbd4db, 0x0dbd655, 0x0dbd658, 0x0dbd659, 0x0dbd6c9, 0x0dbd75b, 0x0dbd75c, 0x0dbd789,
+    0x0dbdaa8, 0x0dbdacb, 0x0dbdadb, 0x0dbdadd, 0x0dbe38c, 0x0dbe396, 0x0dbe39c, 0x0dbee48,
+    0x0dbee4b, 0x0dbee58, 0x0dbee59, 0x0dbee5d, 0x0dbef4c, 0x0dbf796, 0x0dc4155, 0x0dc4bfe,
+    0x0dc5b91, 0x0dc5b9f, 0x0dc638b, 0x0dc68d6, 0x0dc68d9, 0x0dc68dc, 0x0dc6a56, 0x0dc765b,
+    0x0dc775f, 0x0dc787c, 0x0dc7b28, 0x0dc8249, 0x0dc8399, 0x0dc9f98, 0x0dc9f9d, 0x0dce028,
+    0x0dce072, 0x0dce078, 0x0dce27e, 0x0dce29a, 0x0dce2b5, 0x0dcecc8, 0x0dcecdb, 0x0dcecdf,
+    0x0dcee57, 0x0dcee58, 0x0dcee5f, 0x0dceed5, 0x0dcef57, 0x0dcf87b, 0x0dcfa4b, 0x0dcfaa8,
+    0x0dcfaac, 0x0dcfba8, 0x0dd0e48, 0x0dd0ffe, 0x0dd52d9, 0x0dd6ffa, 0x0dd773a, 0x0dd7ffe,
+    0x0dd924b, 0x0dd934c, 0x0dd9e5d, 0x0dddb88, 0x0dde391, 0x0dde4d5, 0x0dde4dc, 0x0dde648,
+    0x0dde65d, 0x0dde75d, 0x0dde795, 0x0dde8d1, 0x0dde8d3, 0x0dde8d9, 0x0ddeb4c, 0x0ddf4d5,
+    0x0df025c, 0x0df10d6, 0x0df10d9, 0x0df10dd, 0x0df12d5, 0x0df134b, 0x0df1cd6, 0x0df1ed3,
+    0x0df1ed5, 0x0df4adc, 0x0df50d1, 0x0df50d6, 0x0df5249, 0x0df524c, 0x0df5355, 0x0df538b,
+    0x0df5aa8, 0x0df5ad1, 0x0df5b3f, 0x0df5be8, 0x0df63c8, 0x0df6cdd, 0x0df6cdf, 0x0df6e51,
+    0x0df6f50, 0x0df6f55, 0x0df74c8, 0x0df74db, 0x0df7748, 0x0df7756, 0x0df7ba8, 0x0df82d7,
+    0x0df8391, 0x0df8869, 0x0df979d, 0x0df97ba, 0x0df9cc8, 0x0df9cd8, 0x0df9cdb, 0x0df9e5e,
+    0x0df9f5c, 0x0dfb86c, 0x0dfb879, 0x0dfba5c, 0x0dfbaa8, 0x0dfbb28, 0x0dfbb98, 0x0dfd634,
+    0x0dfd648, 0x0dfd656, 0x0dfd65b, 0x0dfd79c, 0x0dfda08, 0x0dfdad6, 0x0dfdf97, 0x0dfe38c,
+    0x0dfe6cb, 0x0dfe7ba, 0x0dfe7d2, 0x0dfe7da, 0x0dfeb59, 0x0dfee56, 0x0dff4c8, 0x0dff4d9,
+    0x0dff4db, 0x0dff4dc, 0x0dff4df, 0x0dff648, 0x0dff649, 0x0dff64b, 0x0dff659, 0x0dff6d3,
+    0x0dff6db, 0x0dff748, 0x0dff74c, 0x0dff759, 0x0dff75b, 0x0dff75d, 0x0dff75f, 0x0dff793,
+    0x0dff799, 0x0dff79c, 0x0dff79d, 0x0dff79f, 0x0dffa12, 0x0dffa59, 0x0dffa5c, 0x102d899,
+    0x102da08, 0x102daac, 0x108787b, 0x108787c, 0x1087aa9, 0x1087ab8, 0x1088828, 0x108887c,
+    0x1088b3b, 0x1088b3f, 0x1088be8, 0x108d828, 0x108dab8, 0x108e208, 0x108f828, 0x108faac,
+    0x108fb08, 0x108fb38, 0x108fbe8, 0x10d6075, 0x10d633a, 0x10d63a8, 0x10e1796, 0x10e1ec8,
+    0x10fcaa8, 0x1100ecb, 0x1101012, 0x11013fe, 0x1101b55, 0x110407a, 0x11040df, 0x110424f,
+    0x11042c8, 0x110438b, 0x110438f, 0x11048ca, 0x11057ee, 0x1105fd2, 0x1106ecf, 0x110764f,
+    0x1108a56, 0x1109cd8, 0x1109e58, 0x1109ec8, 0x1109ecf, 0x1109ed7, 0x110cb48, 0x110d828,
+    0x110d878, 0x110d87b, 0x110d87c, 0x110d8c8, 0x110daa8, 0x110dacc, 0x110dad1, 0x110dadd,
+    0x110dbf0, 0x110e028, 0x110e069, 0x110e075, 0x110e079, 0x110e07c, 0x110e27a, 0x110e2a8,
+    0x110e338, 0x110e33c, 0x110f648, 0x110f64f, 0x110f65d, 0x110f6d9, 0x110f788, 0x110f879,
+    0x110fa4c, 0x110fa57, 0x110fb34, 0x110fb3a, 0x112897a, 0x112caa9, 0x112caac, 0x112d828,
+    0x112d89a, 0x112da08, 0x112daa8, 0x112db3b, 0x112db3c, 0x112db3f, 0x112dba8, 0x112dbe8,
+    0x112dfd4, 0x112e028, 0x112e088, 0x112e208, 0x112e23a, 0x112e2a8, 0x112e2b8, 0x112e3a8,
+    0x112e3e8, 0x112eedc, 0x112faa8, 0x112fafa, 0x112fba8, 0x1130a55, 0x1130a58, 0x1130a7a,
+    0x1130acb, 0x1130b8b, 0x1130b91, 0x1130b96, 0x1130b9d, 0x1130bda, 0x1131256, 0x1131395,
+    0x1131cd5, 0x1131cd7, 0x1131cd8, 0x1131e55, 0x1131ec9, 0x1131ecf, 0x1131f8c, 0x1131f9d,
+    0x1134a74, 0x1134aa9, 0x1134adc, 0x113587e, 0x1135a7a, 0x1135ab5, 0x1135ab8, 0x1135ac9,
+    0x1135ad1, 0x1135ad8, 0x1136075, 0x113607a, 0x11362a9, 0x11362ac, 0x11362b8, 0x1136338,
+    0x1136391, 0x1136396, 0x1136397, 0x113639c, 0x1136651, 0x1136798, 0x1136ec8, 0x1136ec9,
+    0x1136ed9, 0x1136f4b, 0x11374d5, 0x113765f, 0x113787a, 0x11378dc, 0x1137a4b, 0x1137b95,
+    0x1137b97, 0x113887b, 0x1138a1a, 0x1138a48, 0x1138a5d, 0x1138ab8, 0x1138b3f, 0x1138b8b,
+    0x1139249, 0x113924c, 0x1139255, 0x1139258, 0x113925b, 0x113925d, 0x11394db, 0x1139651,
+    0x1139f9f, 0x113d828, 0x113d872, 0x113d878, 0x113d87c, 0x113d8f4, 0x113da7a, 0x113da9a,
+    0x113db08, 0x113db28, 0x113db35, 0x113db3e, 0x113e06c, 0x113e0ca, 0x113e3c8, 0x113f869,
+    0x113f86c, 0x113f8c8, 0x113f8ca, 0x113faac, 0x113fb3e, 0x113fba8, 0x113fbc8, 0x113fbee,
+    0x1168a5c, 0x116d878, 0x116d87c, 0x116db3b, 0x116db3c, 0x116dbda, 0x116e07f, 0x116e39b,
+    0x116f875, 0x116fa56, 0x116fac8, 0x1181cd5, 0x1181e08, 0x1181e9a, 0x1181ea9, 0x1181fa8,
+    0x1183a55, 0x11853de, 0x11864cb, 0x11866c9, 0x11876d6, 0x118ce5c, 0x118dab8, 0x118fbf0,
+    0x1190a5c, 0x1190b8b, 0x1190b9c, 0x1191cc8, 0x1191cd5, 0x1191e51, 0x1191e5b, 0x1191ecf,
+    0x1191ed6, 0x1191f59, 0x1191f9c, 0x1191f9f, 0x1194b48, 0x1194b51, 0x11954d3, 0x11954d7,
+    0x11954db, 0x11954df, 0x119565b, 0x11956cc, 0x11956d1, 0x11956dd, 0x119574b, 0x1195756,
+    0x1195791, 0x1195799, 0x119580e, 0x1195828, 0x1195a3a, 0x1195bd2, 0x1196cd1, 0x1196e4b,
+    0x1196e56, 0x1196f48, 0x1196f5b, 0x1196f5d, 0x11974db, 0x119775b, 0x1199651, 0x119965b,
+    0x1199749, 0x1199751, 0x119d258, 0x119d357, 0x11a433a, 0x11aba56, 0x11ae075, 0x11ae23a,
+    0x11ae33c, 0x11af869, 0x11af87b, 0x11b0869, 0x11b0a48, 0x11b0ad9, 0x11b1e5f, 0x11b1f9f,
+    0x11b4b55, 0x11b4b57, 0x11b5869, 0x11b587b, 0x11b587c, 0x11b5ad5, 0x11b5b35, 0x11b5ba8,
+    0x11b6cd4, 0x11b6cd9, 0x11b6e51, 0x11b6e59, 0x11b6ed5, 0x11b6edd, 0x11b6edf, 0x11b6f48,
+    0x11b6f4c, 0x11b6f56, 0x11b7869, 0x11b7875, 0x11b7889, 0x11b78d3, 0x11b7b28, 0x11b7b8f,
+    0x11b7ba8, 0x11b883e, 0x11b8875, 0x11b8878, 0x11b8b3e, 0x11b9f9d, 0x11bd869, 0x11bd87c,
+    0x11bd8fe, 0x11bdaa8, 0x11bdb3b, 0x11bdb3c, 0x11bdba8, 0x11be07e, 0x11be27a, 0x11be359,
+    0x11be3fa, 0x11bf749, 0x11bf81a, 0x11bf875, 0x11bf87b, 0x11bf8b4, 0x11bf8dc, 0x11bfa7a,
+    0x11bfab8, 0x11bfb28, 0x11bfb3c, 0x11bfb3e, 0x11bfbe8, 0x11c0b35, 0x11c0b3f, 0x11c3aa9,
+    0x11c3aab, 0x11c4878, 0x11c4aa9, 0x11c587f, 0x11c5aa8, 0x11c5b3b, 0x11c5b3f, 0x11c635b,
+    0x11c63fc, 0x11c6adf, 0x11c7875, 0x11c7878, 0x11c787c, 0x11c7ab8, 0x11c7b28, 0x11c7bfa,
+    0x11c8875, 0x11c9f9b, 0x11cca08, 0x11cd878, 0x11cdb35, 0x11cdbf2, 0x11ce028, 0x11ce03a,
+    0x11ce075, 0x11ce078, 0x11ce079, 0x11ce174, 0x11ce208, 0x11ce2a8, 0x11ce2b5, 0x11ce338,
+    0x11ce33a, 0x11ceed5, 0x11cf86e, 0x11cf87b, 0x11cf888, 0x11cf889, 0x11cf8f4, 0x11cfaa8,
+    0x11cfaac, 0x11cfba8, 0x11cfbb4, 0x11d6e58, 0x11d8b98, 0x11dc878, 0x11dd879, 0x11dd87c,
+    0x11dda9a, 0x11ddaa8, 0x11de069, 0x11de07c, 0x11de208, 0x11de328, 0x11de33e, 0x11df869,
+    0x11df87c, 0x11dfbe8, 0x11e0755, 0x11e0f96, 0x11e14d8, 0x11e17ee, 0x11e1ede, 0x11e6edc,
+    0x11e76db, 0x11f0b3f, 0x11f5828, 0x11f5879, 0x11f587b, 0x11f589a, 0x11f58ca, 0x11f5aa8,
+    0x11f5b3f, 0x11f5be8, 0x11f6028, 0x11f607b, 0x11f609a, 0x11f60fe, 0x11f62b8, 0x11f633b,
+    0x11f63a8, 0x11f63c8, 0x11f7b3a, 0x11f7ba8, 0x11f8b9b, 0x11f935a, 0x11f9749, 0x11fb828,
+    0x11fc0db, 0x11fc25e, 0x11fc3fa, 0x11fcf4b, 0x11fd158, 0x11fd3ee, 0x11fd651, 0x11fd828,
+    0x11fda08, 0x11fdaa8, 0x11fdaac, 0x11fde49, 0x11fde58, 0x11fde5f, 0x11fdf5b, 0x11fdf97,
+    0x11fdfda, 0x11fe028, 0x11fe2ac, 0x11fe656, 0x11fe7ba, 0x11fe7da, 0x11ff3fa, 0x11ff4c9,
+    0x11ff6db, 0x11ff82e, 0x11ff8be, 0x11ff8dc, 0x11ffa9a, 0x11ffaac, 0x11ffbc8, 0x1229d56,
+    0x1230878, 0x123087b, 0x1230aa8, 0x1230b28, 0x1230b35, 0x1230b3b, 0x1230b3f, 0x1231e56,
+    0x1231e5d, 0x123487f, 0x1234b3f, 0x1235828, 0x1235869, 0x1235878, 0x123587b, 0x1235888,
+    0x123589a, 0x12358ca, 0x1235ad1, 0x1235b28, 0x1235b38, 0x1235b3f, 0x1235bc8, 0x1235bfc,
+    0x1236328, 0x12376cc, 0x1237888, 0x1238748, 0x1238869, 0x1238b82, 0x1238b88, 0x1238b96,
+    0x1239e5e, 0x1239edb, 0x1239f56, 0x1239f5b, 0x1239f5c, 0x1239f8c, 0x1239f97, 0x1239f9f,
+    0x123cac9, 0x123cf5f, 0x123d74c, 0x123d86c, 0x123d888, 0x123dad9, 0x123dadd, 0x123db91,
+    0x123e07b, 0x123e07f, 0x123e0ca, 0x123e328, 0x123e338, 0x123e388, 0x123e389, 0x123e39b,
+    0x123e6d9, 0x123eec9, 0x123ef57, 0x123ef96, 0x123f75f, 0x123fa5f, 0x123fbc8, 0x1290a51,
+    0x1290b89, 0x1290b8b, 0x1290b98, 0x1290b99, 0x1290b9b, 0x1297aa9, 0x1297acc, 0x1297ad7,
+    0x12a7e4b, 0x12b0b89, 0x12b0b8f, 0x12b0b95, 0x12b0b98, 0x12b14d9, 0x12b14db, 0x12b14dd,
+    0x12b164c, 0x12b1651, 0x12b1655, 0x12b1656, 0x12b1658, 0x12b165b, 0x12b165d, 0x12b16cb,
+    0x12b16df, 0x12b174c, 0x12b1755, 0x12b1759, 0x12b175d, 0x12b1797, 0x12b179b, 0x12b1cd1,
+    0x12b1e56, 0x12b1ed5, 0x12b1f5b, 0x12b1f89, 0x12b1f95, 0x12b4ad1, 0x12b4adb, 0x12b5ac9,
+    0x12b5acb, 0x12b5ad1, 0x12b5ad5, 0x12b5adb, 0x12b5b8b, 0x12b5b98, 0x12b6395, 0x12b63be,
+    0x12b6cd1, 0x12b6cd5, 0x12b6cd6, 0x12b6cdb, 0x12b6cdd, 0x12b6e4b, 0x12b6edb, 0x12b6f4c,
+    0x12b6f55, 0x12b6f58, 0x12b6f5f, 0x12b6f98, 0x12b74d6, 0x12b74dc, 0x12b76cc, 0x12b76db,
+    0x12b7aac, 0x12d9f96, 0x12dbb3c, 0x12dd87c, 0x12de8dd, 0x12de951, 0x12de957, 0x12df64b,
+    0x1301ea8, 0x1305ed9, 0x13c8828, 0x13c886c, 0x13c8888, 0x13c8b28, 0x13c8b38, 0x13c8b3f,
+    0x13c8b82, 0x13cd889, 0x13cdb28, 0x13cdb38, 0x13ce06c, 0x13ce075, 0x13ce2a9, 0x13ce33a,
+    0x13ce3da, 0x13cf80e, 0x13cf828, 0x13cf86c, 0x13cf87b, 0x13cf888, 0x13cf894, 0x13cf8c8,
+    0x13cf949, 0x13cf94f, 0x13cf951, 0x13cf959, 0x13cf95e, 0x13cfa12, 0x13cfa9a, 0x13cfaa9,
+    0x13cfadb, 0x13cfb1e, 0x13cfb28, 0x13cfb38, 0x13cfb3f, 0x13cfb99, 0x13cfb9c, 0x13cfbba,
+    0x13e1fa8, 0x1401e08, 0x1401ea8, 0x1428b3b, 0x14a46cb, 0x14a5ed0, 0x14c0878, 0x14c0aa9,
+    0x14c0b35, 0x14c7b38, 0x14d1ea9, 0x14e0848, 0x1509e51, 0x150d8dc, 0x15294be, 0x152972e,
+    0x1529ec9, 0x152cbb4, 0x152db49, 0x152dec3, 0x152df98, 0x152dfce, 0x152e33f, 0x1537648,
+    0x1539255, 0x153934f, 0x1539f9a, 0x153caa9, 0x153e0ca, 0x153ecd3, 0x153f6d9, 0x156bf55,
+    0x156db35, 0x1586fba, 0x1594bd4, 0x1596e56, 0x1596f89, 0x159d396, 0x159e73a, 0x15a8a08,
+    0x15ae8cb, 0x15b1f58, 0x15b52d6, 0x15c1e50, 0x15c4256, 0x15c4348, 0x15c4399, 0x15c4bfe,
+    0x15c5879, 0x15c5b31, 0x15c607a, 0x15c6a56, 0x15c6a5c, 0x15c6b98, 0x15c8a48, 0x15c8a5f,
+    0x15cc87a, 0x15cc95d, 0x15cfab8, 0x15d5398, 0x15de650, 0x15e4e56, 0x15e56d6, 0x15e5f49,
+    0x15e66c8, 0x15e6e56, 0x15eef57, 0x15f1e55, 0x15f578f, 0x15f7795, 0x15fdb90, 0x15fe34f,
+    0x15ff6df, 0x15ff74f, 0x15ffb8f, 0x160587f, 0x1606075, 0x1606338, 0x160633a, 0x1616078,
+    0x1628b9c, 0x162d89a, 0x162d8dc, 0x162daa8, 0x162dab8, 0x162dadb, 0x162dadd, 0x162db9b,
+    0x162db9d, 0x162e088, 0x162e2b8, 0x162e37f, 0x162faa9, 0x162facc, 0x16803ee, 0x1680b38,
+    0x16810db, 0x1684828, 0x1684878, 0x168487b, 0x168487c, 0x168487f, 0x1684889, 0x1684b3b,
+    0x1684ba8, 0x1684bf0, 0x1684fee, 0x1685fde, 0x168767a, 0x1687869, 0x1687875, 0x1687878,
+    0x1687879, 0x168787f, 0x1687aa8, 0x1687b35, 0x1687ba8, 0x16a0848, 0x16a4828, 0x16a4869,
+    0x16a4879, 0x16a487b, 0x16a4aba, 0x16a4b35, 0x16a4bf0, 0x16a607b, 0x16a6b97, 0x16a6f9c,
+    0x16a7648, 0x16a7869, 0x16c8b88, 0x16c8b8b, 0x16c8b8c, 0x16c8b95, 0x16c8b96, 0x16c8b9b,
+    0x16c8b9d, 0x16c8b9f, 0x16cc869, 0x16ccb3b, 0x16ccb5f, 0x16ccba8, 0x16ccbda, 0x16cd828,
+    0x16cd87b, 0x16cd87c, 0x16cdb3b, 0x16cdb3c, 0x16ce07f, 0x16ce33b, 0x16cf87c, 0x16cfb3b,
+    0x16d6028, 0x16d607b, 0x16d633b, 0x16d633f, 0x16d6d48, 0x16e0879, 0x16e0b3f, 0x16e0f4f,
+    0x16e0f51, 0x16e16df, 0x16e1cd1, 0x16e1e1a, 0x16e434b, 0x16e47ba, 0x16e50d1, 0x16e57ee,
+    0x16e5828, 0x16e587b, 0x16e5b35, 0x16e5e4b, 0x16e60f4, 0x16e60fa, 0x16e664b, 0x16e664f,
+    0x16e66c9, 0x16e6751, 0x16e68dd, 0x16e6b49, 0x16e764f, 0x16e7788, 0x16f8b8c, 0x16f8b98,
+    0x16f9f8c, 0x16fcb42, 0x16fcb4c, 0x16fcb5f, 0x16fda08, 0x16fe208, 0x16ff8db, 0x16ff8dc,
+    0x16ffab8, 0x17a68c8, 0x17a7751, 0x17a7b32, 0x17d0e5d, 0x17e0789, 0x17e0f58, 0x17e10d6,
+    0x17e125b, 0x17e143a, 0x17e17b4, 0x17e17fa, 0x17e1d51, 0x17e4256, 0x17e4391, 0x17e443e,
+    0x17e56d6, 0x17e5cd5, 0x17e5cd8, 0x17e6028, 0x17e6789, 0x17e6b56, 0x17e6b98, 0x17e6cc9,
+    0x17e6d58, 0x17e6e55, 0x17e6e56, 0x17e6f88, 0x17e6f89, 0x17e6f92, 0x17e6f98, 0x17e76cb,
+    0x1801ecb, 0x18042db, 0x1815875, 0x1815879, 0x181587b, 0x1815ba8, 0x1816078, 0x1816079,
+    0x181607b, 0x181607c, 0x181607f, 0x18162a8, 0x1816338, 0x181633b, 0x181633f, 0x18163f0,
+    0x1828ab8, 0x1828b96, 0x1828ba8, 0x182c828, 0x182dac2, 0x182dad1, 0x182e088, 0x182e208,
+    0x182e21a, 0x182e23a, 0x182e2a8, 0x182e2a9, 0x182fa58, 0x188064c, 0x188074f, 0x1880e4b,
+    0x1880e5d, 0x1880ec8, 0x1880f5c, 0x1880f8c, 0x1880f98, 0x188134b, 0x188165e, 0x18816f4,
+    0x1881f48, 0x1883f99, 0x188441a, 0x1884875, 0x188487c, 0x18848ca, 0x1884aa8, 0x1885651,
+    0x1885734, 0x188574c, 0x188674b, 0x18868d1, 0x188695d, 0x1886a4b, 0x1886ac8, 0x1886b8c,
+    0x1886f51, 0x1887249, 0x1887254, 0x1887351, 0x1887389, 0x188738c, 0x1887b3a, 0x1897acb,
+    0x1897ad9, 0x1897adf, 0x1897b3a, 0x18a1749, 0x18a4074, 0x18a4255, 0x18a42cf, 0x18a42db,
+    0x18a4a14, 0x18a4b38, 0x18a4b3c, 0x18a52d5, 0x18a56c8, 0x18a5c6e, 0x18a607c, 0x18a68dd,
+    0x18a6b8c, 0x18a78fa, 0x18d107a, 0x18d1256, 0x18d135b, 0x18d165b, 0x18d1e5b, 0x18d1edd,
+    0x18d1f96, 0x18d1fba, 0x18d3a4b, 0x18d424c, 0x18d525b, 0x18d6088, 0x18d63a8, 0x18d6ad1,
+    0x18d6ad9, 0x18d6e58, 0x18d7557, 0x18d7648, 0x18d7649, 0x18d76d6, 0x18d76df, 0x18d7798,
+    0x18d78ba, 0x18d7a08, 0x18d7bee, 0x18d7bf4, 0x18e0789, 0x18e125b, 0x18e12cb, 0x18e1648,
+    0x18e42db, 0x18e4391, 0x18e4828, 0x18e4f3e, 0x18e5828, 0x18e5869, 0x18e5879, 0x18e587b,
+    0x18e587c, 0x18e5a9a, 0x18e5ab8, 0x18e5b28, 0x18e5b35, 0x18e5e58, 0x18e5f8b, 0x18e607c,
+    0x18e68d8, 0x18e6a3a, 0x1901659, 0x1901e08, 0x1901ea9, 0x1901ec8, 0x1901f9f, 0x1905f3a,
+    0x1907bb4, 0x192cba8, 0x192d888, 0x192dab8, 0x192dacb, 0x192db3a, 0x192e028, 0x1935ab8,
+    0x1935ba8, 0x1937875, 0x1981789, 0x1981e5d, 0x1985796, 0x198779c, 0x19a1e08, 0x19a4828,
+    0x19a4878, 0x19a4879, 0x19a4b3c, 0x19a5656, 0x19d04db, 0x19d139b, 0x19d607b, 0x19d607c,
+    0x19d633b, 0x19d633c, 0x19d6ecf, 0x19d78ba, 0x19d7a32, 0x19e0656, 0x19e5b38, 0x19e6ed9,
+    0x19e6f56, 0x19fd815, 0x19fd8ca, 0x19fdacb, 0x1a016c8, 0x1a01d48, 0x1a06078, 0x1a0607c,
+    0x1a2880e, 0x1a28b28, 0x1a2daa8, 0x1a2fab8, 0x1a3587c, 0x1a35b38, 0x1a37878, 0x1a67795,
+    0x1a84828, 0x1a84878, 0x1a84888, 0x1a84aa8, 0x1a84b28, 0x1a84b3b, 0x1a8535b, 0x1aa1c28,
+    0x1aa1e08, 0x1aa4ab8, 0x1aa52cb, 0x1ac0828, 0x1ac0869, 0x1ac0878, 0x1ac0aa9, 0x1ac0ab8,
+    0x1ac0b28, 0x1ac0b35, 0x1ac0b38, 0x1ac5828, 0x1ac5869, 0x1ac5878, 0x1ac5888, 0x1ac5a08,
+    0x1ac5ab8, 0x1ac5b38, 0x1ac6028, 0x1ac7878, 0x1ac7b08, 0x1ac7b3b, 0x1ad6028, 0x1ad6069,
+    0x1ad6079, 0x1ad6088, 0x1ad6208, 0x1ad62ac, 0x1ad6328, 0x1ad63e8, 0x1ae085e, 0x1ae1c28,
+    0x1ae3fee, 0x1ae74c9, 0x1afcaac, 0x1afda08, 0x1b0d87b, 0x1b0f648, 0x1b296cb, 0x1b296d6,
+    0x1b297f2, 0x1b2d256, 0x1b2d356, 0x1b2d55d, 0x1b31251, 0x1b31ecf, 0x1b31f89, 0x1b390dc,
+    0x1b392d5, 0x1b39759, 0x1b39796, 0x1b3e2b5, 0x1b3ecd3, 0x1b3ef55, 0x1b8574f, 0x1b8578b,
+    0x1b86a58, 0x1b914d4, 0x1b91e58, 0x1b91f9f, 0x1b96e49, 0x1b96e56, 0x1b96f51, 0x1b96f59,
+    0x1b96f5b, 0x1b96f9b, 0x1b9d256, 0x1ba5258, 0x1ba9cc9, 0x1bae8d3, 0x1bae8dc, 0x1baea56,
+    0x1baeb51, 0x1bb1359, 0x1bb94d4, 0x1bbc878, 0x1bbef98, 0x1bc7875, 0x1bcdb55, 0x1bcfaab,
+    0x1bd5e49, 0x1bd7692, 0x1bde75d, 0x1bdeac9, 0x1be164b, 0x1be1655, 0x1be1cd8, 0x1be54da,
+    0x1be564b, 0x1be779f, 0x1beee5b, 0x1bf52dc, 0x1bff6d8, 0x1bff6dd, 0x1d06ffe, 0x1d358ca,
+    0x1d3d258, 0x1d96cdf, 0x1d990c8, 0x1dade4b, 0x1dafb3a, 0x1dc5888, 0x1de564b, 0x1df5ab0,
+    0x1dffab8, 0x1e04396, 0x1e04c9a, 0x1e062bc, 0x1e062fa, 0x1e06ffa, 0x1e15869, 0x1e15878,
+    0x1e15879, 0x1e1587b, 0x1e15aa8, 0x1e16075, 0x1e1607c, 0x1e16208, 0x1e2dad5, 0x1e2dbe8,
+    0x1e2f888, 0x1e2f889, 0x1e2faac, 0x1e66f4f, 0x1e802d3, 0x1e80389, 0x1e8038f, 0x1e80399,
+    0x1e8039b, 0x1e80755, 0x1e80878, 0x1e8087c, 0x1e80e57, 0x1e80e5c, 0x1e80ecb, 0x1e80ed1,
+    0x1e80edb, 0x1e80f97, 0x1e80f9d, 0x1e8125e, 0x1e816db, 0x1e81796, 0x1e8179d, 0x1e83e5d,
+    0x1e83edb, 0x1e8425b, 0x1e843fa, 0x1e84828, 0x1e84aac, 0x1e84bf0, 0x1e850be, 0x1e85796,
+    0x1e85e51, 0x1e85ecb, 0x1e85f51, 0x1e864be, 0x1e86651, 0x1e866cb, 0x1e867d2, 0x1e86a58,
+    0x1e86e55, 0x1e87ba8, 0x1ea080e, 0x1ea085e, 0x1ea0e57, 0x1ea0f4b, 0x1ea1257, 0x1ea125b,
+    0x1ea1614, 0x1ea1657, 0x1ea165f, 0x1ea16d5, 0x1ea16d6, 0x1ea16df, 0x1ea174f, 0x1ea1789,
+    0x1ea1ccb, 0x1ea1cd6, 0x1ea1edf, 0x1ea1f4f, 0x1ea1f96, 0x1ea1f98, 0x1ea3b8b, 0x1ea3b91,
+    0x1ea42cb, 0x1ea42d1, 0x1ea4828, 0x1ea4a32, 0x1ea4ef4, 0x1ea52d9, 0x1ea52df, 0x1ea538f,
+    0x1ea5391, 0x1ea539f, 0x1ea56d5, 0x1ea56d6, 0x1ea5749, 0x1ea5796, 0x1ea5cc9, 0x1ea5e58,
+    0x1ea62a8, 0x1ea6655, 0x1ea6e58, 0x1ea6e5b, 0x1ea6ecb, 0x1ea6ed5, 0x1ea6f5f, 0x1ea6f83,
+    0x1ea6f89, 0x1ea7869, 0x1ea78ba, 0x1ed14be, 0x1ed1e58, 0x1ed6028, 0x1ed6079, 0x1ed63a8,
+    0x1ee0e58, 0x1ee0ed9, 0x1ee0f58, 0x1ee0ffa, 0x1ee125b, 0x1ee17ee, 0x1ee1ed5, 0x1ee434f,
+    0x1ee5869, 0x1ee587c, 0x1ee587f, 0x1ee58ca, 0x1ee58fa, 0x1ee5b3f, 0x1ee5bde, 0x1ee5be8,
+    0x1ee607b, 0x1ee63a8, 0x1ee64d5, 0x1ef8b08, 0x1efba32, 0x1efc888, 0x1efc899, 0x1efc8ca,
+    0x1efcaa8, 0x1efcba8, 0x1efcbc8, 0x1efd828, 0x1efdaa8, 0x1efdbc8, 0x1efe03a, 0x1efe069,
+    0x1efe079, 0x1efe3f0, 0x1eff828, 0x1eff870, 0x1eff879, 0x1eff87c, 0x1eff87f, 0x1eff888,
+    0x1eff8ca, 0x1effab8, 0x1effb08, 0x1effba8, 0x1f2cb38, 0x1f2d828, 0x1f2d8ca, 0x1f2daa8,
+    0x1f2dba8, 0x1f2e028, 0x1f2f8ca, 0x1f2faa8, 0x1f2fbc8, 0x1f35b3f, 0x1f36350, 0x1f3787b,
+    0x1f3787f, 0x1f37aac, 0x1f84878, 0x1f84ab8, 0x1f84b28, 0x1fa3a50, 0x1fa4828, 0x1fa486c,
+    0x1fa4878, 0x1fa487b, 0x1fa487f, 0x1fa4889, 0x1fa4b3b, 0x1fa4ba8, 0x1fa4be8, 0x1fa6078,
+    0x1fa6338, 0x1fb0828, 0x1fb0869, 0x1fb0aa8, 0x1fb0ab8, 0x1fb0b35, 0x1fb0b38, 0x1fb0be8,
+    0x1fb486c, 0x1fb4ab8, 0x1fb4b3f, 0x1fb4ba8, 0x1fb5828, 0x1fb5869, 0x1fb586c, 0x1fb5878,
+    0x1fb58ca, 0x1fb5a7a, 0x1fb5aa8, 0x1fb5aac, 0x1fb5b28, 0x1fb5b38, 0x1fb5b3b, 0x1fb5b3f,
+    0x1fb5bc8, 0x1fb5be8, 0x1fb5bf0, 0x1fb6028, 0x1fb6078, 0x1fb607f, 0x1fb62a8, 0x1fb62b8,
+    0x1fb6338, 0x1fb633b, 0x1fb633f, 0x1fb63c8, 0x1fb63f0, 0x1fb7828, 0x1fb7869, 0x1fb7875,
+    0x1fb7878, 0x1fb787b, 0x1fb78ca, 0x1fb7aa9, 0x1fb7ab8, 0x1fb7b28, 0x1fb7b38, 0x1fb7b3f,
+    0x1fc8828, 0x1fc8869, 0x1fc8879, 0x1fc8ab8, 0x1fc8b08, 0x1fc8b28, 0x1fc8b35, 0x1fc8b3f,
+    0x1fc8ba8, 0x1fcd828, 0x1fcd875, 0x1fcd878, 0x1fcd879, 0x1fcd87f, 0x1fcdaa8, 0x1fcdaa9,
+    0x1fcdb35, 0x1fcdb38, 0x1fcdb3b, 0x1fcdb3f, 0x1fcdba8, 0x1fcf828, 0x1fcf879, 0x1fcf87b,
+    0x1fcfaa9, 0x1fcfb28, 0x1fcfb38, 0x1fcfb3b, 0x1fd6078, 0x1fd607b, 0x1fd62a8, 0x1fd63a8,
+    0x1fe4aa8, 0x1ff8a58, 0x1ff8b08, 0x1ffd828, 0x1ffdab8,
 };
-const unsigned words_size = 10638;
+const unsigned dict_answers_size = 2309;
 
+const uint32_t dict_words[] = {
+    0x0321c00, 0x0842c00, 0x0734400, 0x089c400, 0x0010020, 0x0810020, 0x1210020, 0x1328020,
+    0x0050020, 0x0f60020, 0x0368020, 0x0790020, 0x0a90020, 0x00c0020, 0x1200420, 0x0320420,
+    0x1220420, 0x0420820, 0x0c01020, 0x1101020, 0x0459020, 0x1289020, 0x1299020, 0x1222020,
+    0x1122c20, 0x1222c20, 0x1322c20, 0x1672c20, 0x0e3b020, 0x0c3b820, 0x0b43820, 0x0063820,
+    0x0d73820, 0x038b820, 0x048b820, 0x0c04420, 0x1804420, 0x0c44420, 0x0d44420, 0x1244420,
+    0x1824820, 0x1344820, 0x006d020, 0x046d020, 0x129d020, 0x19cd020, 0x1226020, 0x0c96020,
+    0x1240040, 0x0888040, 0x1200840, 0x1870840, 0x0189040, 0x1289040, 0x0099040, 0x1101c40,
+    0x0321c40, 0x1221c40, 0x0e71c40, 0x121a040, 0x181a040, 0x066a040, 0x086a040, 0x0422840,
+    0x1122840, 0x1223040, 0x0243040, 0x0323440, 0x1223440, 0x0a13840, 0x035b840, 0x0324440,
+    0x1224440, 0x1274440, 0x0324c40, 0x0d44c40, 0x0d74c40, 0x125e040, 0x12b0060, 0x12c0060,
+    0x1370460, 0x1700c60, 0x0320c60, 0x1120c60, 0x0e40c60, 0x0458c60, 0x0c21060, 0x0d01c60,
+    0x1422060, 0x1272060, 0x129a060, 0x0d03060, 0x0d23060, 0x1743060, 0x0e0b860, 0x0db3860,
+    0x04cb860, 0x0304460, 0x0324460, 0x0ca4860, 0x0855060, 0x026d060, 0x1395060, 0x1625460,
+    0x009e060, 0x0326460, 0x1226460, 0x0040880, 0x1220c80, 0x1241880, 0x126b880, 0x0444480,
+    0x1274480, 0x1144880, 0x03580a0, 0x00880a0, 0x12880a0, 0x11010a0, 0x0902ca0, 0x048b8a0,
+    0x13444a0, 0x12744a0, 0x00600c0, 0x08600c0, 0x12880c0, 0x13900c0, 0x04a80c0, 0x04c80c0,
+    0x04690c0, 0x12890c0, 0x11218c0, 0x04418c0, 0x08898c0, 0x0e898c0, 0x18898c0, 0x1201cc0,
+    0x005a0c0, 0x12720c0, 0x0c920c0, 0x13920c0, 0x009a0c0, 0x0422cc0, 0x1322cc0, 0x1822cc0,
+    0x0e72cc0, 0x12a2cc0, 0x12030c0, 0x04338c0, 0x046b8c0, 0x126b8c0, 0x03738c0, 0x00444c0,
+    0x0d444c0, 0x12744c0, 0x03250c0, 0x12250c0, 0x006d0c0, 0x089d0c0, 0x0f010e0, 0x13690e0,
+    0x07320e0, 0x036a0e0, 0x066a0e0, 0x136a0e0, 0x035b8e0, 0x0b5d0e0, 0x148d0e0, 0x1200d00,
+    0x0320d00, 0x1220d00, 0x0870d00, 0x1270d00, 0x1889100, 0x1201900, 0x1339900, 0x0322d00,
+    0x0323100, 0x1123100, 0x0423500, 0x0033500, 0x085b900, 0x0324500, 0x1124500, 0x126c500,
+    0x079c500, 0x129c500, 0x0714d00, 0x12a4d00, 0x1125500, 0x0426100, 0x045e500, 0x1222120,
+    0x00aa120, 0x0035120, 0x0d05920, 0x1221140, 0x0059140, 0x0469140, 0x066a140, 0x009a140,
+    0x1202940, 0x0f00160, 0x0a10160, 0x0e60160, 0x0368160, 0x0468160, 0x0668160, 0x1268160,
+    0x1368160, 0x0078160, 0x1278160, 0x1888160, 0x0498160, 0x12c0160, 0x1200560, 0x0420560,
+    0x0340960, 0x1270960, 0x0020d60, 0x1120d60, 0x0b70d60, 0x0a11160, 0x1211160, 0x1229160,
+    0x1329160, 0x0779160, 0x12b1160, 0x04c1160, 0x1201560, 0x0b01960, 0x1201960, 0x0341960,
+    0x0d41960, 0x1171960, 0x0ca1960, 0x1202160, 0x122a160, 0x046a160, 0x1392160, 0x00c2160,
+    0x0442960, 0x1272960, 0x03c2960, 0x0bc2960, 0x0422d60, 0x0b22d60, 0x1242d60, 0x0372d60,
+    0x0bc2d60, 0x0703160, 0x1203160, 0x0723160, 0x1223160, 0x03a3160, 0x06a3160, 0x121b960,
+    0x0323960, 0x1223960, 0x003b960, 0x0d43960, 0x1273960, 0x04b3960, 0x0e3cd60, 0x1274d60,
+    0x005d160, 0x1265160, 0x048d160, 0x1105560, 0x1805960, 0x1238180, 0x0d40180, 0x0498180,
+    0x13a0180, 0x0d00580, 0x1340580, 0x1270580, 0x1888580, 0x0009180, 0x1121180, 0x0469180,
+    0x1269180, 0x1369180, 0x1202180, 0x0412180, 0x0812180, 0x041a180, 0x0e1a180, 0x121a180,
+    0x1222180, 0x0032180, 0x0e32180, 0x046a180, 0x0e6a180, 0x126a180, 0x128a180, 0x1202d80,
+    0x0d03180, 0x0d73180, 0x1273180, 0x0043580, 0x0243580, 0x0e43580, 0x1253980, 0x045b980,
+    0x138b980, 0x11a3980, 0x04ab980, 0x13b3980, 0x0323d80, 0x0ba3d80, 0x1344580, 0x0a15180,
+    0x125e180, 0x00681a0, 0x00981a0, 0x0e389a0, 0x04589a0, 0x0d709a0, 0x0e88da0, 0x11011a0,
+    0x04591a0, 0x13691a0, 0x12019a0, 0x0e599a0, 0x07321a0, 0x045a1a0, 0x125a1a0, 0x00621a0,
+    0x08621a0, 0x0d721a0, 0x04921a0, 0x11229a0, 0x123a9a0, 0x12a29a0, 0x1202da0, 0x0b035a0,
+    0x12035a0, 0x13035a0, 0x12039a0, 0x045b9a0, 0x18639a0, 0x04049a0, 0x0404da0, 0x1104da0,
+    0x1204da0, 0x0324da0, 0x1224da0, 0x1244da0, 0x008cda0, 0x048cda0, 0x1894da0, 0x008d1a0,
+    0x0d761a0, 0x04101e0, 0x04301e0, 0x03401e0, 0x03c01e0, 0x12c01e0, 0x0a011e0, 0x0a211e0,
+    0x12891e0, 0x13891e0, 0x18891e0, 0x11019e0, 0x1241de0, 0x0d021e0, 0x0b721e0, 0x07921e0,
+    0x0c921e0, 0x041b9e0, 0x121b9e0, 0x0f739e0, 0x138b9e0, 0x0b03de0, 0x1803de0, 0x0b23de0,
+    0x0e8bde0, 0x08a3de0, 0x18a3de0, 0x12245e0, 0x12249e0, 0x12449e0, 0x12749e0, 0x0324de0,
+    0x1124de0, 0x0405200, 0x1205200, 0x0008220, 0x1250220, 0x0460220, 0x1288220, 0x1200620,
+    0x0320a20, 0x0838a20, 0x1270a20, 0x12a0a20, 0x0120e20, 0x0888e20, 0x0301220, 0x0401220,
+    0x0b01220, 0x1101220, 0x1201220, 0x0011220, 0x0319220, 0x0419220, 0x1829220, 0x0241220,
+    0x0469220, 0x0079220, 0x0489220, 0x0499220, 0x1299220, 0x1399220, 0x0b01a20, 0x0d01a20,
+    0x0b41a20, 0x0459a20, 0x0b71a20, 0x0d71a20, 0x1371a20, 0x12a1a20, 0x1301e20, 0x1202220,
+    0x0b22220, 0x0852220, 0x125a220, 0x1372220, 0x0792220, 0x0322a20, 0x0322e20, 0x1222e20,
+    0x0323220, 0x1123220, 0x1323220, 0x0b43220, 0x1203620, 0x13a3620, 0x000ba20, 0x003ba20,
+    0x0343a20, 0x1203e20, 0x0d23e20, 0x0704620, 0x1204620, 0x1324620, 0x1244620, 0x1974620,
+    0x0324a20, 0x1224a20, 0x1824a20, 0x1244a20, 0x0b04e20, 0x0b24e20, 0x0244e20, 0x1244e20,
+    0x043d220, 0x1265220, 0x0b05620, 0x0425620, 0x1275620, 0x125e220, 0x0068240, 0x0d70a40,
+    0x12a0a40, 0x0240e40, 0x0321e40, 0x1221e40, 0x1321e40, 0x0322a40, 0x1122a40, 0x0872a40,
+    0x1272a40, 0x0d23e40, 0x1123e40, 0x0243e40, 0x0443e40, 0x1243e40, 0x0e8be40, 0x0804a40,
+    0x0c04a40, 0x1224a40, 0x1924a40, 0x1374a40, 0x1124e40, 0x1144e40, 0x0da4e40, 0x008d240,
+    0x1805a40, 0x0c45a40, 0x005e240, 0x1278260, 0x18b8260, 0x0832260, 0x135a260, 0x1862260,
+    0x1202e60, 0x0d03260, 0x1203260, 0x1273260, 0x1213a60, 0x0453a60, 0x1253a60, 0x1263a60,
+    0x1863a60, 0x186ba60, 0x187ba60, 0x0044660, 0x0f44660, 0x0f04e60, 0x1104e60, 0x1205260,
+    0x0300e80, 0x1121a80, 0x1339a80, 0x1202e80, 0x0242e80, 0x0872e80, 0x1272e80, 0x0b43280,
+    0x1223680, 0x129b680, 0x0404680, 0x0b04680, 0x1104680, 0x1204680, 0x0824680, 0x1224680,
+    0x0244680, 0x1244680, 0x0ca4680, 0x1274e80, 0x0d45e80, 0x04582a0, 0x13682a0, 0x13902a0,
+    0x12592a0, 0x12692a0, 0x12892a0, 0x1201aa0, 0x046a2a0, 0x0d722a0, 0x04922a0, 0x0e922a0,
+    0x04ca2a0, 0x12b3aa0, 0x04ce2a0, 0x0d882c0, 0x0e982c0, 0x04a82c0, 0x12c02c0, 0x1258ec0,
+    0x0b212c0, 0x0e992c0, 0x066a2c0, 0x188b2c0, 0x03236c0, 0x11236c0, 0x125bac0, 0x0a8bac0,
+    0x12592e0, 0x045a2e0, 0x125a2e0, 0x066a2e0, 0x049a2e0, 0x0322ee0, 0x1222ee0, 0x0d032e0,
+    0x0d232e0, 0x0343ae0, 0x046bae0, 0x126bae0, 0x1238300, 0x00c0300, 0x0f59300, 0x0489b00,
+    0x126a300, 0x136bb00, 0x1224700, 0x0444700, 0x1268320, 0x041a320, 0x0e1a320, 0x046a320,
+    0x0d72f20, 0x0243b20, 0x045bb20, 0x126bb20, 0x049bb20, 0x079bb20, 0x0855320, 0x0d8d320,
+    0x188d320, 0x1836320, 0x0466320, 0x1266320, 0x0320001, 0x1258001, 0x1200401, 0x0b20401,
+    0x1220401, 0x0050401, 0x0e70401, 0x0ba0401, 0x12a0401, 0x0010801, 0x0e10801, 0x1810801,
+    0x0038801, 0x1238801, 0x1250801, 0x1818c01, 0x1259001, 0x1229401, 0x1829401, 0x1299401,
+    0x1239801, 0x0441801, 0x1299c01, 0x12a1c01, 0x13a1c01, 0x125a001, 0x0d8a001, 0x0092001,
+    0x079a001, 0x129a001, 0x00ca001, 0x04ca001, 0x0d02401, 0x008a401, 0x088a401, 0x12a2401,
+    0x0322801, 0x0d22801, 0x1222801, 0x008a801, 0x1202c01, 0x121ac01, 0x181ac01, 0x0322c01,
+    0x1222c01, 0x1252c01, 0x1852c01, 0x125ac01, 0x185ac01, 0x1262c01, 0x0e72c01, 0x0092c01,
+    0x089ac01, 0x0da2c01, 0x12a2c01, 0x080b001, 0x0a03401, 0x0e13401, 0x1213401, 0x001b401,
+    0x071b401, 0x121b401, 0x181b401, 0x0323401, 0x1223401, 0x1233401, 0x0043401, 0x1253401,
+    0x126b401, 0x129b401, 0x149b401, 0x189b401, 0x00c3401, 0x12a3c01, 0x040c401, 0x120c401,
+    0x180c401, 0x0014401, 0x041c401, 0x0e1c401, 0x121c401, 0x181c401, 0x0324401, 0x1124401,
+    0x1224401, 0x082c401, 0x122c401, 0x0244401, 0x1254401, 0x1854401, 0x1264401, 0x1864401,
+    0x126c401, 0x186c401, 0x127c401, 0x008c401, 0x048c401, 0x0e8c401, 0x188c401, 0x04c4401,
+    0x0d04801, 0x0324801, 0x0d24801, 0x1124801, 0x1224801, 0x0e3c801, 0x0944801, 0x1254801,
+    0x0d74801, 0x0494801, 0x0894801, 0x0e94801, 0x1894801, 0x009c801, 0x089c801, 0x0e9c801,
+    0x129c801, 0x0324c01, 0x1224c01, 0x123cc01, 0x0a44c01, 0x009cc01, 0x129cc01, 0x149cc01,
+    0x121d001, 0x1255001, 0x0a5d001, 0x128d001, 0x0d45401, 0x121d801, 0x1255801, 0x125d801,
+    0x126d801, 0x128d801, 0x189d801, 0x0326001, 0x1126001, 0x1226001, 0x045e001, 0x129e001,
+    0x1106401, 0x0e76401, 0x1218081, 0x1250081, 0x1850081, 0x1258081, 0x1260081, 0x1860081,
+    0x0e68081, 0x1268081, 0x1868081, 0x0488081, 0x1288081, 0x0798081, 0x1298081, 0x1898081,
+    0x12a0081, 0x13a0081, 0x17a0081, 0x0f70481, 0x0f00881, 0x0450881, 0x1250881, 0x0300c81,
+    0x0b20c81, 0x1220c81, 0x1620c81, 0x0c40c81, 0x04c0c81, 0x0819081, 0x1229081, 0x1279081,
+    0x1289081, 0x1889081, 0x1299081, 0x0671481, 0x0301881, 0x1101881, 0x0c21881, 0x1371881,
+    0x0ca1881, 0x0432081, 0x1832081, 0x126a081, 0x0702881, 0x0702c81, 0x1102c81, 0x1802c81,
+    0x0422c81, 0x0032c81, 0x125ac81, 0x0d72c81, 0x129ac81, 0x0303081, 0x1203081, 0x1743081,
+    0x03a3081, 0x121b481, 0x181b481, 0x1223481, 0x1323481, 0x0033481, 0x1243481, 0x046b481,
+    0x086b481, 0x186b481, 0x0e9b481, 0x129b481, 0x189b481, 0x1303c81, 0x1804481, 0x1224481,
+    0x1234481, 0x0e54481, 0x1254481, 0x0464481, 0x1264481, 0x0174481, 0x0bc4481, 0x1304881,
+    0x1604881, 0x0424881, 0x1224881, 0x1344881, 0x0c74881, 0x1374881, 0x089c881, 0x129c881,
+    0x1204c81, 0x0324c81, 0x1224c81, 0x123cc81, 0x0344c81, 0x0d74c81, 0x009cc81, 0x189cc81,
+    0x1125481, 0x1175481, 0x04a5481, 0x18ad481, 0x1325881, 0x0645881, 0x1226481, 0x0b46481,
+    0x18ce481, 0x12400e1, 0x08480e1, 0x06680e1, 0x12980e1, 0x12590e1, 0x13738e1, 0x006d0e1,
+    0x129d0e1, 0x0710101, 0x0858101, 0x1858101, 0x1208501, 0x1220501, 0x1810901, 0x1220901,
+    0x0320d01, 0x1120d01, 0x1220d01, 0x1320d01, 0x1240d01, 0x0d70d01, 0x0359101, 0x1289101,
+    0x0e29501, 0x1229501, 0x1829501, 0x0341501, 0x0401901, 0x1231901, 0x1831901, 0x0039901,
+    0x1339901, 0x1859901, 0x1271901, 0x1472501, 0x0322901, 0x1122901, 0x1222901, 0x0442901,
+    0x0e0ad01, 0x180ad01, 0x0322d01, 0x1222d01, 0x1832d01, 0x1252d01, 0x125ad01, 0x0703101,
+    0x1203101, 0x0e0b101, 0x0b03501, 0x081b501, 0x121b501, 0x1123501, 0x1223501, 0x1233501,
+    0x1833501, 0x1343501, 0x1253501, 0x129b501, 0x1233901, 0x136b901, 0x009b901, 0x0323d01,
+    0x0373d01, 0x121c501, 0x1254501, 0x045c501, 0x125c501, 0x1274501, 0x128c501, 0x0494501,
+    0x1894501, 0x1224901, 0x1254901, 0x0c74901, 0x1124d01, 0x1224d01, 0x1274d01, 0x1474d01,
+    0x1894d01, 0x049cd01, 0x129cd01, 0x0045501, 0x18ad501, 0x1226501, 0x0ece501, 0x18ce501,
+    0x1208161, 0x1218161, 0x1818161, 0x1120161, 0x1220161, 0x0528161, 0x1230161, 0x1238161,
+    0x0d40161, 0x1260161, 0x1388161, 0x0490161, 0x0790161, 0x0498161, 0x1298161, 0x1398161,
+    0x03a0161, 0x0db0161, 0x12b0161, 0x12c0161, 0x1101161, 0x1209161, 0x0711161, 0x1221161,
+    0x1369161, 0x1389161, 0x1391161, 0x1299161, 0x12c1161, 0x1862161, 0x066a161, 0x086a161,
+    0x126a161, 0x186a161, 0x127a161, 0x1392161, 0x049a161, 0x129a161, 0x04aa161, 0x120b961,
+    0x1213961, 0x1233961, 0x0a73961, 0x0f73961, 0x048b961, 0x129b961, 0x12b3961, 0x18b3961,
+    0x120d161, 0x041d161, 0x121d161, 0x181d161, 0x0325161, 0x1225161, 0x1325161, 0x1825161,
+    0x0345161, 0x0465161, 0x0a6d161, 0x128d161, 0x047e161, 0x12081c1, 0x12501c1, 0x12881c1,
+    0x13881c1, 0x12981c1, 0x02005c1, 0x0a005c1, 0x12005c1, 0x0b705c1, 0x12705c1, 0x00109c1,
+    0x04109c1, 0x08109c1, 0x04389c1, 0x12509c1, 0x0320dc1, 0x1220dc1, 0x0430dc1, 0x0838dc1,
+    0x0458dc1, 0x12791c1, 0x12991c1, 0x05a11c1, 0x0e295c1, 0x12295c1, 0x0d019c1, 0x18219c1,
+    0x18319c1, 0x04419c1, 0x04599c1, 0x04a19c1, 0x12a19c1, 0x0021dc1, 0x1271dc1, 0x125a1c1,
+    0x066a1c1, 0x0a6a1c1, 0x049a1c1, 0x03229c1, 0x07229c1, 0x12229c1, 0x12729c1, 0x1102dc1,
+    0x1202dc1, 0x121adc1, 0x1222dc1, 0x1742dc1, 0x125adc1, 0x1272dc1, 0x129adc1, 0x12a2dc1,
+    0x12031c1, 0x040b1c1, 0x0e0b1c1, 0x120b1c1, 0x04135c1, 0x121b5c1, 0x03235c1, 0x11235c1,
+    0x12235c1, 0x12335c1, 0x04435c1, 0x12535c1, 0x046b5c1, 0x186b5c1, 0x00cb5c1, 0x04cb5c1,
+    0x08039c1, 0x18039c1, 0x120b9c1, 0x181b9c1, 0x03239c1, 0x182b9c1, 0x18339c1, 0x123b9c1,
+    0x12539c1, 0x18539c1, 0x125b9c1, 0x12639c1, 0x18639c1, 0x066b9c1, 0x126b9c1, 0x038b9c1,
+    0x128b9c1, 0x04939c1, 0x129b9c1, 0x187bdc1, 0x0a045c1, 0x0b045c1, 0x12045c1, 0x041c5c1,
+    0x121c5c1, 0x03245c1, 0x04245c1, 0x0b245c1, 0x11245c1, 0x12245c1, 0x0e345c1, 0x02445c1,
+    0x12545c1, 0x12645c1, 0x006c5c1, 0x0d745c1, 0x129c5c1, 0x189c5c1, 0x199c5c1, 0x04449c1,
+    0x12549c1, 0x18549c1, 0x0d749c1, 0x0da49c1, 0x1204dc1, 0x0b24dc1, 0x1224dc1, 0x183cdc1,
+    0x049cdc1, 0x129cdc1, 0x189cdc1, 0x04351c1, 0x12551c1, 0x135d1c1, 0x126d1c1, 0x038d1c1,
+    0x068d1c1, 0x0d8d1c1, 0x04951c1, 0x18951c1, 0x129d1c1, 0x03455c1, 0x13059c1, 0x03259c1,
+    0x11259c1, 0x12259c1, 0x13259c1, 0x04459c1, 0x125d9c1, 0x046d9c1, 0x128d9c1, 0x04959c1,
+    0x0325dc1, 0x0d25dc1, 0x1225dc1, 0x005ddc1, 0x189ddc1, 0x11061c1, 0x14061c1, 0x03261c1,
+    0x122e1c1, 0x12361c1, 0x005e1c1, 0x12761c1, 0x18961c1, 0x12765c1, 0x0800221, 0x0710221,
+    0x0a10221, 0x1310221, 0x1218221, 0x1220221, 0x1230221, 0x0b40221, 0x1250221, 0x1850221,
+    0x0460221, 0x0468221, 0x0a68221, 0x1268221, 0x1368221, 0x1390221, 0x1298221, 0x00a8221,
+    0x08a8221, 0x12b0221, 0x18b8221, 0x12c0221, 0x00c8221, 0x04c8221, 0x0c01221, 0x0419221,
+    0x1219221, 0x0c21221, 0x1121221, 0x1221221, 0x0341221, 0x1241221, 0x0461221, 0x1269221,
+    0x1369221, 0x0489221, 0x1289221, 0x04a9221, 0x12b1221, 0x12c1221, 0x1122221, 0x1222221,
+    0x1232221, 0x0852221, 0x1252221, 0x0b5a221, 0x1262221, 0x126a221, 0x1272221, 0x0492221,
+    0x1292221, 0x079a221, 0x129a221, 0x139a221, 0x04ca221, 0x0713a21, 0x0a13a21, 0x121ba21,
+    0x0733a21, 0x1233a21, 0x0463a21, 0x0e63a21, 0x026ba21, 0x036ba21, 0x0b73a21, 0x1273a21,
+    0x0493a21, 0x1893a21, 0x12b3a21, 0x0735221, 0x0d45221, 0x1345221, 0x045d221, 0x0465221,
+    0x066d221, 0x0a95221, 0x1395221, 0x129d221, 0x1298281, 0x04c8281, 0x0b00681, 0x1200681,
+    0x0008681, 0x0408681, 0x1808681, 0x12a0681, 0x1438a81, 0x0e50a81, 0x1250a81, 0x1450a81,
+    0x1200e81, 0x1240e81, 0x1270e81, 0x0029681, 0x0429681, 0x0829681, 0x0e29681, 0x1229681,
+    0x1829681, 0x1271681, 0x1899681, 0x1259e81, 0x1289e81, 0x1252281, 0x1392281, 0x1222a81,
+    0x120ae81, 0x1832e81, 0x1252e81, 0x005ae81, 0x125ae81, 0x0492e81, 0x0e0b281, 0x122b281,
+    0x077b281, 0x127b281, 0x187b281, 0x1203681, 0x0413681, 0x0e13681, 0x041b681, 0x071b681,
+    0x121b681, 0x131b681, 0x141b681, 0x181b681, 0x1233681, 0x1833681, 0x0043681, 0x044b681,
+    0x184b681, 0x0e53681, 0x1253681, 0x126b681, 0x129b681, 0x189b681, 0x00c3681, 0x12c3a81,
+    0x187be81, 0x0d04681, 0x1204681, 0x120c681, 0x121c681, 0x1324681, 0x082c681, 0x0734681,
+    0x1234681, 0x0d44681, 0x0054681, 0x0454681, 0x1254681, 0x125c681, 0x126c681, 0x0e74681,
+    0x127c681, 0x0084681, 0x0e8c681, 0x128c681, 0x188c681, 0x0094681, 0x0494681, 0x180ca81,
+    0x1224a81, 0x1254a81, 0x1854a81, 0x1494a81, 0x089ca81, 0x129ca81, 0x189ca81, 0x0e24e81,
+    0x1224e81, 0x045ce81, 0x0774e81, 0x129ce81, 0x189ce81, 0x13a4e81, 0x0bc4e81, 0x18ce681,
+    0x00682c1, 0x08c82c1, 0x0320f01, 0x1220f01, 0x0322b01, 0x1222b01, 0x1224701, 0x125c701,
+    0x0894b01, 0x1224f01, 0x1805b01, 0x0320002, 0x1200402, 0x1120402, 0x0170402, 0x0270402,
+    0x0488402, 0x1200802, 0x1250802, 0x1850802, 0x0420c02, 0x1220c02, 0x0430c02, 0x1830c02,
+    0x0440c02, 0x1240c02, 0x0488c02, 0x0011002, 0x0491002, 0x1221402, 0x1229402, 0x0321802,
+    0x1121802, 0x1221802, 0x1371802, 0x1671c02, 0x121a002, 0x126a002, 0x038a002, 0x0d72402,
+    0x0da2402, 0x0322802, 0x1222802, 0x1822802, 0x122ac02, 0x0342c02, 0x0542c02, 0x1742c02,
+    0x1252c02, 0x005ac02, 0x125ac02, 0x1262c02, 0x1862c02, 0x1272c02, 0x007ac02, 0x127ac02,
+    0x04aac02, 0x17c2c02, 0x0d03002, 0x1203002, 0x1223002, 0x1243002, 0x1273002, 0x087b002,
+    0x0e7b002, 0x127b002, 0x187b002, 0x12a3002, 0x0323402, 0x0723402, 0x1123402, 0x1223402,
+    0x1233402, 0x0343402, 0x006b402, 0x126b402, 0x0e93402, 0x1393402, 0x0e9b402, 0x129b402,
+    0x189b402, 0x1203c02, 0x0323c02, 0x1223c02, 0x1723c02, 0x123bc02, 0x1943c02, 0x045bc02,
+    0x0d73c02, 0x1273c02, 0x1373c02, 0x088bc02, 0x0ba3c02, 0x0f04402, 0x0e0c402, 0x120c402,
+    0x180c402, 0x081c402, 0x121c402, 0x181c402, 0x0324402, 0x1124402, 0x1224402, 0x1324402,
+    0x1724402, 0x1254402, 0x045c402, 0x125c402, 0x126c402, 0x186c402, 0x0174402, 0x0c74402,
+    0x0d74402, 0x087c402, 0x127c402, 0x128c402, 0x0494402, 0x009c402, 0x049c402, 0x129c402,
+    0x18ac402, 0x1204802, 0x0e14802, 0x0324802, 0x1224802, 0x1254802, 0x1854802, 0x129c802,
+    0x12a4802, 0x1224c02, 0x001d002, 0x1255002, 0x035d002, 0x125d002, 0x1265002, 0x127d002,
+    0x088d002, 0x0095002, 0x1205402, 0x0325402, 0x0b25402, 0x1125402, 0x1225402, 0x0445402,
+    0x0325802, 0x1255802, 0x0d75c02, 0x04c8082, 0x0340482, 0x0b00882, 0x0ca0882, 0x0320c82,
+    0x1120c82, 0x1220c82, 0x1240c82, 0x000a082, 0x085a082, 0x125a082, 0x0122c82, 0x005ac82,
+    0x085ac82, 0x125ac82, 0x0c72c82, 0x129ac82, 0x0493482, 0x0e9b482, 0x129b482, 0x149b482,
+    0x0b8b882, 0x1223c82, 0x0814482, 0x0324482, 0x1224482, 0x0434482, 0x0044482, 0x0244482,
+    0x046c482, 0x0274482, 0x1274482, 0x129c482, 0x189c482, 0x0494882, 0x009c882, 0x089c882,
+    0x1224c82, 0x0bc4c82, 0x04ae482, 0x04100e2, 0x0a100e2, 0x0e100e2, 0x0e180e2, 0x12180e2,
+    0x13280e2, 0x12400e2, 0x12580e2, 0x12600e2, 0x00680e2, 0x06680e2, 0x0a680e2, 0x04780e2,
+    0x12780e2, 0x13780e2, 0x00880e2, 0x04880e2, 0x0a880e2, 0x11880e2, 0x12880e2, 0x18880e2,
+    0x12980e2, 0x04a80e2, 0x12a80e2, 0x0ab00e2, 0x12b00e2, 0x00c00e2, 0x12c00e2, 0x0f210e2,
+    0x12290e2, 0x00510e2, 0x00590e2, 0x0f590e2, 0x0e610e2, 0x12610e2, 0x04890e2, 0x13890e2,
+    0x07990e2, 0x18a90e2, 0x12b10e2, 0x18b10e2, 0x0e020e2, 0x12020e2, 0x120a0e2, 0x00120e2,
+    0x07120e2, 0x0e120e2, 0x12120e2, 0x0b220e2, 0x12520e2, 0x045a0e2, 0x01620e2, 0x0e620e2,
+    0x0f620e2, 0x046a0e2, 0x066a0e2, 0x0e6a0e2, 0x126a0e2, 0x127a0e2, 0x0a8a0e2, 0x0b8a0e2,
+    0x0c8a0e2, 0x0e8a0e2, 0x118a0e2, 0x138a0e2, 0x148a0e2, 0x129a0e2, 0x04aa0e2, 0x12aa0e2,
+    0x18aa0e2, 0x19ca0e2, 0x0e138e2, 0x12138e2, 0x041b8e2, 0x12338e2, 0x0b438e2, 0x0e538e2,
+    0x18538e2, 0x005b8e2, 0x085b8e2, 0x0e5b8e2, 0x0f638e2, 0x126b8e2, 0x05738e2, 0x0a738e2,
+    0x0c738e2, 0x0d738e2, 0x127b8e2, 0x009b8e2, 0x139b8e2, 0x13a38e2, 0x17a38e2, 0x0ab38e2,
+    0x12b38e2, 0x120d0e2, 0x002d0e2, 0x052d0e2, 0x12350e2, 0x12650e2, 0x0b8d0e2, 0x118d0e2,
+    0x04950e2, 0x129d0e2, 0x045e0e2, 0x04660e2, 0x036e0e2, 0x0b70502, 0x0320d02, 0x1220d02,
+    0x1259102, 0x1831902, 0x0042d02, 0x125ad02, 0x1103102, 0x1723102, 0x1313502, 0x1223502,
+    0x1283502, 0x126b902, 0x087bd02, 0x1214502, 0x1224502, 0x125c502, 0x088c502, 0x0e14902,
+    0x1894902, 0x129c902, 0x0b04d02, 0x0324d02, 0x1124d02, 0x1224d02, 0x1225502, 0x1325502,
+    0x0445502, 0x18ad502, 0x0710162, 0x0418162, 0x1218162, 0x1220162, 0x1230162, 0x0460162,
+    0x1260162, 0x1268162, 0x1278162, 0x1378162, 0x0e88162, 0x1388162, 0x1888162, 0x1390162,
+    0x1298162, 0x13a0162, 0x04a8162, 0x08a8162, 0x12b0162, 0x12c0162, 0x0a11162, 0x0a21162,
+    0x0f21162, 0x1229162, 0x1231162, 0x0a41162, 0x1261162, 0x0479162, 0x1379162, 0x04a9162,
+    0x12b1162, 0x0322162, 0x1222162, 0x132a162, 0x0462162, 0x046a162, 0x136a162, 0x047a162,
+    0x127a162, 0x137a162, 0x129a162, 0x0c03962, 0x121b962, 0x052b962, 0x1233962, 0x0453962,
+    0x0163962, 0x0f63962, 0x0a6b962, 0x126b962, 0x0f73962, 0x1373962, 0x127b962, 0x049b962,
+    0x129b962, 0x11a3962, 0x12a3962, 0x12b3962, 0x04c3962, 0x12c3962, 0x04cb962, 0x120d162,
+    0x1225162, 0x1825162, 0x0a6d162, 0x047e162, 0x001a1a2, 0x13101c2, 0x18181c2, 0x00581c2,
+    0x12581c2, 0x18581c2, 0x13781c2, 0x01881c2, 0x04981c2, 0x08981c2, 0x12981c2, 0x12085c2,
+    0x18085c2, 0x00405c2, 0x04585c2, 0x00c85c2, 0x12009c2, 0x08109c2, 0x0e109c2, 0x12509c2,
+    0x18509c2, 0x12709c2, 0x1200dc2, 0x0220dc2, 0x0320dc2, 0x0d20dc2, 0x1120dc2, 0x1220dc2,
+    0x1720dc2, 0x0d70dc2, 0x12191c2, 0x12295c2, 0x04419c2, 0x0d719c2, 0x04a19c2, 0x0101dc2,
+    0x0d21dc2, 0x0471dc2, 0x0671dc2, 0x1271dc2, 0x122a1c2, 0x0d321c2, 0x125a1c2, 0x126a1c2,
+    0x128a1c2, 0x129a1c2, 0x03229c2, 0x12229c2, 0x1202dc2, 0x180adc2, 0x121adc2, 0x0322dc2,
+    0x1222dc2, 0x1822dc2, 0x0242dc2, 0x0d42dc2, 0x125adc2, 0x185adc2, 0x0672dc2, 0x129adc2,
+    0x00cadc2, 0x04031c2, 0x0b031c2, 0x12031c2, 0x040b1c2, 0x080b1c2, 0x0e0b1c2, 0x120b1c2,
+    0x180b1c2, 0x11231c2, 0x12231c2, 0x17431c2, 0x0e631c2, 0x12631c2, 0x18631c2, 0x0e7b1c2,
+    0x127b1c2, 0x137b1c2, 0x049b1c2, 0x12a31c2, 0x03235c2, 0x12235c2, 0x18235c2, 0x122b5c2,
+    0x00335c2, 0x04335c2, 0x0e335c2, 0x00435c2, 0x0d435c2, 0x12535c2, 0x18535c2, 0x046b5c2,
+    0x126b5c2, 0x049b5c2, 0x0e9b5c2, 0x12a35c2, 0x0eab5c2, 0x07139c2, 0x03239c2, 0x04239c2,
+    0x11239c2, 0x18239c2, 0x122b9c2, 0x12539c2, 0x18539c2, 0x125b9c2, 0x185b9c2, 0x01639c2,
+    0x12639c2, 0x18639c2, 0x127b9c2, 0x137b9c2, 0x13939c2, 0x129b9c2, 0x04cb9c2, 0x0b03dc2,
+    0x1803dc2, 0x0323dc2, 0x0d23dc2, 0x1123dc2, 0x1223dc2, 0x187bdc2, 0x008bdc2, 0x1893dc2,
+    0x08a41c2, 0x0c045c2, 0x040c5c2, 0x180c5c2, 0x121c5c2, 0x03245c2, 0x12245c2, 0x18245c2,
+    0x08345c2, 0x00445c2, 0x12545c2, 0x18545c2, 0x12645c2, 0x086c5c2, 0x0e6c5c2, 0x126c5c2,
+    0x146c5c2, 0x127c5c2, 0x04945c2, 0x0e945c2, 0x02249c2, 0x03249c2, 0x12249c2, 0x13249c2,
+    0x18249c2, 0x04449c2, 0x009c9c2, 0x049c9c2, 0x129c9c2, 0x0d04dc2, 0x0324dc2, 0x1224dc2,
+    0x123cdc2, 0x009cdc2, 0x129cdc2, 0x041d1c2, 0x127d1c2, 0x018d1c2, 0x038d1c2, 0x048d1c2,
+    0x128d1c2, 0x009d1c2, 0x079d1c2, 0x03255c2, 0x12255c2, 0x0d455c2, 0x0b059c2, 0x0d059c2,
+    0x03259c2, 0x12559c2, 0x125d9c2, 0x127d9c2, 0x188d9c2, 0x0405dc2, 0x0b05dc2, 0x0325dc2,
+    0x1225dc2, 0x0145dc2, 0x14061c2, 0x03261c2, 0x11261c2, 0x147e1c2, 0x03265c2, 0x0d265c2,
+    0x12265c2, 0x18265c2, 0x04465c2, 0x0b00222, 0x1208222, 0x1230222, 0x0240222, 0x0640222,
+    0x0450222, 0x0460222, 0x1260222, 0x1268222, 0x0478222, 0x1278222, 0x1878222, 0x0488222,
+    0x12b0222, 0x12c0222, 0x1219222, 0x0b21222, 0x1221222, 0x1261222, 0x0069222, 0x1279222,
+    0x1879222, 0x04b1222, 0x12b1222, 0x1202222, 0x120a222, 0x1222222, 0x1262222, 0x046a222,
+    0x1272222, 0x047a222, 0x127a222, 0x0492222, 0x079a222, 0x129a222, 0x0813a22, 0x1213a22,
+    0x132ba22, 0x1233a22, 0x0163a22, 0x0463a22, 0x0a6ba22, 0x126ba22, 0x0b73a22, 0x0d73a22,
+    0x127ba22, 0x048ba22, 0x1393a22, 0x13a3a22, 0x12b3a22, 0x04cba22, 0x0a15222, 0x0e1d222,
+    0x121d222, 0x181d222, 0x1225222, 0x1325222, 0x132d222, 0x0a6d222, 0x1175222, 0x008d222,
+    0x0495222, 0x1895222, 0x04ad222, 0x079da22, 0x1126222, 0x0469262, 0x1808682, 0x0120682,
+    0x0320682, 0x1120682, 0x1220682, 0x1340682, 0x1818e82, 0x0e29682, 0x1229682, 0x122a282,
+    0x066a282, 0x0792282, 0x129a282, 0x1222a82, 0x0712e82, 0x1322e82, 0x1722e82, 0x125ae82,
+    0x185ae82, 0x1262e82, 0x007ae82, 0x089ae82, 0x129ae82, 0x189ae82, 0x0223282, 0x181b682,
+    0x0823682, 0x1343682, 0x129b682, 0x0b23e82, 0x0343e82, 0x007be82, 0x187be82, 0x1304682,
+    0x120c682, 0x0714682, 0x121c682, 0x181c682, 0x0324682, 0x1124682, 0x1224682, 0x1324682,
+    0x122c682, 0x0044682, 0x0444682, 0x085c682, 0x125c682, 0x126c682, 0x186c682, 0x128c682,
+    0x0894682, 0x1394682, 0x0224a82, 0x183ca82, 0x1254a82, 0x127ca82, 0x187ca82, 0x0e94a82,
+    0x0ca4a82, 0x0714e82, 0x1124e82, 0x1224e82, 0x1824e82, 0x0d44e82, 0x1244e82, 0x0e9ce82,
+    0x189ce82, 0x0fa4e82, 0x0425682, 0x1226682, 0x0714ec2, 0x0e68302, 0x1268302, 0x0300b02,
+    0x1200b02, 0x0e58b02, 0x1120f02, 0x1742f02, 0x0403302, 0x1103302, 0x1203302, 0x1223302,
+    0x0b73302, 0x129cb02, 0x1224f02, 0x0d74f02, 0x1288322, 0x1258003, 0x0008403, 0x1220803,
+    0x0038803, 0x1250803, 0x0700c03, 0x1200c03, 0x1270c03, 0x1229403, 0x1829403, 0x0031803,
+    0x1831803, 0x1271803, 0x1259c03, 0x0e52003, 0x046a003, 0x136a003, 0x1122803, 0x0322c03,
+    0x1222c03, 0x1242c03, 0x045ac03, 0x129ac03, 0x0d03003, 0x1103003, 0x1223003, 0x0463003,
+    0x126b003, 0x127b003, 0x187b003, 0x1813403, 0x1233403, 0x0e43403, 0x1253403, 0x186b403,
+    0x129b403, 0x0504403, 0x120c403, 0x1814403, 0x0324403, 0x1124403, 0x1224403, 0x0034403,
+    0x1234403, 0x0244403, 0x1244403, 0x1254403, 0x126c403, 0x048c403, 0x129c403, 0x08cc403,
+    0x083c803, 0x183c803, 0x0b04c03, 0x0324c03, 0x1124c03, 0x1224c03, 0x1274c03, 0x0e9cc03,
+    0x040d003, 0x120d003, 0x180d003, 0x121d003, 0x135d003, 0x128d003, 0x129d003, 0x0d25403,
+    0x1345403, 0x0705803, 0x121d803, 0x0325803, 0x0d25803, 0x1255803, 0x126d803, 0x129d803,
+    0x0d06003, 0x0716003, 0x136e003, 0x0326403, 0x1126403, 0x1226403, 0x1218083, 0x1140083,
+    0x1258083, 0x1268083, 0x0488083, 0x0d88083, 0x1288083, 0x1888083, 0x0790083, 0x04a8083,
+    0x12b0083, 0x18b0083, 0x0600483, 0x1808483, 0x0b20483, 0x1220483, 0x1298483, 0x03a0483,
+    0x11a0483, 0x12a0483, 0x04c0483, 0x0300883, 0x0500883, 0x0d00883, 0x0e50883, 0x1250883,
+    0x1270883, 0x0b00c83, 0x1219083, 0x1819083, 0x1859083, 0x1261083, 0x1269083, 0x1279083,
+    0x0489083, 0x1289083, 0x1299083, 0x04a9083, 0x12a9083, 0x1301483, 0x0e29483, 0x1241483,
+    0x0671483, 0x1201883, 0x0ca1883, 0x12a1883, 0x0412083, 0x121a083, 0x182a083, 0x125a083,
+    0x0c92083, 0x1392083, 0x0322883, 0x1222883, 0x0e52883, 0x0322c83, 0x1222c83, 0x122ac83,
+    0x132ac83, 0x1242c83, 0x125ac83, 0x185ac83, 0x1272c83, 0x077ac83, 0x129ac83, 0x0d03083,
+    0x1223083, 0x0243083, 0x1343083, 0x0173083, 0x0873083, 0x1273083, 0x137b083, 0x1103483,
+    0x1803483, 0x0713483, 0x1223483, 0x1323483, 0x1243483, 0x129b483, 0x18bb883, 0x1304483,
+    0x1804483, 0x0324483, 0x1224483, 0x0644483, 0x0064483, 0x1264483, 0x126c483, 0x186c483,
+    0x1274483, 0x0e8c483, 0x188c483, 0x079c483, 0x12ac483, 0x1724883, 0x083c883, 0x1244883,
+    0x1254883, 0x0494883, 0x1205483, 0x0b25483, 0x1245483, 0x0d75483, 0x1275483, 0x1375483,
+    0x0d05883, 0x1105883, 0x1705883, 0x0325883, 0x1225c83, 0x0445c83, 0x00080e3, 0x12500e3,
+    0x12580e3, 0x11520e3, 0x080b8e3, 0x045b8e3, 0x0b5b8e3, 0x125b8e3, 0x089b8e3, 0x12b38e3,
+    0x089d0e3, 0x1310103, 0x1258103, 0x0468103, 0x0ec8103, 0x1208503, 0x0320903, 0x1120903,
+    0x1220903, 0x1338903, 0x1250903, 0x1850903, 0x1370903, 0x0098903, 0x1298903, 0x1898903,
+    0x1818d03, 0x0440d03, 0x1270d03, 0x1390d03, 0x1209103, 0x1259103, 0x0469103, 0x1299103,
+    0x1229503, 0x1339903, 0x1202903, 0x0322903, 0x1122903, 0x1222903, 0x1822903, 0x0e1ad03,
+    0x085ad03, 0x125ad03, 0x0e0b103, 0x1123103, 0x1223103, 0x127b103, 0x1103503, 0x0323503,
+    0x1223503, 0x0433503, 0x1233503, 0x0243503, 0x1253503, 0x1853503, 0x006b503, 0x1273503,
+    0x129b503, 0x125b903, 0x009b903, 0x187bd03, 0x0e93d03, 0x0c04503, 0x1124503, 0x0454503,
+    0x1254503, 0x125c503, 0x129c503, 0x1204903, 0x0814903, 0x1214903, 0x183c903, 0x1254903,
+    0x0464903, 0x0b04d03, 0x1204d03, 0x0324d03, 0x1224d03, 0x1894d03, 0x129cd03, 0x18ccd03,
+    0x0d05503, 0x1205503, 0x0325503, 0x1225503, 0x1245503, 0x006d503, 0x1275503, 0x1375503,
+    0x18ad503, 0x0d05903, 0x0445d03, 0x1345d03, 0x1206103, 0x0d26503, 0x0d6a123, 0x126a123,
+    0x12081c3, 0x12981c3, 0x18085c3, 0x12205c3, 0x04405c3, 0x00585c3, 0x00885c3, 0x0e885c3,
+    0x13389c3, 0x12509c3, 0x12709c3, 0x12a09c3, 0x1818dc3, 0x1270dc3, 0x12511c3, 0x12891c3,
+    0x13911c3, 0x07991c3, 0x12295c3, 0x0d019c3, 0x12219c3, 0x18219c3, 0x0e319c3, 0x18319c3,
+    0x04419c3, 0x0ec1dc3, 0x135a1c3, 0x185a1c3, 0x129a1c3, 0x12725c3, 0x0412dc3, 0x0812dc3,
+    0x0322dc3, 0x1222dc3, 0x0042dc3, 0x125adc3, 0x0062dc3, 0x1172dc3, 0x1272dc3, 0x129adc3,
+    0x0b031c3, 0x03231c3, 0x12231c3, 0x02431c3, 0x07035c3, 0x12035c3, 0x04235c3, 0x11235c3,
+    0x00335c3, 0x12335c3, 0x0e535c3, 0x006b5c3, 0x046b5c3, 0x186b5c3, 0x18935c3, 0x120b9c3,
+    0x04139c3, 0x181b9c3, 0x12539c3, 0x045b9c3, 0x125b9c3, 0x185b9c3, 0x12639c3, 0x18639c3,
+    0x006b9c3, 0x0d8b9c3, 0x128b9c3, 0x18cb9c3, 0x1203dc3, 0x0323dc3, 0x1123dc3, 0x1223dc3,
+    0x03045c3, 0x000c5c3, 0x120c5c3, 0x04245c3, 0x12245c3, 0x02445c3, 0x12445c3, 0x12545c3,
+    0x18545c3, 0x12645c3, 0x18645c3, 0x127c5c3, 0x128c5c3, 0x00945c3, 0x04945c3, 0x129c5c3,
+    0x189c5c3, 0x08049c3, 0x12049c3, 0x03249c3, 0x07249c3, 0x11249c3, 0x12249c3, 0x003c9c3,
+    0x0b04dc3, 0x0324dc3, 0x1124dc3, 0x1224dc3, 0x189cdc3, 0x11051c3, 0x04151c3, 0x12151c3,
+    0x12551c3, 0x005d1c3, 0x00651c3, 0x12651c3, 0x127d1c3, 0x008d1c3, 0x04951c3, 0x129d1c3,
+    0x03255c3, 0x0d255c3, 0x11255c3, 0x12255c3, 0x04455c3, 0x11059c3, 0x121d9c3, 0x03259c3,
+    0x11259c3, 0x04459c3, 0x045d9c3, 0x125d9c3, 0x185d9c3, 0x006d9c3, 0x126d9c3, 0x127d9c3,
+    0x04959c3, 0x129d9c3, 0x0325dc3, 0x1225dc3, 0x0445dc3, 0x0d261c3, 0x185e1c3, 0x03265c3,
+    0x11265c3, 0x12265c3, 0x1208223, 0x0a10223, 0x0e10223, 0x0528223, 0x1230223, 0x0b40223,
+    0x1260223, 0x1368223, 0x1278223, 0x1298223, 0x04a8223, 0x12b0223, 0x12c0223, 0x1101223,
+    0x0a11223, 0x0321223, 0x1121223, 0x1221223, 0x1231223, 0x1251223, 0x1369223, 0x0489223,
+    0x1391223, 0x12c1223, 0x120a223, 0x0412223, 0x1222223, 0x185a223, 0x127a223, 0x137a223,
+    0x0343a23, 0x0b43a23, 0x0453a23, 0x045ba23, 0x0463a23, 0x186ba23, 0x0173a23, 0x0673a23,
+    0x0a73a23, 0x127ba23, 0x137ba23, 0x0aa3a23, 0x12b3a23, 0x120d223, 0x1235223, 0x1265223,
+    0x047d223, 0x0495223, 0x1895223, 0x18bd223, 0x0306223, 0x1206223, 0x0e0ba43, 0x0e63a43,
+    0x1218283, 0x1258283, 0x1268283, 0x1288283, 0x0e08683, 0x0b00a83, 0x1300a83, 0x1220a83,
+    0x1250a83, 0x1850a83, 0x1298a83, 0x1818e83, 0x0320e83, 0x1220e83, 0x1259283, 0x1299283,
+    0x1399283, 0x1229683, 0x12a1683, 0x066a283, 0x129a283, 0x1202a83, 0x0322a83, 0x1222a83,
+    0x0052a83, 0x0412e83, 0x1222e83, 0x0042e83, 0x125ae83, 0x0492e83, 0x1203283, 0x0e0b283,
+    0x120b283, 0x0053283, 0x1853283, 0x127b283, 0x0c03683, 0x0713683, 0x1223683, 0x1233683,
+    0x1833683, 0x1253683, 0x0e6b683, 0x186b683, 0x0793683, 0x129b683, 0x0863a83, 0x0e63a83,
+    0x0323e83, 0x1123e83, 0x1223e83, 0x045be83, 0x185be83, 0x187be83, 0x0b04683, 0x1204683,
+    0x0324683, 0x1224683, 0x1834683, 0x126c683, 0x0274683, 0x1274683, 0x1874683, 0x008c683,
+    0x128c683, 0x188c683, 0x1394683, 0x0ca4683, 0x08cc683, 0x1254a83, 0x129ca83, 0x1225e83,
+    0x0b002c3, 0x04582c3, 0x0c582c3, 0x12602c3, 0x06682c3, 0x0ca02c3, 0x01212c3, 0x045a2c3,
+    0x046a2c3, 0x1218303, 0x1289303, 0x0d72b03, 0x0b23703, 0x1223703, 0x1271f23, 0x0489804,
+    0x0322c04, 0x1222c04, 0x0323404, 0x121c404, 0x0324404, 0x125c404, 0x126c404, 0x136c404,
+    0x1394404, 0x0324804, 0x1124804, 0x1224804, 0x045c804, 0x129c804, 0x043cc04, 0x0325404,
+    0x1225404, 0x0320424, 0x1320424, 0x126b824, 0x0a73824, 0x1218044, 0x0321c44, 0x1221c44,
+    0x1271c44, 0x12a4444, 0x0061064, 0x0321864, 0x1121864, 0x1221864, 0x045a064, 0x129a064,
+    0x0415064, 0x1315064, 0x1342484, 0x1893484, 0x0d25484, 0x126d484, 0x03214a4, 0x12180c4,
+    0x12890c4, 0x13910c4, 0x11018c4, 0x03218c4, 0x11218c4, 0x12030c4, 0x066a0e4, 0x1120d04,
+    0x1270d04, 0x0469904, 0x0322904, 0x0d72904, 0x121ad04, 0x0b24904, 0x0e1a124, 0x1202944,
+    0x0d40164, 0x0368164, 0x1268164, 0x0838964, 0x0d40d64, 0x0861164, 0x0321564, 0x0302164,
+    0x136a164, 0x0d23164, 0x0433964, 0x1833964, 0x0d43964, 0x127b964, 0x0423d64, 0x0d44964,
+    0x049d164, 0x0d05564, 0x0d25564, 0x1125564, 0x1225564, 0x1210184, 0x1100584, 0x1800584,
+    0x0670584, 0x1670584, 0x1770584, 0x12a0584, 0x1121184, 0x0369184, 0x0689184, 0x1889184,
+    0x12a1184, 0x1212184, 0x128a184, 0x129a184, 0x1203184, 0x1123184, 0x1323184, 0x1623184,
+    0x12c3184, 0x084b984, 0x066b984, 0x049b984, 0x04ab984, 0x129bd84, 0x045d184, 0x048d184,
+    0x041e184, 0x121e184, 0x0c881a4, 0x04981a4, 0x0320da4, 0x1120da4, 0x1620da4, 0x04a0da4,
+    0x12b11a4, 0x17415a4, 0x02021a4, 0x1342da4, 0x16231a4, 0x06735a4, 0x08539a4, 0x125b9a4,
+    0x0c8b9a4, 0x12b39a4, 0x0b745a4, 0x16249a4, 0x18549a4, 0x0044da4, 0x048d1a4, 0x0d8d1a4,
+    0x08755a4, 0x0cc65a4, 0x125c5c4, 0x0d449c4, 0x13101e4, 0x12211e4, 0x0701de4, 0x1201de4,
+    0x0371de4, 0x1171de4, 0x12121e4, 0x041b9e4, 0x137b9e4, 0x12445e4, 0x1225204, 0x0345204,
+    0x0040624, 0x12a9224, 0x0d71a24, 0x1271a24, 0x1371a24, 0x12a1e24, 0x0012224, 0x0a12224,
+    0x1212224, 0x066a224, 0x0323624, 0x1223624, 0x0493a24, 0x0324624, 0x1224a24, 0x1315224,
+    0x0e35224, 0x12ad224, 0x0d25624, 0x0b45624, 0x1100a44, 0x1370a44, 0x045a244, 0x1102a44,
+    0x1122a44, 0x1223644, 0x1224a44, 0x0274e44, 0x0f74e44, 0x0e8ce44, 0x0430264, 0x0478264,
+    0x1298264, 0x1269264, 0x0b01e64, 0x0469e64, 0x0bc1e64, 0x1212264, 0x1203664, 0x0d44e64,
+    0x045ce64, 0x1245264, 0x0425a64, 0x0066264, 0x1239a84, 0x0322a84, 0x0303e84, 0x1274684,
+    0x0b74a84, 0x12692a4, 0x13892a4, 0x12992a4, 0x0471ea4, 0x125a2a4, 0x049a2a4, 0x043baa4,
+    0x12892c4, 0x13912c4, 0x1671ec4, 0x0322ac4, 0x12602e4, 0x13012e4, 0x12112e4, 0x0c212e4,
+    0x04612e4, 0x0b416e4, 0x12222e4, 0x046a2e4, 0x066a2e4, 0x129a2e4, 0x041bae4, 0x0463ae4,
+    0x126bae4, 0x1303ee4, 0x1273ee4, 0x041d2e4, 0x125d2e4, 0x018d2e4, 0x1290304, 0x1289304,
+    0x129bb04, 0x1204704, 0x1224704, 0x0444704, 0x1144704, 0x046a324, 0x1808405, 0x0320805,
+    0x1120805, 0x1220805, 0x0040805, 0x0098805, 0x1298805, 0x1818c05, 0x0320c05, 0x1120c05,
+    0x1220c05, 0x0430c05, 0x1270c05, 0x0069005, 0x1889005, 0x1229405, 0x1829405, 0x0d41805,
+    0x1252005, 0x125a005, 0x046a005, 0x126a005, 0x128a005, 0x0322805, 0x1122805, 0x1222805,
+    0x1822805, 0x0442805, 0x1142805, 0x0902c05, 0x125ac05, 0x0323005, 0x1223005, 0x0b03405,
+    0x121b405, 0x1223405, 0x0033405, 0x0e33405, 0x1233405, 0x1253405, 0x0d73405, 0x1273405,
+    0x0ca3405, 0x1144005, 0x0304405, 0x0814405, 0x1814405, 0x121c405, 0x0324405, 0x1124405,
+    0x1224405, 0x045c405, 0x125c405, 0x1264405, 0x1274405, 0x0e8c405, 0x0494405, 0x129c405,
+    0x0814805, 0x089c805, 0x129c805, 0x0324c05, 0x1224c05, 0x185cc05, 0x0e94c05, 0x00b4c05,
+    0x0735005, 0x035d005, 0x126d005, 0x038d005, 0x129d005, 0x04ad005, 0x1205405, 0x0b25405,
+    0x1125405, 0x1225405, 0x12a5405, 0x126d805, 0x186d805, 0x0325c05, 0x1225c05, 0x0326005,
+    0x1126005, 0x046e005, 0x048e005, 0x0326405, 0x1226405, 0x1258085, 0x0488085, 0x1288085,
+    0x1388085, 0x0490085, 0x1298085, 0x04c8085, 0x1220885, 0x1338885, 0x1340885, 0x1250885,
+    0x1720c85, 0x1209085, 0x1219085, 0x1259085, 0x1269085, 0x1289085, 0x0491085, 0x04c9085,
+    0x0461c85, 0x136a085, 0x1392085, 0x0712c85, 0x0342c85, 0x125ac85, 0x185ac85, 0x129ac85,
+    0x189ac85, 0x0b03085, 0x1223085, 0x1863085, 0x121b485, 0x181b485, 0x1243485, 0x1253485,
+    0x186b485, 0x129b485, 0x121b885, 0x052b885, 0x1124485, 0x1224485, 0x0044485, 0x185c485,
+    0x0864485, 0x1264485, 0x126c485, 0x186c485, 0x0494885, 0x009c885, 0x129c885, 0x189c885,
+    0x1204c85, 0x0324c85, 0x1224c85, 0x1174c85, 0x009cc85, 0x129cc85, 0x00b4c85, 0x1105085,
+    0x121d085, 0x0325085, 0x0326085, 0x1126085, 0x185e085, 0x1226485, 0x18ce485, 0x1288105,
+    0x1298105, 0x0e88505, 0x1220905, 0x0438905, 0x1438905, 0x0d40905, 0x1270905, 0x1220d05,
+    0x0430d05, 0x1270d05, 0x1229105, 0x1369105, 0x0489105, 0x1289105, 0x1391105, 0x0321505,
+    0x1121505, 0x1221505, 0x1241505, 0x1831905, 0x1271905, 0x0322905, 0x1222905, 0x1102d05,
+    0x0712d05, 0x0322d05, 0x1222d05, 0x0842d05, 0x1252d05, 0x045ad05, 0x0e5ad05, 0x125ad05,
+    0x0862d05, 0x1262d05, 0x1272d05, 0x0ca2d05, 0x0013505, 0x121b505, 0x0323505, 0x1223505,
+    0x1243505, 0x1253505, 0x186b505, 0x1273505, 0x038b905, 0x123c105, 0x04a4105, 0x0324505,
+    0x1124505, 0x1224505, 0x0444505, 0x1254505, 0x1264505, 0x126c505, 0x188c505, 0x079c505,
+    0x1214905, 0x1254905, 0x129c905, 0x189c905, 0x0714d05, 0x185cd05, 0x006cd05, 0x049cd05,
+    0x129cd05, 0x1125505, 0x1225505, 0x0325d05, 0x1225d05, 0x1345d05, 0x0359125, 0x1208165,
+    0x0528165, 0x1230165, 0x1250165, 0x0c60165, 0x1260165, 0x1860165, 0x0468165, 0x1268165,
+    0x1278165, 0x1888165, 0x1298165, 0x00a8165, 0x0db0165, 0x12b0165, 0x18b0165, 0x18b8165,
+    0x12c0165, 0x0c01165, 0x1201165, 0x0a21165, 0x1121165, 0x1221165, 0x1231165, 0x0461165,
+    0x11a1165, 0x12b1165, 0x08b9165, 0x0eb9165, 0x12c1165, 0x1212165, 0x0322165, 0x1222165,
+    0x0f62165, 0x1262165, 0x127a165, 0x128a165, 0x0a92165, 0x049a165, 0x129a165, 0x139a165,
+    0x120b965, 0x1213965, 0x1223965, 0x1233965, 0x066b965, 0x127b965, 0x128b965, 0x188b965,
+    0x0793965, 0x009b965, 0x049b965, 0x12b3965, 0x120d165, 0x0325165, 0x1225165, 0x1825165,
+    0x1855165, 0x0f65165, 0x1175165, 0x118d165, 0x189d165, 0x13c5165, 0x180e165, 0x047e165,
+    0x049e165, 0x12581c5, 0x12601c5, 0x0d391c5, 0x18219c5, 0x04419c5, 0x04599c5, 0x14719c5,
+    0x1269dc5, 0x121a1c5, 0x125a1c5, 0x126a1c5, 0x121adc5, 0x1822dc5, 0x0042dc5, 0x0242dc5,
+    0x0442dc5, 0x1252dc5, 0x1852dc5, 0x12231c5, 0x001b5c5, 0x121b5c5, 0x141b5c5, 0x12235c5,
+    0x185b5c5, 0x129b5c5, 0x121b9c5, 0x181b9c5, 0x125b9c5, 0x129b9c5, 0x189b9c5, 0x0c045c5,
+    0x120c5c5, 0x180c5c5, 0x0e1c5c5, 0x121c5c5, 0x0b245c5, 0x12245c5, 0x17245c5, 0x12545c5,
+    0x18545c5, 0x04645c5, 0x12645c5, 0x129c5c5, 0x00cc5c5, 0x04cc5c5, 0x00949c5, 0x04949c5,
+    0x13051c5, 0x121d1c5, 0x11251c5, 0x13251c5, 0x045d1c5, 0x125d1c5, 0x136d1c5, 0x128d1c5,
+    0x079d1c5, 0x00255c5, 0x125d9c5, 0x079d9c5, 0x0325dc5, 0x1225dc5, 0x0445dc5, 0x045e1c5,
+    0x046e1c5, 0x1208225, 0x0a10225, 0x1310225, 0x1230225, 0x0c40225, 0x0268225, 0x0478225,
+    0x1278225, 0x1290225, 0x0498225, 0x0898225, 0x1298225, 0x12a0225, 0x12c0225, 0x1221225,
+    0x1321225, 0x1341225, 0x0361225, 0x0069225, 0x0d71225, 0x0489225, 0x1299225, 0x120a225,
+    0x1122225, 0x1222225, 0x1232225, 0x0492225, 0x1392225, 0x079a225, 0x129a225, 0x139a225,
+    0x04ca225, 0x19ca225, 0x1223a25, 0x1233a25, 0x126ba25, 0x048ba25, 0x0d8ba25, 0x188ba25,
+    0x0793a25, 0x12b3a25, 0x18b3a25, 0x1235225, 0x0f65225, 0x0795225, 0x1395225, 0x1126225,
+    0x1100685, 0x1808685, 0x1890685, 0x1250a85, 0x12a0a85, 0x1818e85, 0x1830e85, 0x1259285,
+    0x0e89285, 0x1229685, 0x1829685, 0x0b01a85, 0x1831a85, 0x0441a85, 0x0e41a85, 0x0459a85,
+    0x1859a85, 0x12a1a85, 0x1242685, 0x125ae85, 0x0323285, 0x1123285, 0x1223285, 0x1323285,
+    0x081b685, 0x121b685, 0x181b685, 0x0e33685, 0x1233685, 0x1253685, 0x0b04685, 0x0d04685,
+    0x0014685, 0x125c685, 0x0b74685, 0x128c685, 0x079c685, 0x04cc685, 0x18cc685, 0x0324a85,
+    0x0424a85, 0x0b24a85, 0x1224a85, 0x0b44a85, 0x1254a85, 0x129ca85, 0x189ca85, 0x0d74e85,
+    0x0326685, 0x0426685, 0x1226685, 0x0b46685, 0x1220b05, 0x0322b05, 0x1222b05, 0x1222f05,
+    0x121c705, 0x049cf05, 0x0008406, 0x1808406, 0x0458406, 0x0818c06, 0x1220c06, 0x0430c06,
+    0x0340c06, 0x1240c06, 0x0448c06, 0x0e48c06, 0x0e90c06, 0x1229406, 0x0321806, 0x1121806,
+    0x1221806, 0x121a006, 0x126a006, 0x128a006, 0x009a006, 0x129a006, 0x139a006, 0x1272406,
+    0x0702c06, 0x1202c06, 0x1702c06, 0x0022c06, 0x0322c06, 0x1222c06, 0x125ac06, 0x185ac06,
+    0x0f72c06, 0x13a2c06, 0x0eaac06, 0x1203006, 0x1803006, 0x000b006, 0x040b006, 0x0e0b006,
+    0x120b006, 0x0323006, 0x1223006, 0x1823006, 0x0243006, 0x0d43006, 0x0463006, 0x1863006,
+    0x127b006, 0x0713406, 0x181b406, 0x0523406, 0x1523406, 0x1233406, 0x004b406, 0x0573406,
+    0x129b406, 0x125b806, 0x0323c06, 0x1123c06, 0x1223c06, 0x1273c06, 0x187bc06, 0x040c406,
+    0x0e0c406, 0x120c406, 0x001c406, 0x1224406, 0x1244406, 0x1264406, 0x086c406, 0x048c406,
+    0x079c406, 0x0ca4406, 0x1224806, 0x127c806, 0x187c806, 0x129c806, 0x0714c06, 0x0324c06,
+    0x1124c06, 0x1224c06, 0x123cc06, 0x1174c06, 0x0715006, 0x1815006, 0x121d006, 0x044d006,
+    0x135d006, 0x1265006, 0x1865006, 0x127d006, 0x128d006, 0x1295006, 0x18cd006, 0x1375406,
+    0x1815806, 0x121d806, 0x1255806, 0x127d806, 0x1895806, 0x0b06006, 0x0b06406, 0x1106406,
+    0x0326406, 0x1226406, 0x0d76406, 0x0e76406, 0x1258086, 0x1268086, 0x0488086, 0x1288086,
+    0x1298086, 0x11a0486, 0x1250886, 0x1251086, 0x1279086, 0x1391086, 0x1392086, 0x129a086,
+    0x121ac86, 0x0422c86, 0x0342c86, 0x185ac86, 0x129ac86, 0x0b23086, 0x0063086, 0x1863086,
+    0x1373086, 0x0b03486, 0x1203486, 0x1223486, 0x1323486, 0x0243486, 0x0843486, 0x0f43486,
+    0x186b486, 0x0073486, 0x0c73486, 0x0e8b486, 0x129b486, 0x189b486, 0x00a3486, 0x12a3486,
+    0x041b886, 0x0343886, 0x0704486, 0x040c486, 0x1224486, 0x045c486, 0x1264486, 0x1864486,
+    0x046c486, 0x0494886, 0x0e94886, 0x049c886, 0x129c886, 0x1204c86, 0x0fa4c86, 0x1265086,
+    0x0d06086, 0x1126086, 0x13900e6, 0x12980e6, 0x13a00e6, 0x08c80e6, 0x12210e6, 0x13910e6,
+    0x0b5e0e6, 0x0320506, 0x0b20506, 0x1120506, 0x1220506, 0x0858506, 0x12a0506, 0x1299506,
+    0x1201906, 0x0439906, 0x1371906, 0x04a1906, 0x1202d06, 0x121ad06, 0x1322d06, 0x125ad06,
+    0x185ad06, 0x187ad06, 0x129ad06, 0x0b23106, 0x0463106, 0x127b106, 0x187b106, 0x0713506,
+    0x0433506, 0x1233506, 0x1253506, 0x186b506, 0x0ecb506, 0x0d73d06, 0x0e7bd06, 0x187bd06,
+    0x121c506, 0x125c506, 0x126c506, 0x0d74506, 0x1274506, 0x128c506, 0x0794506, 0x129c506,
+    0x0e64906, 0x1264906, 0x129c906, 0x0714d06, 0x1224d06, 0x1395106, 0x0325506, 0x1225506,
+    0x0e66506, 0x0410166, 0x1218166, 0x1818166, 0x0a40166, 0x1140166, 0x1260166, 0x1268166,
+    0x1888166, 0x0ca0166, 0x11a0166, 0x18c8166, 0x0009166, 0x0409166, 0x1809166, 0x0419166,
+    0x1219166, 0x0321166, 0x0a21166, 0x1221166, 0x1321166, 0x1241166, 0x1269166, 0x1369166,
+    0x12c1166, 0x0b02166, 0x1202166, 0x120a166, 0x052a166, 0x132a166, 0x0452166, 0x0462166,
+    0x1262166, 0x0a92166, 0x129a166, 0x199a166, 0x0c03966, 0x080b966, 0x120b966, 0x180b966,
+    0x041b966, 0x0633966, 0x1263966, 0x0f73966, 0x127b966, 0x1393966, 0x13a3966, 0x12b3966,
+    0x04cb966, 0x0325166, 0x1125166, 0x1225166, 0x1825166, 0x1235166, 0x0465166, 0x1265166,
+    0x0d75166, 0x049d166, 0x129d166, 0x0b881a6, 0x11881a6, 0x12881a6, 0x12981a6, 0x0db01a6,
+    0x12b01a6, 0x12b39a6, 0x12181c6, 0x12281c6, 0x12581c6, 0x18881c6, 0x12981c6, 0x18981c6,
+    0x0d005c6, 0x11005c6, 0x08085c6, 0x0e085c6, 0x18085c6, 0x12405c6, 0x12705c6, 0x1320dc6,
+    0x0e90dc6, 0x12591c6, 0x12891c6, 0x13911c6, 0x07991c6, 0x18991c6, 0x11215c6, 0x12295c6,
+    0x00319c6, 0x12719c6, 0x11221c6, 0x12425c6, 0x121adc6, 0x181adc6, 0x1222dc6, 0x122adc6,
+    0x047adc6, 0x127adc6, 0x0e0b1c6, 0x11231c6, 0x007b1c6, 0x07135c6, 0x05235c6, 0x12335c6,
+    0x00435c6, 0x05435c6, 0x12535c6, 0x006b5c6, 0x05735c6, 0x12c35c6, 0x0ecb5c6, 0x180b9c6,
+    0x121b9c6, 0x122b9c6, 0x12339c6, 0x18539c6, 0x035b9c6, 0x125b9c6, 0x185b9c6, 0x126b9c6,
+    0x186b9c6, 0x127b9c6, 0x187b9c6, 0x128b9c6, 0x188b9c6, 0x18939c6, 0x0a03dc6, 0x0a43dc6,
+    0x0b045c6, 0x12045c6, 0x03245c6, 0x12245c6, 0x12445c6, 0x12645c6, 0x18645c6, 0x127c5c6,
+    0x04945c6, 0x18945c6, 0x133c9c6, 0x04949c6, 0x0714dc6, 0x123cdc6, 0x183cdc6, 0x009cdc6,
+    0x07151c6, 0x12551c6, 0x008d1c6, 0x129d1c6, 0x189d1c6, 0x0d059c6, 0x121d9c6, 0x122d9c6,
+    0x12559c6, 0x125d9c6, 0x126d9c6, 0x1225dc6, 0x0c461c6, 0x045e1c6, 0x0b00226, 0x1208226,
+    0x1218226, 0x0528226, 0x0f40226, 0x0060226, 0x0460226, 0x0f60226, 0x1260226, 0x0068226,
+    0x1268226, 0x1878226, 0x12a8226, 0x12c0226, 0x0409226, 0x0e09226, 0x0411226, 0x0a21226,
+    0x1221226, 0x0431226, 0x0e31226, 0x0d41226, 0x1269226, 0x0491226, 0x04a9226, 0x12b1226,
+    0x12c1226, 0x0412226, 0x041a226, 0x121a226, 0x052a226, 0x132a226, 0x1232226, 0x0452226,
+    0x126a226, 0x1372226, 0x127a226, 0x137a226, 0x187a226, 0x0492226, 0x1392226, 0x1892226,
+    0x079a226, 0x129a226, 0x04ca226, 0x1303a26, 0x181ba26, 0x1233a26, 0x1253a26, 0x0063a26,
+    0x046ba26, 0x0573a26, 0x1993a26, 0x129ba26, 0x05a3a26, 0x18aba26, 0x12b3a26, 0x125c626,
+    0x0b8c626, 0x120d226, 0x0325226, 0x1225226, 0x042d226, 0x0465226, 0x0f65226, 0x036d226,
+    0x0416226, 0x041e226, 0x0456226, 0x047e226, 0x137e226, 0x0e10286, 0x0068286, 0x0e68286,
+    0x1268286, 0x1288286, 0x1250a86, 0x1850a86, 0x1220e86, 0x1229686, 0x1201a86, 0x121a286,
+    0x0f62286, 0x0e8a286, 0x0602e86, 0x1102e86, 0x1202e86, 0x1222e86, 0x1322e86, 0x122ae86,
+    0x182ae86, 0x125ae86, 0x077ae86, 0x127ae86, 0x187ae86, 0x0063286, 0x0863286, 0x127b286,
+    0x181b686, 0x0433686, 0x1833686, 0x1253686, 0x1853686, 0x186b686, 0x0d44286, 0x181c686,
+    0x0434686, 0x125c686, 0x185c686, 0x126c686, 0x188c686, 0x0794686, 0x12a4686, 0x183ca86,
+    0x005ca86, 0x045ca86, 0x085ca86, 0x1894a86, 0x129ca86, 0x1894e86, 0x009ce86, 0x189ce86,
+    0x0326286, 0x045e286, 0x1376286, 0x0496286, 0x046a2c6, 0x1258306, 0x1268306, 0x0320706,
+    0x1220706, 0x0359306, 0x127b306, 0x0403706, 0x0443706, 0x186b706, 0x1273706, 0x00cbb06,
+    0x1273f06, 0x0e7bf06, 0x187bf06, 0x0b04706, 0x0324706, 0x1224706, 0x0d74706, 0x1274706,
+    0x12a4706, 0x1224f06, 0x0325706, 0x1225706, 0x1228007, 0x1288007, 0x0458407, 0x12a0407,
+    0x0a20807, 0x1250807, 0x0b00c07, 0x0320c07, 0x1220c07, 0x0848c07, 0x1390c07, 0x1261007,
+    0x1299007, 0x1229407, 0x1941407, 0x1299407, 0x1231807, 0x1201c07, 0x0a12007, 0x0052007,
+    0x1252007, 0x1452007, 0x125a007, 0x185a007, 0x126a007, 0x136a007, 0x128a007, 0x079a007,
+    0x1222407, 0x1242407, 0x084a407, 0x0c02807, 0x1202807, 0x0022807, 0x1222807, 0x0c42807,
+    0x12a2807, 0x0b02c07, 0x0322c07, 0x1122c07, 0x1222c07, 0x002ac07, 0x122ac07, 0x0342c07,
+    0x0e5ac07, 0x125ac07, 0x0062c07, 0x1262c07, 0x0d72c07, 0x1272c07, 0x0492c07, 0x129ac07,
+    0x00aac07, 0x00b2c07, 0x0b03007, 0x000b007, 0x0323007, 0x1223007, 0x1863007, 0x00cb007,
+    0x0f03407, 0x0413407, 0x0713407, 0x121b407, 0x0833407, 0x1233407, 0x1253407, 0x1853407,
+    0x0093407, 0x0493407, 0x129b407, 0x045b807, 0x0063807, 0x1703c07, 0x185bc07, 0x087bc07,
+    0x12a3c07, 0x0c04407, 0x121c407, 0x0324407, 0x1224407, 0x0c44407, 0x1254407, 0x125c407,
+    0x1264407, 0x126c407, 0x1274407, 0x127c407, 0x129c407, 0x183c807, 0x1254807, 0x127c807,
+    0x009c807, 0x0324c07, 0x1224c07, 0x003cc07, 0x121d007, 0x122d007, 0x0735007, 0x035d007,
+    0x0c5d007, 0x125d007, 0x135d007, 0x126d007, 0x0495007, 0x1125407, 0x1225407, 0x0325807,
+    0x1255807, 0x1265807, 0x0495807, 0x0326007, 0x1126007, 0x1826007, 0x045e007, 0x0d06407,
+    0x0326407, 0x1126407, 0x1226407, 0x1218087, 0x0358087, 0x1258087, 0x0460087, 0x1278087,
+    0x1878087, 0x0488087, 0x1288087, 0x1390087, 0x1298087, 0x0d20487, 0x1220487, 0x1338887,
+    0x1250887, 0x1120c87, 0x1830c87, 0x1219087, 0x1819087, 0x1259087, 0x04c9087, 0x0499487,
+    0x1299487, 0x121a087, 0x0732087, 0x125a087, 0x128a087, 0x0102487, 0x008a487, 0x0322c87,
+    0x1222c87, 0x0e42c87, 0x125ac87, 0x1262c87, 0x1272c87, 0x1372c87, 0x127ac87, 0x04aac87,
+    0x0b03087, 0x1223087, 0x0243087, 0x0d43087, 0x127b087, 0x187b087, 0x0713487, 0x121b487,
+    0x0433487, 0x006b487, 0x186b487, 0x188b487, 0x129b487, 0x1103c87, 0x120c487, 0x180c487,
+    0x121c487, 0x1224487, 0x125c487, 0x0064487, 0x1264487, 0x126c487, 0x1274487, 0x188c487,
+    0x0494487, 0x199c487, 0x04c4487, 0x127c887, 0x129c887, 0x1224c87, 0x123cc87, 0x0715087,
+    0x0735087, 0x0025487, 0x0325887, 0x1125887, 0x0735887, 0x0305c87, 0x0325c87, 0x1125c87,
+    0x1225c87, 0x0bc5c87, 0x0326087, 0x1368107, 0x1250907, 0x0320d07, 0x1120d07, 0x1220d07,
+    0x1261107, 0x1239907, 0x1339907, 0x0102507, 0x008a507, 0x0322907, 0x1122907, 0x1222907,
+    0x0872907, 0x1102d07, 0x0712d07, 0x0e5ad07, 0x125ad07, 0x129ad07, 0x0ca2d07, 0x12a2d07,
+    0x0e0b107, 0x1403507, 0x121b507, 0x1233507, 0x1853507, 0x186b507, 0x129b507, 0x1243907,
+    0x185bd07, 0x0324507, 0x0424507, 0x1124507, 0x1224507, 0x1894907, 0x129c907, 0x043cd07,
+    0x0325507, 0x1125507, 0x1225507, 0x0d26507, 0x03201c7, 0x18301c7, 0x12881c7, 0x18881c7,
+    0x13901c7, 0x12705c7, 0x12509c7, 0x12a09c7, 0x0300dc7, 0x0048dc7, 0x12891c7, 0x0d019c7,
+    0x0d219c7, 0x12319c7, 0x12399c7, 0x0321dc7, 0x0a121c7, 0x03221c7, 0x12521c7, 0x066a1c7,
+    0x04921c7, 0x12029c7, 0x03229c7, 0x12229c7, 0x18229c7, 0x12429c7, 0x14529c7, 0x0ca29c7,
+    0x121adc7, 0x0322dc7, 0x1222dc7, 0x1822dc7, 0x1252dc7, 0x005adc7, 0x0e5adc7, 0x0462dc7,
+    0x1262dc7, 0x0d72dc7, 0x1272dc7, 0x129adc7, 0x12031c7, 0x03231c7, 0x12231c7, 0x18231c7,
+    0x04431c7, 0x04631c7, 0x0d035c7, 0x001b5c7, 0x121b5c7, 0x03235c7, 0x11235c7, 0x12235c7,
+    0x08335c7, 0x12335c7, 0x12535c7, 0x18535c7, 0x07139c7, 0x121b9c7, 0x181b9c7, 0x18239c7,
+    0x122b9c7, 0x00539c7, 0x12539c7, 0x18539c7, 0x185b9c7, 0x126b9c7, 0x127b9c7, 0x038b9c7,
+    0x128b9c7, 0x07939c7, 0x129b9c7, 0x189b9c7, 0x04ab9c7, 0x0a03dc7, 0x0323dc7, 0x1123dc7,
+    0x1223dc7, 0x187bdc7, 0x07045c7, 0x0b045c7, 0x12045c7, 0x12445c7, 0x12545c7, 0x04645c7,
+    0x126c5c7, 0x13945c7, 0x18945c7, 0x03249c7, 0x0b249c7, 0x0d249c7, 0x11249c7, 0x12249c7,
+    0x18249c7, 0x009c9c7, 0x129c9c7, 0x0714dc7, 0x0d24dc7, 0x189cdc7, 0x052d1c7, 0x122d1c7,
+    0x07351c7, 0x088d1c7, 0x128d1c7, 0x129d1c7, 0x00255c7, 0x03255c7, 0x0d255c7, 0x12255c7,
+    0x040d9c7, 0x12259c7, 0x052d9c7, 0x122d9c7, 0x12559c7, 0x125d9c7, 0x048d9c7, 0x0e959c7,
+    0x0325dc7, 0x1225dc7, 0x12061c7, 0x03261c7, 0x045e1c7, 0x1808687, 0x1250a87, 0x0068e87,
+    0x03a0e87, 0x1289287, 0x1229687, 0x1829687, 0x1121a87, 0x1831a87, 0x12a1e87, 0x1202287,
+    0x1202e87, 0x1222e87, 0x1252e87, 0x1852e87, 0x0e5ae87, 0x125ae87, 0x185ae87, 0x1203287,
+    0x122b287, 0x0243287, 0x127b287, 0x187b287, 0x1253687, 0x129b687, 0x121c687, 0x125c687,
+    0x185c687, 0x008c687, 0x1394687, 0x129c687, 0x183ca87, 0x1254a87, 0x1274a87, 0x0044e87,
+    0x00ce687, 0x18ce687, 0x125e2c7, 0x0088f07, 0x1269307, 0x0431b07, 0x066a307, 0x1222b07,
+    0x1202f07, 0x0622f07, 0x1222f07, 0x0242f07, 0x126b307, 0x041b707, 0x0343b07, 0x0323f07,
+    0x1223f07, 0x003bf07, 0x183bf07, 0x1273f07, 0x1704707, 0x0d74b07, 0x043cf07, 0x080b008,
+    0x120b008, 0x0a44428, 0x1289048, 0x0321c48, 0x1221c48, 0x1171c48, 0x1122048, 0x1122848,
+    0x045a848, 0x126b848, 0x0b04c48, 0x0244c48, 0x12a4c48, 0x1368068, 0x1201068, 0x1221068,
+    0x1369068, 0x0322c68, 0x1222c68, 0x005b868, 0x125b868, 0x125e068, 0x1104ca8, 0x0e780c8,
+    0x03218c8, 0x12a2cc8, 0x0c044e8, 0x1268148, 0x1298148, 0x126b948, 0x0201168, 0x0b01168,
+    0x0ca1168, 0x12a1168, 0x0302168, 0x0b02168, 0x0ca2168, 0x1122d68, 0x079ad68, 0x0e30188,
+    0x1260188, 0x0888188, 0x0ca0188, 0x1100588, 0x0320588, 0x041a188, 0x0e1a188, 0x121a188,
+    0x046a188, 0x0e6a188, 0x1623188, 0x1343188, 0x1743188, 0x0323d88, 0x1243d88, 0x1373d88,
+    0x0e8bd88, 0x083c988, 0x183c988, 0x13781a8, 0x0c881a8, 0x04c05a8, 0x0b209a8, 0x04589a8,
+    0x06709a8, 0x12a09a8, 0x13a09a8, 0x1620da8, 0x0040da8, 0x0440da8, 0x0b70da8, 0x1670da8,
+    0x0888da8, 0x04a0da8, 0x0c891a8, 0x17415a8, 0x12715a8, 0x00895a8, 0x0d019a8, 0x04599a8,
+    0x0d721a8, 0x03229a8, 0x11229a8, 0x045a9a8, 0x03235a8, 0x13435a8, 0x018b9a8, 0x0da45a8,
+    0x13249a8, 0x0e7c9a8, 0x0b24da8, 0x0b44da8, 0x1244da8, 0x008cda8, 0x005d1a8, 0x048d1a8,
+    0x0d8d1a8, 0x13951a8, 0x11055a8, 0x13459a8, 0x0240dc8, 0x0340dc8, 0x0d40dc8, 0x1204dc8,
+    0x0d73de8, 0x0418228, 0x121a228, 0x066a228, 0x0322a28, 0x0e53a28, 0x046ba28, 0x126ba28,
+    0x1200648, 0x1221e48, 0x0322e48, 0x1222e48, 0x0403648, 0x0824a48, 0x045ce48, 0x1261268,
+    0x1121e68, 0x03222a8, 0x12222a8, 0x12022e8, 0x18036e8, 0x008bae8, 0x045cee8, 0x0388328,
+    0x1288328, 0x1306728, 0x1278009, 0x1370409, 0x0b00809, 0x1250809, 0x1850809, 0x0320c09,
+    0x1220c09, 0x1201409, 0x0029409, 0x1201809, 0x1121809, 0x1231809, 0x1831809, 0x1141809,
+    0x0089809, 0x125a009, 0x1122809, 0x1222809, 0x1822809, 0x0f02c09, 0x0f72c09, 0x040b009,
+    0x0e0b009, 0x120b009, 0x140b009, 0x1223009, 0x1863009, 0x0d73009, 0x1223409, 0x126b409,
+    0x186b409, 0x189b409, 0x0d03c09, 0x0323c09, 0x1123c09, 0x1223c09, 0x1254409, 0x125c409,
+    0x127c409, 0x009c409, 0x0ba4409, 0x1824809, 0x047c809, 0x127c809, 0x1274c09, 0x1255009,
+    0x127d009, 0x1205409, 0x0b25409, 0x0d05809, 0x0325809, 0x0445c09, 0x1268089, 0x1298089,
+    0x0b20489, 0x1240c89, 0x1259089, 0x1859089, 0x1279089, 0x1289089, 0x04c9089, 0x1221489,
+    0x1229489, 0x0301c89, 0x12a1c89, 0x0102c89, 0x0e5ac89, 0x125ac89, 0x040b089, 0x1863089,
+    0x186b489, 0x126b889, 0x0344489, 0x1254489, 0x188c489, 0x0494889, 0x129c889, 0x12a4889,
+    0x1224c89, 0x0d74c89, 0x046d089, 0x0325889, 0x0445889, 0x00580e9, 0x1270109, 0x0008509,
+    0x1208509, 0x0320509, 0x1120509, 0x1220509, 0x1229509, 0x1831909, 0x1371909, 0x0301d09,
+    0x125ad09, 0x129ad09, 0x1863109, 0x187b109, 0x0e33509, 0x1253509, 0x046b509, 0x086b509,
+    0x126b509, 0x121c509, 0x0034509, 0x048c509, 0x1264909, 0x0325509, 0x1125509, 0x1225509,
+    0x1825509, 0x00681a9, 0x03205c9, 0x12205c9, 0x0e509c9, 0x12509c9, 0x18509c9, 0x12709c9,
+    0x0b20dc9, 0x12c11c9, 0x1269dc9, 0x126a1c9, 0x03229c9, 0x12229c9, 0x18229c9, 0x0b729c9,
+    0x0322dc9, 0x1222dc9, 0x125adc9, 0x129adc9, 0x189adc9, 0x0d731c9, 0x12731c9, 0x12235c9,
+    0x12335c9, 0x189b5c9, 0x12539c9, 0x0c045c9, 0x0ca45c9, 0x1204dc9, 0x189cdc9, 0x0da4dc9,
+    0x0b051c9, 0x12351c9, 0x12551c9, 0x045d1c9, 0x128d1c9, 0x11059c9, 0x03259c9, 0x125d9c9,
+    0x185d9c9, 0x03261c9, 0x1200689, 0x1220689, 0x1270a89, 0x1200e89, 0x1830e89, 0x1270e89,
+    0x0b01a89, 0x0ca1a89, 0x12a2689, 0x0322a89, 0x1222a89, 0x12a2a89, 0x0f22e89, 0x1103289,
+    0x180b289, 0x127b289, 0x0e13689, 0x1253689, 0x1853689, 0x1223e89, 0x0d73e89, 0x0b04689,
+    0x1304689, 0x0b24689, 0x1224689, 0x129ca89, 0x1224e89, 0x189ce89, 0x1225689, 0x0445689,
+    0x006000a, 0x010040a, 0x110040a, 0x017040a, 0x003880a, 0x125080a, 0x0800c0a, 0x1220c0a,
+    0x1240c0a, 0x114140a, 0x127180a, 0x12a180a, 0x0b01c0a, 0x0a0200a, 0x121a00a, 0x122200a,
+    0x122a00a, 0x005200a, 0x125200a, 0x125a00a, 0x126200a, 0x066a00a, 0x126a00a, 0x120280a,
+    0x124280a, 0x0c02c0a, 0x1222c0a, 0x0542c0a, 0x1242c0a, 0x007ac0a, 0x120300a, 0x122300a,
+    0x0a4300a, 0x124300a, 0x046300a, 0x040340a, 0x120340a, 0x181b40a, 0x072340a, 0x122340a,
+    0x003340a, 0x123340a, 0x084b40a, 0x129b40a, 0x14cb40a, 0x126b80a, 0x1203c0a, 0x123bc0a,
+    0x0a73c0a, 0x1673c0a, 0x12a3c0a, 0x13a3c0a, 0x120440a, 0x130440a, 0x125440a, 0x126c40a,
+    0x0e7440a, 0x127440a, 0x088c40a, 0x139440a, 0x189440a, 0x129c40a, 0x18cc40a, 0x003c80a,
+    0x046480a, 0x0b04c0a, 0x1204c0a, 0x1244c0a, 0x089cc0a, 0x073500a, 0x088d00a, 0x148d00a,
+    0x188d00a, 0x0b0540a, 0x120540a, 0x120580a, 0x140580a, 0x032580a, 0x045e00a, 0x127600a,
+    0x124640a, 0x0e7640a, 0x128802a, 0x110048a, 0x017048a, 0x125088a, 0x0430c8a, 0x1830c8a,
+    0x071108a, 0x122908a, 0x125108a, 0x125908a, 0x006108a, 0x0e6908a, 0x126908a, 0x127908a,
+    0x129908a, 0x04a908a, 0x114148a, 0x00a1c8a, 0x128a08a, 0x0f22c8a, 0x0c42c8a, 0x125ac8a,
+    0x185ac8a, 0x127ac8a, 0x187ac8a, 0x129ac8a, 0x189ac8a, 0x0e0b08a, 0x120b08a, 0x127b08a,
+    0x137b08a, 0x187b08a, 0x050348a, 0x071348a, 0x0e1b48a, 0x127348a, 0x049b48a, 0x129b48a,
+    0x1243c8a, 0x120c48a, 0x0b2448a, 0x122c48a, 0x185448a, 0x006448a, 0x046c48a, 0x126c48a,
+    0x127448a, 0x188c48a, 0x04ac48a, 0x110488a, 0x129c88a, 0x1204c8a, 0x0714c8a, 0x1224c8a,
+    0x0b74c8a, 0x0b2548a, 0x0b4548a, 0x1225c8a, 0x032608a, 0x112608a, 0x08180ea, 0x12280ea,
+    0x12680ea, 0x07780ea, 0x12980ea, 0x00c00ea, 0x08c80ea, 0x00190ea, 0x07990ea, 0x12990ea,
+    0x004b8ea, 0x128b8ea, 0x0ca38ea, 0x121d0ea, 0x130010a, 0x0a1010a, 0x066810a, 0x040850a,
+    0x080850a, 0x082050a, 0x122050a, 0x005850a, 0x125090a, 0x185090a, 0x0e18d0a, 0x1818d0a,
+    0x0b20d0a, 0x0430d0a, 0x122910a, 0x128910a, 0x04a910a, 0x12a910a, 0x133990a, 0x087290a,
+    0x1822d0a, 0x0c42d0a, 0x125ad0a, 0x126ad0a, 0x1272d0a, 0x127ad0a, 0x129ad0a, 0x189ad0a,
+    0x0e0b10a, 0x120350a, 0x001b50a, 0x121b50a, 0x181b50a, 0x122350a, 0x123350a, 0x0d4350a,
+    0x125350a, 0x127350a, 0x048b90a, 0x1223d0a, 0x007bd0a, 0x127bd0a, 0x180c50a, 0x125450a,
+    0x126c50a, 0x088c50a, 0x0d0490a, 0x189490a, 0x129c90a, 0x0324d0a, 0x1124d0a, 0x1224d0a,
+    0x043cd0a, 0x123cd0a, 0x0ba4d0a, 0x120550a, 0x124590a, 0x066816a, 0x127816a, 0x139916a,
+    0x0a1216a, 0x062216a, 0x125216a, 0x066b96a, 0x057396a, 0x043516a, 0x199d16a, 0x12301aa,
+    0x12781aa, 0x0b881aa, 0x12881aa, 0x11a01aa, 0x04b01aa, 0x12211aa, 0x0b591aa, 0x07921aa,
+    0x129a1aa, 0x04aa1aa, 0x120b9aa, 0x127b9aa, 0x0f939aa, 0x129b9aa, 0x13a39aa, 0x04b39aa,
+    0x12b39aa, 0x120d1aa, 0x0b8d1aa, 0x118d1aa, 0x128d1aa, 0x129d1aa, 0x12681ca, 0x12781ca,
+    0x0d005ca, 0x12705ca, 0x12591ca, 0x12295ca, 0x00995ca, 0x0b019ca, 0x1201dca, 0x0d21dca,
+    0x1259dca, 0x046a1ca, 0x12425ca, 0x0c029ca, 0x12029ca, 0x11229ca, 0x008a9ca, 0x0ca29ca,
+    0x1202dca, 0x1272dca, 0x140b1ca, 0x140b5ca, 0x0e1b5ca, 0x12535ca, 0x12539ca, 0x18539ca,
+    0x088b9ca, 0x0a23dca, 0x123bdca, 0x044bdca, 0x007bdca, 0x08045ca, 0x12045ca, 0x13045ca,
+    0x12245ca, 0x00645ca, 0x12745ca, 0x0da45ca, 0x12a45ca, 0x12249ca, 0x0714dca, 0x1274dca,
+    0x1674dca, 0x008d1ca, 0x0b0022a, 0x120822a, 0x132822a, 0x124022a, 0x134022a, 0x066822a,
+    0x126822a, 0x196822a, 0x13a022a, 0x12c022a, 0x0f2122a, 0x066922a, 0x04b122a, 0x006ba2a,
+    0x046ba2a, 0x0d73a2a, 0x080d22a, 0x0a6d22a, 0x128824a, 0x044068a, 0x1270e8a, 0x12a0e8a,
+    0x14c8e8a, 0x124168a, 0x0b21a8a, 0x120228a, 0x088aa8a, 0x12a2a8a, 0x0a02e8a, 0x0d02e8a,
+    0x1202e8a, 0x082ae8a, 0x124328a, 0x12c328a, 0x124468a, 0x048c68a, 0x009c68a, 0x12a468a,
+    0x0e94a8a, 0x1204e8a, 0x0714e8a, 0x1244e8a, 0x12a4e8a, 0x12a668a, 0x12902aa, 0x0b592aa,
+    0x00592ca, 0x0a1030a, 0x125030a, 0x066830a, 0x128830a, 0x129830a, 0x127070a, 0x1390f0a,
+    0x1222f0a, 0x0442f0a, 0x0d42f0a, 0x1742f0a, 0x0472f0a, 0x041b70a, 0x121b70a, 0x1223f0a,
+    0x044470a, 0x1224f0a, 0x043cf0a, 0x088800b, 0x001840b, 0x004040b, 0x124040b, 0x008840b,
+    0x032080b, 0x112080b, 0x122080b, 0x132080b, 0x182080b, 0x125080b, 0x1818c0b, 0x0320c0b,
+    0x1120c0b, 0x1220c0b, 0x128900b, 0x0ea900b, 0x0d0180b, 0x0b01c0b, 0x1101c0b, 0x071200b,
+    0x121200b, 0x121a00b, 0x073200b, 0x005200b, 0x125200b, 0x038a00b, 0x128a00b, 0x188a00b,
+    0x079a00b, 0x189a00b, 0x032280b, 0x112280b, 0x122280b, 0x123a80b, 0x0d4280b, 0x009280b,
+    0x181ac0b, 0x125ac0b, 0x120300b, 0x120b00b, 0x180b00b, 0x032300b, 0x112300b, 0x122300b,
+    0x004300b, 0x186300b, 0x127b00b, 0x080340b, 0x120340b, 0x071340b, 0x041b40b, 0x121b40b,
+    0x122340b, 0x125340b, 0x129b40b, 0x0d43c0b, 0x1243c0b, 0x044bc0b, 0x071440b, 0x121c40b,
+    0x181c40b, 0x042440b, 0x122440b, 0x0e3440b, 0x124440b, 0x125440b, 0x185440b, 0x126c40b,
+    0x136c40b, 0x0ca440b, 0x032480b, 0x112480b, 0x122480b, 0x089480b, 0x149480b, 0x189480b,
+    0x129c80b, 0x0704c0b, 0x0324c0b, 0x0d24c0b, 0x1724c0b, 0x083cc0b, 0x123cc0b, 0x183cc0b,
+    0x0454c0b, 0x12a4c0b, 0x0d0500b, 0x071500b, 0x121d00b, 0x122d00b, 0x036d00b, 0x008d00b,
+    0x0b0540b, 0x120540b, 0x032540b, 0x112540b, 0x122540b, 0x008d40b, 0x18ad40b, 0x032580b,
+    0x112580b, 0x0d4580b, 0x125580b, 0x126d80b, 0x186d80b, 0x0325c0b, 0x1125c0b, 0x1225c0b,
+    0x185dc0b, 0x032600b, 0x0d4600b, 0x0fa600b, 0x110640b, 0x032640b, 0x122640b, 0x127640b,
+    0x08ce40b, 0x0ece40b, 0x121808b, 0x181808b, 0x122808b, 0x125008b, 0x126008b, 0x126808b,
+    0x186808b, 0x127808b, 0x048808b, 0x128808b, 0x188808b, 0x129808b, 0x18a808b, 0x04c808b,
+    0x0d2048b, 0x181088b, 0x1220c8b, 0x1830c8b, 0x0ca0c8b, 0x110108b, 0x125108b, 0x127908b,
+    0x128908b, 0x049108b, 0x129908b, 0x04c908b, 0x049948b, 0x129948b, 0x112188b, 0x122188b,
+    0x043188b, 0x0e3188b, 0x134188b, 0x1289c8b, 0x00a1c8b, 0x128a08b, 0x079208b, 0x0d0308b,
+    0x032308b, 0x0b2308b, 0x122308b, 0x006308b, 0x046308b, 0x121b48b, 0x122348b, 0x123348b,
+    0x124348b, 0x127348b, 0x049348b, 0x089b48b, 0x0e9b48b, 0x046b88b, 0x0343c8b, 0x008bc8b,
+    0x009bc8b, 0x032448b, 0x122448b, 0x127c48b, 0x122488b, 0x129c88b, 0x0714c8b, 0x043cc8b,
+    0x0fa4c8b, 0x071508b, 0x0e1508b, 0x121d08b, 0x073508b, 0x120548b, 0x042548b, 0x122548b,
+    0x0d4548b, 0x124548b, 0x124588b, 0x1225c8b, 0x1245c8b, 0x122648b, 0x00ce48b, 0x18ce48b,
+    0x006810b, 0x046810b, 0x066810b, 0x038810b, 0x128810b, 0x138810b, 0x112050b, 0x008850b,
+    0x088850b, 0x083890b, 0x133890b, 0x134090b, 0x125090b, 0x1100d0b, 0x1270d0b, 0x122910b,
+    0x126910b, 0x128910b, 0x12a110b, 0x04a910b, 0x112150b, 0x122150b, 0x129950b, 0x0d0190b,
+    0x112190b, 0x043190b, 0x046990b, 0x032290b, 0x112290b, 0x122290b, 0x0d4290b, 0x125ad0b,
+    0x1272d0b, 0x129ad0b, 0x0d0310b, 0x120310b, 0x170310b, 0x000b10b, 0x080b10b, 0x120b10b,
+    0x180b10b, 0x032310b, 0x0d2310b, 0x122310b, 0x182310b, 0x006310b, 0x126b10b, 0x127310b,
+    0x007b10b, 0x127b10b, 0x020350b, 0x071350b, 0x121b50b, 0x181b50b, 0x032350b, 0x122350b,
+    0x182350b, 0x003350b, 0x123350b, 0x183350b, 0x0d4350b, 0x125350b, 0x185350b, 0x126b50b,
+    0x186b50b, 0x127350b, 0x129b50b, 0x189b50b, 0x0ca350b, 0x17a350b, 0x126b90b, 0x1203d0b,
+    0x1223d0b, 0x0d43d0b, 0x1273d0b, 0x187bd0b, 0x120450b, 0x125450b, 0x137450b, 0x125490b,
+    0x045c90b, 0x127c90b, 0x129c90b, 0x0804d0b, 0x1204d0b, 0x0324d0b, 0x1124d0b, 0x1224d0b,
+    0x0e3cd0b, 0x123cd0b, 0x048cd0b, 0x032550b, 0x0d2550b, 0x122550b, 0x117550b, 0x048d50b,
+    0x0e6816b, 0x07101cb, 0x12181cb, 0x12281cb, 0x12601cb, 0x12681cb, 0x13901cb, 0x04a81cb,
+    0x11005cb, 0x03205cb, 0x12205cb, 0x12705cb, 0x12a05cb, 0x04389cb, 0x12389cb, 0x04409cb,
+    0x12409cb, 0x12509cb, 0x12709cb, 0x0ca09cb, 0x0d20dcb, 0x1220dcb, 0x12911cb, 0x12995cb,
+    0x0d019cb, 0x12219cb, 0x18319cb, 0x00419cb, 0x04419cb, 0x08719cb, 0x0d719cb, 0x12719cb,
+    0x0d01dcb, 0x121a1cb, 0x126a1cb, 0x047a1cb, 0x128a1cb, 0x12229cb, 0x125adcb, 0x185adcb,
+    0x0672dcb, 0x12031cb, 0x03231cb, 0x12231cb, 0x11235cb, 0x00335cb, 0x04335cb, 0x12335cb,
+    0x180b9cb, 0x03239cb, 0x18239cb, 0x002b9cb, 0x122b9cb, 0x04439cb, 0x12539cb, 0x18539cb,
+    0x12639cb, 0x126b9cb, 0x186b9cb, 0x127b9cb, 0x038b9cb, 0x129b9cb, 0x0323dcb, 0x1123dcb,
+    0x1223dcb, 0x187bdcb, 0x0b045cb, 0x0d045cb, 0x121c5cb, 0x181c5cb, 0x0b245cb, 0x12245cb,
+    0x02445cb, 0x12445cb, 0x03249cb, 0x0b249cb, 0x0d249cb, 0x12249cb, 0x18949cb, 0x0704dcb,
+    0x1204dcb, 0x1224dcb, 0x0244dcb, 0x1274dcb, 0x0094dcb, 0x009cdcb, 0x049cdcb, 0x0e9cdcb,
+    0x12a4dcb, 0x03251cb, 0x07351cb, 0x04451cb, 0x12451cb, 0x00651cb, 0x036d1cb, 0x126d1cb,
+    0x047d1cb, 0x127d1cb, 0x048d1cb, 0x128d1cb, 0x188d1cb, 0x129d1cb, 0x13055cb, 0x03255cb,
+    0x12255cb, 0x18255cb, 0x04455cb, 0x0d059cb, 0x03259cb, 0x12259cb, 0x036d9cb, 0x046d9cb,
+    0x126d9cb, 0x127d9cb, 0x188d9cb, 0x04959cb, 0x129d9cb, 0x0325dcb, 0x1225dcb, 0x0d265cb,
+    0x071028b, 0x12a028b, 0x032068b, 0x122068b, 0x008868b, 0x1220a8b, 0x1250a8b, 0x0488a8b,
+    0x1220e8b, 0x0240e8b, 0x1270e8b, 0x002968b, 0x122968b, 0x0321a8b, 0x1121a8b, 0x1221a8b,
+    0x125ae8b, 0x12a2e8b, 0x120328b, 0x080b28b, 0x046328b, 0x186328b, 0x127b28b, 0x120368b,
+    0x122368b, 0x132368b, 0x083368b, 0x123368b, 0x125368b, 0x129b68b, 0x0d43e8b, 0x032468b,
+    0x112468b, 0x122468b, 0x172468b, 0x083468b, 0x183468b, 0x125468b, 0x188c68b, 0x04ac68b,
+    0x1124a8b, 0x183ca8b, 0x1254a8b, 0x129ca8b, 0x12a4a8b, 0x0024e8b, 0x0324e8b, 0x1124e8b,
+    0x1224e8b, 0x18ad68b, 0x0325e8b, 0x1125e8b, 0x1225e8b, 0x12412cb, 0x126030b, 0x038830b,
+    0x138830b, 0x049030b, 0x0020b0b, 0x0420b0b, 0x0088b0b, 0x122330b, 0x122370b, 0x122470b,
+    0x0324b0b, 0x1224b0b, 0x0d44b0b, 0x1244b0b, 0x0b74b0b, 0x0094b0b, 0x0324f0b, 0x1224f0b,
+    0x043cf0b, 0x0244f0b, 0x009cf0b, 0x032000c, 0x048800c, 0x128800c, 0x122040c, 0x120080c,
+    0x032080c, 0x112080c, 0x122080c, 0x043880c, 0x083880c, 0x123880c, 0x125080c, 0x045880c,
+    0x0d7080c, 0x0430c0c, 0x0340c0c, 0x0488c0c, 0x0b8900c, 0x024140c, 0x122180c, 0x123180c,
+    0x137180c, 0x12a180c, 0x0471c0c, 0x00a1c0c, 0x00b1c0c, 0x121a00c, 0x0e5200c, 0x125200c,
+    0x045a00c, 0x0b5a00c, 0x125a00c, 0x126200c, 0x126a00c, 0x048a00c, 0x128a00c, 0x049200c,
+    0x139200c, 0x110280c, 0x122280c, 0x124280c, 0x127280c, 0x0c02c0c, 0x1102c0c, 0x1202c0c,
+    0x1702c0c, 0x1222c0c, 0x0242c0c, 0x0a42c0c, 0x1242c0c, 0x125ac0c, 0x1262c0c, 0x1862c0c,
+    0x129ac0c, 0x189ac0c, 0x12a2c0c, 0x00aac0c, 0x00b2c0c, 0x120300c, 0x000b00c, 0x042300c,
+    0x182300c, 0x044300c, 0x120340c, 0x130340c, 0x081b40c, 0x012340c, 0x032340c, 0x072340c,
+    0x122340c, 0x132340c, 0x123340c, 0x124340c, 0x185340c, 0x006b40c, 0x127340c, 0x049340c,
+    0x009b40c, 0x0e9b40c, 0x189b40c, 0x0ba340c, 0x12a340c, 0x1403c0c, 0x08a400c, 0x040440c,
+    0x070440c, 0x120440c, 0x121440c, 0x181c40c, 0x122440c, 0x043440c, 0x123440c, 0x004440c,
+    0x034440c, 0x005440c, 0x125440c, 0x045c40c, 0x125c40c, 0x185c40c, 0x126440c, 0x0d7440c,
+    0x117440c, 0x008c40c, 0x088c40c, 0x049440c, 0x129c40c, 0x18ac40c, 0x120480c, 0x032480c,
+    0x112480c, 0x122480c, 0x183c80c, 0x125480c, 0x009480c, 0x189480c, 0x129c80c, 0x189c80c,
+    0x12a480c, 0x0804c0c, 0x0324c0c, 0x1124c0c, 0x1224c0c, 0x123cc0c, 0x0d44c0c, 0x0e5cc0c,
+    0x049cc0c, 0x129cc0c, 0x00ccc0c, 0x0eccc0c, 0x180d00c, 0x121d00c, 0x125d00c, 0x036d00c,
+    0x088d00c, 0x189500c, 0x129d00c, 0x18cd00c, 0x0d2540c, 0x044540c, 0x0d4540c, 0x124540c,
+    0x032580c, 0x125580c, 0x185580c, 0x126d80c, 0x128d80c, 0x0325c0c, 0x1225c0c, 0x1245c0c,
+    0x0d0600c, 0x120600c, 0x032600c, 0x127600c, 0x139600c, 0x032640c, 0x112640c, 0x122640c,
+    0x182640c, 0x13a640c, 0x008a02c, 0x121808c, 0x125808c, 0x046808c, 0x126808c, 0x186808c,
+    0x048808c, 0x049008c, 0x079808c, 0x129808c, 0x127048c, 0x123888c, 0x125088c, 0x0840c8c,
+    0x0458c8c, 0x121908c, 0x128908c, 0x129908c, 0x122948c, 0x126a08c, 0x136a08c, 0x186a08c,
+    0x079a08c, 0x005288c, 0x1202c8c, 0x000ac8c, 0x121ac8c, 0x0242c8c, 0x0a42c8c, 0x125ac8c,
+    0x129ac8c, 0x189ac8c, 0x122308c, 0x127308c, 0x030348c, 0x121b48c, 0x032348c, 0x122348c,
+    0x043348c, 0x123348c, 0x009348c, 0x049348c, 0x079348c, 0x009b48c, 0x0e9b48c, 0x12a348c,
+    0x12a388c, 0x12b388c, 0x071448c, 0x121448c, 0x041c48c, 0x032448c, 0x0b2448c, 0x112448c,
+    0x122448c, 0x0b4448c, 0x124448c, 0x125448c, 0x045c48c, 0x125c48c, 0x049448c, 0x0b0488c,
+    0x120488c, 0x0b2488c, 0x122488c, 0x183c88c, 0x024488c, 0x046c88c, 0x0d7488c, 0x189488c,
+    0x0e9c88c, 0x0324c8c, 0x1224c8c, 0x0e3cc8c, 0x123cc8c, 0x0244c8c, 0x0544c8c, 0x1244c8c,
+    0x0b74c8c, 0x048cc8c, 0x049508c, 0x032548c, 0x122548c, 0x032588c, 0x125d88c, 0x136e08c,
+    0x122648c, 0x04ce48c, 0x0ece48c, 0x118b8ec, 0x147010c, 0x167010c, 0x0c9010c, 0x0ba010c,
+    0x120090c, 0x043890c, 0x133890c, 0x125090c, 0x185090c, 0x127090c, 0x008890c, 0x1818d0c,
+    0x1830d0c, 0x1240d0c, 0x126910c, 0x04a910c, 0x122950c, 0x182950c, 0x189950c, 0x123190c,
+    0x1201d0c, 0x1241d0c, 0x032290c, 0x122290c, 0x008a90c, 0x00aa90c, 0x0712d0c, 0x121ad0c,
+    0x1122d0c, 0x1222d0c, 0x122ad0c, 0x0042d0c, 0x0e52d0c, 0x1252d0c, 0x045ad0c, 0x125ad0c,
+    0x1172d0c, 0x1272d0c, 0x007ad0c, 0x129ad0c, 0x189ad0c, 0x199ad0c, 0x032310c, 0x0e2310c,
+    0x112310c, 0x122310c, 0x189310c, 0x040350c, 0x110350c, 0x120350c, 0x181350c, 0x121b50c,
+    0x032350c, 0x122350c, 0x043350c, 0x123350c, 0x183350c, 0x124350c, 0x045350c, 0x125350c,
+    0x186b50c, 0x127350c, 0x129b50c, 0x032450c, 0x122450c, 0x172450c, 0x034450c, 0x0d4450c,
+    0x125450c, 0x185450c, 0x185c50c, 0x127450c, 0x12ac50c, 0x00cc50c, 0x071490c, 0x0e1c90c,
+    0x122490c, 0x0e3490c, 0x127490c, 0x009490c, 0x129c90c, 0x189c90c, 0x0714d0c, 0x1124d0c,
+    0x1224d0c, 0x1244d0c, 0x048cd0c, 0x129cd0c, 0x0325d0c, 0x0d25d0c, 0x1125d0c, 0x1225d0c,
+    0x049dd0c, 0x0fa5d0c, 0x0d2650c, 0x18ce50c, 0x04611ac, 0x12681cc, 0x12981cc, 0x18085cc,
+    0x12205cc, 0x18205cc, 0x04405cc, 0x04585cc, 0x08389cc, 0x12389cc, 0x18389cc, 0x12509cc,
+    0x1120dcc, 0x1220dcc, 0x0430dcc, 0x0840dcc, 0x12a0dcc, 0x12891cc, 0x12715cc, 0x18319cc,
+    0x0b21dcc, 0x1271dcc, 0x1289dcc, 0x00a1dcc, 0x11a1dcc, 0x045a1cc, 0x125a1cc, 0x008a1cc,
+    0x048a1cc, 0x129a1cc, 0x12725cc, 0x12229cc, 0x12429cc, 0x12729cc, 0x0b02dcc, 0x1202dcc,
+    0x121adcc, 0x0322dcc, 0x1222dcc, 0x005adcc, 0x125adcc, 0x185adcc, 0x0e9adcc, 0x129adcc,
+    0x12c2dcc, 0x12231cc, 0x00631cc, 0x18631cc, 0x12a31cc, 0x03035cc, 0x0b035cc, 0x12035cc,
+    0x041b5cc, 0x0e1b5cc, 0x11235cc, 0x0e335cc, 0x12335cc, 0x02435cc, 0x04435cc, 0x12535cc,
+    0x12735cc, 0x049b5cc, 0x189b5cc, 0x120b9cc, 0x07139cc, 0x121b9cc, 0x03239cc, 0x12539cc,
+    0x005b9cc, 0x085b9cc, 0x125b9cc, 0x185b9cc, 0x066b9cc, 0x126b9cc, 0x186b9cc, 0x127b9cc,
+    0x128b9cc, 0x188b9cc, 0x129b9cc, 0x04ab9cc, 0x0323dcc, 0x1123dcc, 0x1223dcc, 0x1823dcc,
+    0x187bdcc, 0x1893dcc, 0x12a3dcc, 0x04045cc, 0x12045cc, 0x13045cc, 0x18045cc, 0x0b245cc,
+    0x12245cc, 0x00445cc, 0x046c5cc, 0x126c5cc, 0x008c5cc, 0x0e8c5cc, 0x04945cc, 0x129c5cc,
+    0x03249cc, 0x12249cc, 0x18249cc, 0x12549cc, 0x0e949cc, 0x049c9cc, 0x129c9cc, 0x0324dcc,
+    0x0d24dcc, 0x1224dcc, 0x1324dcc, 0x1824dcc, 0x123cdcc, 0x183cdcc, 0x1244dcc, 0x049cdcc,
+    0x129cdcc, 0x189cdcc, 0x12a4dcc, 0x00ccdcc, 0x07151cc, 0x12251cc, 0x035d1cc, 0x125d1cc,
+    0x127d1cc, 0x13951cc, 0x18951cc, 0x03255cc, 0x12255cc, 0x12059cc, 0x03259cc, 0x008d9cc,
+    0x1205dcc, 0x0445dcc, 0x12061cc, 0x045e1cc, 0x125e1cc, 0x03265cc, 0x12265cc, 0x12765cc,
+    0x13245ec, 0x0e38a8c, 0x0240a8c, 0x0340a8c, 0x0d40a8c, 0x1250a8c, 0x1170a8c, 0x0e88a8c,
+    0x0430e8c, 0x1140e8c, 0x0088e8c, 0x122968c, 0x089968c, 0x0031a8c, 0x1231a8c, 0x1831a8c,
+    0x1859e8c, 0x121a28c, 0x125a28c, 0x128a28c, 0x139228c, 0x0a4268c, 0x1312e8c, 0x0322e8c,
+    0x1222e8c, 0x1822e8c, 0x0032e8c, 0x0442e8c, 0x005ae8c, 0x125ae8c, 0x0492e8c, 0x0792e8c,
+    0x126328c, 0x127b28c, 0x189328c, 0x12a328c, 0x003368c, 0x043368c, 0x0e3368c, 0x123368c,
+    0x124368c, 0x129b68c, 0x149b68c, 0x126ba8c, 0x120468c, 0x032468c, 0x122468c, 0x172468c,
+    0x034468c, 0x125468c, 0x125c68c, 0x185c68c, 0x008c68c, 0x048c68c, 0x088c68c, 0x128c68c,
+    0x188c68c, 0x089c68c, 0x00ac68c, 0x1104a8c, 0x0014a8c, 0x0324a8c, 0x1124a8c, 0x1224a8c,
+    0x1324a8c, 0x003ca8c, 0x1344a8c, 0x1254a8c, 0x1274a8c, 0x0494a8c, 0x1894a8c, 0x079ca8c,
+    0x129ca8c, 0x0714e8c, 0x0324e8c, 0x1124e8c, 0x1224e8c, 0x003ce8c, 0x1244e8c, 0x0d74e8c,
+    0x129ce8c, 0x0325e8c, 0x1225e8c, 0x0a0668c, 0x18ce68c, 0x045d2ac, 0x0b5830c, 0x1102f0c,
+    0x070370c, 0x120370c, 0x0343b0c, 0x0063b0c, 0x047bb0c, 0x127bb0c, 0x187bb0c, 0x0344b0c,
+    0x083cf0c, 0x123cf0c, 0x183cf0c, 0x1275f0c, 0x122132c, 0x126000d, 0x126800d, 0x122040d,
+    0x124040d, 0x125040d, 0x005840d, 0x017040d, 0x043880d, 0x0e3880d, 0x048880d, 0x1200c0d,
+    0x04a900d, 0x08a900d, 0x122940d, 0x120180d, 0x183180d, 0x117180d, 0x0b01c0d, 0x030200d,
+    0x122a00d, 0x125200d, 0x125a00d, 0x008a00d, 0x148a00d, 0x032280d, 0x112280d, 0x002a80d,
+    0x1202c0d, 0x0322c0d, 0x005ac0d, 0x032300d, 0x112300d, 0x122300d, 0x006300d, 0x12a300d,
+    0x120340d, 0x041340d, 0x181340d, 0x141b40d, 0x006b40d, 0x127340d, 0x00a340d, 0x1203c0d,
+    0x0323c0d, 0x1223c0d, 0x0e73c0d, 0x007bc0d, 0x047bc0d, 0x187bc0d, 0x120440d, 0x0e1440d,
+    0x121440d, 0x121c40d, 0x122440d, 0x024440d, 0x124440d, 0x125440d, 0x185440d, 0x048c40d,
+    0x083c80d, 0x0714c0d, 0x1224c0d, 0x1244c0d, 0x189cc0d, 0x071500d, 0x136d00d, 0x110540d,
+    0x122540d, 0x162540d, 0x18ad40d, 0x010580d, 0x122640d, 0x114640d, 0x124640d, 0x004d06d,
+    0x042808d, 0x125808d, 0x127808d, 0x128808d, 0x079808d, 0x129808d, 0x0a2048d, 0x0b2048d,
+    0x125088d, 0x1818c8d, 0x121908d, 0x035908d, 0x045908d, 0x016108d, 0x126108d, 0x127908d,
+    0x049108d, 0x04c908d, 0x0e8988d, 0x12a188d, 0x122a08d, 0x139208d, 0x04aa08d, 0x1242c8d,
+    0x185ac8d, 0x120308d, 0x126b08d, 0x137b08d, 0x122348d, 0x126b88d, 0x1123c8d, 0x1343c8d,
+    0x0b0448d, 0x121c48d, 0x005448d, 0x125448d, 0x0b7448d, 0x129c48d, 0x199c48d, 0x18ac48d,
+    0x129c88d, 0x1224c8d, 0x0f74c8d, 0x129cc8d, 0x189cc8d, 0x125508d, 0x046508d, 0x126508d,
+    0x0b2548d, 0x122548d, 0x12a548d, 0x120d88d, 0x032588d, 0x0b2588d, 0x044588d, 0x189588d,
+    0x129d88d, 0x129dc8d, 0x12a5c8d, 0x0e400cd, 0x00680cd, 0x08980cd, 0x00638cd, 0x04258cd,
+    0x030090d, 0x133890d, 0x125090d, 0x0b7090d, 0x0b00d0d, 0x0320d0d, 0x1220d0d, 0x1170d0d,
+    0x12a0d0d, 0x122910d, 0x04a910d, 0x122150d, 0x122950d, 0x182950d, 0x189950d, 0x112190d,
+    0x123990d, 0x0b41d0d, 0x010290d, 0x070290d, 0x140290d, 0x125ad0d, 0x080b10d, 0x120b10d,
+    0x127b10d, 0x112350d, 0x122350d, 0x0d7350d, 0x1203d0d, 0x187bd0d, 0x010410d, 0x125c50d,
+    0x185c50d, 0x082490d, 0x049490d, 0x12a490d, 0x1124d0d, 0x1224d0d, 0x0344d0d, 0x0d74d0d,
+    0x048cd0d, 0x0e8cd0d, 0x188cd0d, 0x189cd0d, 0x0b0550d, 0x0325d0d, 0x1125d0d, 0x1225d0d,
+    0x0445d0d, 0x0c0650d, 0x089394d, 0x12381cd, 0x18085cd, 0x12509cd, 0x0b00dcd, 0x1818dcd,
+    0x1220dcd, 0x12a0dcd, 0x12591cd, 0x12319cd, 0x1671dcd, 0x125a1cd, 0x185a1cd, 0x136a1cd,
+    0x128a1cd, 0x1222dcd, 0x125adcd, 0x1272dcd, 0x12031cd, 0x0d231cd, 0x12231cd, 0x02431cd,
+    0x08731cd, 0x12731cd, 0x12035cd, 0x04135cd, 0x12235cd, 0x13235cd, 0x12335cd, 0x12435cd,
+    0x186b5cd, 0x0bc35cd, 0x120b9cd, 0x13439cd, 0x12539cd, 0x18539cd, 0x126b9cd, 0x127b9cd,
+    0x0b03dcd, 0x00445cd, 0x12445cd, 0x12545cd, 0x00645cd, 0x12645cd, 0x03249cd, 0x11249cd,
+    0x12249cd, 0x0b04dcd, 0x0324dcd, 0x1124dcd, 0x1224dcd, 0x0ca4dcd, 0x035d1cd, 0x045d1cd,
+    0x125d1cd, 0x126d1cd, 0x186d1cd, 0x127d1cd, 0x04055cd, 0x12055cd, 0x0ca55cd, 0x18059cd,
+    0x03259cd, 0x125d9cd, 0x129d9cd, 0x189d9cd, 0x0b05dcd, 0x1225dcd, 0x14061cd, 0x03261cd,
+    0x12261cd, 0x180868d, 0x004068d, 0x0038a8d, 0x1818e8d, 0x1120e8d, 0x1220e8d, 0x0440e8d,
+    0x07c8e8d, 0x122968d, 0x0401a8d, 0x0322a8d, 0x1222a8d, 0x005ae8d, 0x125ae8d, 0x120b28d,
+    0x0d2328d, 0x186328d, 0x186b68d, 0x121c68d, 0x181c68d, 0x125c68d, 0x128c68d, 0x0e94e8d,
+    0x1894e8d, 0x052830d, 0x005830d, 0x066a30d, 0x0094b0d, 0x032280e, 0x112280e, 0x0ca280e,
+    0x032440e, 0x122480e, 0x124480e, 0x129c80e, 0x0d24c0e, 0x1124c0e, 0x123cc0e, 0x122540e,
+    0x066802e, 0x070102e, 0x085902e, 0x12c102e, 0x120202e, 0x032202e, 0x134202e, 0x129a02e,
+    0x132242e, 0x122382e, 0x045b82e, 0x085b82e, 0x125b82e, 0x0c0084e, 0x1121c4e, 0x1221c4e,
+    0x0489c4e, 0x1889c4e, 0x112284e, 0x002444e, 0x0304c4e, 0x0d04c4e, 0x1204c4e, 0x0bc4c4e,
+    0x085d04e, 0x123806e, 0x125806e, 0x0d7106e, 0x0ca106e, 0x0c9206e, 0x139206e, 0x0ca206e,
+    0x128b86e, 0x11a386e, 0x045e06e, 0x125e06e, 0x12c00ae, 0x03214ae, 0x04414ae, 0x0602cae,
+    0x1124cae, 0x12600ce, 0x03210ce, 0x12210ce, 0x0d418ce, 0x0c01cce, 0x04aa0ce, 0x0322cce,
+    0x1122cce, 0x1222cce, 0x02430ce, 0x12244ce, 0x12020ee, 0x066a0ee, 0x02430ee, 0x046b8ee,
+    0x0040d0e, 0x0322d0e, 0x1122d0e, 0x125350e, 0x129b50e, 0x046212e, 0x087814e, 0x12c014e,
+    0x123914e, 0x120454e, 0x1204d4e, 0x0440d6e, 0x024116e, 0x0d4116e, 0x136916e, 0x127116e,
+    0x0ca116e, 0x127216e, 0x1202d6e, 0x1502d6e, 0x1122d6e, 0x0442d6e, 0x183396e, 0x0403d6e,
+    0x1223d6e, 0x009018e, 0x112058e, 0x12a058e, 0x126918e, 0x128918e, 0x129a18e, 0x0702d8e,
+    0x12ab98e, 0x070458e, 0x11209ae, 0x12209ae, 0x13209ae, 0x12a09ae, 0x18591ae, 0x12891ae,
+    0x18891ae, 0x0ca21ae, 0x12a29ae, 0x1802dae, 0x03235ae, 0x0244dae, 0x13405ce, 0x0321dce,
+    0x077b1ce, 0x129b5ce, 0x0323dce, 0x04445ce, 0x12249ce, 0x0344dce, 0x03265ce, 0x12265ce,
+    0x12381ee, 0x12581ee, 0x12691ee, 0x04791ee, 0x066a1ee, 0x1273dee, 0x0d449ee, 0x0324dee,
+    0x1124dee, 0x071022e, 0x181022e, 0x125822e, 0x066822e, 0x136822e, 0x049822e, 0x032062e,
+    0x1200a2e, 0x0d40a2e, 0x1270e2e, 0x030122e, 0x122162e, 0x0041a2e, 0x0241a2e, 0x04a1a2e,
+    0x080a22e, 0x0b2222e, 0x00ba22e, 0x1222e2e, 0x0d72e2e, 0x0f72e2e, 0x112322e, 0x124362e,
+    0x0d43e2e, 0x124462e, 0x0e3ce2e, 0x0b0562e, 0x127662e, 0x1100a4e, 0x0201e4e, 0x112224e,
+    0x024324e, 0x0b7324e, 0x0044a4e, 0x0044e4e, 0x145026e, 0x188826e, 0x1104e6e, 0x1274e6e,
+    0x134068e, 0x1338a8e, 0x126928e, 0x004a28e, 0x1252e8e, 0x120328e, 0x181b68e, 0x1203e8e,
+    0x0323e8e, 0x043be8e, 0x123be8e, 0x044468e, 0x0b24a8e, 0x129ca8e, 0x180ce8e, 0x0324e8e,
+    0x048ce8e, 0x0e8ce8e, 0x009ce8e, 0x0b2668e, 0x127668e, 0x12582ae, 0x12592ae, 0x12692ae,
+    0x12892ae, 0x13922ae, 0x085baae, 0x0e5baae, 0x045d2ae, 0x0438ace, 0x12222ce, 0x0322ece,
+    0x1122ece, 0x1322ece, 0x03236ce, 0x12246ce, 0x04446ce, 0x0d24ace, 0x16706ee, 0x12892ee,
+    0x04c12ee, 0x121a2ee, 0x12222ee, 0x04622ee, 0x12622ee, 0x0f42eee, 0x1124eee, 0x128930e,
+    0x085132e, 0x044672e, 0x125800f, 0x126800f, 0x120080f, 0x032080f, 0x112080f, 0x122080f,
+    0x182080f, 0x003880f, 0x125080f, 0x127080f, 0x009880f, 0x129880f, 0x1240c0f, 0x0458c0f,
+    0x0060c0f, 0x0488c0f, 0x0888c0f, 0x0d0100f, 0x0e1900f, 0x0d7100f, 0x032180f, 0x112180f,
+    0x122180f, 0x045980f, 0x037180f, 0x088980f, 0x125200f, 0x125a00f, 0x126a00f, 0x048a00f,
+    0x128a00f, 0x009200f, 0x049200f, 0x005280f, 0x1202c0f, 0x1802c0f, 0x0022c0f, 0x0322c0f,
+    0x1222c0f, 0x1322c0f, 0x1242c0f, 0x0852c0f, 0x005ac0f, 0x125ac0f, 0x185ac0f, 0x1262c0f,
+    0x1862c0f, 0x087ac0f, 0x127ac0f, 0x0092c0f, 0x007b00f, 0x170340f, 0x041340f, 0x001b40f,
+    0x121b40f, 0x181b40f, 0x032340f, 0x122340f, 0x003340f, 0x123340f, 0x0c4340f, 0x0e5340f,
+    0x046b40f, 0x086b40f, 0x0e9b40f, 0x129b40f, 0x189b40f, 0x085b80f, 0x0e5b80f, 0x1203c0f,
+    0x1603c0f, 0x1223c0f, 0x087bc0f, 0x187bc0f, 0x040440f, 0x120440f, 0x071440f, 0x081c40f,
+    0x121c40f, 0x181c40f, 0x032440f, 0x0d2440f, 0x0e2440f, 0x122440f, 0x142440f, 0x152440f,
+    0x043440f, 0x0e3440f, 0x124440f, 0x085440f, 0x125440f, 0x185440f, 0x045c40f, 0x185c40f,
+    0x006440f, 0x0b7440f, 0x127c40f, 0x008c40f, 0x128c40f, 0x089c40f, 0x129c40f, 0x04ac40f,
+    0x0eac40f, 0x0e2480f, 0x122480f, 0x003c80f, 0x0c3c80f, 0x005480f, 0x187c80f, 0x049480f,
+    0x129c80f, 0x0324c0f, 0x0d24c0f, 0x1124c0f, 0x1224c0f, 0x123cc0f, 0x0d44c0f, 0x0054c0f,
+    0x185cc0f, 0x049cc0f, 0x12a4c0f, 0x120500f, 0x125d00f, 0x0d0540f, 0x032540f, 0x0d2540f,
+    0x112540f, 0x122540f, 0x034540f, 0x0d4540f, 0x124540f, 0x120580f, 0x160580f, 0x032580f,
+    0x112580f, 0x125580f, 0x185580f, 0x125d80f, 0x126d80f, 0x1225c0f, 0x032600f, 0x117600f,
+    0x039600f, 0x043008f, 0x123008f, 0x125008f, 0x185008f, 0x125808f, 0x126808f, 0x048808f,
+    0x128808f, 0x138808f, 0x049008f, 0x129808f, 0x189808f, 0x18a808f, 0x04c808f, 0x120048f,
+    0x123888f, 0x045088f, 0x125088f, 0x185088f, 0x1220c8f, 0x1240c8f, 0x0e88c8f, 0x041108f,
+    0x125108f, 0x125908f, 0x126908f, 0x187108f, 0x047908f, 0x127908f, 0x128908f, 0x188908f,
+    0x04a908f, 0x183188f, 0x123988f, 0x126a08f, 0x049208f, 0x04ca08f, 0x0d0288f, 0x122288f,
+    0x0d4288f, 0x047288f, 0x1202c8f, 0x1402c8f, 0x1222c8f, 0x122ac8f, 0x125ac8f, 0x0062c8f,
+    0x0d72c8f, 0x009ac8f, 0x129ac8f, 0x121b48f, 0x141b48f, 0x032348f, 0x122348f, 0x0e3348f,
+    0x044348f, 0x124348f, 0x125348f, 0x006b48f, 0x086b48f, 0x129b48f, 0x126b88f, 0x186b88f,
+    0x005bc8f, 0x1273c8f, 0x187bc8f, 0x0893c8f, 0x080448f, 0x041448f, 0x121448f, 0x141c48f,
+    0x181c48f, 0x002448f, 0x122448f, 0x124448f, 0x125448f, 0x126448f, 0x126c48f, 0x067448f,
+    0x127c48f, 0x188c48f, 0x049448f, 0x139448f, 0x129c48f, 0x04ac48f, 0x0eac48f, 0x12ac48f,
+    0x18ac48f, 0x127488f, 0x129c88f, 0x189c88f, 0x1104c8f, 0x1124c8f, 0x1344c8f, 0x048cc8f,
+    0x088cc8f, 0x089cc8f, 0x0e9cc8f, 0x042588f, 0x134588f, 0x049608f, 0x04300ef, 0x06680ef,
+    0x04880ef, 0x0c880ef, 0x11210ef, 0x04690ef, 0x0d710ef, 0x04910ef, 0x0b020ef, 0x07920ef,
+    0x19ca0ef, 0x1772cef, 0x00138ef, 0x0e6b8ef, 0x126b8ef, 0x129b8ef, 0x133bcef, 0x129d0ef,
+    0x005e0ef, 0x045e0ef, 0x086810f, 0x126810f, 0x0b0050f, 0x0b0090f, 0x120090f, 0x181090f,
+    0x125090f, 0x137090f, 0x008890f, 0x0ba090f, 0x036910f, 0x128910f, 0x138910f, 0x009910f,
+    0x129910f, 0x0ec910f, 0x133990f, 0x186190f, 0x066a10f, 0x120290f, 0x140290f, 0x032290f,
+    0x112290f, 0x122290f, 0x182290f, 0x124290f, 0x0ba290f, 0x0402d0f, 0x0502d0f, 0x0e02d0f,
+    0x1102d0f, 0x1402d0f, 0x1602d0f, 0x0712d0f, 0x0022d0f, 0x0322d0f, 0x0822d0f, 0x1122d0f,
+    0x1222d0f, 0x1242d0f, 0x125ad0f, 0x1672d0f, 0x0ca2d0f, 0x12a2d0f, 0x120310f, 0x127b10f,
+    0x120350f, 0x032350f, 0x122350f, 0x0e3350f, 0x123350f, 0x0e5350f, 0x125350f, 0x006b50f,
+    0x186b50f, 0x0d7350f, 0x137350f, 0x009b50f, 0x129b50f, 0x0fa350f, 0x126b90f, 0x186b90f,
+    0x12a390f, 0x04c390f, 0x12c390f, 0x0b03d0f, 0x1203d0f, 0x0323d0f, 0x1223d0f, 0x1323d0f,
+    0x1243d0f, 0x1343d0f, 0x187bd0f, 0x0ba3d0f, 0x080450f, 0x125c50f, 0x126c50f, 0x067450f,
+    0x0e1490f, 0x122490f, 0x185490f, 0x127490f, 0x189490f, 0x049c90f, 0x1204d0f, 0x123cd0f,
+    0x0d74d0f, 0x1374d0f, 0x009cd0f, 0x126510f, 0x1225d0f, 0x032650f, 0x122650f, 0x120016f,
+    0x0a1016f, 0x043016f, 0x126816f, 0x127816f, 0x079016f, 0x0c9016f, 0x139016f, 0x129816f,
+    0x139816f, 0x189816f, 0x00c016f, 0x12c016f, 0x120116f, 0x040916f, 0x120916f, 0x006916f,
+    0x0d7116f, 0x079116f, 0x12b116f, 0x001216f, 0x122216f, 0x126216f, 0x066a16f, 0x0a6a16f,
+    0x130396f, 0x121b96f, 0x066b96f, 0x0a6b96f, 0x0a7396f, 0x127b96f, 0x129b96f, 0x199b96f,
+    0x0aa396f, 0x12b396f, 0x04c396f, 0x12c396f, 0x122516f, 0x052d16f, 0x123516f, 0x126516f,
+    0x186516f, 0x137516f, 0x0e9d16f, 0x112616f, 0x07101cf, 0x00501cf, 0x04501cf, 0x18705cf,
+    0x12509cf, 0x18509cf, 0x0b00dcf, 0x1818dcf, 0x1720dcf, 0x0430dcf, 0x1830dcf, 0x0040dcf,
+    0x12611cf, 0x12791cf, 0x12991cf, 0x18219cf, 0x04319cf, 0x12719cf, 0x0321dcf, 0x145a1cf,
+    0x036a1cf, 0x0b029cf, 0x03229cf, 0x12229cf, 0x18229cf, 0x04429cf, 0x0322dcf, 0x1122dcf,
+    0x1222dcf, 0x1822dcf, 0x0e42dcf, 0x1242dcf, 0x044adcf, 0x1252dcf, 0x125adcf, 0x185adcf,
+    0x1272dcf, 0x129adcf, 0x12c2dcf, 0x040b1cf, 0x12231cf, 0x18631cf, 0x12731cf, 0x127b1cf,
+    0x04135cf, 0x18135cf, 0x121b5cf, 0x12235cf, 0x18235cf, 0x00335cf, 0x0e335cf, 0x12335cf,
+    0x18335cf, 0x12535cf, 0x129b5cf, 0x189b5cf, 0x14cb5cf, 0x121b9cf, 0x03239cf, 0x122b9cf,
+    0x182b9cf, 0x123b9cf, 0x004b9cf, 0x00539cf, 0x12539cf, 0x125b9cf, 0x126b9cf, 0x127b9cf,
+    0x187b9cf, 0x088b9cf, 0x138b9cf, 0x129b9cf, 0x04ab9cf, 0x18ab9cf, 0x1223dcf, 0x007bdcf,
+    0x1893dcf, 0x04045cf, 0x0b045cf, 0x03245cf, 0x11245cf, 0x12245cf, 0x04345cf, 0x18345cf,
+    0x0d445cf, 0x12545cf, 0x18545cf, 0x0e6c5cf, 0x126c5cf, 0x186c5cf, 0x009c5cf, 0x129c5cf,
+    0x189c5cf, 0x03249cf, 0x12249cf, 0x18249cf, 0x0e3c9cf, 0x129c9cf, 0x0404dcf, 0x0714dcf,
+    0x0324dcf, 0x1224dcf, 0x0d44dcf, 0x0e74dcf, 0x1894dcf, 0x0e9cdcf, 0x129cdcf, 0x189cdcf,
+    0x052d1cf, 0x122d1cf, 0x04551cf, 0x12551cf, 0x045d1cf, 0x0f5d1cf, 0x135d1cf, 0x047d1cf,
+    0x137d1cf, 0x128d1cf, 0x129d1cf, 0x0d059cf, 0x0d459cf, 0x036d9cf, 0x126d9cf, 0x186d9cf,
+    0x048d9cf, 0x0325dcf, 0x1225dcf, 0x136e1cf, 0x14761cf, 0x04961cf, 0x18ce5cf, 0x0c0022f,
+    0x121822f, 0x143822f, 0x126022f, 0x006822f, 0x066822f, 0x127022f, 0x049022f, 0x049822f,
+    0x129822f, 0x139822f, 0x189822f, 0x12a022f, 0x12c022f, 0x181922f, 0x032122f, 0x122122f,
+    0x054122f, 0x126122f, 0x186122f, 0x136922f, 0x0d7122f, 0x0f7122f, 0x127922f, 0x009122f,
+    0x049122f, 0x139122f, 0x04a922f, 0x18b922f, 0x12c122f, 0x0b0222f, 0x181222f, 0x052222f,
+    0x112222f, 0x122222f, 0x123222f, 0x0b5a22f, 0x006222f, 0x086222f, 0x0f6222f, 0x126222f,
+    0x186222f, 0x0a6a22f, 0x0d7222f, 0x049222f, 0x129222f, 0x1203a2f, 0x120ba2f, 0x121ba2f,
+    0x0c23a2f, 0x122ba2f, 0x1233a2f, 0x0d43a2f, 0x0453a2f, 0x045ba2f, 0x0b5ba2f, 0x0e63a2f,
+    0x1263a2f, 0x0a6ba2f, 0x127ba2f, 0x048ba2f, 0x0e93a2f, 0x1293a2f, 0x1393a2f, 0x1893a2f,
+    0x0e9ba2f, 0x0ba3a2f, 0x12b3a2f, 0x0dc3a2f, 0x136d22f, 0x009d22f, 0x112622f, 0x049622f,
+    0x03a124f, 0x1601e4f, 0x0d7224f, 0x0403a4f, 0x0803a4f, 0x1203a4f, 0x008ba4f, 0x071624f,
+    0x0f7624f, 0x0e1068f, 0x122068f, 0x124068f, 0x0d00a8f, 0x1120a8f, 0x1220a8f, 0x0050a8f,
+    0x1250a8f, 0x1818e8f, 0x0430e8f, 0x0240e8f, 0x1170e8f, 0x1890e8f, 0x12a0e8f, 0x128928f,
+    0x002968f, 0x122968f, 0x1831a8f, 0x0b41a8f, 0x1201e8f, 0x070268f, 0x120268f, 0x1202a8f,
+    0x0322a8f, 0x1122a8f, 0x1222a8f, 0x1822a8f, 0x0052a8f, 0x12a2a8f, 0x0e02e8f, 0x1202e8f,
+    0x0322e8f, 0x1122e8f, 0x1222e8f, 0x0a42e8f, 0x1242e8f, 0x0052e8f, 0x1252e8f, 0x085ae8f,
+    0x125ae8f, 0x185ae8f, 0x0e62e8f, 0x127ae8f, 0x12a2e8f, 0x120328f, 0x044328f, 0x127b28f,
+    0x120368f, 0x041368f, 0x003368f, 0x123368f, 0x084b68f, 0x005368f, 0x125368f, 0x185368f,
+    0x186b68f, 0x0e9b68f, 0x129b68f, 0x189b68f, 0x0403e8f, 0x1203e8f, 0x12a3e8f, 0x001c68f,
+    0x032468f, 0x122468f, 0x0d4468f, 0x124468f, 0x125c68f, 0x187c68f, 0x128c68f, 0x189468f,
+    0x189c68f, 0x1224a8f, 0x045ca8f, 0x0344e8f, 0x0d74e8f, 0x089ce8f, 0x0e9ce8f, 0x129ce8f,
+    0x0b2668f, 0x03236cf, 0x129830f, 0x129930f, 0x0b01b0f, 0x126a30f, 0x0d72f0f, 0x032370f,
+    0x122370f, 0x0343b0f, 0x129bb0f, 0x0b0470f, 0x0d0470f, 0x122470f, 0x172470f, 0x024470f,
+    0x127470f, 0x0325f0f, 0x1225f0f, 0x0445f0f, 0x1245f0f, 0x19c832f, 0x1240c10, 0x121a010,
+    0x1002410, 0x1303410, 0x0a43c10, 0x0058510, 0x123bdd0, 0x00645d0, 0x1218290, 0x0528290,
+    0x1230290, 0x1140290, 0x1240290, 0x1850290, 0x0458290, 0x1368290, 0x0488290, 0x1290290,
+    0x0498290, 0x1298290, 0x03c0290, 0x12c0290, 0x1340690, 0x0d01290, 0x0461290, 0x0069290,
+    0x0d89290, 0x0dc1290, 0x12c1290, 0x0712290, 0x121a290, 0x052a290, 0x1262290, 0x006a290,
+    0x046a290, 0x0e6a290, 0x126a290, 0x136a290, 0x0e7a290, 0x127a290, 0x147a290, 0x048a290,
+    0x138a290, 0x1392290, 0x129a290, 0x0303a90, 0x121ba90, 0x0543a90, 0x0d43a90, 0x1343a90,
+    0x0b5ba90, 0x0a6ba90, 0x127ba90, 0x0794690, 0x049e290, 0x1300411, 0x0240411, 0x1240411,
+    0x0320811, 0x1220811, 0x0438811, 0x1250811, 0x0d70811, 0x0430c11, 0x1740c11, 0x0d70c11,
+    0x1229411, 0x1299411, 0x1201811, 0x0419811, 0x0321811, 0x0421811, 0x1121811, 0x1221811,
+    0x0031811, 0x1231811, 0x1831811, 0x1241811, 0x12a1811, 0x0321c11, 0x08a1c11, 0x1202011,
+    0x121a011, 0x1252011, 0x045a011, 0x125a011, 0x046a011, 0x126a011, 0x038a011, 0x009a011,
+    0x129a011, 0x1202411, 0x1222411, 0x0322811, 0x0422811, 0x1122811, 0x1222811, 0x0042811,
+    0x1242811, 0x12a2811, 0x1222c11, 0x0b03011, 0x0423011, 0x1323011, 0x0443011, 0x0d43011,
+    0x1243011, 0x1863011, 0x127b011, 0x12a3011, 0x1203411, 0x0413411, 0x121b411, 0x0423411,
+    0x0033411, 0x0833411, 0x1233411, 0x1833411, 0x0343411, 0x1243411, 0x0453411, 0x1253411,
+    0x129b411, 0x0323c11, 0x1123c11, 0x1223c11, 0x043bc11, 0x047bc11, 0x0324411, 0x0424411,
+    0x1224411, 0x1254411, 0x0324811, 0x1124811, 0x1224811, 0x127c811, 0x0494811, 0x009c811,
+    0x0b04c11, 0x0d04c11, 0x1204c11, 0x0714c11, 0x0324c11, 0x0b24c11, 0x1124c11, 0x1224c11,
+    0x003cc11, 0x043cc11, 0x123cc11, 0x0e74c11, 0x1274c11, 0x12a4c11, 0x126d011, 0x0e7d011,
+    0x0325411, 0x0b25411, 0x1125411, 0x1225411, 0x1825411, 0x0d45411, 0x1125811, 0x0d45811,
+    0x185d811, 0x126d811, 0x0325c11, 0x1225c11, 0x0706011, 0x1206011, 0x0326011, 0x045e011,
+    0x046e011, 0x0326411, 0x0426411, 0x1126411, 0x1226411, 0x0e76411, 0x0318091, 0x1218091,
+    0x1240091, 0x1250091, 0x0e58091, 0x1258091, 0x0460091, 0x1260091, 0x1860091, 0x1268091,
+    0x1278091, 0x1288091, 0x1390091, 0x0098091, 0x0498091, 0x04a8091, 0x0408491, 0x0220491,
+    0x0340491, 0x1340491, 0x0f70491, 0x18a0491, 0x0b00891, 0x0410891, 0x0e10891, 0x1810891,
+    0x1340891, 0x1250891, 0x0d70891, 0x0098891, 0x0898891, 0x0e98891, 0x0d00c91, 0x1218c91,
+    0x1818c91, 0x0320c91, 0x1220c91, 0x0040c91, 0x0340c91, 0x0f40c91, 0x1858c91, 0x0d70c91,
+    0x1270c91, 0x1770c91, 0x1888c91, 0x01a0c91, 0x17a0c91, 0x04c0c91, 0x0711091, 0x0419091,
+    0x1219091, 0x1229091, 0x1829091, 0x1251091, 0x1851091, 0x1259091, 0x1269091, 0x1391091,
+    0x04a9091, 0x0321491, 0x0b21491, 0x0e29491, 0x1241491, 0x1741491, 0x1859491, 0x1889491,
+    0x1101891, 0x1221891, 0x0e31891, 0x0441891, 0x0061891, 0x0069891, 0x1271891, 0x11a1891,
+    0x0c21c91, 0x122a091, 0x182a091, 0x0852091, 0x1252091, 0x0a6a091, 0x126a091, 0x038a091,
+    0x1392091, 0x04aa091, 0x0642491, 0x0d72491, 0x0322891, 0x1222891, 0x1822891, 0x1322c91,
+    0x0442c91, 0x1342c91, 0x0e5ac91, 0x0d03091, 0x0f03091, 0x0d23091, 0x1323091, 0x1723091,
+    0x1743091, 0x1803491, 0x121b491, 0x1823491, 0x0033491, 0x0643491, 0x0d43491, 0x046b491,
+    0x1273491, 0x049b491, 0x129b491, 0x0b43891, 0x068b891, 0x0623c91, 0x0d43c91, 0x005bc91,
+    0x1273c91, 0x1373c91, 0x127bc91, 0x0e8bc91, 0x0d04491, 0x0644491, 0x1304891, 0x1604891,
+    0x1804891, 0x0424891, 0x1224891, 0x1624891, 0x0344891, 0x1344891, 0x0374891, 0x1674891,
+    0x0e9c891, 0x129c891, 0x189c891, 0x12a4891, 0x0604c91, 0x1704c91, 0x0c24c91, 0x0044c91,
+    0x0444c91, 0x1774c91, 0x1325491, 0x0445491, 0x0d05891, 0x1705891, 0x0325891, 0x1325891,
+    0x0d45891, 0x0d75891, 0x079d891, 0x1225c91, 0x1226491, 0x12010f1, 0x04610f1, 0x0ca10f1,
+    0x12220f1, 0x04620f1, 0x046a0f1, 0x181b8f1, 0x01638f1, 0x046b8f1, 0x01650f1, 0x046e0f1,
+    0x009e0f1, 0x1218111, 0x1258111, 0x1368111, 0x0098111, 0x1200511, 0x1808511, 0x1220511,
+    0x0320911, 0x1120911, 0x1220911, 0x1820911, 0x1338911, 0x0d40911, 0x1250911, 0x1220d11,
+    0x1830d11, 0x0240d11, 0x1259111, 0x1261111, 0x04a9111, 0x1121511, 0x1229511, 0x0499511,
+    0x1299511, 0x1899511, 0x1231911, 0x0b71911, 0x0322d11, 0x1222d11, 0x1822d11, 0x045ad11,
+    0x125ad11, 0x0403111, 0x0323111, 0x1123111, 0x1223111, 0x12a3111, 0x121b511, 0x181b511,
+    0x1223511, 0x1233511, 0x1253511, 0x004b911, 0x129b911, 0x0323d11, 0x1223d11, 0x127bd11,
+    0x1224911, 0x083c911, 0x1254911, 0x127c911, 0x12a4911, 0x1224d11, 0x129cd11, 0x18ccd11,
+    0x1205511, 0x0325511, 0x0b25511, 0x0d25511, 0x1225511, 0x0b06111, 0x1206511, 0x12181d1,
+    0x12601d1, 0x12681d1, 0x12881d1, 0x18881d1, 0x04981d1, 0x03205d1, 0x12205d1, 0x04585d1,
+    0x12509d1, 0x0320dd1, 0x1220dd1, 0x18a19d1, 0x1221dd1, 0x121a1d1, 0x125a1d1, 0x185a1d1,
+    0x126a1d1, 0x13921d1, 0x0a025d1, 0x12425d1, 0x03229d1, 0x11229d1, 0x12229d1, 0x0602dd1,
+    0x1222dd1, 0x122add1, 0x125add1, 0x0b031d1, 0x0d031d1, 0x0e231d1, 0x127b1d1, 0x041b5d1,
+    0x0e1b5d1, 0x0e235d1, 0x12235d1, 0x0d435d1, 0x046b5d1, 0x049b5d1, 0x129b5d1, 0x121b9d1,
+    0x122b9d1, 0x182b9d1, 0x12539d1, 0x18539d1, 0x12639d1, 0x126b9d1, 0x127b9d1, 0x187b9d1,
+    0x00939d1, 0x04939d1, 0x129b9d1, 0x189b9d1, 0x0323dd1, 0x1123dd1, 0x1223dd1, 0x1823dd1,
+    0x04a41d1, 0x0b045d1, 0x12245d1, 0x02445d1, 0x03445d1, 0x04445d1, 0x129c5d1, 0x189c5d1,
+    0x03249d1, 0x12249d1, 0x13249d1, 0x083c9d1, 0x0d449d1, 0x13449d1, 0x089c9d1, 0x129c9d1,
+    0x0b04dd1, 0x0d04dd1, 0x1204dd1, 0x0714dd1, 0x0324dd1, 0x1224dd1, 0x1244dd1, 0x125cdd1,
+    0x0d74dd1, 0x1274dd1, 0x049cdd1, 0x0d251d1, 0x12251d1, 0x045d1d1, 0x125d1d1, 0x12651d1,
+    0x127d1d1, 0x187d1d1, 0x13951d1, 0x079d1d1, 0x129d1d1, 0x03255d1, 0x0d255d1, 0x12255d1,
+    0x0d059d1, 0x03259d1, 0x0b259d1, 0x0d259d1, 0x04459d1, 0x04659d1, 0x036d9d1, 0x079d9d1,
+    0x129d9d1, 0x046e1d1, 0x13961d1, 0x13265d1, 0x13465d1, 0x0068291, 0x0800691, 0x1808691,
+    0x0b20691, 0x1220691, 0x0d40691, 0x0458691, 0x0858691, 0x12a0691, 0x0438a91, 0x1250a91,
+    0x1200e91, 0x1218e91, 0x1220e91, 0x0440e91, 0x1240e91, 0x0019291, 0x1289291, 0x0429691,
+    0x1229691, 0x0401a91, 0x0b01a91, 0x1831a91, 0x066a291, 0x126a291, 0x123aa91, 0x0322e91,
+    0x1222e91, 0x0b03291, 0x0e0b291, 0x0d23291, 0x1223291, 0x185b291, 0x1863291, 0x0e7b291,
+    0x127b291, 0x187b291, 0x0713691, 0x121b691, 0x0323691, 0x1223691, 0x1233691, 0x0243691,
+    0x186b691, 0x129b691, 0x189b691, 0x0043e91, 0x127c691, 0x12a4691, 0x1204a91, 0x1224a91,
+    0x183ca91, 0x1254a91, 0x0064a91, 0x0494a91, 0x129ca91, 0x123ce91, 0x0d44e91, 0x189ce91,
+    0x1258311, 0x1300711, 0x0322b11, 0x1222b11, 0x0463311, 0x121b711, 0x129bb11, 0x1123f11,
+    0x1230012, 0x0b00412, 0x0320412, 0x1120412, 0x1220412, 0x0038412, 0x0d40412, 0x1140412,
+    0x0458412, 0x1370412, 0x0088412, 0x0488412, 0x1250812, 0x0088812, 0x0e18c12, 0x1220c12,
+    0x0438c12, 0x1438c12, 0x1240c12, 0x1270c12, 0x00c8c12, 0x0321412, 0x1221412, 0x1201812,
+    0x1121812, 0x1221812, 0x1831812, 0x1271812, 0x0ca1812, 0x0121c12, 0x0141c12, 0x0412012,
+    0x0a12012, 0x1212012, 0x121a012, 0x0032012, 0x125a012, 0x1262012, 0x046a012, 0x126a012,
+    0x128a012, 0x1392012, 0x079a012, 0x1472412, 0x0802812, 0x1122812, 0x1222812, 0x0042812,
+    0x1242812, 0x089a812, 0x0b02c12, 0x1302c12, 0x0f22c12, 0x1222c12, 0x1322c12, 0x0242c12,
+    0x1742c12, 0x045ac12, 0x0862c12, 0x0b72c12, 0x0f72c12, 0x007ac12, 0x127ac12, 0x0492c12,
+    0x0e9ac12, 0x129ac12, 0x04a2c12, 0x13a2c12, 0x0d03012, 0x1203012, 0x000b012, 0x0e0b012,
+    0x0a23012, 0x0b23012, 0x0d23012, 0x1223012, 0x1823012, 0x142b012, 0x1863012, 0x087b012,
+    0x127b012, 0x121b412, 0x0323412, 0x1223412, 0x0033412, 0x0733412, 0x0e33412, 0x1233412,
+    0x0e53412, 0x0093412, 0x0e9b412, 0x129b412, 0x005b812, 0x0d03c12, 0x0343c12, 0x1173c12,
+    0x0d04412, 0x121c412, 0x0324412, 0x0424412, 0x0434412, 0x0e34412, 0x0d44412, 0x1244412,
+    0x1254412, 0x1854412, 0x0374412, 0x1274412, 0x12a4412, 0x1124812, 0x0d44812, 0x0494812,
+    0x0804c12, 0x1804c12, 0x0324c12, 0x0c24c12, 0x1224c12, 0x1244c12, 0x000d012, 0x0715012,
+    0x0735012, 0x125d012, 0x135d012, 0x136d012, 0x188d012, 0x129d012, 0x0325412, 0x1125412,
+    0x1225412, 0x1825412, 0x0d45412, 0x0705812, 0x0325812, 0x1125812, 0x1225c12, 0x0326012,
+    0x1126012, 0x0346012, 0x046e012, 0x0d76012, 0x1396012, 0x1226412, 0x1208052, 0x1218052,
+    0x0528052, 0x1230052, 0x0b40052, 0x0058052, 0x0b58052, 0x1260052, 0x0368052, 0x1268052,
+    0x0078052, 0x0478052, 0x0878052, 0x0f88052, 0x1288052, 0x1388052, 0x0798052, 0x1298052,
+    0x1398052, 0x03a0052, 0x0fa0052, 0x11a0052, 0x12b0052, 0x1301052, 0x0069052, 0x0369052,
+    0x1501c52, 0x0e61c52, 0x0ba1c52, 0x00b1c52, 0x0c42c52, 0x181b852, 0x1233852, 0x0673852,
+    0x1373852, 0x007b852, 0x127b852, 0x129b852, 0x06a3852, 0x0fa3852, 0x0fb3852, 0x12b3852,
+    0x0104452, 0x0404452, 0x0604452, 0x0d04452, 0x1304452, 0x1604452, 0x1804452, 0x0c44452,
+    0x0f44452, 0x0174452, 0x0374452, 0x0674452, 0x1674452, 0x081d052, 0x0e1d052, 0x121d052,
+    0x052d052, 0x132d052, 0x1235052, 0x0a5d052, 0x0b5d052, 0x0f5d052, 0x125d052, 0x1265052,
+    0x127d052, 0x058d052, 0x128d052, 0x0495052, 0x009d052, 0x049d052, 0x129d052, 0x19cd052,
+    0x1226052, 0x0dc0072, 0x0d41072, 0x1258092, 0x0460092, 0x1260092, 0x1860092, 0x1268092,
+    0x0488092, 0x1288092, 0x0490092, 0x1298092, 0x04c8092, 0x0ca0492, 0x0e10892, 0x1238892,
+    0x1298892, 0x1120c92, 0x1220c92, 0x0430c92, 0x1830c92, 0x0ca0c92, 0x1219092, 0x1251092,
+    0x0359092, 0x1259092, 0x1859092, 0x1261092, 0x1279092, 0x1879092, 0x1289092, 0x1121492,
+    0x1101892, 0x0869892, 0x0e69892, 0x0b71892, 0x1271892, 0x0889c92, 0x122a092, 0x125a092,
+    0x046a092, 0x128a092, 0x0492092, 0x0c92092, 0x189a092, 0x00ca092, 0x1272892, 0x129a892,
+    0x0702c92, 0x1222c92, 0x122ac92, 0x005ac92, 0x045ac92, 0x125ac92, 0x00aac92, 0x0423092,
+    0x1223092, 0x0443092, 0x1243092, 0x1203492, 0x121b492, 0x1223492, 0x0833492, 0x006b492,
+    0x1173492, 0x0093492, 0x0893492, 0x049b492, 0x089b492, 0x129b492, 0x18ab492, 0x00cb492,
+    0x0303c92, 0x0b03c92, 0x0243c92, 0x1873c92, 0x009bc92, 0x129bc92, 0x0204492, 0x0804492,
+    0x0b04492, 0x0324492, 0x1124492, 0x1224492, 0x122c492, 0x0434492, 0x0244492, 0x0d44492,
+    0x1254492, 0x0d74492, 0x1674492, 0x008c492, 0x048c492, 0x128c492, 0x188c492, 0x0eac492,
+    0x1824892, 0x0094892, 0x0404c92, 0x0b04c92, 0x0d74c92, 0x129cc92, 0x0d05892, 0x1105892,
+    0x0325892, 0x0b25892, 0x0d25892, 0x0d45892, 0x0325c92, 0x1125c92, 0x1225c92, 0x0e9dc92,
+    0x129dc92, 0x0d26092, 0x12180f2, 0x12300f2, 0x12380f2, 0x0e500f2, 0x13500f2, 0x0c580f2,
+    0x18580f2, 0x00600f2, 0x12600f2, 0x03680f2, 0x12680f2, 0x12780f2, 0x0d880f2, 0x07900f2,
+    0x0ba00f2, 0x0cb00f2, 0x0db00f2, 0x12b00f2, 0x00c00f2, 0x12c00f2, 0x08388f2, 0x05010f2,
+    0x0b010f2, 0x12010f2, 0x12190f2, 0x0b210f2, 0x03690f2, 0x13690f2, 0x0b710f2, 0x03890f2,
+    0x04890f2, 0x0e890f2, 0x12990f2, 0x00a90f2, 0x0db10f2, 0x12b10f2, 0x08020f2, 0x0b220f2,
+    0x11220f2, 0x12220f2, 0x0b5a0f2, 0x185a0f2, 0x12620f2, 0x126a0f2, 0x127a0f2, 0x118a0f2,
+    0x128a0f2, 0x07920f2, 0x0e920f2, 0x13920f2, 0x049a0f2, 0x129a0f2, 0x11a20f2, 0x00aa0f2,
+    0x04aa0f2, 0x12aa0f2, 0x0f22cf2, 0x01a2cf2, 0x0a230f2, 0x04730f2, 0x13038f2, 0x03238f2,
+    0x11238f2, 0x12238f2, 0x08338f2, 0x12338f2, 0x084b8f2, 0x0e4b8f2, 0x005b8f2, 0x0b738f2,
+    0x0d738f2, 0x12738f2, 0x047b8f2, 0x127b8f2, 0x0b8b8f2, 0x049b8f2, 0x129b8f2, 0x139b8f2,
+    0x03b38f2, 0x12b38f2, 0x14c38f2, 0x03244f2, 0x12444f2, 0x16744f2, 0x0a44cf2, 0x0ca4cf2,
+    0x0fa4cf2, 0x045d0f2, 0x0d5d0f2, 0x125d0f2, 0x126d0f2, 0x008d0f2, 0x049d0f2, 0x129d0f2,
+    0x12058f2, 0x11260f2, 0x1258112, 0x1208512, 0x0bc0512, 0x1220912, 0x1338912, 0x0e50912,
+    0x1250912, 0x1850912, 0x1200d12, 0x0320d12, 0x1120d12, 0x1220d12, 0x0038d12, 0x0438d12,
+    0x0458d12, 0x0359112, 0x1269112, 0x1369112, 0x0799112, 0x11a1112, 0x1299512, 0x1239912,
+    0x0b41912, 0x0059912, 0x0069912, 0x1269912, 0x1272512, 0x1202912, 0x1122912, 0x1222912,
+    0x121ad12, 0x0322d12, 0x0d22d12, 0x1122d12, 0x1222d12, 0x1722d12, 0x1252d12, 0x125ad12,
+    0x1272d12, 0x129ad12, 0x189ad12, 0x00aad12, 0x1103112, 0x1203112, 0x000b112, 0x1243112,
+    0x127b112, 0x0ba3112, 0x121b512, 0x0323512, 0x1223512, 0x1233512, 0x123b512, 0x1253512,
+    0x1853512, 0x12a3512, 0x0323d12, 0x1223d12, 0x187bd12, 0x0324512, 0x0424512, 0x1224512,
+    0x0744512, 0x1244512, 0x0274512, 0x008c512, 0x0fa4512, 0x0b04912, 0x1224912, 0x009c912,
+    0x129c912, 0x1104d12, 0x0324d12, 0x1224d12, 0x043cd12, 0x0054d12, 0x0fa4d12, 0x12a4d12,
+    0x1125512, 0x1125d12, 0x1225d12, 0x0e65d12, 0x049dd12, 0x1106512, 0x0326512, 0x0b26512,
+    0x1126512, 0x1226512, 0x1230152, 0x0b40152, 0x0358152, 0x0a68152, 0x1388152, 0x1298152,
+    0x1398152, 0x12b0152, 0x0d01152, 0x1101152, 0x1219152, 0x0321152, 0x0521152, 0x0d21152,
+    0x1121152, 0x1221152, 0x1321152, 0x0631152, 0x1231152, 0x0d41152, 0x0559152, 0x0b59152,
+    0x0c59152, 0x0f59152, 0x0469152, 0x1269152, 0x1271152, 0x1279152, 0x1289152, 0x1299152,
+    0x12b1152, 0x121a152, 0x0322152, 0x1222152, 0x1822152, 0x0e62152, 0x1262152, 0x0a6a152,
+    0x126a152, 0x136a152, 0x1272152, 0x127a152, 0x0b8a152, 0x118a152, 0x049a152, 0x129a152,
+    0x04aa152, 0x18aa152, 0x0c42d52, 0x0b03952, 0x181b952, 0x052b952, 0x1233952, 0x125b952,
+    0x0b73952, 0x138b952, 0x0793952, 0x0d04552, 0x0a44552, 0x1205152, 0x1235152, 0x0326152,
+    0x1126152, 0x1826152, 0x122e152, 0x048e152, 0x128e152, 0x049e152, 0x1208172, 0x0418172,
+    0x1220172, 0x1230172, 0x0340172, 0x0450172, 0x1260172, 0x0468172, 0x0a68172, 0x1278172,
+    0x1388172, 0x1298172, 0x1898172, 0x12b0172, 0x12c0172, 0x1209172, 0x1219172, 0x1121172,
+    0x12b1172, 0x12c1172, 0x1122172, 0x185a172, 0x1262172, 0x047a172, 0x127a172, 0x137a172,
+    0x0792172, 0x129a172, 0x04aa172, 0x0d03972, 0x120b972, 0x1223972, 0x1233972, 0x0343972,
+    0x034b972, 0x0e63972, 0x0c73972, 0x1373972, 0x127b972, 0x187b972, 0x0c8b972, 0x129b972,
+    0x04ab972, 0x12b3972, 0x03c3972, 0x010d172, 0x120d172, 0x0325172, 0x1225172, 0x052d172,
+    0x1235172, 0x1345172, 0x1265172, 0x018d172, 0x128d172, 0x0495172, 0x1126172, 0x047e172,
+    0x0a00192, 0x0a40192, 0x0c58192, 0x1358192, 0x0c88192, 0x04c8192, 0x0a21192, 0x1221192,
+    0x0a41192, 0x0451192, 0x0a89192, 0x12b1192, 0x118a192, 0x128a192, 0x129a192, 0x1233992,
+    0x0e53992, 0x135b992, 0x1173992, 0x1373992, 0x048b992, 0x068b992, 0x13a3992, 0x13b3992,
+    0x1235192, 0x128d192, 0x0795192, 0x129d192, 0x12081b2, 0x14281b2, 0x12301b2, 0x12781b2,
+    0x05881b2, 0x0a881b2, 0x12881b2, 0x18881b2, 0x07901b2, 0x07981b2, 0x12b01b2, 0x03011b2,
+    0x0f011b2, 0x12091b2, 0x0a111b2, 0x12191b2, 0x03211b2, 0x12211b2, 0x0b591b2, 0x120a1b2,
+    0x0a121b2, 0x12221b2, 0x132a1b2, 0x12321b2, 0x127a1b2, 0x187a1b2, 0x138a1b2, 0x129a1b2,
+    0x120b9b2, 0x121b9b2, 0x0a239b2, 0x0f239b2, 0x12339b2, 0x04539b2, 0x03739b2, 0x0a739b2,
+    0x0b739b2, 0x13739b2, 0x129b9b2, 0x0ab39b2, 0x12b39b2, 0x120d1b2, 0x12351b2, 0x07951b2,
+    0x12261b2, 0x12501d2, 0x12781d2, 0x04881d2, 0x12881d2, 0x04a81d2, 0x12005d2, 0x12009d2,
+    0x12209d2, 0x0e509d2, 0x12509d2, 0x04589d2, 0x1200dd2, 0x1818dd2, 0x0240dd2, 0x0c70dd2,
+    0x11015d2, 0x12015d2, 0x00995d2, 0x12995d2, 0x18995d2, 0x11219d2, 0x11a1dd2, 0x125a1d2,
+    0x185a1d2, 0x12025d2, 0x12a25d2, 0x07029d2, 0x0d229d2, 0x12229d2, 0x0b729d2, 0x0702dd2,
+    0x0d02dd2, 0x1202dd2, 0x041add2, 0x081add2, 0x0e1add2, 0x121add2, 0x0322dd2, 0x0822dd2,
+    0x1122dd2, 0x1222dd2, 0x0d72dd2, 0x1272dd2, 0x0ca2dd2, 0x12a2dd2, 0x0d031d2, 0x12031d2,
+    0x04135d2, 0x041b5d2, 0x12235d2, 0x12335d2, 0x185b5d2, 0x046b5d2, 0x186b5d2, 0x04935d2,
+    0x18935d2, 0x18239d2, 0x12539d2, 0x18539d2, 0x045b9d2, 0x125b9d2, 0x12639d2, 0x127b9d2,
+    0x049b9d2, 0x129b9d2, 0x123bdd2, 0x183bdd2, 0x1173dd2, 0x187bdd2, 0x008bdd2, 0x0b045d2,
+    0x12045d2, 0x0e0c5d2, 0x120c5d2, 0x001c5d2, 0x0e1c5d2, 0x121c5d2, 0x03245d2, 0x04245d2,
+    0x0b245d2, 0x11245d2, 0x12245d2, 0x17245d2, 0x0e345d2, 0x126c5d2, 0x008c5d2, 0x009c5d2,
+    0x129c5d2, 0x12a45d2, 0x123cdd2, 0x0b74dd2, 0x04151d2, 0x13151d2, 0x07351d2, 0x12551d2,
+    0x125d1d2, 0x12651d2, 0x127d1d2, 0x187d1d2, 0x128d1d2, 0x04951d2, 0x129d1d2, 0x11059d2,
+    0x04159d2, 0x03259d2, 0x052d9d2, 0x122d9d2, 0x045d9d2, 0x125d9d2, 0x12659d2, 0x036d9d2,
+    0x046d9d2, 0x127d9d2, 0x04959d2, 0x079d9d2, 0x12061d2, 0x045e1d2, 0x19a61d2, 0x0d465d2,
+    0x18101f2, 0x0e181f2, 0x03201f2, 0x11201f2, 0x12201f2, 0x12301f2, 0x08381f2, 0x0b401f2,
+    0x0d401f2, 0x13401f2, 0x04501f2, 0x03581f2, 0x04581f2, 0x0b581f2, 0x13581f2, 0x12601f2,
+    0x04681f2, 0x06681f2, 0x12681f2, 0x03881f2, 0x12881f2, 0x13881f2, 0x04981f2, 0x12981f2,
+    0x0ba01f2, 0x0bb01f2, 0x12b01f2, 0x03c01f2, 0x12c01f2, 0x00c81f2, 0x19c81f2, 0x0b011f2,
+    0x0d011f2, 0x13011f2, 0x12111f2, 0x13111f2, 0x0b211f2, 0x11211f2, 0x0b411f2, 0x11411f2,
+    0x12511f2, 0x03591f2, 0x0a591f2, 0x12711f2, 0x12991f2, 0x06a11f2, 0x12b11f2, 0x18b11f2,
+    0x0b021f2, 0x00121f2, 0x041a1f2, 0x11221f2, 0x12221f2, 0x052a1f2, 0x122a1f2, 0x045a1f2,
+    0x12621f2, 0x006a1f2, 0x0a6a1f2, 0x126a1f2, 0x138a1f2, 0x188a1f2, 0x129a1f2, 0x199a1f2,
+    0x12aa1f2, 0x1802df2, 0x0672df2, 0x041b9f2, 0x121b9f2, 0x0c739f2, 0x11739f2, 0x13739f2,
+    0x0a8b9f2, 0x07939f2, 0x129b9f2, 0x03045f2, 0x06045f2, 0x13045f2, 0x03245f2, 0x16245f2,
+    0x13445f2, 0x03745f2, 0x06745f2, 0x04a45f2, 0x06a45f2, 0x121d1f2, 0x03251f2, 0x11251f2,
+    0x12251f2, 0x12351f2, 0x045d1f2, 0x04651f2, 0x18651f2, 0x128d1f2, 0x009d1f2, 0x0b061f2,
+    0x048e1f2, 0x0105212, 0x1605212, 0x0625212, 0x0345212, 0x1345212, 0x1945212, 0x1208272,
+    0x0418272, 0x1230272, 0x1830272, 0x0640272, 0x0468272, 0x0668272, 0x0778272, 0x1278272,
+    0x0d88272, 0x1188272, 0x1288272, 0x1298272, 0x0da0272, 0x12b0272, 0x12c0272, 0x0d01272,
+    0x1101272, 0x0319272, 0x0419272, 0x1219272, 0x0a21272, 0x0c21272, 0x0d21272, 0x0b41272,
+    0x0059272, 0x0459272, 0x0b59272, 0x0461272, 0x1261272, 0x0369272, 0x0e69272, 0x1269272,
+    0x1369272, 0x1279272, 0x1379272, 0x0489272, 0x1299272, 0x12b1272, 0x18b1272, 0x12c1272,
+    0x0712272, 0x0322272, 0x1222272, 0x015a272, 0x045a272, 0x0462272, 0x1262272, 0x1862272,
+    0x007a272, 0x047a272, 0x048a272, 0x0a8a272, 0x0f8a272, 0x128a272, 0x04aa272, 0x18aa272,
+    0x0403a72, 0x0803a72, 0x1203a72, 0x1303a72, 0x120ba72, 0x0f23a72, 0x1833a72, 0x1343a72,
+    0x0d5ba72, 0x0063a72, 0x036ba72, 0x066ba72, 0x0a6ba72, 0x0d6ba72, 0x0a73a72, 0x1173a72,
+    0x047ba72, 0x127ba72, 0x137ba72, 0x1293a72, 0x129ba72, 0x139ba72, 0x0da3a72, 0x0fa3a72,
+    0x11a3a72, 0x0db3a72, 0x0fb3a72, 0x12b3a72, 0x0304672, 0x0404672, 0x0604672, 0x0a04672,
+    0x0f24672, 0x1624672, 0x0044672, 0x0644672, 0x0c44672, 0x0f74672, 0x1674672, 0x1874672,
+    0x0ca4672, 0x120d272, 0x041d272, 0x121d272, 0x0b5d272, 0x0c5d272, 0x0c65272, 0x1265272,
+    0x126d272, 0x007d272, 0x047d272, 0x048d272, 0x138d272, 0x0326272, 0x1226272, 0x085e272,
+    0x0e5e272, 0x0466272, 0x1866272, 0x048e272, 0x049e272, 0x0700692, 0x1200692, 0x1808692,
+    0x1120692, 0x0038692, 0x0810a92, 0x1250a92, 0x1850a92, 0x0488a92, 0x1218e92, 0x1170e92,
+    0x1890e92, 0x0419292, 0x1369292, 0x1289292, 0x0499292, 0x1299292, 0x1899292, 0x0d01a92,
+    0x1239a92, 0x1271a92, 0x11a1e92, 0x121a292, 0x136a292, 0x129a292, 0x0422692, 0x123aa92,
+    0x0aa2a92, 0x0812e92, 0x002ae92, 0x0e2ae92, 0x1252e92, 0x077ae92, 0x12a2e92, 0x1243292,
+    0x0063292, 0x1273292, 0x077b292, 0x127b292, 0x1243692, 0x1253692, 0x006b692, 0x126b692,
+    0x0fa3692, 0x1223e92, 0x008be92, 0x0704692, 0x0b04692, 0x1204692, 0x1304692, 0x121c692,
+    0x0324692, 0x1224692, 0x122c692, 0x182c692, 0x1834692, 0x008c692, 0x0324a92, 0x1224a92,
+    0x12a4a92, 0x1174e92, 0x008ce92, 0x009ce92, 0x12082d2, 0x0a102d2, 0x12182d2, 0x04302d2,
+    0x12302d2, 0x0b402d2, 0x0d402d2, 0x04582d2, 0x18582d2, 0x18602d2, 0x06682d2, 0x0a682d2,
+    0x12682d2, 0x12782d2, 0x13782d2, 0x03882d2, 0x04882d2, 0x05882d2, 0x13882d2, 0x12982d2,
+    0x0bc02d2, 0x12c02d2, 0x0b012d2, 0x04192d2, 0x03212d2, 0x0b212d2, 0x11212d2, 0x12212d2,
+    0x11412d2, 0x13592d2, 0x05892d2, 0x12c12d2, 0x12222d2, 0x12322d2, 0x045a2d2, 0x12622d2,
+    0x0a6a2d2, 0x047a2d2, 0x048a2d2, 0x12922d2, 0x079a2d2, 0x129a2d2, 0x04aa2d2, 0x19ca2d2,
+    0x120bad2, 0x045bad2, 0x0d5bad2, 0x127bad2, 0x137bad2, 0x129bad2, 0x0da3ad2, 0x0408712,
+    0x0b40712, 0x0470712, 0x1670712, 0x0420b12, 0x1220b12, 0x0d70b12, 0x1269312, 0x1122b12,
+    0x1222b12, 0x1242f12, 0x077af12, 0x00aaf12, 0x1103312, 0x0713712, 0x1213712, 0x121b712,
+    0x0323712, 0x1223712, 0x079b712, 0x0323f12, 0x1223f12, 0x123bf12, 0x0704712, 0x0d24712,
+    0x0f74b12, 0x043cf12, 0x1125712, 0x1258013, 0x0098013, 0x1120413, 0x1220413, 0x0340413,
+    0x1240413, 0x0058413, 0x1170413, 0x0da0413, 0x12a0413, 0x0d00813, 0x1220813, 0x1320813,
+    0x0438813, 0x0e38813, 0x1238813, 0x1250813, 0x1270813, 0x1298813, 0x1259013, 0x0041413,
+    0x1831813, 0x0061813, 0x1201c13, 0x1289c13, 0x0032013, 0x1232013, 0x0e52013, 0x125a013,
+    0x126a013, 0x008a013, 0x0792013, 0x129a013, 0x1222413, 0x1202813, 0x1222813, 0x083a813,
+    0x0d42813, 0x1242813, 0x1852813, 0x0a02c13, 0x1002c13, 0x1102c13, 0x1202c13, 0x1212c13,
+    0x1812c13, 0x0022c13, 0x1122c13, 0x1222c13, 0x1252c13, 0x1852c13, 0x125ac13, 0x0062c13,
+    0x007ac13, 0x0aa2c13, 0x12a2c13, 0x0b03013, 0x0323013, 0x1223013, 0x0d43013, 0x1243013,
+    0x1863013, 0x127b013, 0x1203413, 0x0033413, 0x0833413, 0x1233413, 0x123b413, 0x0053413,
+    0x1253413, 0x1853413, 0x006b413, 0x1893413, 0x089b413, 0x0e9b413, 0x189b413, 0x1203c13,
+    0x0323c13, 0x0d23c13, 0x1223c13, 0x1323c13, 0x1243c13, 0x007bc13, 0x12a3c13, 0x1204413,
+    0x0e1c413, 0x0324413, 0x1224413, 0x0034413, 0x0434413, 0x126c413, 0x0274413, 0x0a74413,
+    0x1274413, 0x127c413, 0x048c413, 0x188c413, 0x0894413, 0x129c413, 0x189c413, 0x1104813,
+    0x0324813, 0x1124813, 0x1224813, 0x1254813, 0x0094813, 0x0494813, 0x0e94813, 0x1104c13,
+    0x1124c13, 0x1224c13, 0x123cc13, 0x0444c13, 0x1474c13, 0x129cc13, 0x12a4c13, 0x040d013,
+    0x035d013, 0x0d75013, 0x047d013, 0x129d013, 0x0705413, 0x1205413, 0x1125413, 0x0805813,
+    0x1205813, 0x0325813, 0x1125813, 0x0445813, 0x0495813, 0x129d813, 0x0325c13, 0x1125c13,
+    0x1225c13, 0x1245c13, 0x0b75c13, 0x0d75c13, 0x1175c13, 0x12a5c13, 0x008e013, 0x00ce413,
+    0x04ce413, 0x0418093, 0x1218093, 0x0320093, 0x1250093, 0x1258093, 0x1260093, 0x1288093,
+    0x1298093, 0x04c8093, 0x1238893, 0x1838893, 0x0098893, 0x1259093, 0x1261093, 0x0369093,
+    0x0469093, 0x1269093, 0x1869093, 0x1289093, 0x1229493, 0x1231893, 0x00a1893, 0x12a1893,
+    0x1289c93, 0x0342093, 0x125a093, 0x036a093, 0x126a093, 0x0402c93, 0x0e12c93, 0x1222c93,
+    0x1722c93, 0x0042c93, 0x0242c93, 0x125ac93, 0x185ac93, 0x0872c93, 0x1272c93, 0x0323093,
+    0x1223093, 0x087b093, 0x127b093, 0x137b093, 0x0493093, 0x0713493, 0x121b493, 0x141b493,
+    0x1223493, 0x0433493, 0x0043493, 0x046b493, 0x0e6b493, 0x186b493, 0x0d73493, 0x129b493,
+    0x189b493, 0x04a3493, 0x0b03c93, 0x1203c93, 0x1873c93, 0x0804493, 0x1204493, 0x0414493,
+    0x0a24493, 0x1224493, 0x042c493, 0x122c493, 0x0034493, 0x1264493, 0x046c493, 0x126c493,
+    0x188c493, 0x129c493, 0x005c893, 0x009c893, 0x049c893, 0x129c893, 0x1224c93, 0x123cc93,
+    0x008cc93, 0x088cc93, 0x0715093, 0x0735093, 0x0325893, 0x0b25893, 0x1345893, 0x1205c93,
+    0x1225c93, 0x129dc93, 0x0a100f3, 0x08300f3, 0x0c400f3, 0x04580f3, 0x08580f3, 0x00680f3,
+    0x04680f3, 0x06680f3, 0x12680f3, 0x17680f3, 0x0c880f3, 0x12880f3, 0x12b00f3, 0x18b00f3,
+    0x04090f3, 0x00110f3, 0x03210f3, 0x0a210f3, 0x12210f3, 0x0d310f3, 0x02410f3, 0x0d410f3,
+    0x05590f3, 0x00610f3, 0x12690f3, 0x16710f3, 0x0c890f3, 0x0f910f3, 0x04990f3, 0x12b10f3,
+    0x18b10f3, 0x12320f3, 0x0a5a0f3, 0x0b5a0f3, 0x046a0f3, 0x126a0f3, 0x0b720f3, 0x0b8a0f3,
+    0x132b8f3, 0x045b8f3, 0x085b8f3, 0x0e8b8f3, 0x0f8b8f3, 0x12a38f3, 0x0bb38f3, 0x04044f3,
+    0x16044f3, 0x03444f3, 0x0f444f3, 0x04744f3, 0x121d0f3, 0x12350f3, 0x004d0f3, 0x0a6d0f3,
+    0x0b8d0f3, 0x00c50f3, 0x08660f3, 0x18660f3, 0x1268113, 0x1288113, 0x0b00913, 0x0010913,
+    0x0320913, 0x1220913, 0x1838913, 0x1250913, 0x1850913, 0x1818d13, 0x0320d13, 0x1220d13,
+    0x1289113, 0x1229513, 0x1271513, 0x1299513, 0x1221913, 0x0d71913, 0x1202913, 0x1222913,
+    0x1242913, 0x0052913, 0x0a02d13, 0x0322d13, 0x1122d13, 0x1222d13, 0x125ad13, 0x185ad13,
+    0x079ad13, 0x129ad13, 0x0e0b113, 0x0323113, 0x1223113, 0x0d73113, 0x127b113, 0x1203513,
+    0x1313513, 0x121b513, 0x0023513, 0x0323513, 0x1223513, 0x0433513, 0x1233513, 0x1253513,
+    0x186b513, 0x129b513, 0x189b513, 0x1243d13, 0x187bd13, 0x0324513, 0x1224513, 0x125c513,
+    0x1274513, 0x128c513, 0x0714d13, 0x1124d13, 0x1244d13, 0x048cd13, 0x189cd13, 0x0fa4d13,
+    0x0d46113, 0x126e113, 0x1226513, 0x18ce513, 0x12181d3, 0x18181d3, 0x04c81d3, 0x12509d3,
+    0x18509d3, 0x12709d3, 0x0418dd3, 0x12011d3, 0x12295d3, 0x18295d3, 0x12995d3, 0x12a15d3,
+    0x04019d3, 0x12019d3, 0x03219d3, 0x12219d3, 0x04a19d3, 0x1271dd3, 0x045a1d3, 0x125a1d3,
+    0x066a1d3, 0x04921d3, 0x129a1d3, 0x18029d3, 0x03229d3, 0x11229d3, 0x12229d3, 0x12729d3,
+    0x0d02dd3, 0x1102dd3, 0x1202dd3, 0x0322dd3, 0x1222dd3, 0x125add3, 0x185add3, 0x129add3,
+    0x12a2dd3, 0x0bc2dd3, 0x0d031d3, 0x120b1d3, 0x12231d3, 0x00431d3, 0x18631d3, 0x12731d3,
+    0x081b5d3, 0x0e1b5d3, 0x03235d3, 0x11235d3, 0x12235d3, 0x18235d3, 0x12335d3, 0x00535d3,
+    0x12535d3, 0x046b5d3, 0x12a35d3, 0x125b9d3, 0x12639d3, 0x126b9d3, 0x129b9d3, 0x0323dd3,
+    0x0423dd3, 0x0a23dd3, 0x1123dd3, 0x1223dd3, 0x043bdd3, 0x083bdd3, 0x123bdd3, 0x1243dd3,
+    0x0873dd3, 0x1273dd3, 0x187bdd3, 0x04a41d3, 0x07045d3, 0x0d045d3, 0x12045d3, 0x12145d3,
+    0x12245d3, 0x02445d3, 0x08445d3, 0x12745d3, 0x13745d3, 0x128c5d3, 0x04945d3, 0x08945d3,
+    0x0a945d3, 0x009c5d3, 0x049c5d3, 0x129c5d3, 0x12049d3, 0x03249d3, 0x12249d3, 0x183c9d3,
+    0x18949d3, 0x0324dd3, 0x1124dd3, 0x1224dd3, 0x189cdd3, 0x12551d3, 0x126d1d3, 0x128d1d3,
+    0x04951d3, 0x18951d3, 0x129d1d3, 0x04cd1d3, 0x18cd1d3, 0x03259d3, 0x04459d3, 0x126d9d3,
+    0x186d9d3, 0x04959d3, 0x18959d3, 0x129d9d3, 0x04cd9d3, 0x18cd9d3, 0x03261d3, 0x11261d3,
+    0x0d761d3, 0x12761d3, 0x03265d3, 0x12265d3, 0x04465d3, 0x1208233, 0x1218233, 0x0830233,
+    0x0a40233, 0x1260233, 0x0a68233, 0x1068233, 0x1268233, 0x1368233, 0x0478233, 0x1278233,
+    0x1378233, 0x1290233, 0x1298233, 0x1398233, 0x04a8233, 0x05c0233, 0x12c0233, 0x0a11233,
+    0x0321233, 0x0d21233, 0x1221233, 0x0029233, 0x0541233, 0x1251233, 0x0061233, 0x1261233,
+    0x1291233, 0x1391233, 0x1299233, 0x12b1233, 0x05c1233, 0x12c1233, 0x0202233, 0x041a233,
+    0x1122233, 0x1222233, 0x052a233, 0x0e32233, 0x1232233, 0x0452233, 0x035a233, 0x0b5a233,
+    0x1262233, 0x046a233, 0x126a233, 0x0b72233, 0x1172233, 0x1272233, 0x127a233, 0x187a233,
+    0x1392233, 0x0303a33, 0x0a03a33, 0x1303a33, 0x0a13a33, 0x041ba33, 0x121ba33, 0x1233a33,
+    0x1243a33, 0x0453a33, 0x0f63a33, 0x006ba33, 0x026ba33, 0x046ba33, 0x0a6ba33, 0x126ba33,
+    0x1973a33, 0x079ba33, 0x129ba33, 0x12b3a33, 0x12c3a33, 0x0325233, 0x1225233, 0x0e35233,
+    0x1235233, 0x0b5d233, 0x1126233, 0x0456233, 0x0066233, 0x127e233, 0x0418253, 0x0818253,
+    0x1288253, 0x0322a53, 0x000d253, 0x0e0d253, 0x1268293, 0x1388293, 0x0798293, 0x0400693,
+    0x1100693, 0x1200693, 0x1808693, 0x0320693, 0x1220693, 0x1250a93, 0x1201693, 0x0429693,
+    0x1229693, 0x1299693, 0x1899693, 0x0089a93, 0x045a293, 0x006a293, 0x0c92293, 0x149aa93,
+    0x1222e93, 0x007ae93, 0x0892e93, 0x0343293, 0x1863293, 0x127b293, 0x187b293, 0x1203693,
+    0x121b693, 0x0323693, 0x1123693, 0x1223693, 0x1233693, 0x186b693, 0x0a23e93, 0x0a43e93,
+    0x045be93, 0x04a4293, 0x121c693, 0x122c693, 0x182c693, 0x1254693, 0x0464693, 0x1264693,
+    0x126c693, 0x136c693, 0x127c693, 0x128c693, 0x183ca93, 0x1254a93, 0x1854a93, 0x0424e93,
+    0x089ce93, 0x189ce93, 0x12a4e93, 0x1225e93, 0x1126293, 0x12202d3, 0x0d402d3, 0x12582d3,
+    0x0a682d3, 0x12982d3, 0x12c02d3, 0x0b212d3, 0x0d212d3, 0x0f212d3, 0x11212d3, 0x0a892d3,
+    0x0f892d3, 0x11222d3, 0x12322d3, 0x0b5a2d3, 0x135a2d3, 0x0a6a2d3, 0x126a2d3, 0x186a2d3,
+    0x048a2d3, 0x0f8a2d3, 0x049a2d3, 0x129a2d3, 0x1123ad3, 0x11262d3, 0x1221313, 0x1289313,
+    0x0dc2313, 0x1222b13, 0x1122f13, 0x127b313, 0x041b713, 0x0323713, 0x1223713, 0x0b03f13,
+    0x0323f13, 0x1223f13, 0x1823f13, 0x0243f13, 0x1273f13, 0x127bf13, 0x0e9bf13, 0x0d04713,
+    0x0324713, 0x1224713, 0x1274713, 0x043cf13, 0x1288333, 0x1258074, 0x126b874, 0x08580d4,
+    0x03218d4, 0x0d02cf4, 0x148d0f4, 0x0490154, 0x0060174, 0x1268174, 0x0061174, 0x0d43174,
+    0x0303574, 0x0403574, 0x1103574, 0x1203574, 0x0d03d74, 0x1205574, 0x0446174, 0x0446574,
+    0x0860194, 0x0b20594, 0x1120594, 0x0458594, 0x1270594, 0x0488594, 0x0202194, 0x0a02194,
+    0x1002194, 0x0703194, 0x1203194, 0x0323194, 0x0323d94, 0x123bd94, 0x0443d94, 0x189bd94,
+    0x0704594, 0x1204594, 0x12401b4, 0x13781b4, 0x0c881b4, 0x18881b4, 0x12a01b4, 0x06005b4,
+    0x0d005b4, 0x11005b4, 0x03205b4, 0x03405b4, 0x17705b4, 0x0f009b4, 0x12209b4, 0x00409b4,
+    0x12709b4, 0x18709b4, 0x12a09b4, 0x0c00db4, 0x0420db4, 0x1270db4, 0x06a0db4, 0x07991b4,
+    0x17415b4, 0x06019b4, 0x13219b4, 0x03719b4, 0x13719b4, 0x0ca19b4, 0x1301db4, 0x0f41db4,
+    0x00121b4, 0x129a1b4, 0x0c025b4, 0x03229b4, 0x13229b4, 0x03429b4, 0x1602db4, 0x1802db4,
+    0x0322db4, 0x1322db4, 0x0342db4, 0x0d031b4, 0x16231b4, 0x17431b4, 0x1803db4, 0x0623db4,
+    0x0d23db4, 0x0d43db4, 0x03245b4, 0x03445b4, 0x06445b4, 0x0f445b4, 0x16049b4, 0x18049b4,
+    0x04249b4, 0x16249b4, 0x17249b4, 0x03749b4, 0x1704db4, 0x0d44db4, 0x13259b4, 0x13459b4,
+    0x0d759b4, 0x16705f4, 0x04c05f4, 0x1270df4, 0x1888df4, 0x03691f4, 0x13225f4, 0x1802df4,
+    0x0322df4, 0x1342df4, 0x0323df4, 0x0d045f4, 0x0da45f4, 0x04249f4, 0x18249f4, 0x0a04df4,
+    0x1124df4, 0x0444df4, 0x0820234, 0x0858234, 0x1270234, 0x0488234, 0x0888234, 0x0490234,
+    0x0498234, 0x1720634, 0x0040634, 0x0420e34, 0x0b01234, 0x1201234, 0x0e19234, 0x0241234,
+    0x0069234, 0x1369234, 0x0321a34, 0x1121a34, 0x1221a34, 0x0b02234, 0x049a234, 0x0d03234,
+    0x0b03634, 0x0323634, 0x0323e34, 0x0404a34, 0x0344a34, 0x0d74a34, 0x140d234, 0x1205634,
+    0x1289254, 0x0023654, 0x04a4254, 0x048d254, 0x188d254, 0x0889274, 0x0b012b4, 0x12012b4,
+    0x005d2b4, 0x00a0815, 0x0320c15, 0x1220c15, 0x0b01815, 0x12a1815, 0x125a015, 0x048a015,
+    0x128a015, 0x188a015, 0x1202815, 0x0b42815, 0x1222c15, 0x1242c15, 0x0492c15, 0x127b015,
+    0x187b015, 0x001b415, 0x0323415, 0x1223415, 0x1233415, 0x129b415, 0x0323c15, 0x1123c15,
+    0x1223c15, 0x0d04415, 0x1204415, 0x181c415, 0x0224415, 0x1224415, 0x0044415, 0x1744415,
+    0x006c415, 0x12a4415, 0x04ac415, 0x0b04815, 0x1224815, 0x129c815, 0x189c815, 0x0244c15,
+    0x12a4c15, 0x0715015, 0x049d015, 0x129d015, 0x049d815, 0x1225c15, 0x0458095, 0x1258095,
+    0x1858095, 0x0069095, 0x1279095, 0x1289095, 0x1889095, 0x1201895, 0x1221895, 0x0441895,
+    0x1271895, 0x0461c95, 0x125a095, 0x185a095, 0x126a095, 0x186a095, 0x1102c95, 0x121ac95,
+    0x131ac95, 0x1222c95, 0x125ac95, 0x0ca2c95, 0x0403495, 0x0b03495, 0x121b495, 0x141b495,
+    0x1823495, 0x0433495, 0x0d43495, 0x129b495, 0x12a3495, 0x120c495, 0x008c495, 0x188c495,
+    0x1394495, 0x129c495, 0x149c495, 0x007c895, 0x009c895, 0x129c895, 0x0714c95, 0x0325c95,
+    0x1125c95, 0x1225c95, 0x0b45c95, 0x1146495, 0x1258115, 0x0368115, 0x1220515, 0x1720515,
+    0x1820515, 0x0320915, 0x1220915, 0x1838915, 0x1289115, 0x12b1115, 0x18b1115, 0x0019515,
+    0x1229515, 0x1201915, 0x0041915, 0x041ad15, 0x1122d15, 0x085ad15, 0x125ad15, 0x0d23115,
+    0x0b03515, 0x1203515, 0x0013515, 0x0323515, 0x1123515, 0x1223515, 0x1623515, 0x0243515,
+    0x1273515, 0x129b515, 0x035b915, 0x125b915, 0x0324515, 0x0e24515, 0x1224515, 0x0034515,
+    0x0434515, 0x0344515, 0x125c515, 0x149c515, 0x1204915, 0x0324915, 0x1224915, 0x0444915,
+    0x046c915, 0x0d74915, 0x0e9c915, 0x0404d15, 0x1204d15, 0x1724d15, 0x0e8cd15, 0x009cd15,
+    0x1205515, 0x1305515, 0x001d515, 0x1125515, 0x1225515, 0x1146515, 0x1176515, 0x1241175,
+    0x1222175, 0x1233975, 0x12881d5, 0x01009d5, 0x12209d5, 0x1818dd5, 0x1470dd5, 0x0da0dd5,
+    0x00611d5, 0x04419d5, 0x121a1d5, 0x045a1d5, 0x127a1d5, 0x0402dd5, 0x1102dd5, 0x0322dd5,
+    0x1222dd5, 0x1322dd5, 0x1252dd5, 0x009add5, 0x049add5, 0x089add5, 0x129add5, 0x00aadd5,
+    0x04aadd5, 0x11231d5, 0x0324dd5, 0x1224dd5, 0x04351d5, 0x145d1d5, 0x03259d5, 0x11259d5,
+    0x0b25dd5, 0x033e5d5, 0x0240235, 0x125a235, 0x0c73a35, 0x12a3a35, 0x16a3a35, 0x12b3a35,
+    0x1231a95, 0x1831a95, 0x1239a95, 0x1839a95, 0x0e32e95, 0x126ae95, 0x00aae95, 0x189ce95,
+    0x1210016, 0x0450816, 0x0e50816, 0x1250816, 0x1218c16, 0x1818c16, 0x0320c16, 0x1120c16,
+    0x1220c16, 0x0430c16, 0x1240c16, 0x1298c16, 0x1229416, 0x1299416, 0x0321816, 0x1221816,
+    0x0031816, 0x14c1816, 0x0e71c16, 0x041a016, 0x122a016, 0x132a016, 0x125a016, 0x126a016,
+    0x128a016, 0x049a016, 0x129a016, 0x1202816, 0x0322816, 0x0d22816, 0x1122816, 0x1222816,
+    0x122a816, 0x0e1ac16, 0x121ac16, 0x0322c16, 0x1122c16, 0x1222c16, 0x0442c16, 0x1242c16,
+    0x1252c16, 0x005ac16, 0x125ac16, 0x185ac16, 0x189ac16, 0x0323016, 0x1223016, 0x12a3016,
+    0x121b416, 0x0323416, 0x1223416, 0x1823416, 0x1233416, 0x1253416, 0x1853416, 0x045b416,
+    0x185b416, 0x006b416, 0x129b416, 0x189b416, 0x04cb416, 0x122c016, 0x120c416, 0x180c416,
+    0x121c416, 0x0324416, 0x1224416, 0x1924416, 0x1254416, 0x1264416, 0x126c416, 0x127c416,
+    0x048c416, 0x1394416, 0x129c416, 0x1224816, 0x183c816, 0x1264816, 0x127c816, 0x187c816,
+    0x129c816, 0x0f04c16, 0x129cc16, 0x052d016, 0x0735016, 0x1255016, 0x0a5d016, 0x125d016,
+    0x128d016, 0x0325416, 0x1225416, 0x1825416, 0x1205816, 0x1225816, 0x125d816, 0x0325c16,
+    0x1125c16, 0x1225c16, 0x0326016, 0x1146416, 0x0e76416, 0x0358096, 0x1258096, 0x0160096,
+    0x1268096, 0x1288096, 0x1808496, 0x1120496, 0x1338896, 0x0b20c96, 0x1830c96, 0x1219096,
+    0x0451096, 0x1251096, 0x1259096, 0x1261096, 0x1269096, 0x1869096, 0x1279096, 0x1879096,
+    0x1391096, 0x0499096, 0x1299096, 0x0499496, 0x1299496, 0x121a096, 0x125a096, 0x128a096,
+    0x0492096, 0x04ca096, 0x1202896, 0x121ac96, 0x0452c96, 0x1252c96, 0x1352c96, 0x125ac96,
+    0x185ac96, 0x129ac96, 0x120b096, 0x121b496, 0x0433496, 0x186b496, 0x129b496, 0x1274496,
+    0x0794496, 0x129c896, 0x1204c96, 0x185cc96, 0x0325c96, 0x1225c96, 0x0e600f6, 0x12600f6,
+    0x06680f6, 0x12780f6, 0x04880f6, 0x00980f6, 0x12980f6, 0x0fa00f6, 0x11a00f6, 0x0b010f6,
+    0x11010f6, 0x0d210f6, 0x0f210f6, 0x13290f6, 0x0a590f6, 0x0c590f6, 0x12690f6, 0x12990f6,
+    0x12b10f6, 0x12c10f6, 0x121a0f6, 0x132a0f6, 0x12320f6, 0x0a5a0f6, 0x12620f6, 0x126a0f6,
+    0x12720f6, 0x127a0f6, 0x137a0f6, 0x118a0f6, 0x128a0f6, 0x07920f6, 0x12920f6, 0x13920f6,
+    0x129a0f6, 0x189a0f6, 0x19ca0f6, 0x0f638f6, 0x05738f6, 0x13738f6, 0x127b8f6, 0x0b8b8f6,
+    0x138b8f6, 0x0e938f6, 0x12b38f6, 0x0f650f6, 0x127d0f6, 0x001e0f6, 0x0010916, 0x1250916,
+    0x1850916, 0x1818d16, 0x1220d16, 0x1259116, 0x0321516, 0x1221516, 0x1821516, 0x0441516,
+    0x1899516, 0x0d01916, 0x0031916, 0x1831916, 0x1242916, 0x0e12d16, 0x121ad16, 0x0322d16,
+    0x1222d16, 0x0032d16, 0x1242d16, 0x004ad16, 0x125ad16, 0x129ad16, 0x127b116, 0x121b516,
+    0x0323516, 0x1223516, 0x1823516, 0x0433516, 0x1233516, 0x1833516, 0x1253516, 0x006b516,
+    0x126b516, 0x1273516, 0x04cb516, 0x0323d16, 0x1123d16, 0x1223d16, 0x0324516, 0x1124516,
+    0x1224516, 0x008c516, 0x0324916, 0x1224916, 0x003c916, 0x133c916, 0x127c916, 0x129c916,
+    0x0d04d16, 0x0324d16, 0x1224d16, 0x043cd16, 0x123cd16, 0x183cd16, 0x0325516, 0x1125516,
+    0x1225516, 0x0d26516, 0x1226516, 0x12181d6, 0x03581d6, 0x12509d6, 0x0430dd6, 0x0ba15d6,
+    0x12a25d6, 0x11229d6, 0x00529d6, 0x121add6, 0x122add6, 0x185add6, 0x04aadd6, 0x120b1d6,
+    0x180b1d6, 0x0dc31d6, 0x00335d6, 0x08335d6, 0x12535d6, 0x18535d6, 0x129b5d6, 0x121b9d6,
+    0x03239d6, 0x122b9d6, 0x182b9d6, 0x035b9d6, 0x125b9d6, 0x126b9d6, 0x127b9d6, 0x187b9d6,
+    0x04939d6, 0x07939d6, 0x199b9d6, 0x121c5d6, 0x12545d6, 0x12645d6, 0x18645d6, 0x129c5d6,
+    0x03259d6, 0x04259d6, 0x0d25dd6, 0x0668236, 0x1278236, 0x1378236, 0x1390236, 0x0498236,
+    0x0bb0236, 0x1269236, 0x0a12236, 0x0322236, 0x1122236, 0x1222236, 0x129a236, 0x0453a36,
+    0x1373a36, 0x079ba36, 0x1126236, 0x1818e96, 0x12a0e96, 0x125ae96, 0x1394696, 0x1224a96,
+    0x143ca96, 0x1894a96, 0x0045e96, 0x0322f16, 0x1222f16, 0x121b716, 0x126b716, 0x0324f16,
+    0x1224f16, 0x0220497, 0x0043497, 0x0243497, 0x0d73497, 0x0244497, 0x1774497, 0x12a4497,
+    0x00681d7, 0x12c0237, 0x0d02f17, 0x0c22f17, 0x0242f17, 0x0b72f17, 0x0bc2f17, 0x089cb17,
+    0x129cb17, 0x1288018, 0x1200418, 0x0008418, 0x1808418, 0x0010818, 0x0050818, 0x1250818,
+    0x1229418, 0x1121818, 0x1221818, 0x1241818, 0x0e71c18, 0x038a018, 0x0052818, 0x1672818,
+    0x1222c18, 0x0d23018, 0x187b018, 0x0da3018, 0x1233418, 0x1253418, 0x0a73c18, 0x0d73c18,
+    0x127bc18, 0x187bc18, 0x0a04418, 0x0e14418, 0x121c418, 0x1124418, 0x002c418, 0x1254418,
+    0x126c418, 0x128c418, 0x009c418, 0x0e9c418, 0x1224c18, 0x121d018, 0x035d018, 0x127d018,
+    0x0325818, 0x1825818, 0x125d818, 0x126d818, 0x186d818, 0x127d818, 0x048b838, 0x0302c58,
+    0x0322c58, 0x036b858, 0x0304478, 0x0324478, 0x1218098, 0x1238098, 0x0c58098, 0x1268098,
+    0x0388098, 0x1288098, 0x0710898, 0x1238898, 0x1838898, 0x1220c98, 0x1219098, 0x0791098,
+    0x1231898, 0x1252c98, 0x125ac98, 0x1262c98, 0x127ac98, 0x129ac98, 0x009b498, 0x049b498,
+    0x000c498, 0x121c498, 0x1254498, 0x1224898, 0x1254898, 0x129c898, 0x189c898, 0x1244c98,
+    0x129cc98, 0x1255098, 0x1855098, 0x0d25498, 0x1225498, 0x0d25898, 0x0325c98, 0x1225c98,
+    0x04890b8, 0x0322918, 0x1222918, 0x125ad18, 0x0413518, 0x1223d18, 0x187bd18, 0x121c518,
+    0x1254518, 0x128c518, 0x079c518, 0x1224d18, 0x0444d18, 0x1261178, 0x0452178, 0x1222978,
+    0x135b998, 0x1223d98, 0x0e085d8, 0x18085d8, 0x12509d8, 0x0b20dd8, 0x1238dd8, 0x0458dd8,
+    0x12019d8, 0x04219d8, 0x12399d8, 0x02419d8, 0x0d419d8, 0x12419d8, 0x0a121d8, 0x0d025d8,
+    0x03229d8, 0x0b229d8, 0x11229d8, 0x12229d8, 0x0ba29d8, 0x1252dd8, 0x1852dd8, 0x0c431d8,
+    0x127b1d8, 0x02435d8, 0x12435d8, 0x12535d8, 0x122b9d8, 0x127b9d8, 0x12245d8, 0x12545d8,
+    0x127c5d8, 0x12551d8, 0x0d8d1d8, 0x128d1d8, 0x138d1d8, 0x04951d8, 0x03259d8, 0x12259d8,
+    0x04459d8, 0x125d9d8, 0x00cd9d8, 0x1378238, 0x1369238, 0x03aa238, 0x0723638, 0x0460258,
+    0x1393a78, 0x1268298, 0x1200a98, 0x0010a98, 0x0710a98, 0x0e50a98, 0x1250a98, 0x1850a98,
+    0x1299698, 0x1201a98, 0x0322a98, 0x1222a98, 0x1852a98, 0x1272a98, 0x0d02e98, 0x1222e98,
+    0x0e63298, 0x1863298, 0x127b298, 0x0d73e98, 0x187be98, 0x009c698, 0x129c698, 0x12a6698,
+    0x0088419, 0x1250819, 0x001a019, 0x181a019, 0x048a019, 0x1302819, 0x0d03019, 0x0e0b019,
+    0x0043019, 0x004b419, 0x049b419, 0x00cb419, 0x04cb419, 0x187bc19, 0x122c419, 0x1244419,
+    0x1244c19, 0x1225c19, 0x0d46019, 0x0d26419, 0x1258099, 0x0220499, 0x01a0499, 0x12a0499,
+    0x1200c99, 0x126a099, 0x0e1b499, 0x001c499, 0x1254499, 0x1274499, 0x129c899, 0x1204c99,
+    0x1225c99, 0x1226499, 0x0e638f9, 0x1320519, 0x1229519, 0x0d01919, 0x1202d19, 0x0712d19,
+    0x005ad19, 0x125ad19, 0x080b119, 0x120b119, 0x0e13519, 0x1213519, 0x1813519, 0x0123519,
+    0x1223519, 0x1233519, 0x1833519, 0x0453519, 0x1853519, 0x0e7bd19, 0x187bd19, 0x0c04519,
+    0x1244d19, 0x0b26519, 0x1346519, 0x049b979, 0x189b979, 0x00201d9, 0x12705d9, 0x12a05d9,
+    0x0e109d9, 0x04011d9, 0x0b011d9, 0x12011d9, 0x0c921d9, 0x13921d9, 0x080b1d9, 0x04035d9,
+    0x001b5d9, 0x03235d9, 0x11235d9, 0x12235d9, 0x12535d9, 0x00239d9, 0x18239d9, 0x03439d9,
+    0x12539d9, 0x12639d9, 0x126b9d9, 0x189b9d9, 0x007bdd9, 0x0e7bdd9, 0x0b445d9, 0x12445d9,
+    0x0e8c5d9, 0x12551d9, 0x04259d9, 0x04459d9, 0x12a2e99, 0x0d03e99, 0x1203e99, 0x007be99,
+    0x122c699, 0x0c46699, 0x0b01b19, 0x0d71b19, 0x1223319, 0x0243319,
+};
+const unsigned dict_words_size = 10638;
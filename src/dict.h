@@ -1,11 +1,40 @@
 // jawc dictionary data
 
-
 #ifndef _JAWC_DICT_H_
 #define _JAWC_DICT_H_
 
-extern const char *answers[];
-extern const unsigned answers_size;
-extern const char *words[];
-extern const unsigned words_size;
+#include <stdint.h>
+
+// Packed words: 5 letters of 5 bits each (a = 0), first letter in the low bits.
+#define DICT_LETTER_BITS    (5)
+#define DICT_LETTER_MASK    ((1u << DICT_LETTER_BITS) - 1)
+#define DICT_ANSWER_KEY     (0x15a5a5au)
+
+extern const uint32_t dict_answers[];
+extern const unsigned dict_answers_size;
+extern const uint32_t dict_words[];
+extern const unsigned dict_words_size;
+// Puzzle number -> index in dict_answers (src/target.c).
+extern const unsigned dict_target_count;
+extern const unsigned dict_targets[];
+
+static inline uint32_t dict_answer(unsigned i) {
+    return dict_answers[i] ^ DICT_ANSWER_KEY;
+}
+
+static inline uint32_t dict_word(unsigned i) {
+    return dict_words[i];
+}
+
+static inline unsigned dict_letter(uint32_t packed, unsigned i) {
+    return (packed >> (i * DICT_LETTER_BITS)) & DICT_LETTER_MASK;
+}
+
+static inline void dict_decode(uint32_t packed, char out[6]) {
+    for(unsigned i = 0; i < 5; ++i) {
+        out[i] = 'a' + dict_letter(packed, i);
+    }
+    out[5] = '\0';
+}
+
 #endif
@@ -0,0 +1,446 @@
+//===--------------------------------------------------------------------------------------------===
+// exact.c - Branch-and-bound search for optimal strategies
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "exact.h"
+#include "game.h"
+#include "memory.h"
+#include "pool.h"
+#include "score.h"
+#include <assert.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Cost of a position that can't be solved in the guesses left. Sums of a few of these still fit.
+#define COST_INF        (1u << 30)
+#define MAX_LEVELS      (MAX_TURNS + 1)
+#define CACHE_SIZE      (1u << 20)
+#define CACHE_LOCKS     (1024)
+
+// A position's cost is the number of guesses it takes to find each of its candidates, summed.
+typedef struct {
+    uint64_t        key;            // 0 for an empty slot.
+    uint32_t        cost;
+    uint8_t         worst;
+    bool            exact;          // Otherwise, `cost` is only a lower bound.
+} cache_entry_t;
+
+typedef struct {
+    uint32_t        order;          // Sort key: smaller is more promising.
+    uint32_t        bound;          // Lower bound on the cost with this guess.
+    unsigned        guess;
+} ranked_t;
+
+// Per-worker scratch: level L holds the candidates of every child of the position being searched
+// at depth L-1, bucket by bucket.
+typedef struct {
+    word_t          *words[MAX_LEVELS];
+    unsigned        *indices[MAX_LEVELS];
+    ranked_t        *ranked[MAX_LEVELS];
+    pattern_t       *patterns;
+    uint64_t        nodes;
+    uint64_t        cache_hits;
+} worker_t;
+
+typedef struct {
+    const lexicon_t *lex;
+    exact_options_t options;
+    cache_entry_t   *cache;
+    pthread_mutex_t locks[CACHE_LOCKS];
+    worker_t        *workers;
+    
+    // Top level: the candidates split by the forced opener, or every candidate first guess.
+    const word_t    *root_words;
+    const unsigned  *root_indices;
+    unsigned        bucket_count;
+    unsigned        bucket_start[PATTERN_COUNT];
+    unsigned        bucket_size[PATTERN_COUNT];
+    ranked_t        *root_ranked;
+    atomic_uint     root_best;
+    uint32_t        *root_cost;
+    uint8_t         *root_worst;
+} exact_t;
+
+// No strategy does better: guessing a candidate finds at most one answer on the spot, and one guess
+// splits the others into at most PATTERN_WON groups. A group of k costs at least 2k - 1 more.
+static uint32_t lower_bound(unsigned n) {
+    if(n <= 1) return n;
+    unsigned groups = n - 1 < PATTERN_WON ? n - 1 : PATTERN_WON;
+    return n + 2 * (n - 1) - groups;
+}
+
+static uint64_t set_key(const unsigned *indices, unsigned n, unsigned depth) {
+    uint64_t hash = 0xcbf29ce484222325ull ^ ((uint64_t)n << 8) ^ depth;
+    for(unsigned i = 0; i < n; ++i) {
+        hash = (hash ^ indices[i]) * 0x100000001b3ull;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash ? hash : 1;
+}
+
+static bool cache_find(exact_t *ex, uint64_t key, cache_entry_t *out) {
+    unsigned slot = key & (CACHE_SIZE - 1);
+    pthread_mutex_t *lock = &ex->locks[slot % CACHE_LOCKS];
+    pthread_mutex_lock(lock);
+    *out = ex->cache[slot];
+    pthread_mutex_unlock(lock);
+    return out->key == key;
+}
+
+static void cache_store(exact_t *ex, uint64_t key, uint32_t cost, uint8_t worst, bool exact) {
+    unsigned slot = key & (CACHE_SIZE - 1);
+    pthread_mutex_t *lock = &ex->locks[slot % CACHE_LOCKS];
+    pthread_mutex_lock(lock);
+    ex->cache[slot] = (cache_entry_t){key, cost, worst, exact};
+    pthread_mutex_unlock(lock);
+}
+
+static int compare_ranked(const void *a, const void *b) {
+    const ranked_t *ra = a, *rb = b;
+    if(ra->order != rb->order) return ra->order < rb->order ? -1 : 1;
+    return (ra->guess > rb->guess) - (ra->guess < rb->guess);
+}
+
+static void count_patterns(const pattern_t *patterns, unsigned n, unsigned counts[PATTERN_COUNT]) {
+    memset(counts, 0, PATTERN_COUNT * sizeof(unsigned));
+    for(unsigned i = 0; i < n; ++i) {
+        counts[patterns[i]] += 1;
+    }
+}
+
+// Guesses worth trying from a position, most promising (smallest expected group) first. This
+// doesn't depend on the search bound, so that a cached cost means the same thing however the
+// position was reached, even when `width` cuts the list short.
+static unsigned rank_guesses(exact_t *ex, worker_t *w, unsigned level, const word_t *words,
+                             unsigned n) {
+    const lexicon_t *lex = ex->lex;
+    ranked_t *ranked = w->ranked[level];
+    unsigned count = 0;
+    unsigned counts[PATTERN_COUNT];
+    
+    for(unsigned g = 0; g < lex->guess_count; ++g) {
+        score_batch(lex->guesses[g], words, n, w->patterns);
+        count_patterns(w->patterns, n, counts);
+        if(counts[w->patterns[0]] == n && w->patterns[0] != PATTERN_WON) continue;
+        
+        uint32_t cost = n;
+        uint32_t squares = 0;
+        for(unsigned p = 0; p < PATTERN_WON; ++p) {
+            cost += lower_bound(counts[p]);
+            squares += counts[p] * counts[p];
+        }
+        // Candidates win ties: they might end the game on the spot.
+        ranked[count++] = (ranked_t){2 * squares + !counts[PATTERN_WON], cost, g};
+    }
+    
+    qsort(ranked, count, sizeof(ranked_t), compare_ranked);
+    if(ex->options.width && count > ex->options.width) count = ex->options.width;
+    return count;
+}
+
+static uint32_t search(exact_t *ex, worker_t *w, unsigned level, const word_t *words,
+                       const unsigned *indices, unsigned n, unsigned depth, uint32_t bound,
+                       uint8_t *worst);
+
+// Cost of playing `guess` from a position, if it is below `bound`. Otherwise returns something at
+// least `bound`.
+static uint32_t try_guess(exact_t *ex, worker_t *w, unsigned level, const word_t *words,
+                          const unsigned *indices, unsigned n, unsigned depth, word_t guess,
+                          uint32_t bound, uint8_t *worst) {
+    unsigned counts[PATTERN_COUNT];
+    score_batch(guess, words, n, w->patterns);
+    count_patterns(w->patterns, n, counts);
+    
+    uint32_t cost = n;
+    uint32_t rest = 0;
+    pattern_t order[PATTERN_COUNT];
+    unsigned bucket_count = 0;
+    for(unsigned p = 0; p < PATTERN_WON; ++p) {
+        if(!counts[p]) continue;
+        order[bucket_count++] = p;
+        rest += lower_bound(counts[p]);
+    }
+    if(cost + rest >= bound) return cost + rest;
+    
+    // Stable counting sort into the next level, so that every child's indices stay sorted and its
+    // cache key doesn't depend on how it was reached.
+    unsigned start[PATTERN_COUNT];
+    unsigned offset = 0;
+    for(unsigned p = 0; p < PATTERN_COUNT; ++p) {
+        start[p] = offset;
+        offset += counts[p];
+    }
+    word_t *child_words = w->words[level+1];
+    unsigned *child_indices = w->indices[level+1];
+    unsigned next[PATTERN_COUNT];
+    memcpy(next, start, sizeof(next));
+    for(unsigned i = 0; i < n; ++i) {
+        unsigned at = next[w->patterns[i]]++;
+        child_words[at] = words[i];
+        child_indices[at] = indices[i];
+    }
+    
+    // Biggest groups first: they decide whether the guess is any good, so bad ones fail early.
+    for(unsigned i = 1; i < bucket_count; ++i) {
+        pattern_t p = order[i];
+        unsigned j = i;
+        for(; j > 0 && counts[order[j-1]] < counts[p]; --j) {
+            order[j] = order[j-1];
+        }
+        order[j] = p;
+    }
+    
+    uint8_t deepest = counts[PATTERN_WON] ? 1 : 0;
+    for(unsigned i = 0; i < bucket_count; ++i) {
+        pattern_t p = order[i];
+        rest -= lower_bound(counts[p]);
+        uint8_t child_worst = 0;
+        cost += search(ex, w, level+1, child_words + start[p], child_indices + start[p],
+                       counts[p], depth - 1, bound - cost - rest, &child_worst);
+        if(cost + rest >= bound) return cost + rest;
+        if(child_worst + 1 > deepest) deepest = child_worst + 1;
+    }
+    *worst = deepest;
+    return cost;
+}
+
+// Cost of the best strategy from a position with `depth` guesses left, if it is below `bound`.
+// Otherwise returns something at least `bound`.
+static uint32_t search(exact_t *ex, worker_t *w, unsigned level, const word_t *words,
+                       const unsigned *indices, unsigned n, unsigned depth, uint32_t bound,
+                       uint8_t *worst) {
+    w->nodes += 1;
+    if(!depth) return COST_INF;
+    if(n == 1) {
+        *worst = 1;
+        return 1;
+    }
+    if(depth == 1) return COST_INF;
+    
+    uint32_t least = lower_bound(n);
+    if(least >= bound) return least;
+    if(n == 2) {
+        *worst = 2;
+        return 3;
+    }
+    
+    uint64_t key = set_key(indices, n, depth);
+    cache_entry_t entry;
+    if(cache_find(ex, key, &entry)) {
+        w->cache_hits += 1;
+        if(entry.exact) {
+            *worst = entry.worst;
+            return entry.cost;
+        }
+        if(entry.cost >= bound) return entry.cost;
+        if(entry.cost > least) least = entry.cost;
+    }
+    
+    // A candidate that tells all the others apart meets the lower bound.
+    if(n <= PATTERN_WON) {
+        unsigned counts[PATTERN_COUNT];
+        for(unsigned i = 0; i < n; ++i) {
+            score_batch(words[i], words, n, w->patterns);
+            count_patterns(w->patterns, n, counts);
+            bool split = true;
+            for(unsigned p = 0; p < PATTERN_WON && split; ++p) {
+                split = counts[p] <= 1;
+            }
+            if(!split) continue;
+            *worst = 2;
+            cache_store(ex, key, 2 * n - 1, 2, true);
+            return 2 * n - 1;
+        }
+        // Any other guess costs at least 2n.
+        if(2 * n > least) least = 2 * n;
+        if(least >= bound) return least;
+    }
+    
+    unsigned count = rank_guesses(ex, w, level, words, n);
+    const ranked_t *ranked = w->ranked[level];
+    uint32_t best = bound;
+    uint8_t best_worst = 0;
+    for(unsigned r = 0; r < count; ++r) {
+        if(ranked[r].bound >= best) continue;
+        uint8_t guess_worst = 0;
+        uint32_t cost = try_guess(ex, w, level, words, indices, n, depth,
+                                  ex->lex->guesses[ranked[r].guess], best, &guess_worst);
+        if(cost >= best) continue;
+        best = cost;
+        best_worst = guess_worst;
+        if(best <= least) break;
+    }
+    
+    if(best < bound) {
+        *worst = best_worst;
+        cache_store(ex, key, best, best_worst, true);
+        return best;
+    }
+    cache_store(ex, key, bound > least ? bound : least, 0, false);
+    return bound;
+}
+
+// Top level with a forced opener: each group it leaves is its own task.
+static void search_bucket(void *ctx, unsigned worker, unsigned begin, unsigned end) {
+    exact_t *ex = ctx;
+    worker_t *w = &ex->workers[worker];
+    for(unsigned b = begin; b < end; ++b) {
+        uint8_t worst = 0;
+        ex->root_cost[b] = search(ex, w, 1, ex->root_words + ex->bucket_start[b],
+                                  ex->root_indices + ex->bucket_start[b], ex->bucket_size[b],
+                                  ex->options.max_guesses - 1, COST_INF, &worst);
+        ex->root_worst[b] = worst;
+    }
+}
+
+// Top level without one: each candidate opener is its own task, and they share the best cost so
+// far as their bound. Ties are searched too (bound + 1) so that the first in rank order wins,
+// whichever thread gets there first.
+static void search_opener(void *ctx, unsigned worker, unsigned begin, unsigned end) {
+    exact_t *ex = ctx;
+    worker_t *w = &ex->workers[worker];
+    unsigned n = ex->lex->answer_count;
+    for(unsigned r = begin; r < end; ++r) {
+        uint32_t bound = atomic_load(&ex->root_best);
+        bound = bound < COST_INF ? bound + 1 : COST_INF;
+        ex->root_cost[r] = COST_INF;
+        if(ex->root_ranked[r].bound >= bound) continue;
+        
+        uint8_t worst = 0;
+        word_t guess = ex->lex->guesses[ex->root_ranked[r].guess];
+        uint32_t cost = try_guess(ex, w, 0, ex->root_words, ex->root_indices, n,
+                                  ex->options.max_guesses, guess, bound, &worst);
+        if(cost >= bound) continue;
+        ex->root_cost[r] = cost;
+        ex->root_worst[r] = worst;
+        
+        uint32_t best = atomic_load(&ex->root_best);
+        while(cost < best && !atomic_compare_exchange_weak(&ex->root_best, &best, cost)) {}
+    }
+}
+
+void exact_solve(const lexicon_t *lex, const exact_options_t *options, exact_result_t *result) {
+    assert(lex);
+    assert(options);
+    assert(result);
+    assert(options->max_guesses > 0 && options->max_guesses < MAX_LEVELS);
+    lexicon_wait(lex);
+    
+    pool_t pool;
+    pool_init(&pool, options->threads);
+    
+    unsigned n = lex->answer_count;
+    exact_t *ex = safe_calloc(1, sizeof(exact_t));
+    ex->lex = lex;
+    ex->options = *options;
+    ex->cache = safe_calloc(CACHE_SIZE, sizeof(cache_entry_t));
+    for(unsigned i = 0; i < CACHE_LOCKS; ++i) {
+        pthread_mutex_init(&ex->locks[i], NULL);
+    }
+    ex->workers = safe_calloc(pool.thread_count, sizeof(worker_t));
+    for(unsigned i = 0; i < pool.thread_count; ++i) {
+        worker_t *w = &ex->workers[i];
+        for(unsigned l = 0; l <= options->max_guesses; ++l) {
+            w->words[l] = safe_malloc(n * sizeof(word_t));
+            w->indices[l] = safe_malloc(n * sizeof(unsigned));
+            w->ranked[l] = safe_malloc(lex->guess_count * sizeof(ranked_t));
+        }
+        w->patterns = safe_malloc(n);
+    }
+    
+    word_t *words = safe_malloc(n * sizeof(word_t));
+    unsigned *indices = safe_malloc(n * sizeof(unsigned));
+    for(unsigned i = 0; i < n; ++i) {
+        words[i] = lex->answers[i];
+        indices[i] = i;
+    }
+    ex->root_words = words;
+    ex->root_indices = indices;
+    *result = (exact_result_t){.opener = options->opener, .total = COST_INF};
+    
+    if(options->opener != WORD_NONE) {
+        worker_t *w = &ex->workers[0];
+        score_batch(options->opener, words, n, w->patterns);
+        unsigned counts[PATTERN_COUNT];
+        count_patterns(w->patterns, n, counts);
+        unsigned start[PATTERN_COUNT], next[PATTERN_COUNT];
+        unsigned offset = 0;
+        for(unsigned p = 0; p < PATTERN_COUNT; ++p) {
+            start[p] = next[p] = offset;
+            offset += counts[p];
+        }
+        for(unsigned i = 0; i < n; ++i) {
+            unsigned at = next[w->patterns[i]]++;
+            words[at] = lex->answers[i];
+            indices[at] = i;
+        }
+        for(unsigned p = 0; p < PATTERN_WON; ++p) {
+            if(!counts[p]) continue;
+            ex->bucket_start[ex->bucket_count] = start[p];
+            ex->bucket_size[ex->bucket_count] = counts[p];
+            ex->bucket_count += 1;
+        }
+        
+        ex->root_cost = safe_malloc(ex->bucket_count * sizeof(uint32_t));
+        ex->root_worst = safe_malloc(ex->bucket_count);
+        pool_for(&pool, ex->bucket_count, 1, search_bucket, ex);
+        
+        uint64_t total = n;
+        unsigned worst = counts[PATTERN_WON] ? 1 : 0;
+        for(unsigned b = 0; b < ex->bucket_count; ++b) {
+            total += ex->root_cost[b];
+            if(ex->root_worst[b] + 1u > worst) worst = ex->root_worst[b] + 1;
+        }
+        result->total = total;
+        result->worst = worst;
+    } else {
+        unsigned count = rank_guesses(ex, &ex->workers[0], 0, words, n);
+        ex->root_ranked = safe_malloc(count * sizeof(ranked_t));
+        memcpy(ex->root_ranked, ex->workers[0].ranked[0], count * sizeof(ranked_t));
+        ex->root_cost = safe_malloc(count * sizeof(uint32_t));
+        ex->root_worst = safe_malloc(count);
+        atomic_init(&ex->root_best, COST_INF);
+        pool_for(&pool, count, 1, search_opener, ex);
+        
+        for(unsigned r = 0; r < count; ++r) {
+            if(ex->root_cost[r] >= result->total) continue;
+            result->total = ex->root_cost[r];
+            result->worst = ex->root_worst[r];
+            result->opener = lex->guesses[ex->root_ranked[r].guess];
+        }
+        safe_free(ex->root_ranked);
+    }
+    
+    result->solved = result->total < COST_INF;
+    result->proven = options->width == 0;
+    for(unsigned i = 0; i < pool.thread_count; ++i) {
+        worker_t *w = &ex->workers[i];
+        result->nodes += w->nodes;
+        result->cache_hits += w->cache_hits;
+        for(unsigned l = 0; l <= options->max_guesses; ++l) {
+            safe_free(w->words[l]);
+            safe_free(w->indices[l]);
+            safe_free(w->ranked[l]);
+        }
+        safe_free(w->patterns);
+    }
+    
+    pool_fini(&pool);
+    for(unsigned i = 0; i < CACHE_LOCKS; ++i) {
+        pthread_mutex_destroy(&ex->locks[i]);
+    }
+    safe_free(ex->root_cost);
+    safe_free(ex->root_worst);
+    safe_free(ex->workers);
+    safe_free(ex->cache);
+    safe_free(ex);
+    safe_free(words);
+    safe_free(indices);
+}
@@ -0,0 +1,40 @@
+//===--------------------------------------------------------------------------------------------===
+// exact.h - Optimal strategy search
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef EXACT_H
+#define EXACT_H
+
+#include "lexicon.h"
+#include <stdint.h>
+
+typedef struct {
+    unsigned        max_guesses;    // Every answer must be found within this many guesses.
+    // Guesses tried at each position, most promising first. 0 tries all of them, which is what
+    // makes the result a proof; anything else gives an upper bound, much faster.
+    unsigned        width;
+    word_t          opener;         // Forces the first guess. WORD_NONE searches for it too.
+    unsigned        threads;        // 0 for one per CPU.
+} exact_options_t;
+
+typedef struct {
+    word_t          opener;
+    uint64_t        total;          // Guesses summed over every answer; divide for the mean.
+    unsigned        worst;          // Most guesses any answer needs with that strategy.
+    bool            solved;         // False if no strategy finds every answer in max_guesses.
+    bool            proven;         // `total` is the true minimum (for the forced opener, if any).
+    uint64_t        nodes;
+    uint64_t        cache_hits;
+} exact_result_t;
+
+// Finds the strategy with the fewest total guesses over the answer list, by depth-first
+// branch-and-bound: a position is abandoned as soon as its lower bound can't beat the best
+// strategy found so far. Positions are cached by candidate set, and the top-level branches are
+// searched in parallel.
+void exact_solve(const lexicon_t *lex, const exact_options_t *options, exact_result_t *result);
+
+#endif /* end of include guard: EXACT_H */
@@ -7,56 +7,14 @@
 // =^•.•^=
 //===--------------------------------------------------------------------------------------------===
 #include "game.h"
-#include "memory.h"
-#include "dict.h"
+#include "profile.h"
 #include <assert.h>
-#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
-extern const unsigned target_count;
-extern const unsigned targets[];
-
-#define XOR_KEY 0x5a
-
-static void xor_string(char *str, uint8_t key) {
-    while(*str) {
-        *str = (*str) ^ key;
-        str++;
-    }
-}
-
-void load_answer_list(hset_t *set) {
-    
-    for(unsigned i = 0; i < answers_size; ++i) {
-        const char *answer = answers[i];
-        char word[WORD_SIZE+1];
-        strncpy(word, answer, WORD_SIZE);
-        word[WORD_SIZE] = '\0';
-        xor_string(word, XOR_KEY);
-        
-        size_t len = strlen(word);
-        if(len && word[len-1] == '\n') {
-            word[len-1] = '\0';
-            len -= 1;
-        }
-        if(len != WORD_SIZE) continue;
-        hset_insert(set, word);
-    }
-}
-
-void load_word_list(hset_t *set) {
-    assert(set);
-    
-    for(unsigned i = 0; i < words_size; ++i) {
-        const char *word = words[i];
-        hset_insert(set, word);
-    }
-}
-
-unsigned get_wordle_seq() {
+static unsigned get_wordle_seq(void) {
     static const uint64_t day_seconds = (24 * 60 * 60);
     
     struct tm epoch_tm = {
@@ -74,137 +32,209 @@ unsigned get_wordle_seq() {
 }
 
 
-void game_init(game_t *game, int wordle) {
+void game_init(game_t *game, const lexicon_t *lexicon, int wordle) {
+    game_init_boards(game, lexicon, wordle, 1);
+}
+
+// Extra boards play the following puzzles, so a multi-board game is as reproducible as a single
+// one.
+static void reset_boards(game_t *game, unsigned seq) {
+    const lexicon_t *lexicon = game->lexicon;
+    game->won = false;
+    game->guess_count = 0;
+    game->seq = seq;
+    for(unsigned i = 0; i < game->board_count; ++i) {
+        board_t *board = &game->boards[i];
+        board->answer = lexicon_target(lexicon, (seq + i) % lexicon->target_count);
+        board->solved_at = 0;
+        memset(board->keyboard, 0, sizeof(board->keyboard));
+    }
+}
+
+static void init_boards(game_t *game, const lexicon_t *lexicon, unsigned seq, unsigned board_count) {
+    memset(game, 0, sizeof(*game));
+    game->lexicon = lexicon;
+    game->board_count = board_count;
+    game->max_guesses = MAX_GUESSES + board_count - 1;
+    reset_boards(game, seq);
+}
+
+void game_init_boards(game_t *game, const lexicon_t *lexicon, int wordle, unsigned board_count) {
     assert(game);
-    
-    (void)safe_strdup; // Because clang.
+    assert(lexicon);
+    assert(board_count > 0 && board_count <= MAX_BOARDS);
     
     unsigned seq = get_wordle_seq();
-    if(seq >= answers_size) {
-        seq = answers_size - 1;
+    if(seq >= lexicon->target_count) {
+        seq = lexicon->target_count - 1;
     }
     
     if(wordle > 0 && (unsigned)wordle <= seq) {
         seq = wordle;
     }
-    
-    if(seq < 0 || seq >= target_count) {
-        seq = 0;
-    }
+    init_boards(game, lexicon, seq, board_count);
+}
+
+void game_init_target(game_t *game, const lexicon_t *lexicon, unsigned seq) {
+    assert(game);
+    assert(lexicon);
+    assert(seq < lexicon->target_count);
+    init_boards(game, lexicon, seq, 1);
+}
+
+void game_init_absurdle(game_t *game, const lexicon_t *lexicon) {
+    assert(game);
+    assert(lexicon);
     
     memset(game, 0, sizeof(*game));
+    game->lexicon = lexicon;
+    game->mode = GAME_MODE_ABSURDLE;
     game->won = false;
     game->guess_count = 0;
-    game->seq = seq;
-    hset_init(&game->words);
-    
-    load_answer_list(&game->words);
-    load_word_list(&game->words);
-    
-    int answer_idx = targets[seq];
-    
-    strncpy(game->answer, answers[answer_idx], WORD_SIZE);
-    xor_string(game->answer, XOR_KEY);
-    
-    for(int i = 0; i < ALPHABET_SIZE; ++i) {
-        game->alphabet[i] = GAME_LETTER_UNUSED;
+    game->seq = 0;
+    game->board_count = 1;
+    game->max_guesses = MAX_TURNS;
+    game->boards[0].answer = WORD_NONE;
+    partition_init(&game->pool, lexicon);
+}
+
+void game_reset(game_t *game, unsigned seq) {
+    assert(game);
+    assert(game->lexicon);
+    if(game->mode != GAME_MODE_ABSURDLE) {
+        assert(seq < game->lexicon->target_count);
+        reset_boards(game, seq);
+        return;
     }
+    
+    board_t *board = &game->boards[0];
+    game->won = false;
+    game->guess_count = 0;
+    board->answer = WORD_NONE;
+    board->solved_at = 0;
+    memset(board->keyboard, 0, sizeof(board->keyboard));
+    partition_reset(&game->pool, game->lexicon);
 }
 
 void game_fini(game_t *game) {
     assert(game);
-    hset_fini(&game->words);
+    if(game->mode == GAME_MODE_ABSURDLE) partition_fini(&game->pool);
+    game->lexicon = NULL;
 }
 
 static inline letter_state_t mark_letter(letter_state_t existing, letter_state_t guess) {
     return guess > existing ? guess : existing;
 }
 
-static bool check(guess_t *guess, const char *word, letter_state_t state[ALPHABET_SIZE]) {
-    unsigned noice_count = 0;
-    
-    char answer[WORD_SIZE+1];
-    strncpy(answer, word, WORD_SIZE);
-    answer[WORD_SIZE] = '\0';
+static void mark_keyboard(board_t *board, word_t word, pattern_t pattern) {
+    letter_state_t check[WORD_SIZE];
+    pattern_decode(pattern, check);
     
     for(unsigned i = 0; i < WORD_SIZE; ++i) {
-        guess->check[i] = GAME_LETTER_NO;
+        letter_t letter = word_letter(word, i);
+        letter_state_t state = mark_letter(board_letter(board, letter), check[i]);
+        unsigned shift = (letter % 16) * 2;
+        board->keyboard[letter / 16] &= ~(3u << shift);
+        board->keyboard[letter / 16] |= (uint32_t)state << shift;
+    }
+}
+
+// The answer is whatever the guess leaves the most of: split the remaining candidates by the
+// feedback they would give, and keep the biggest bucket.
+static bool check_absurdle(game_t *game, guess_t *guess) {
+    board_t *board = &game->boards[0];
+    partition_split(&game->pool, guess->word);
+    pattern_t pattern = partition_largest(&game->pool);
+    partition_keep(&game->pool, pattern);
+    
+    if(game->pool.count == 1) board->answer = game->pool.words[0];
+    guess->patterns[0] = pattern;
+    mark_keyboard(board, guess->word, pattern);
+    
+    if(pattern != PATTERN_WON) return false;
+    board->solved_at = game->guess_count;
+    return true;
+}
+
+// Scores the guess against every board still in play in a single batch, then updates each
+// board's keyboard. Returns whether every board is now solved.
+static bool check(game_t *game, guess_t *guess) {
+    uint64_t start = prof_begin();
+    if(game->mode == GAME_MODE_ABSURDLE) {
+        bool won = check_absurdle(game, guess);
+        prof_end(PROF_CHECK, start);
+        return won;
     }
     
-    for(unsigned i = 0; i < WORD_SIZE; ++i) {
-        if(guess->word[i] == answer[i]) {
-            guess->check[i] = GAME_LETTER_RIGHT;
-            answer[i] = '_';
-            noice_count += 1;
-        }
+    word_t answers[MAX_BOARDS];
+    pattern_t patterns[MAX_BOARDS];
+    unsigned boards[MAX_BOARDS];
+    unsigned count = 0;
+    
+    for(unsigned i = 0; i < game->board_count; ++i) {
+        guess->patterns[i] = PATTERN_WON;
+        if(board_is_solved(&game->boards[i])) continue;
+        boards[count] = i;
+        answers[count++] = game->boards[i].answer;
     }
-    if(noice_count == WORD_SIZE) return true;
     
-    for(unsigned i = 0; i < WORD_SIZE; ++i) {
-        if(guess->check[i] == GAME_LETTER_RIGHT) continue;
-        char *pos = strchr(answer, guess->word[i]);
-        if(pos != NULL) {
-            *pos = '_';
-            guess->check[i] = GAME_LETTER_MISPLACED;
+    score_batch(guess->word, answers, count, patterns);
+    
+    bool all_solved = true;
+    for(unsigned i = 0; i < count; ++i) {
+        board_t *board = &game->boards[boards[i]];
+        guess->patterns[boards[i]] = patterns[i];
+        mark_keyboard(board, guess->word, patterns[i]);
+        
+        if(patterns[i] == PATTERN_WON) {
+            board->solved_at = game->guess_count;
         } else {
-            guess->check[i] = GAME_LETTER_NO;
+            all_solved = false;
         }
     }
-    
-    for(unsigned i = 0; i < WORD_SIZE; ++i) {
-        unsigned idx = guess->word[i]-'a';
-        state[idx] = mark_letter(state[idx], guess->check[i]);
-    }
-    
-    return noice_count == WORD_SIZE;
+    prof_end(PROF_CHECK, start);
+    return all_solved;
 }
 
-static bool check_already_guessed(const game_t *game, const char *word) {
+static bool check_already_guessed(const game_t *game, word_t word) {
     for(unsigned i = 0; i < game->guess_count; ++i) {
-        if(!strcmp(game->guesses[i].word, word)) return true;
+        if(game->guesses[i].word == word) return true;
     }
     return false;
 }
 
-static void trim_whitespace(char *word) {
-    while(*word) {
-        if(*word == '\n' || *word == '\t' || *word == ' ' || *word == '\r') {
-            *word = '\0';
-            return;
-        }
-        word++;
-    }
-}
-
 result_t game_submit(game_t *game, const char *word, const guess_t **out) {
     assert(game);
     assert(word);
     assert(out);
     
-    if(game->guess_count >= MAX_GUESSES) return GAME_RESULT_LOST;
+    word_t encoded;
+    if(!lang_encode(game->lexicon->lang, word, &encoded)) return GAME_RESULT_NOT_A_WORD;
+    return game_submit_word(game, encoded, out);
+}
+
+result_t game_submit_word(game_t *game, word_t word, const guess_t **out) {
+    assert(game);
+    assert(out);
     
-    guess_t *guess = &game->guesses[game->guess_count];
-    strncpy(guess->word, word, WORD_SIZE);
-    trim_whitespace(guess->word);
-    for(int i = 0; i < WORD_SIZE; ++i) {
-        guess->word[i] = tolower(guess->word[i]);
-    }
+    if(game->guess_count >= game->max_guesses) return GAME_RESULT_LOST;
+    if(check_already_guessed(game, word)) return GAME_RESULT_ALREADY_GUESSED;
+    // First use of the validation set if the lexicon is still loading in the background.
+    lexicon_wait(game->lexicon);
+    if(!lexicon_contains(game->lexicon, word)) return GAME_RESULT_NOT_A_WORD;
     
-    if(strlen(guess->word) != WORD_SIZE) return GAME_RESULT_NOT_A_WORD;
-    if(check_already_guessed(game, guess->word)) return GAME_RESULT_ALREADY_GUESSED;
-    if(!hset_contains(&game->words, guess->word)) return GAME_RESULT_NOT_A_WORD;
-
+    guess_t *guess = &game->guesses[game->guess_count];
+    guess->word = word;
     game->guess_count += 1;
     *out = guess;
     
-    if(check(guess, game->answer, game->alphabet)) {
+    if(check(game, guess)) {
         game->won = true;
         return GAME_RESULT_WON;
     }
-    return game->guess_count < MAX_GUESSES ? GAME_RESULT_AGAIN : GAME_RESULT_LOST;
+    return game->guess_count < game->max_guesses ? GAME_RESULT_AGAIN : GAME_RESULT_LOST;
 }
 
-
 unsigned game_get_guess_count(const game_t *game) {
     assert(game);
     return game->guess_count;
@@ -9,19 +9,15 @@
 #ifndef JAWC_GAME_H
 #define JAWC_GAME_H
 
-#include "set.h"
+#include "lexicon.h"
+#include "partition.h"
+#include "score.h"
 #include <stdio.h>
 
 #define MAX_GUESSES     (6)
-#define WORD_SIZE       (5)
-#define ALPHABET_SIZE   (26)
-
-typedef enum {
-    GAME_LETTER_UNUSED,
-    GAME_LETTER_NO,
-    GAME_LETTER_MISPLACED,
-    GAME_LETTER_RIGHT,
-} letter_state_t;
+#define MAX_BOARDS      (8)
+// Each extra board buys one extra guess: 7 for dordle, 9 for quordle, 13 for octordle.
+#define MAX_TURNS       (MAX_GUESSES + MAX_BOARDS - 1)
 
 typedef enum {
     GAME_RESULT_ALREADY_GUESSED,
@@ -31,31 +27,64 @@ typedef enum {
     GAME_RESULT_AGAIN
 } result_t;
 
+typedef enum {
+    GAME_MODE_NORMAL,
+    GAME_MODE_ABSURDLE,             // No answer until the guesses leave only one.
+} game_mode_t;
+
 typedef struct {
-    char            word[WORD_SIZE+1];
-    letter_state_t  check[WORD_SIZE];
+    word_t          word;
+    pattern_t       patterns[MAX_BOARDS];
 } guess_t;
 
+// Keyboard state is two bits per letter, so a board's whole keyboard fits in 16 bytes.
+typedef struct {
+    word_t          answer;         // WORD_NONE while an absurdle game hasn't settled on one.
+    unsigned        solved_at;      // Guess count when solved, 0 while still in play.
+    uint32_t        keyboard[MAX_ALPHABET_SIZE / 16];
+} board_t;
+
 typedef struct {
-    hset_t          words;
+    const lexicon_t *lexicon;
     
+    game_mode_t     mode;
     bool            won;
     unsigned        seq;
+    unsigned        board_count;
+    unsigned        max_guesses;
     unsigned        guess_count;
-    char            answer[WORD_SIZE+1];
-    guess_t         guesses[MAX_GUESSES];
-    letter_state_t  alphabet[ALPHABET_SIZE];
+    board_t         boards[MAX_BOARDS];
+    guess_t         guesses[MAX_TURNS];
+    partition_t     pool;           // Absurdle only: every answer consistent with the guesses.
     // result_t    last_result;
 } game_t;
 
-void game_init(game_t *game, int wordle);
+void game_init(game_t *game, const lexicon_t *lexicon, int wordle);
+// Plays `board_count` answers at once (1, 2, 4 or 8), starting from puzzle `wordle`.
+void game_init_boards(game_t *game, const lexicon_t *lexicon, int wordle, unsigned board_count);
+// Plays puzzle `seq` whatever today's date, including ones that haven't come out yet: for bots
+// and analysis rather than players.
+void game_init_target(game_t *game, const lexicon_t *lexicon, unsigned seq);
+// Adversarial mode: every guess gets whichever feedback leaves the most candidates.
+void game_init_absurdle(game_t *game, const lexicon_t *lexicon);
+// Starts a new game in place, with the same mode and board count, on puzzle `seq` (ignored by
+// absurdle). Only the boards are touched, so it costs the same whatever the size of the lexicon,
+// except in absurdle, which has to put every answer back in its pool.
+void game_reset(game_t *game, unsigned seq);
 void game_fini(game_t *game);
 
 result_t game_submit(game_t *game, const char *guess, const guess_t **out);
+// Same, for a guess that is already encoded (replayed from a log, or generated).
+result_t game_submit_word(game_t *game, word_t guess, const guess_t **out);
+unsigned game_get_guess_count(const game_t *game);
+const guess_t *game_get_guess(const game_t *game, unsigned idx);
 
-void print_board(const game_t *game, bool show_emoji, FILE *out);
-void print_share_sheet(const game_t *game, FILE *out);
+static inline letter_state_t board_letter(const board_t *board, letter_t letter) {
+    return (board->keyboard[letter / 16] >> ((letter % 16) * 2)) & 3;
+}
 
-void game_stats(const game_t *game);
+static inline bool board_is_solved(const board_t *board) {
+    return board->solved_at != 0;
+}
 
 #endif /* end of include guard: JAWC_GAME_H */
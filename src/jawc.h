@@ -0,0 +1,35 @@
+//===--------------------------------------------------------------------------------------------===
+// jawc.h - Public interface of libjawc
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef JAWC_H
+#define JAWC_H
+
+// The game engine without the terminal front end. A lexicon is built once and can be shared by
+// any number of games, read-only; each game_t is independent, so embedders can run many games
+// in-process from one dictionary.
+#include "lang.h"
+#include "lexicon.h"
+#include "score.h"
+#include "game.h"
+#include "cset.h"
+#include "book.h"
+#include "exact.h"
+#include "solver.h"
+#include "strategy.h"
+#include "arena.h"
+#include "reverse.h"
+#include "audit.h"
+#include "analysis.h"
+#include "bulk.h"
+#include "query.h"
+#include "tile.h"
+#include "bundle.h"
+#include "stats.h"
+#include "wal.h"
+
+#endif /* end of include guard: JAWC_H */
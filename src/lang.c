@@ -0,0 +1,201 @@
+//===--------------------------------------------------------------------------------------------===
+// lang.c - Alphabet tables and UTF-8 encoding
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "lang.h"
+#include <assert.h>
+#include <string.h>
+
+#define COUNTOF(arr) (sizeof(arr) / sizeof(arr[0]))
+
+#define LATIN(c)    {(c), (c) - 0x20}
+#define CYRILLIC(n) {0x0430 + (n), 0x0410 + (n)}
+
+#define LATIN_BASIC \
+    LATIN('a'), LATIN('b'), LATIN('c'), LATIN('d'), LATIN('e'), LATIN('f'), LATIN('g'), \
+    LATIN('h'), LATIN('i'), LATIN('j'), LATIN('k'), LATIN('l'), LATIN('m'), LATIN('n'), \
+    LATIN('o'), LATIN('p'), LATIN('q'), LATIN('r'), LATIN('s'), LATIN('t'), LATIN('u'), \
+    LATIN('v'), LATIN('w'), LATIN('x'), LATIN('y'), LATIN('z')
+
+const lang_t lang_english = {
+    .name = "en",
+    .size = 26,
+    .letters = {LATIN_BASIC},
+};
+
+static const lang_t lang_spanish = {
+    .name = "es",
+    .size = 27,
+    .letters = {LATIN_BASIC, {0x00f1, 0x00d1}},
+    .fold_count = 12,
+    .folds = {
+        {0x00e1, 0}, {0x00c1, 0},   // á
+        {0x00e9, 4}, {0x00c9, 4},   // é
+        {0x00ed, 8}, {0x00cd, 8},   // í
+        {0x00f3, 14}, {0x00d3, 14}, // ó
+        {0x00fa, 20}, {0x00da, 20}, // ú
+        {0x00fc, 20}, {0x00dc, 20}, // ü
+    },
+};
+
+static const lang_t lang_german = {
+    .name = "de",
+    .size = 30,
+    .letters = {
+        LATIN_BASIC,
+        {0x00e4, 0x00c4},   // ä
+        {0x00f6, 0x00d6},   // ö
+        {0x00fc, 0x00dc},   // ü
+        {0x00df, 0x1e9e},   // ß
+    },
+};
+
+static const lang_t lang_russian = {
+    .name = "ru",
+    .size = 32,
+    .letters = {
+        CYRILLIC(0), CYRILLIC(1), CYRILLIC(2), CYRILLIC(3), CYRILLIC(4), CYRILLIC(5),
+        CYRILLIC(6), CYRILLIC(7), CYRILLIC(8), CYRILLIC(9), CYRILLIC(10), CYRILLIC(11),
+        CYRILLIC(12), CYRILLIC(13), CYRILLIC(14), CYRILLIC(15), CYRILLIC(16), CYRILLIC(17),
+        CYRILLIC(18), CYRILLIC(19), CYRILLIC(20), CYRILLIC(21), CYRILLIC(22), CYRILLIC(23),
+        CYRILLIC(24), CYRILLIC(25), CYRILLIC(26), CYRILLIC(27), CYRILLIC(28), CYRILLIC(29),
+        CYRILLIC(30), CYRILLIC(31),
+    },
+    .fold_count = 2,
+    .folds = {{0x0451, 5}, {0x0401, 5}}, // ё -> е
+};
+
+static const lang_t *languages[] = {
+    &lang_english,
+    &lang_spanish,
+    &lang_german,
+    &lang_russian,
+};
+
+const lang_t *lang_find(const char *name) {
+    assert(name);
+    for(unsigned i = 0; i < COUNTOF(languages); ++i) {
+        if(!strcmp(languages[i]->name, name)) return languages[i];
+    }
+    return NULL;
+}
+
+void lang_print_list(FILE *out) {
+    for(unsigned i = 0; i < COUNTOF(languages); ++i) {
+        fprintf(out, "%s%s", i ? ", " : "", languages[i]->name);
+    }
+    fprintf(out, "\n");
+}
+
+uint32_t jawc_utf8_decode(const char **str) {
+    const uint8_t *s = (const uint8_t *)*str;
+    uint32_t cp = 0;
+    unsigned len = 0;
+    
+    if(s[0] < 0x80) {
+        cp = s[0];
+        len = 1;
+    } else if((s[0] & 0xe0) == 0xc0) {
+        cp = s[0] & 0x1f;
+        len = 2;
+    } else if((s[0] & 0xf0) == 0xe0) {
+        cp = s[0] & 0x0f;
+        len = 3;
+    } else if((s[0] & 0xf8) == 0xf0) {
+        cp = s[0] & 0x07;
+        len = 4;
+    } else {
+        *str += 1;
+        return 0xfffd;
+    }
+    
+    for(unsigned i = 1; i < len; ++i) {
+        if((s[i] & 0xc0) != 0x80) {
+            *str += i;
+            return 0xfffd;
+        }
+        cp = (cp << 6) | (s[i] & 0x3f);
+    }
+    *str += len;
+    return cp;
+}
+
+unsigned jawc_utf8_encode(uint32_t cp, char out[4]) {
+    if(cp < 0x80) {
+        out[0] = cp;
+        return 1;
+    }
+    if(cp < 0x800) {
+        out[0] = 0xc0 | (cp >> 6);
+        out[1] = 0x80 | (cp & 0x3f);
+        return 2;
+    }
+    if(cp < 0x10000) {
+        out[0] = 0xe0 | (cp >> 12);
+        out[1] = 0x80 | ((cp >> 6) & 0x3f);
+        out[2] = 0x80 | (cp & 0x3f);
+        return 3;
+    }
+    out[0] = 0xf0 | (cp >> 18);
+    out[1] = 0x80 | ((cp >> 12) & 0x3f);
+    out[2] = 0x80 | ((cp >> 6) & 0x3f);
+    out[3] = 0x80 | (cp & 0x3f);
+    return 4;
+}
+
+int lang_index(const lang_t *lang, uint32_t cp) {
+    assert(lang);
+    for(unsigned i = 0; i < lang->size; ++i) {
+        if(lang->letters[i].lower == cp || lang->letters[i].upper == cp) return i;
+    }
+    for(unsigned i = 0; i < lang->fold_count; ++i) {
+        if(lang->folds[i].codepoint == cp) return lang->folds[i].letter;
+    }
+    return -1;
+}
+
+static bool is_space(uint32_t cp) {
+    return cp == '\0' || cp == '\n' || cp == '\t' || cp == ' ' || cp == '\r';
+}
+
+bool lang_encode(const lang_t *lang, const char *utf8, word_t *out) {
+    assert(lang);
+    assert(utf8);
+    assert(out);
+    
+    letter_t letters[WORD_SIZE];
+    unsigned count = 0;
+    
+    for(;;) {
+        uint32_t cp = jawc_utf8_decode(&utf8);
+        if(is_space(cp)) break;
+        if(count == WORD_SIZE) return false;
+        
+        int idx = lang_index(lang, cp);
+        if(idx < 0) return false;
+        letters[count++] = idx;
+    }
+    if(count != WORD_SIZE) return false;
+    *out = word_pack(letters);
+    return true;
+}
+
+unsigned lang_letter_utf8(const lang_t *lang, letter_t letter, bool upper, char out[4]) {
+    assert(lang);
+    assert(letter < lang->size);
+    const lang_letter_t *l = &lang->letters[letter];
+    return jawc_utf8_encode(upper ? l->upper : l->lower, out);
+}
+
+void lang_decode(const lang_t *lang, word_t word, bool upper, char out[WORD_UTF8_SIZE]) {
+    assert(lang);
+    unsigned len = 0;
+    for(unsigned i = 0; i < WORD_SIZE; ++i) {
+        len += lang_letter_utf8(lang, word_letter(word, i), upper, out + len);
+    }
+    out[len] = '\0';
+}
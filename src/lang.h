@@ -0,0 +1,91 @@
+//===--------------------------------------------------------------------------------------------===
+// lang.h - Alphabets, UTF-8 letter encoding and packed words
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef LANG_H
+#define LANG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#define WORD_SIZE           (5)
+#define MAX_ALPHABET_SIZE   (64)
+#define MAX_LANG_FOLDS      (16)
+#define LETTER_BITS         (6)
+#define LETTER_MASK         ((1u << LETTER_BITS) - 1)
+#define LETTER_NONE         (0xff)
+
+// Longest UTF-8 spelling of a word, including the terminator.
+#define WORD_UTF8_SIZE      (WORD_SIZE * 4 + 1)
+
+// Letters are dense per-language indices (0 to lang->size-1), so that keyboard state and scoring
+// tables are fixed-size arrays regardless of the script. A word packs its WORD_SIZE letters into
+// a single integer, LETTER_BITS per letter, first letter in the low bits.
+typedef uint8_t letter_t;
+typedef uint32_t word_t;
+
+// Packed words only use WORD_SIZE * LETTER_BITS bits, so all-ones is never a real word.
+#define WORD_NONE           (UINT32_MAX)
+
+typedef struct {
+    uint32_t        lower;
+    uint32_t        upper;
+} lang_letter_t;
+
+// Code points that aren't letters of their own, but are accepted as input for one (á -> a in
+// Spanish, ё -> е in Russian).
+typedef struct {
+    uint32_t        codepoint;
+    letter_t        letter;
+} lang_fold_t;
+
+typedef struct {
+    const char      *name;
+    unsigned        size;
+    unsigned        fold_count;
+    lang_letter_t   letters[MAX_ALPHABET_SIZE];
+    lang_fold_t     folds[MAX_LANG_FOLDS];
+} lang_t;
+
+extern const lang_t lang_english;
+
+const lang_t *lang_find(const char *name);
+void lang_print_list(FILE *out);
+
+// Reads one code point and advances `str`. Malformed sequences decode as U+FFFD.
+uint32_t jawc_utf8_decode(const char **str);
+unsigned jawc_utf8_encode(uint32_t codepoint, char out[4]);
+
+int lang_index(const lang_t *lang, uint32_t codepoint);
+
+// Encodes a UTF-8 word, stopping at the first whitespace. Fails unless the word is exactly
+// WORD_SIZE letters of `lang`.
+bool lang_encode(const lang_t *lang, const char *utf8, word_t *out);
+unsigned lang_letter_utf8(const lang_t *lang, letter_t letter, bool upper, char out[4]);
+void lang_decode(const lang_t *lang, word_t word, bool upper, char out[WORD_UTF8_SIZE]);
+
+static inline letter_t word_letter(word_t word, unsigned i) {
+    return (word >> (i * LETTER_BITS)) & LETTER_MASK;
+}
+
+static inline word_t word_pack(const letter_t letters[WORD_SIZE]) {
+    word_t word = 0;
+    for(unsigned i = 0; i < WORD_SIZE; ++i) {
+        word |= (word_t)letters[i] << (i * LETTER_BITS);
+    }
+    return word;
+}
+
+static inline void word_unpack(word_t word, letter_t letters[WORD_SIZE]) {
+    for(unsigned i = 0; i < WORD_SIZE; ++i) {
+        letters[i] = word_letter(word, i);
+    }
+}
+
+#endif /* end of include guard: LANG_H */
@@ -0,0 +1,220 @@
+//===--------------------------------------------------------------------------------------------===
+// lexicon.c - Answer and guess list loading
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "lexicon.h"
+#include "memory.h"
+#include "profile.h"
+#include "dict.h"
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+struct lexicon_loader {
+    pthread_t       thread;
+    pthread_mutex_t lock;
+    atomic_bool     joined;
+    uint64_t        start;          // Timed on the helper thread, reported when joined.
+    uint64_t        end;
+};
+
+static void lexicon_clear(lexicon_t *lex, const lang_t *lang) {
+    lex->lang = lang;
+    hset_init(&lex->valid);
+    lex->answers = NULL;
+    lex->answer_count = 0;
+    lex->guesses = NULL;
+    lex->guess_count = 0;
+    lex->targets = NULL;
+    lex->target_count = 0;
+    lex->patterns = NULL;
+    lex->mapped = false;
+    lex->loader = NULL;
+}
+
+// The built-in lists are English and packed 5 bits per letter, a = 0, which is also
+// lang_english's letter order, so they repack straight into word_t without going through UTF-8.
+static word_t repack(uint32_t packed) {
+    letter_t letters[WORD_SIZE];
+    for(unsigned i = 0; i < WORD_SIZE; ++i) {
+        letters[i] = dict_letter(packed, i);
+    }
+    return word_pack(letters);
+}
+
+// Decodes the answers only: enough to pick targets and start a game.
+static void load_answer_list(lexicon_t *lex) {
+    lex->answers = safe_calloc(dict_answers_size, sizeof(word_t));
+    lex->guesses = safe_calloc(dict_answers_size + dict_words_size, sizeof(word_t));
+    
+    for(unsigned i = 0; i < dict_answers_size; ++i) {
+        word_t code = repack(dict_answer(i));
+        lex->answers[i] = code;
+        lex->guesses[i] = code;
+    }
+    lex->answer_count = dict_answers_size;
+    lex->targets = dict_targets;
+    lex->target_count = dict_target_count;
+}
+
+// Builds the validation set and the rest of the guess list. This is the bulk of the work, and the
+// only part that runs on the helper thread in an async load.
+static void load_word_list(lexicon_t *lex) {
+    for(unsigned i = 0; i < lex->answer_count; ++i) {
+        hset_insert(&lex->valid, lex->answers[i]);
+    }
+    
+    unsigned count = lex->answer_count;
+    for(unsigned i = 0; i < dict_words_size; ++i) {
+        word_t code = repack(dict_word(i));
+        if(!hset_insert(&lex->valid, code)) continue;
+        lex->guesses[count++] = code;
+    }
+    lex->guess_count = count;
+}
+
+void lexicon_init(lexicon_t *lex) {
+    assert(lex);
+    uint64_t start = prof_begin();
+    lexicon_clear(lex, &lang_english);
+    
+    load_answer_list(lex);
+    load_word_list(lex);
+    prof_end(PROF_LEXICON_LOAD, start);
+}
+
+static void *load_worker(void *data) {
+    lexicon_t *lex = data;
+    lex->loader->start = prof_begin();
+    load_word_list(lex);
+    lex->loader->end = prof_begin();
+    return NULL;
+}
+
+void lexicon_init_async(lexicon_t *lex) {
+    assert(lex);
+    lexicon_clear(lex, &lang_english);
+    load_answer_list(lex);
+    
+    lexicon_loader_t *loader = safe_malloc(sizeof(*loader));
+    pthread_mutex_init(&loader->lock, NULL);
+    atomic_init(&loader->joined, false);
+    loader->start = loader->end = 0;
+    lex->loader = loader;
+    
+    if(pthread_create(&loader->thread, NULL, load_worker, lex) != 0) {
+        load_word_list(lex);
+        atomic_store(&loader->joined, true);
+    }
+}
+
+void lexicon_wait(const lexicon_t *lex) {
+    assert(lex);
+    lexicon_loader_t *loader = lex->loader;
+    if(!loader || atomic_load_explicit(&loader->joined, memory_order_acquire)) return;
+    
+    pthread_mutex_lock(&loader->lock);
+    if(!atomic_load_explicit(&loader->joined, memory_order_relaxed)) {
+        uint64_t start = prof_begin();
+        pthread_join(loader->thread, NULL);
+        prof_end(PROF_LEXICON_WAIT, start);
+        if(loader->start) prof_zone_record(PROF_LEXICON_LOAD, loader->start, loader->end);
+        atomic_store_explicit(&loader->joined, true, memory_order_release);
+    }
+    pthread_mutex_unlock(&loader->lock);
+}
+
+static int count_lines(const char *path) {
+    FILE *in = fopen(path, "rb");
+    if(!in) return -1;
+    
+    int count = 0;
+    char line[256];
+    while(fgets(line, sizeof(line), in)) {
+        count += 1;
+    }
+    fclose(in);
+    return count;
+}
+
+static void load_file(lexicon_t *lex, const char *path, bool is_answers) {
+    FILE *in = fopen(path, "rb");
+    if(!in) return;
+    
+    char line[256];
+    while(fgets(line, sizeof(line), in)) {
+        word_t code;
+        if(!lang_encode(lex->lang, line, &code)) continue;
+        if(!hset_insert(&lex->valid, code)) continue;
+        
+        if(is_answers) lex->answers[lex->answer_count++] = code;
+        lex->guesses[lex->guess_count++] = code;
+    }
+    fclose(in);
+}
+
+bool lexicon_load(lexicon_t *lex, const lang_t *lang, const char *answers_path, const char *guesses_path) {
+    assert(lex);
+    assert(lang);
+    assert(answers_path);
+    lexicon_clear(lex, lang);
+    
+    int answer_lines = count_lines(answers_path);
+    int guess_lines = guesses_path ? count_lines(guesses_path) : 0;
+    if(answer_lines <= 0 || guess_lines < 0) return false;
+    
+    uint64_t start = prof_begin();
+    lex->answers = safe_calloc(answer_lines, sizeof(word_t));
+    lex->guesses = safe_calloc(answer_lines + guess_lines, sizeof(word_t));
+    load_file(lex, answers_path, true);
+    if(guesses_path) load_file(lex, guesses_path, false);
+    
+    if(!lex->answer_count) {
+        lexicon_fini(lex);
+        return false;
+    }
+    lex->target_count = lex->answer_count;
+    prof_end(PROF_LEXICON_LOAD, start);
+    return true;
+}
+
+void lexicon_fini(lexicon_t *lex) {
+    assert(lex);
+    if(lex->loader) {
+        lexicon_wait(lex);
+        pthread_mutex_destroy(&lex->loader->lock);
+        safe_free(lex->loader);
+    }
+    if(!lex->mapped) {
+        hset_fini(&lex->valid);
+        safe_free(lex->answers);
+        safe_free(lex->guesses);
+    }
+    lexicon_clear(lex, lex->lang);
+}
+
+bool lexicon_contains(const lexicon_t *lex, word_t word) {
+    assert(lex);
+    return hset_contains(&lex->valid, word);
+}
+
+word_t lexicon_target(const lexicon_t *lex, unsigned seq) {
+    assert(lex);
+    assert(seq < lex->target_count);
+    return lex->targets ? lex->answers[lex->targets[seq]] : lex->answers[seq];
+}
+
+uint32_t lexicon_hash(const lexicon_t *lex) {
+    assert(lex);
+    lexicon_wait(lex);
+    uint32_t hash = jawc_hash_word(lex->answer_count) ^ lex->guess_count;
+    for(unsigned i = 0; i < lex->guess_count; ++i) {
+        hash = jawc_hash_word(hash ^ lex->guesses[i]);
+    }
+    return hash;
+}
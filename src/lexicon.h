@@ -0,0 +1,59 @@
+//===--------------------------------------------------------------------------------------------===
+// lexicon.h - Answer and guess lists for a language
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef LEXICON_H
+#define LEXICON_H
+
+#include "lang.h"
+#include "score.h"
+#include "set.h"
+
+typedef struct lexicon_loader lexicon_loader_t;
+
+typedef struct {
+    const lang_t    *lang;
+    hset_t          valid;
+    
+    word_t          *answers;
+    unsigned        answer_count;
+    // Every valid guess. The answers come first, in the same order, so an answer index is also
+    // the index of that word in `guesses`.
+    word_t          *guesses;
+    unsigned        guess_count;
+    // Puzzle number -> index in `answers`. NULL for custom lists, which are played in file order.
+    const unsigned  *targets;
+    unsigned        target_count;
+    // Optional: the pattern of every guess against every answer, guess_count rows of answer_count.
+    // Only lexicons mapped from a bundle (bundle.h) have it.
+    const pattern_t *patterns;
+    // The lists and `valid` point into a read-only bundle, which owns them.
+    bool            mapped;
+    
+    lexicon_loader_t *loader;       // Set while an async load may still be running.
+} lexicon_t;
+
+// Loads the built-in (English) wordle lists.
+void lexicon_init(lexicon_t *lex);
+// Same, but only the answers and targets are ready on return: the guess list and `valid` are built
+// on a helper thread. Call lexicon_wait() before touching either (game_submit() and solver_hint()
+// already do). lexicon_fini() waits too.
+void lexicon_init_async(lexicon_t *lex);
+// Blocks until an async load has finished. Safe to call from any thread, any number of times.
+void lexicon_wait(const lexicon_t *lex);
+
+// Loads custom UTF-8 lists, one word per line. Every answer is also a valid guess, so
+// `guesses_path` can be NULL. Lines that aren't WORD_SIZE letters of `lang` are skipped.
+bool lexicon_load(lexicon_t *lex, const lang_t *lang, const char *answers_path, const char *guesses_path);
+void lexicon_fini(lexicon_t *lex);
+
+bool lexicon_contains(const lexicon_t *lex, word_t word);
+word_t lexicon_target(const lexicon_t *lex, unsigned seq);
+// Fingerprint of the answer and guess lists, in order, for caches built from a lexicon.
+uint32_t lexicon_hash(const lexicon_t *lex);
+
+#endif /* end of include guard: LEXICON_H */
@@ -15,30 +15,439 @@
 */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <term/line.h>
 #include <term/colors.h>
 #include <term/arg.h>
 #include <term/printing.h>
+#include "arena.h"
+#include "audit.h"
+#include "bulk.h"
+#include "bundle.h"
 #include "game.h"
+#include "exact.h"
+#include "memory.h"
+#include "printing.h"
+#include "profile.h"
+#include "query.h"
+#include "reverse.h"
+#include "solver.h"
+#include "stats.h"
+#include "tile.h"
+#include "wal.h"
 
 #define COUNTOF(arr) (sizeof(arr) / sizeof(arr[0]))
 
 static game_t game;
+static lexicon_t lexicon;
+static solver_t solver;
+static book_t book;
+static bundle_t bundle;
+static wal_t wal;
 static const term_param_t params[] = {
     {'w', 0, "wordle", TERM_ARG_VALUE, "play a specific past problem"},
     {'s', 0, "no-stats", TERM_ARG_OPTION, "do not save results to the stats file"},
+    {'l', 0, "lang", TERM_ARG_VALUE, "alphabet of a custom dictionary (en, es, de, ru)"},
+    {'d', 0, "dict", TERM_ARG_VALUE, "play answers from a UTF-8 word list"},
+    {'g', 0, "guesses", TERM_ARG_VALUE, "extra allowed guesses for --dict"},
+    {'b', 0, "boards", TERM_ARG_VALUE, "play 2, 4 or 8 answers at once"},
+    {'a', 0, "absurdle", TERM_ARG_OPTION, "play against an answer that dodges your guesses"},
+    {'p', 0, "profile", TERM_ARG_OPTION, "print where time went when jawc exits"},
+    {'t', 0, "trace", TERM_ARG_VALUE, "with --profile, write a Chrome trace-event timeline"},
+    {'m', 0, "mem-stats", TERM_ARG_OPTION, "print allocation accounting when jawc exits"},
+    {'k', 0, "book", TERM_ARG_VALUE, "answer the first hints from an opening book"},
+    {'u', 0, "bundle", TERM_ARG_VALUE, "map the built-in lists from a file, built if out of date"},
+    {'K', 0, "build-book", TERM_ARG_VALUE, "compute the opening book for the dictionary and exit"},
+    {'j', 0, "threads", TERM_ARG_VALUE, "threads for the batch modes (default: all)"},
+    {'x', 0, "exact", TERM_ARG_OPTION, "search for the optimal strategy over the answers and exit"},
+    {'o', 0, "opener", TERM_ARG_VALUE, "with --exact, force the first guess"},
+    {'W', 0, "width", TERM_ARG_VALUE, "with --exact, only try the N likeliest guesses per position"},
+    {'B', 0, "hint-budget", TERM_ARG_VALUE, "answer hints within MS milliseconds"},
+    {'S', 0, "session", TERM_ARG_VALUE, "log the game to a file, and resume it after a crash"},
+    {'A', 0, "arena", TERM_ARG_OPTION, "play every puzzle with each strategy and compare them"},
+    {'P', 0, "strategy", TERM_ARG_VALUE, "with --arena, a built-in strategy or a plugin (.so)"},
+    {'L', 0, "move-limit", TERM_ARG_VALUE, "with --arena, forfeit games on moves over MS ms"},
+    {'U', 0, "audit", TERM_ARG_VALUE, "flag implausibly lucky games in a log of recorded games"},
+    {'r', 0, "report", TERM_ARG_OPTION, "after the game, rate each guess against the solver's"},
+    {'R', 0, "reverse", TERM_ARG_OPTION, "find the answer behind share sheets read from stdin"},
+    {'c', 0, "check", TERM_ARG_OPTION, "print 1 for each valid word on stdin, 0 for the others"},
+    {'C', 0, "score", TERM_ARG_OPTION, "print the feedback for each 'GUESS ANSWER' line on stdin"},
+    {'q', 0, "query", TERM_ARG_VALUE, "list the words that match a pattern and constraints"},
+    {'O', 0, "offset", TERM_ARG_VALUE, "with --query, skip the first N matches"},
+    {'N', 0, "limit", TERM_ARG_VALUE, "with --query or --rank, list at most N words (default 100)"},
+    {'e', 0, "rank", TERM_ARG_OPTION, "rank every guess by the information it gives as an opener"},
+    {'f', 0, "spill", TERM_ARG_VALUE, "with --rank, keep the pattern counts in a file, and resume"},
+    {'n', 0, "practice", TERM_ARG_VALUE, "play puzzles back to back, in 'random' or 'next' order"},
 };
 
 static const char *uses[] = {
     "[--no-stats]",
-    "--wordle WORDLE_NUMBER"
+    "--wordle WORDLE_NUMBER",
+    "--dict ANSWERS_FILE [--guesses GUESSES_FILE] [--lang LANGUAGE]",
+    "--boards BOARD_COUNT",
+    "--absurdle",
+    "--profile [--trace TRACE_FILE]",
+    "--mem-stats",
+    "--book BOOK_FILE",
+    "--bundle BUNDLE_FILE",
+    "--hint-budget MS",
+    "--report",
+    "--practice random|next",
+    "--session SESSION_FILE",
+    "--arena [--strategy NAME_OR_PLUGIN...] [--move-limit MS] [--threads THREAD_COUNT]",
+    "--audit GAMES_FILE [--threads THREAD_COUNT]",
+    "--reverse [--threads THREAD_COUNT] < SHARE_SHEETS",
+    "--check|--score [--threads THREAD_COUNT] < LINES",
+    "--query QUERY [--offset N] [--limit N]",
+    "--rank [--spill SPILL_FILE] [--limit N] [--threads THREAD_COUNT]",
+    "--build-book BOOK_FILE [--threads THREAD_COUNT]",
+    "--exact [--opener WORD] [--width WIDTH] [--threads THREAD_COUNT]",
 };
 
 #define WEBSITE "https://github.com/amyinorbit/jawc"
 #define EMAIL "amy@amyparent.com"
 
+static void report_memory(void) {
+    mem_report(stderr);
+}
+
+// The interactive game is session 0 of its log.
+static void resume_game(void *ctx, uint32_t id, game_t *recovered) {
+    bool *resumed = ctx;
+    if(id != 0 || *resumed) {
+        game_fini(recovered);
+        return;
+    }
+    game = *recovered;
+    *resumed = true;
+}
+
+static void run_arena(const strategy_t *const *strategies, unsigned count, unsigned threads,
+                      double move_limit_ms) {
+    arena_options_t options = {.threads = threads, .move_limit_ns = move_limit_ms * 1e6};
+    arena_result_t results[MAX_STRATEGIES];
+    arena_run(&lexicon, strategies, count, &options, results);
+    
+    printf("%-14s %8s %8s %8s %8s %10s %12s %10s\n", "strategy", "games", "mean", "failed",
+           "timeouts", "cpu (s)", "slowest (ms)", "wall (s)");
+    for(unsigned i = 0; i < count; ++i) {
+        const arena_result_t *r = &results[i];
+        printf("%-14s %8u %8.4f %8u %8u %10.2f %12.2f %10.2f\n", r->strategy->name, r->games,
+               r->solved ? (double)r->guesses / r->solved : 0, r->failed, r->timeouts,
+               r->cpu_ns / 1e9, r->slowest_move_ns / 1e6, r->wall_ns / 1e9);
+    }
+}
+
+#define AUDIT_SHOWN         (20)
+
+typedef struct {
+    double          rank;
+    unsigned        idx;
+} ranked_t;
+
+static int compare_ranked(const void *a, const void *b) {
+    const ranked_t *lhs = a, *rhs = b;
+    if(lhs->rank != rhs->rank) return lhs->rank < rhs->rank ? 1 : -1;
+    return lhs->idx < rhs->idx ? -1 : lhs->idx > rhs->idx;
+}
+
+static void print_player(const char *line) {
+    int length = 0;
+    while(line[length] && line[length] != ' ' && line[length] != '\t') length += 1;
+    printf("%-16.*s", length, line);
+}
+
+// The log has one game per line, "PLAYER ANSWER GUESS GUESS...". Blank lines and lines starting
+// with # are skipped.
+static void run_audit(const char *path, unsigned threads) {
+    FILE *in = fopen(path, "rb");
+    if(!in) term_error("jawc", 1, "could not open '%s'", path);
+    fseek(in, 0, SEEK_END);
+    size_t size = ftell(in);
+    fseek(in, 0, SEEK_SET);
+    char *text = safe_malloc(size + 1);
+    size = fread(text, 1, size, in);
+    text[size] = '\0';
+    fclose(in);
+    
+    unsigned capacity = 1024, count = 0;
+    const char **lines = safe_malloc(capacity * sizeof(const char *));
+    unsigned *numbers = safe_malloc(capacity * sizeof(unsigned));
+    unsigned number = 0;
+    for(char *line = text; *line; ) {
+        char *next = strchr(line, '\n');
+        if(next) *next++ = '\0';
+        else next = line + strlen(line);
+        number += 1;
+        if(*line && *line != '#' && *line != '\r') {
+            if(count == capacity) {
+                capacity *= 2;
+                lines = safe_realloc(lines, capacity * sizeof(const char *));
+                numbers = safe_realloc(numbers, capacity * sizeof(unsigned));
+            }
+            numbers[count] = number;
+            lines[count++] = line;
+        }
+        line = next;
+    }
+    
+    uint64_t start = prof_now();
+    audit_score_t *scores = safe_malloc(count * sizeof(audit_score_t));
+    audit_run(&lexicon, lines, count, threads, scores);
+    audit_player_t *players = safe_malloc(count * sizeof(audit_player_t));
+    unsigned player_count = audit_players(scores, count, players);
+    double seconds = (prof_now() - start) / 1e9;
+    
+    ranked_t *ranked = safe_malloc(count * sizeof(ranked_t));
+    unsigned valid = 0, won = 0, flagged = 0;
+    for(unsigned i = 0; i < count; ++i) {
+        if(!scores[i].valid) continue;
+        valid += 1;
+        won += scores[i].won;
+        if(scores[i].flagged) ranked[flagged++] = (ranked_t){scores[i].luck, i};
+    }
+    qsort(ranked, flagged, sizeof(ranked_t), compare_ranked);
+    
+    printf("games:    %u (%u malformed), %u won, %u players, %.2fs\n", valid, count - valid, won,
+           player_count, seconds);
+    printf("flagged:  %u games over %.0f bits of luck\n", flagged, AUDIT_GAME_BITS);
+    if(flagged) {
+        printf("\n%8s %8s %10s %10s  %s\n", "line", "luck", "won from", "ruled out", "game");
+    }
+    for(unsigned i = 0; i < flagged && i < AUDIT_SHOWN; ++i) {
+        const audit_score_t *score = &scores[ranked[i].idx];
+        printf("%8u %8.2f %10u %10u  %s\n", numbers[ranked[i].idx], score->luck,
+               score->win_candidates, score->inconsistent, lines[ranked[i].idx]);
+    }
+    if(flagged > AUDIT_SHOWN) printf("(%u more)\n", flagged - AUDIT_SHOWN);
+    
+    flagged = 0;
+    for(unsigned i = 0; i < player_count; ++i) {
+        const audit_player_t *player = &players[i];
+        double z = player->z > player->wins_z ? player->z : player->wins_z;
+        if(player->flagged) ranked[flagged++] = (ranked_t){z, i};
+    }
+    qsort(ranked, flagged, sizeof(ranked_t), compare_ranked);
+    printf("\nflagged:  %u players over %.0f standard deviations of luck or wins\n", flagged,
+           AUDIT_PLAYER_Z);
+    if(flagged) {
+        printf("\n%-16s %8s %8s %10s %8s %10s %8s\n", "player", "games", "won", "luck/game", "z",
+               "fair wins", "z");
+    }
+    for(unsigned i = 0; i < flagged && i < AUDIT_SHOWN; ++i) {
+        const audit_player_t *player = &players[ranked[i].idx];
+        print_player(lines[player->first]);
+        printf(" %8u %8u %10.2f %8.1f %10.1f %8.1f\n", player->games, player->won,
+               player->luck / player->games, player->z, player->expected_wins, player->wins_z);
+    }
+    if(flagged > AUDIT_SHOWN) printf("(%u more)\n", flagged - AUDIT_SHOWN);
+    
+    safe_free(ranked);
+    safe_free(players);
+    safe_free(scores);
+    safe_free(numbers);
+    safe_free(lines);
+    safe_free(text);
+}
+
+// Rows kept per grid: more than any mode allows, so only garbage gets cut short.
+#define REVERSE_MAX_ROWS    (64)
+#define REVERSE_SHOWN       (12)
+
+static void print_explained(const reverse_t *rev, word_t answer, pattern_t pattern, unsigned seen) {
+    char word[WORD_UTF8_SIZE];
+    word_t guesses[6];
+    unsigned count = reverse_explain(rev, answer, pattern, guesses, COUNTOF(guesses));
+    print_emoji_pattern(pattern, stdout);
+    printf(" %6u rows, %5u guesses:", seen, count);
+    for(unsigned i = 0; i < count && i < COUNTOF(guesses); ++i) {
+        lang_decode(lexicon.lang, guesses[i], false, word);
+        printf(" %s", word);
+    }
+    printf("%s\n", count > COUNTOF(guesses) ? " ..." : "");
+}
+
+// Share sheets are read line by line: rows of emoji belong to the current grid, and anything else
+// (the "Wordle 123 4/6" header, blank lines) ends it.
+static void run_reverse(unsigned threads) {
+    uint64_t start = prof_now();
+    reverse_t rev;
+    reverse_init(&rev, &lexicon, threads);
+    double build_ms = (prof_now() - start) / 1e6;
+    
+    start = prof_now();
+    reverse_batch_t batch;
+    reverse_batch_init(&batch, &rev);
+    pattern_t rows[REVERSE_MAX_ROWS];
+    unsigned row_count = 0;
+    char line[1024];
+    while(fgets(line, sizeof(line), stdin)) {
+        pattern_t pattern;
+        if(reverse_parse_row(line, &pattern)) {
+            if(row_count < REVERSE_MAX_ROWS) rows[row_count++] = pattern;
+        } else {
+            reverse_batch_add(&batch, rows, row_count);
+            row_count = 0;
+        }
+    }
+    reverse_batch_add(&batch, rows, row_count);
+    double batch_ms = (prof_now() - start) / 1e6;
+    
+    printf("grids:    %u (%u rows), matrix %.0fms, grids %.1fms\n", batch.grid_count,
+           batch.row_count, build_ms, batch_ms);
+    
+    char word[WORD_UTF8_SIZE];
+    unsigned best[REVERSE_SHOWN];
+    unsigned count = reverse_batch_best(&batch, best, REVERSE_SHOWN);
+    if(!count) {
+        printf("no answer fits any of the grids\n");
+    } else {
+        unsigned votes = batch.votes[best[0]];
+        if(votes < batch.grid_count) {
+            printf("no answer fits every grid; the best fit %u of them\n", votes);
+        }
+        if(count == 1) {
+            lang_decode(lexicon.lang, lexicon.answers[best[0]], false, word);
+            printf("answer:   %s, consistent with %u/%u grids", word, votes, batch.grid_count);
+        } else {
+            printf("answers:  %u consistent with %u/%u grids:", count, votes, batch.grid_count);
+            for(unsigned i = 0; i < count && i < REVERSE_SHOWN; ++i) {
+                lang_decode(lexicon.lang, lexicon.answers[best[i]], false, word);
+                printf(" %s", word);
+            }
+        }
+        printf("%s\n", count > REVERSE_SHOWN ? " ..." : "");
+    }
+    
+    // With a single answer left, every row can be traced back to the guesses that produce it.
+    if(count == 1) {
+        printf("\n");
+        pattern_t order[PATTERN_COUNT];
+        unsigned distinct = 0;
+        for(unsigned p = 0; p < PATTERN_COUNT; ++p) {
+            if(batch.rows[p]) order[distinct++] = p;
+        }
+        for(unsigned i = 1; i < distinct; ++i) {
+            pattern_t p = order[i];
+            unsigned j = i;
+            for(; j > 0 && batch.rows[order[j-1]] < batch.rows[p]; --j) order[j] = order[j-1];
+            order[j] = p;
+        }
+        for(unsigned i = 0; i < distinct && i < REVERSE_SHOWN; ++i) {
+            print_explained(&rev, lexicon.answers[best[0]], order[i], batch.rows[order[i]]);
+        }
+        if(distinct > REVERSE_SHOWN) printf("(%u more patterns)\n", distinct - REVERSE_SHOWN);
+    }
+    
+    reverse_batch_fini(&batch);
+    reverse_fini(&rev);
+}
+
+#define QUERY_LIMIT     (100)
+
+static void run_query(const char *text, unsigned offset, unsigned limit) {
+    query_t query;
+    query_clear(lexicon.lang, &query);
+    if(!query_parse(lexicon.lang, text, &query)) {
+        term_error("jawc", 1, "'%s' is not a valid query", text);
+    }
+    
+    query_index_t index;
+    query_index_init(&index, &lexicon);
+    unsigned *matches = safe_malloc((limit ? limit : 1) * sizeof(unsigned));
+    uint64_t start = prof_now();
+    unsigned total = query_run(&index, &query, offset, matches, limit);
+    double elapsed_us = (prof_now() - start) / 1e3;
+    
+    unsigned shown = total > offset ? total - offset : 0;
+    if(shown > limit) shown = limit;
+    printf("%u matches (%.1fus)", total, elapsed_us);
+    if(shown && shown < total) printf(", showing %u-%u", offset + 1, offset + shown);
+    printf("\n");
+    char word[WORD_UTF8_SIZE];
+    for(unsigned i = 0; i < shown; ++i) {
+        lang_decode(lexicon.lang, lexicon.guesses[matches[i]], false, word);
+        printf("%s\n", word);
+    }
+    safe_free(matches);
+    query_index_fini(&index);
+}
+
+static void run_rank(unsigned threads, const char *spill_path, unsigned limit) {
+    lexicon_wait(&lexicon);
+    unsigned count = lexicon.guess_count;
+    double *entropy = safe_malloc(count * sizeof(double));
+    tile_options_t options = {.threads = threads, .spill_path = spill_path};
+    uint64_t start = prof_now();
+    if(!tile_entropy(&lexicon, lexicon.answers, lexicon.answer_count, &options, entropy)) {
+        term_error("jawc", 1, "could not use '%s' as a spill file", spill_path);
+    }
+    double seconds = (prof_now() - start) / 1e9;
+    
+    ranked_t *ranked = safe_malloc(count * sizeof(ranked_t));
+    for(unsigned g = 0; g < count; ++g) {
+        ranked[g] = (ranked_t){entropy[g], g};
+    }
+    qsort(ranked, count, sizeof(ranked_t), compare_ranked);
+    
+    printf("%u guesses against %u answers (%.2fs)\n", count, lexicon.answer_count, seconds);
+    char word[WORD_UTF8_SIZE];
+    for(unsigned i = 0; i < limit && i < count; ++i) {
+        lang_decode(lexicon.lang, lexicon.guesses[ranked[i].idx], false, word);
+        printf("%5u  %s  %.4f bits\n", i + 1, word, ranked[i].rank);
+    }
+    safe_free(ranked);
+    safe_free(entropy);
+}
+
+// Maps the bundle at `path`, building it first if it is missing or out of date.
+static void open_bundle(const char *path, unsigned threads) {
+    bundle_status_t status = bundle_map(&bundle, path);
+    if(status == BUNDLE_STALE) {
+        fprintf(stderr, "jawc: building '%s'...\n", path);
+        if(!bundle_build(path, threads)) {
+            term_error("jawc", 1, "could not write a bundle to '%s'", path);
+        }
+        status = bundle_map(&bundle, path);
+    }
+    if(status != BUNDLE_OK) term_error("jawc", 1, "'%s' is not a jawc bundle", path);
+}
+
+static void print_difficulty(void) {
+    if(!bundle.map || game.mode == GAME_MODE_ABSURDLE || game.board_count > 1) return;
+    unsigned left = bundle.difficulty[lexicon.targets[game.seq]];
+    if(left) {
+        printf("difficulty: %u words left after the book's first two guesses\n", left);
+    } else {
+        printf("difficulty: the book's first two guesses find it\n");
+    }
+}
+
+static void print_title(void) {
+    if(game.mode == GAME_MODE_ABSURDLE) {
+        printf("Playing Absurdle\n");
+    } else if(game.board_count > 1) {
+        printf("Playing Wordle #%u-#%u, %u boards\n", game.seq, game.seq + game.board_count - 1,
+               game.board_count);
+    } else {
+        printf("Playing Wordle #%u\n", game.seq);
+    }
+}
+
+typedef enum {
+    PRACTICE_OFF,
+    PRACTICE_RANDOM,
+    PRACTICE_NEXT,
+} practice_t;
+
+// The puzzle after the current one. Multi-board games skip the puzzles their other boards played.
+static unsigned next_seq(practice_t practice) {
+    if(practice == PRACTICE_RANDOM) return rand() % lexicon.target_count;
+    return (game.seq + game.board_count) % lexicon.target_count;
+}
+
 static void print_prompt(const char *name) {
-    printf("%s %u/%u> ", name, game.guess_count+1, MAX_GUESSES);
+    printf("%s %u/%u> ", name, game.guess_count+1, game.max_guesses);
 }
 
 int main(int argc, const char **argv) {
@@ -47,12 +456,44 @@ int main(int argc, const char **argv) {
     
     int wordle = -1;
     bool do_stats = true;
+    const lang_t *lang = &lang_english;
+    const char *dict_path = NULL;
+    const char *guesses_path = NULL;
+    unsigned boards = 1;
+    bool absurdle = false;
+    bool profile = false;
+    const char *trace_path = NULL;
+    const char *book_path = NULL;
+    const char *bundle_path = NULL;
+    const char *build_path = NULL;
+    unsigned threads = 0;
+    bool exact = false;
+    const char *opener = NULL;
+    unsigned width = 0;
+    double hint_budget = 0;
+    const char *session_path = NULL;
+    bool arena = false;
+    bool reverse = false;
+    const char *audit_path = NULL;
+    bool report = false;
+    practice_t practice = PRACTICE_OFF;
+    bool check = false;
+    const char *query = NULL;
+    unsigned query_offset = 0;
+    unsigned query_limit = QUERY_LIMIT;
+    bool rank = false;
+    const char *spill_path = NULL;
+    bool score = false;
+    const strategy_t *chosen[MAX_STRATEGIES];
+    unsigned chosen_count = 0;
+    strategy_register_builtins();
+    double move_limit = 0;
     
     term_arg_result_t r = term_arg_parse(&args, params, COUNTOF(params));
     while(r.name != TERM_ARG_DONE) {
         switch(r.name) {
         case TERM_ARG_HELP:
-            term_print_usage(stdout, "jawc", uses, 2);
+            term_print_usage(stdout, "jawc", uses, COUNTOF(uses));
             term_print_help(stdout, params, COUNTOF(params));
             return 0;
             
@@ -72,24 +513,305 @@ int main(int argc, const char **argv) {
         case 's':
             do_stats = false;
             break;
+        case 'l':
+            lang = lang_find(r.value);
+            if(!lang) {
+                fprintf(stderr, "available languages: ");
+                lang_print_list(stderr);
+                term_error("jawc", 1, "unknown language '%s'", r.value);
+            }
+            break;
+        case 'd':
+            do_stats = false;
+            dict_path = r.value;
+            break;
+        case 'g':
+            guesses_path = r.value;
+            break;
+        case 'b':
+            boards = atoi(r.value);
+            if(boards != 1 && boards != 2 && boards != 4 && boards != 8) {
+                term_error("jawc", 1, "can only play 1, 2, 4 or 8 boards");
+            }
+            do_stats = boards == 1 && do_stats;
+            break;
+        case 'a':
+            do_stats = false;
+            absurdle = true;
+            break;
+        case 'p':
+            profile = true;
+            break;
+        case 't':
+            profile = true;
+            trace_path = r.value;
+            break;
+        case 'm':
+            atexit(report_memory);
+            break;
+        case 'k':
+            book_path = r.value;
+            break;
+        case 'u':
+            bundle_path = r.value;
+            break;
+        case 'K':
+            build_path = r.value;
+            break;
+        case 'j':
+            threads = atoi(r.value);
+            break;
+        case 'x':
+            exact = true;
+            break;
+        case 'o':
+            opener = r.value;
+            break;
+        case 'W':
+            width = atoi(r.value);
+            break;
+        case 'B':
+            hint_budget = atof(r.value);
+            if(hint_budget <= 0) term_error("jawc", 1, "the hint budget must be positive");
+            break;
+        case 'S':
+            session_path = r.value;
+            break;
+        case 'A':
+            arena = true;
+            break;
+        case 'P':
+            if(chosen_count == MAX_STRATEGIES) term_error("jawc", 1, "too many strategies");
+            if(strchr(r.value, '/') || strstr(r.value, ".so")) {
+                const char *error = strategy_load(r.value);
+                if(error) term_error("jawc", 1, "could not load '%s': %s", r.value, error);
+                chosen[chosen_count++] = strategy_get(strategy_count() - 1);
+            } else {
+                chosen[chosen_count] = strategy_find(r.value);
+                if(!chosen[chosen_count++]) {
+                    term_error("jawc", 1, "no strategy called '%s'", r.value);
+                }
+            }
+            break;
+        case 'L':
+            move_limit = atof(r.value);
+            break;
+        case 'R':
+            reverse = true;
+            break;
+        case 'U':
+            audit_path = r.value;
+            break;
+        case 'r':
+            report = true;
+            break;
+        case 'c':
+            check = true;
+            break;
+        case 'C':
+            score = true;
+            break;
+        case 'q':
+            query = r.value;
+            break;
+        case 'O':
+            query_offset = atoi(r.value);
+            break;
+        case 'N':
+            query_limit = atoi(r.value);
+            break;
+        case 'e':
+            rank = true;
+            break;
+        case 'f':
+            spill_path = r.value;
+            break;
+        case 'n':
+            do_stats = false;
+            if(!strcmp(r.value, "random")) {
+                practice = PRACTICE_RANDOM;
+            } else if(!strcmp(r.value, "next")) {
+                practice = PRACTICE_NEXT;
+            } else {
+                term_error("jawc", 1, "practice order must be 'random' or 'next'");
+            }
+            break;
         }
         r = term_arg_parse(&args, params, COUNTOF(params));
     }
+    if(profile) prof_start(trace_path);
+    
+    bool have_book = false;
+    if(dict_path) {
+        if(bundle_path) term_error("jawc", 1, "a bundle only holds the built-in lists");
+        if(!lexicon_load(&lexicon, lang, dict_path, guesses_path)) {
+            term_error("jawc", 1, "could not load a %s dictionary from '%s'", lang->name, dict_path);
+        }
+    } else if(bundle_path) {
+        open_bundle(bundle_path, threads);
+        bundle_lexicon(&bundle, &lexicon);
+        if(!book_path) {
+            book = *bundle.book;
+            have_book = true;
+        }
+    } else {
+        // Only the answers are needed to show the board: the guess list loads behind the prompt.
+        lexicon_init_async(&lexicon);
+    }
+    
+    char answer[WORD_UTF8_SIZE];
+    if(build_path) {
+        uint64_t start = prof_now();
+        book_build(&book, &lexicon, threads);
+        if(!book_save(&book, build_path)) {
+            term_error("jawc", 1, "could not write the opening book to '%s'", build_path);
+        }
+        lang_decode(lexicon.lang, book.opener, false, answer);
+        printf("opener: %s (%.2fs)\n", answer, (prof_now() - start) / 1e9);
+        lexicon_fini(&lexicon);
+        return 0;
+    }
+    if(exact) {
+        exact_options_t options = {.max_guesses = MAX_GUESSES, .width = width, .opener = WORD_NONE,
+                                   .threads = threads};
+        lexicon_wait(&lexicon);
+        if(opener && (!lang_encode(lexicon.lang, opener, &options.opener)
+                      || !lexicon_contains(&lexicon, options.opener))) {
+            term_error("jawc", 1, "'%s' is not a %s word", opener, lexicon.lang->name);
+        }
+        
+        uint64_t start = prof_now();
+        exact_result_t result;
+        exact_solve(&lexicon, &options, &result);
+        double seconds = (prof_now() - start) / 1e9;
+        if(!result.solved) {
+            printf("no strategy finds every answer in %u guesses\n", MAX_GUESSES);
+        } else {
+            lang_decode(lexicon.lang, result.opener, false, answer);
+            printf("opener:   %s\n", answer);
+            printf("total:    %llu guesses over %u answers (%.4f each)%s\n",
+                   (unsigned long long)result.total, lexicon.answer_count,
+                   (double)result.total / lexicon.answer_count,
+                   result.proven ? ", optimal" : ", upper bound");
+            printf("worst:    %u\n", result.worst);
+        }
+        printf("searched: %llu positions, %llu cached, %.2fs\n", (unsigned long long)result.nodes,
+               (unsigned long long)result.cache_hits, seconds);
+        lexicon_fini(&lexicon);
+        return 0;
+    }
+    
+    if(arena) {
+        // Without --strategy, every built-in plays.
+        if(!chosen_count) {
+            for(unsigned i = 0; i < strategy_count(); ++i) {
+                chosen[chosen_count++] = strategy_get(i);
+            }
+        }
+        run_arena(chosen, chosen_count, threads, move_limit);
+        lexicon_fini(&lexicon);
+        return 0;
+    }
+    if(audit_path) {
+        run_audit(audit_path, threads);
+        lexicon_fini(&lexicon);
+        return 0;
+    }
+    if(reverse) {
+        run_reverse(threads);
+        lexicon_fini(&lexicon);
+        return 0;
+    }
+    if(rank) {
+        run_rank(threads, spill_path, query_limit);
+        lexicon_fini(&lexicon);
+        return 0;
+    }
+    if(query) {
+        run_query(query, query_offset, query_limit);
+        lexicon_fini(&lexicon);
+        return 0;
+    }
+    if(check || score) {
+        if(check && score) term_error("jawc", 1, "--check and --score can't be used together");
+        bulk_mode_t mode = check ? BULK_CHECK : BULK_SCORE;
+        bool ok = bulk_run(&lexicon, mode, stdin, stdout, threads, NULL);
+        lexicon_fini(&lexicon);
+        if(!ok) term_error("jawc", 1, "could not read stdin or write stdout");
+        return 0;
+    }
     
-    game_init(&game, wordle);
+    // A session log holds one game, so it can't follow a practice run.
+    if(practice && session_path) term_error("jawc", 1, "--practice can't be used with --session");
+    if(practice == PRACTICE_RANDOM) srand(prof_now());
+    
+    bool resumed = false;
+    if(session_path) {
+        wal_options_t options = {.fsync = true, .group_window_ns = 0, .compact_bytes = 64 * 1024};
+        if(!wal_open(&wal, &lexicon, session_path, &options)) {
+            term_error("jawc", 1, "'%s' is not a session log for this dictionary", session_path);
+        }
+        wal_recover(&wal, resume_game, &resumed);
+    }
+    if(resumed) {
+        absurdle = game.mode == GAME_MODE_ABSURDLE;
+        boards = game.board_count;
+        // The log doesn't say whether the game was one that counts towards the stats.
+        do_stats = false;
+    } else {
+        if(absurdle) {
+            game_init_absurdle(&game, &lexicon);
+        } else {
+            game_init_boards(&game, &lexicon, wordle, boards);
+            // game_init_boards() only plays puzzles up to today's: random rounds draw from the
+            // whole list, the first one included.
+            if(practice == PRACTICE_RANDOM && wordle < 0) game_reset(&game, next_seq(practice));
+        }
+        if(session_path) wal_commit(&wal, wal_begin(&wal, 0, &game));
+    }
+    solver_init(&solver, &game);
+    if(have_book) solver_use_book(&solver, &book);
     
     line_t *editor = line_new(&(line_functions_t){.print_prompt = print_prompt});
     line_set_prompt(editor, "wordle");
     
-    printf("Playing Wordle #%u\n\n", game.seq);
+    print_title();
+    printf(practice ? "(type ? for a hint, ^D to stop)\n\n" : "(type ? for a hint)\n\n");
+    if(resumed) print_board(&game, false, stdout);
+    
+    analyst_t analyst;
+    analyst_init(&analyst, &lexicon, NULL, 0);
+    unsigned rounds = 0, wins = 0, win_guesses = 0;
     
     bool done = false;
     while(!done) {
         char *word = line_get(editor);
-        if(!word) return 1;
+        if(!word && !practice) return 1;
+        if(!word) break;
+        
+        if(word[0] == '?') {
+            // Loaded on first use: checking it against the dictionary needs the full guess list.
+            if(book_path) {
+                if(book_load(&book, &lexicon, book_path)) {
+                    solver_use_book(&solver, &book);
+                    have_book = true;
+                } else {
+                    fprintf(stderr, "jawc: '%s' is not an opening book for this dictionary\n", book_path);
+                }
+                book_path = NULL;
+            }
+            word_t hint = hint_budget > 0
+                ? solver_hint_within(&solver, hint_budget * 1e6, NULL, NULL)
+                : solver_hint(&solver);
+            lang_decode(lexicon.lang, hint, false, answer);
+            printf("try: %s\n\n", answer);
+            free(word);
+            continue;
+        }
         
         const guess_t *guess = NULL;
         result_t result = game_submit(&game, word, &guess);
+        if(session_path && guess) wal_commit(&wal, wal_guess(&wal, 0, guess->word));
         print_board(&game, false, stdout);
         free(word);
         
@@ -105,20 +827,80 @@ int main(int argc, const char **argv) {
             done = true;
             break;
         case GAME_RESULT_LOST:
-            printf("You lose: %s\n\n", game.answer);
+            printf("You lose:");
+            if(game.boards[0].answer == WORD_NONE) {
+                lang_decode(lexicon.lang, game.pool.words[0], false, answer);
+                printf(" %s (or %u others)\n\n", answer, game.pool.count - 1);
+            } else {
+                for(unsigned i = 0; i < game.board_count; ++i) {
+                    lang_decode(lexicon.lang, game.boards[i].answer, false, answer);
+                    printf(" %s", answer);
+                }
+                printf("\n\n");
+            }
             done = true;
             break;
         case GAME_RESULT_AGAIN:
             printf("Not quite!\n\n");
             break;
         }
+        if(!done || !practice) continue;
+        
+        // The lexicon, the solver's sets and the analyst's opener all carry over to the next round:
+        // only the boards start again.
+        print_share_sheet(&game, stdout);
+        print_difficulty();
+        if(report) {
+            if(book_path) have_book = book_load(&book, &lexicon, book_path);
+            book_path = NULL;
+            analyst.book = have_book ? &book : NULL;
+            analysis_t analysis;
+            analysis_run(&analyst, &game, &analysis);
+            printf("\n");
+            print_analysis(&analysis, &lexicon, stdout);
+        }
+        rounds += 1;
+        if(game.won) {
+            wins += 1;
+            win_guesses += game.guess_count;
+        }
+        printf("\nround %u: won %u, %.2f guesses per win\n\n", rounds, wins,
+               wins ? (double)win_guesses / wins : 0);
+        
+        game_reset(&game, next_seq(practice));
+        solver_reset(&solver);
+        print_title();
+        printf("\n");
+        done = false;
     }
     line_destroy(editor);
+    if(session_path) {
+        wal_commit(&wal, wal_end(&wal, 0));
+        wal_close(&wal);
+    }
+    
+    if(practice) {
+        solver_fini(&solver);
+        game_fini(&game);
+        lexicon_fini(&lexicon);
+        return 0;
+    }
     
     if(do_stats) game_stats(&game);
     print_share_sheet(&game, stdout);
+    print_difficulty();
+    if(report) {
+        if(book_path) have_book = book_load(&book, &lexicon, book_path);
+        analyst.book = have_book ? &book : NULL;
+        analysis_t analysis;
+        analysis_run(&analyst, &game, &analysis);
+        printf("\n");
+        print_analysis(&analysis, &lexicon, stdout);
+    }
     
+    solver_fini(&solver);
     game_fini(&game);
+    lexicon_fini(&lexicon);
     return 0;
 }
 
@@ -0,0 +1,202 @@
+//===--------------------------------------------------------------------------------------------===
+// memory.c - Allocation accounting
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "memory.h"
+
+#ifdef JAWC_ALLOC_ACCOUNTING
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stddef.h>
+
+#define MAX_SITES       (1024)
+#define REPORT_SITES    (20)
+#define BLOCK_MAGIC     (0x6a617763)
+// Sites that don't fit in the table are counted here, and reported as "(other)".
+#define OVERFLOW_SITE   (MAX_SITES)
+
+typedef struct {
+    const char      *file;
+    unsigned        line;
+    uint64_t        allocs;
+    uint64_t        total_bytes;
+    uint64_t        live_bytes;
+} alloc_site_t;
+
+// Sits in front of every block. Padded to max_align_t so the caller's pointer keeps malloc's
+// alignment guarantees.
+typedef union {
+    struct {
+        uint64_t    size;
+        uint32_t    site;
+        uint32_t    magic;
+    } info;
+    max_align_t     align;
+} block_header_t;
+
+static atomic_flag lock = ATOMIC_FLAG_INIT;
+static mem_stats_t stats;
+static alloc_site_t sites[MAX_SITES + 1] = {[OVERFLOW_SITE] = {.file = "(other)"}};
+
+static void acquire(void) {
+    while(atomic_flag_test_and_set_explicit(&lock, memory_order_acquire)) {}
+}
+
+static void release(void) {
+    atomic_flag_clear_explicit(&lock, memory_order_release);
+}
+
+// Call sites are keyed on the __FILE__ pointer and line, which is stable for a given site. When the
+// table fills up, further sites share OVERFLOW_SITE rather than going untracked.
+static uint32_t find_site(const char *file, unsigned line) {
+    uint32_t idx = (((uintptr_t)file >> 4) * 31 + line) % MAX_SITES;
+    for(unsigned i = 0; i < MAX_SITES; ++i) {
+        alloc_site_t *site = &sites[idx];
+        if(!site->file) {
+            site->file = file;
+            site->line = line;
+            return idx;
+        }
+        if(site->file == file && site->line == line) return idx;
+        idx = (idx + 1) % MAX_SITES;
+    }
+    return OVERFLOW_SITE;
+}
+
+static void track_alloc(block_header_t *block, size_t size, const char *file, unsigned line) {
+    acquire();
+    uint32_t idx = find_site(file, line);
+    alloc_site_t *site = &sites[idx];
+    site->allocs += 1;
+    site->total_bytes += size;
+    site->live_bytes += size;
+    
+    stats.allocs += 1;
+    stats.total_bytes += size;
+    stats.live_bytes += size;
+    if(stats.live_bytes > stats.peak_bytes) stats.peak_bytes = stats.live_bytes;
+    release();
+    
+    block->info.size = size;
+    block->info.site = idx;
+    block->info.magic = BLOCK_MAGIC;
+}
+
+static void track_free(const block_header_t *block) {
+    assert(block->info.magic == BLOCK_MAGIC);
+    acquire();
+    sites[block->info.site].live_bytes -= block->info.size;
+    stats.frees += 1;
+    stats.live_bytes -= block->info.size;
+    release();
+}
+
+void *mem_acct_alloc(size_t size, bool zero, const char *file, unsigned line) {
+    assert(size <= SIZE_MAX - sizeof(block_header_t));
+    block_header_t *block = zero
+        ? calloc(1, sizeof(block_header_t) + size)
+        : malloc(sizeof(block_header_t) + size);
+    assert(block);
+    track_alloc(block, size, file, line);
+    return block + 1;
+}
+
+// calloc() fails when count * size overflows, rather than handing back a smaller block.
+void *mem_acct_calloc(size_t count, size_t size, const char *file, unsigned line) {
+    assert(!count || size <= SIZE_MAX / count);
+    return mem_acct_alloc(count * size, true, file, line);
+}
+
+void *mem_acct_realloc(void *mem, size_t size, const char *file, unsigned line) {
+    if(!mem) return mem_acct_alloc(size, false, file, line);
+    if(!size) {
+        mem_acct_free(mem);
+        return NULL;
+    }
+    
+    assert(size <= SIZE_MAX - sizeof(block_header_t));
+    block_header_t *block = (block_header_t *)mem - 1;
+    track_free(block);
+    block = realloc(block, sizeof(block_header_t) + size);
+    assert(block);
+    track_alloc(block, size, file, line);
+    return block + 1;
+}
+
+void mem_acct_free(void *mem) {
+    if(!mem) return;
+    block_header_t *block = (block_header_t *)mem - 1;
+    track_free(block);
+    block->info.magic = 0;
+    free(block);
+}
+
+bool mem_stats(mem_stats_t *out) {
+    assert(out);
+    acquire();
+    *out = stats;
+    release();
+    return true;
+}
+
+void mem_report(FILE *out) {
+    alloc_site_t top[REPORT_SITES];
+    unsigned top_count = 0;
+    mem_stats_t totals;
+    
+    acquire();
+    totals = stats;
+    for(unsigned i = 0; i <= OVERFLOW_SITE; ++i) {
+        const alloc_site_t *site = &sites[i];
+        if(!site->file || !site->allocs) continue;
+        
+        unsigned pos = top_count < REPORT_SITES ? top_count++ : REPORT_SITES;
+        while(pos > 0 && top[pos-1].total_bytes < site->total_bytes) {
+            if(pos < REPORT_SITES) top[pos] = top[pos-1];
+            pos -= 1;
+        }
+        if(pos < REPORT_SITES) top[pos] = *site;
+    }
+    release();
+    
+    fprintf(out, "------\n");
+    fprintf(out, "allocations: %llu (%llu freed)\n",
+            (unsigned long long)totals.allocs, (unsigned long long)totals.frees);
+    fprintf(out, "live bytes:  %llu\n", (unsigned long long)totals.live_bytes);
+    fprintf(out, "peak bytes:  %llu\n", (unsigned long long)totals.peak_bytes);
+    fprintf(out, "total bytes: %llu\n\n", (unsigned long long)totals.total_bytes);
+    
+    fprintf(out, "%-32s %10s %12s %12s\n", "call site", "allocs", "bytes", "live");
+    for(unsigned i = 0; i < top_count; ++i) {
+        const char *file = strrchr(top[i].file, '/');
+        char where[256];
+        if(top[i].line) {
+            snprintf(where, sizeof(where), "%s:%u", file ? file + 1 : top[i].file, top[i].line);
+        } else {
+            snprintf(where, sizeof(where), "%s", top[i].file);
+        }
+        fprintf(out, "%-32s %10llu %12llu %12llu\n", where,
+                (unsigned long long)top[i].allocs, (unsigned long long)top[i].total_bytes,
+                (unsigned long long)top[i].live_bytes);
+    }
+    fprintf(out, "------\n");
+}
+
+#else
+
+bool mem_stats(mem_stats_t *out) {
+    assert(out);
+    memset(out, 0, sizeof(*out));
+    return false;
+}
+
+void mem_report(FILE *out) {
+    fprintf(out, "allocation accounting is off (rebuild with -DJAWC_ALLOC_ACCOUNTING=ON)\n");
+}
+
+#endif /* JAWC_ALLOC_ACCOUNTING */
@@ -11,8 +11,48 @@
 
 #include <stdlib.h>
 #include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 
+typedef struct {
+    uint64_t        allocs;
+    uint64_t        frees;
+    uint64_t        live_bytes;
+    uint64_t        peak_bytes;
+    uint64_t        total_bytes;
+} mem_stats_t;
+
+// Allocation accounting is opt-in at build time (-DJAWC_ALLOC_ACCOUNTING=ON). When it's on, every
+// block carries a small header with its size and call site, so the safe_* wrappers can keep live,
+// peak and per-site totals. Without it, mem_stats() reports zeroes and the wrappers are the plain
+// libc calls below.
+bool mem_stats(mem_stats_t *out);
+void mem_report(FILE *out);
+
+#ifdef JAWC_ALLOC_ACCOUNTING
+
+void *mem_acct_alloc(size_t size, bool zero, const char *file, unsigned line);
+void *mem_acct_calloc(size_t count, size_t size, const char *file, unsigned line);
+void *mem_acct_realloc(void *mem, size_t size, const char *file, unsigned line);
+void mem_acct_free(void *mem);
+
+#define safe_malloc(size)           mem_acct_alloc((size), false, __FILE__, __LINE__)
+#define safe_calloc(count, size)    mem_acct_calloc((count), (size), __FILE__, __LINE__)
+#define safe_realloc(mem, size)     mem_acct_realloc((mem), (size), __FILE__, __LINE__)
+#define safe_free(mem)              mem_acct_free(mem)
+#define safe_strdup(str)            mem_acct_strdup((str), __FILE__, __LINE__)
+
+static inline char *mem_acct_strdup(const char *str, const char *file, unsigned line) {
+    size_t len = strlen(str);
+    char *new_str = mem_acct_alloc(len+1, false, file, line);
+    memcpy(new_str, str, len+1);
+    return new_str;
+}
+
+#else
+
 static inline void *safe_malloc(size_t size) {
     void *mem = malloc(size);
     assert(mem);
@@ -37,7 +77,7 @@ static inline void safe_free(void *mem) {
     }
 }
 
-static char *safe_strdup(const char *str) {
+static inline char *safe_strdup(const char *str) {
     size_t len = strlen(str);
     char *new_str = safe_calloc(len+1, sizeof(char));
     strcpy(new_str, str);
@@ -45,4 +85,6 @@ static char *safe_strdup(const char *str) {
     return new_str;
 }
 
+#endif /* JAWC_ALLOC_ACCOUNTING */
+
 #endif /* end of include guard: MEMORY_H */
@@ -0,0 +1,116 @@
+//===--------------------------------------------------------------------------------------------===
+// partition.c - Bucketed candidate list implementation
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "partition.h"
+#include "memory.h"
+#include <assert.h>
+#include <string.h>
+
+void partition_init(partition_t *part, const lexicon_t *lex) {
+    assert(part);
+    assert(lex);
+    
+    unsigned count = lex->answer_count;
+    part->count = count;
+    part->indices = safe_malloc(count * sizeof(unsigned));
+    part->words = safe_malloc(count * sizeof(word_t));
+    part->scratch_indices = safe_malloc(count * sizeof(unsigned));
+    part->scratch_words = safe_malloc(count * sizeof(word_t));
+    part->patterns = safe_malloc(count * sizeof(pattern_t));
+    partition_reset(part, lex);
+}
+
+void partition_reset(partition_t *part, const lexicon_t *lex) {
+    assert(part);
+    assert(lex);
+    
+    unsigned count = lex->answer_count;
+    part->count = count;
+    for(unsigned i = 0; i < count; ++i) {
+        part->indices[i] = i;
+        part->words[i] = lex->answers[i];
+    }
+    memset(part->bucket_start, 0, sizeof(part->bucket_start));
+    part->bucket_start[PATTERN_COUNT] = count;
+}
+
+void partition_fini(partition_t *part) {
+    assert(part);
+    safe_free(part->indices);
+    safe_free(part->words);
+    safe_free(part->scratch_indices);
+    safe_free(part->scratch_words);
+    safe_free(part->patterns);
+    memset(part, 0, sizeof(*part));
+}
+
+void partition_split(partition_t *part, word_t guess) {
+    assert(part);
+    score_batch(guess, part->words, part->count, part->patterns);
+    
+    unsigned counts[PATTERN_COUNT] = {0};
+    for(unsigned i = 0; i < part->count; ++i) {
+        counts[part->patterns[i]] += 1;
+    }
+    
+    unsigned start = 0;
+    unsigned next[PATTERN_COUNT];
+    for(unsigned p = 0; p < PATTERN_COUNT; ++p) {
+        part->bucket_start[p] = start;
+        next[p] = start;
+        start += counts[p];
+    }
+    part->bucket_start[PATTERN_COUNT] = start;
+    
+    for(unsigned i = 0; i < part->count; ++i) {
+        unsigned dst = next[part->patterns[i]]++;
+        part->scratch_indices[dst] = part->indices[i];
+        part->scratch_words[dst] = part->words[i];
+    }
+    
+    unsigned *indices = part->indices;
+    word_t *words = part->words;
+    part->indices = part->scratch_indices;
+    part->words = part->scratch_words;
+    part->scratch_indices = indices;
+    part->scratch_words = words;
+}
+
+pattern_t partition_largest(const partition_t *part) {
+    assert(part);
+    pattern_t best = 0;
+    for(unsigned p = 1; p < PATTERN_COUNT; ++p) {
+        if(partition_bucket_size(part, p) > partition_bucket_size(part, best)) best = p;
+    }
+    return best;
+}
+
+void partition_keep(partition_t *part, pattern_t pattern) {
+    assert(part);
+    unsigned start = part->bucket_start[pattern];
+    unsigned size = partition_bucket_size(part, pattern);
+    
+    memmove(part->indices, part->indices + start, size * sizeof(unsigned));
+    memmove(part->words, part->words + start, size * sizeof(word_t));
+    part->count = size;
+    memset(part->bucket_start, 0, sizeof(part->bucket_start));
+    part->bucket_start[PATTERN_COUNT] = size;
+}
+
+void partition_copy_bucket(partition_t *dst, const partition_t *src, pattern_t pattern) {
+    assert(dst && src);
+    assert(dst != src);
+    unsigned start = src->bucket_start[pattern];
+    unsigned size = partition_bucket_size(src, pattern);
+    
+    memcpy(dst->indices, src->indices + start, size * sizeof(unsigned));
+    memcpy(dst->words, src->words + start, size * sizeof(word_t));
+    dst->count = size;
+    memset(dst->bucket_start, 0, sizeof(dst->bucket_start));
+    dst->bucket_start[PATTERN_COUNT] = size;
+}
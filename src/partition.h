@@ -0,0 +1,47 @@
+//===--------------------------------------------------------------------------------------------===
+// partition.h - Candidate lists bucketed by feedback pattern
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef PARTITION_H
+#define PARTITION_H
+
+#include "lexicon.h"
+#include "score.h"
+
+// Remaining candidates as a flat list. Splitting on a guess counting-sorts the list so that each
+// pattern's bucket is a contiguous range, and keeping a bucket just moves that range to the front,
+// so refining never allocates.
+typedef struct {
+    unsigned        count;
+    unsigned        *indices;
+    word_t          *words;
+    
+    unsigned        *scratch_indices;
+    word_t          *scratch_words;
+    pattern_t       *patterns;
+    unsigned        bucket_start[PATTERN_COUNT+1];
+} partition_t;
+
+// Starts with every answer in the lexicon.
+void partition_init(partition_t *part, const lexicon_t *lex);
+void partition_fini(partition_t *part);
+// Puts every answer back, without reallocating.
+void partition_reset(partition_t *part, const lexicon_t *lex);
+
+void partition_split(partition_t *part, word_t guess);
+// Biggest bucket of the last split. Ties go to the lowest pattern number.
+pattern_t partition_largest(const partition_t *part);
+void partition_keep(partition_t *part, pattern_t pattern);
+// Replaces the candidates of `dst` with one bucket of the last split of `src`, so that a split can
+// be reused for many games. Both must have been set up for the same lexicon.
+void partition_copy_bucket(partition_t *dst, const partition_t *src, pattern_t pattern);
+
+static inline unsigned partition_bucket_size(const partition_t *part, pattern_t pattern) {
+    return part->bucket_start[pattern+1] - part->bucket_start[pattern];
+}
+
+#endif /* end of include guard: PARTITION_H */
@@ -0,0 +1,250 @@
+//===--------------------------------------------------------------------------------------------===
+// pool.c - Worker pool, task deques and parallel loops
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "pool.h"
+#include "memory.h"
+#include <assert.h>
+#include <sched.h>
+#include <unistd.h>
+
+#define MAX_POOL_THREADS    (256)
+#define DEQUE_CAPACITY      (64)
+
+// Which pool the current thread works for, and as which worker. Threads outside any pool (the one
+// that drives it) count as worker 0.
+static _Thread_local pool_t *current_pool = NULL;
+static _Thread_local unsigned current_worker = 0;
+
+static unsigned worker_index(const pool_t *pool) {
+    return current_pool == pool ? current_worker : 0;
+}
+
+static void deque_init(pool_deque_t *deque) {
+    pthread_mutex_init(&deque->lock, NULL);
+    deque->capacity = DEQUE_CAPACITY;
+    deque->tasks = safe_malloc(deque->capacity * sizeof(pool_future_t *));
+    deque->top = 0;
+    deque->bottom = 0;
+}
+
+static void deque_fini(pool_deque_t *deque) {
+    pthread_mutex_destroy(&deque->lock);
+    safe_free(deque->tasks);
+}
+
+// top and bottom only ever grow; the capacity is a power of two, so they wrap around the ring.
+static void deque_push(pool_deque_t *deque, pool_future_t *task) {
+    pthread_mutex_lock(&deque->lock);
+    if(deque->bottom - deque->top == deque->capacity) {
+        pool_future_t **tasks = safe_malloc(2 * deque->capacity * sizeof(pool_future_t *));
+        for(unsigned i = deque->top; i != deque->bottom; ++i) {
+            tasks[i & (2 * deque->capacity - 1)] = deque->tasks[i & (deque->capacity - 1)];
+        }
+        safe_free(deque->tasks);
+        deque->tasks = tasks;
+        deque->capacity *= 2;
+    }
+    deque->tasks[deque->bottom & (deque->capacity - 1)] = task;
+    deque->bottom += 1;
+    pthread_mutex_unlock(&deque->lock);
+}
+
+static pool_future_t *deque_pop(pool_deque_t *deque) {
+    pool_future_t *task = NULL;
+    pthread_mutex_lock(&deque->lock);
+    if(deque->bottom != deque->top) {
+        deque->bottom -= 1;
+        task = deque->tasks[deque->bottom & (deque->capacity - 1)];
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return task;
+}
+
+static pool_future_t *deque_steal(pool_deque_t *deque) {
+    pool_future_t *task = NULL;
+    pthread_mutex_lock(&deque->lock);
+    if(deque->bottom != deque->top) {
+        task = deque->tasks[deque->top & (deque->capacity - 1)];
+        deque->top += 1;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return task;
+}
+
+// The worker's own newest task if it has one, otherwise the oldest task of someone else.
+static pool_future_t *find_task(pool_t *pool, unsigned worker) {
+    if(!atomic_load_explicit(&pool->pending, memory_order_relaxed)) return NULL;
+
+    pool_future_t *task = deque_pop(&pool->deques[worker]);
+    for(unsigned i = 1; !task && i < pool->thread_count; ++i) {
+        task = deque_steal(&pool->deques[(worker + i) % pool->thread_count]);
+    }
+    if(task) atomic_fetch_sub(&pool->pending, 1);
+    return task;
+}
+
+static void run_task(pool_future_t *task, unsigned worker) {
+    task->fn(task->arg, worker);
+    atomic_store_explicit(&task->done, true, memory_order_release);
+}
+
+typedef struct {
+    pool_t          *pool;
+    unsigned        worker;
+} worker_arg_t;
+
+static void *worker_main(void *data) {
+    worker_arg_t arg = *(worker_arg_t *)data;
+    safe_free(data);
+    pool_t *pool = arg.pool;
+    current_pool = pool;
+    current_worker = arg.worker;
+
+    for(;;) {
+        pool_future_t *task = find_task(pool, arg.worker);
+        if(task) {
+            run_task(task, arg.worker);
+            continue;
+        }
+
+        // Spawners check `sleepers` after bumping `pending`, and this checks `pending` after
+        // bumping `sleepers`, so one of the two always sees the other.
+        pthread_mutex_lock(&pool->lock);
+        atomic_fetch_add(&pool->sleepers, 1);
+        while(!pool->quit && !atomic_load(&pool->pending)) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        atomic_fetch_sub(&pool->sleepers, 1);
+        bool quit = pool->quit;
+        pthread_mutex_unlock(&pool->lock);
+        if(quit) return NULL;
+    }
+}
+
+void pool_init(pool_t *pool, unsigned threads) {
+    assert(pool);
+    if(!threads) threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if(threads < 1) threads = 1;
+    if(threads > MAX_POOL_THREADS) threads = MAX_POOL_THREADS;
+
+    pool->thread_count = threads;
+    pool->threads = safe_calloc(threads, sizeof(pthread_t));
+    pool->deques = safe_calloc(threads, sizeof(pool_deque_t));
+    for(unsigned i = 0; i < threads; ++i) {
+        deque_init(&pool->deques[i]);
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    atomic_init(&pool->pending, 0);
+    atomic_init(&pool->sleepers, 0);
+    pool->quit = false;
+
+    for(unsigned i = 1; i < threads; ++i) {
+        worker_arg_t *arg = safe_malloc(sizeof(*arg));
+        *arg = (worker_arg_t){pool, i};
+        pthread_create(&pool->threads[i], NULL, worker_main, arg);
+    }
+}
+
+void pool_fini(pool_t *pool) {
+    assert(pool);
+    assert(!atomic_load(&pool->pending));
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = true;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for(unsigned i = 1; i < pool->thread_count; ++i) {
+        pthread_join(pool->threads[i], NULL);
+    }
+    for(unsigned i = 0; i < pool->thread_count; ++i) {
+        deque_fini(&pool->deques[i]);
+    }
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    safe_free(pool->threads);
+    safe_free(pool->deques);
+}
+
+void pool_spawn(pool_t *pool, pool_future_t *future, pool_task_fn fn, void *arg) {
+    assert(pool);
+    assert(future);
+    assert(fn);
+    future->fn = fn;
+    future->arg = arg;
+    atomic_init(&future->done, false);
+
+    deque_push(&pool->deques[worker_index(pool)], future);
+    atomic_fetch_add(&pool->pending, 1);
+    if(atomic_load(&pool->sleepers)) {
+        pthread_mutex_lock(&pool->lock);
+        pthread_cond_signal(&pool->wake);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+void pool_join(pool_t *pool, pool_future_t *future) {
+    assert(pool);
+    assert(future);
+    unsigned worker = worker_index(pool);
+    while(!atomic_load_explicit(&future->done, memory_order_acquire)) {
+        // Usually finds `future` itself, unless a thief got to it first.
+        pool_future_t *task = find_task(pool, worker);
+        if(task) {
+            run_task(task, worker);
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+typedef struct {
+    pool_t          *pool;
+    pool_range_fn   fn;
+    void            *ctx;
+    unsigned        grain;
+} loop_t;
+
+typedef struct {
+    const loop_t    *loop;
+    unsigned        begin;
+    unsigned        end;
+} loop_range_t;
+
+static void loop_split(void *arg, unsigned worker);
+
+// Hands the back half of the range to the pool until what is left is one chunk, runs that, then
+// waits for the halves it handed out.
+static void loop_run(const loop_t *loop, unsigned begin, unsigned end, unsigned worker) {
+    if(end - begin <= loop->grain) {
+        loop->fn(loop->ctx, worker, begin, end);
+        return;
+    }
+
+    unsigned mid = begin + (end - begin) / 2;
+    loop_range_t back = {loop, mid, end};
+    pool_future_t future;
+    pool_spawn(loop->pool, &future, loop_split, &back);
+    loop_run(loop, begin, mid, worker);
+    pool_join(loop->pool, &future);
+}
+
+static void loop_split(void *arg, unsigned worker) {
+    const loop_range_t *range = arg;
+    loop_run(range->loop, range->begin, range->end, worker);
+}
+
+void pool_for(pool_t *pool, unsigned count, unsigned grain, pool_range_fn fn, void *ctx) {
+    assert(pool);
+    assert(fn);
+    if(!count) return;
+
+    loop_t loop = {pool, fn, ctx, grain ? grain : 1};
+    loop_run(&loop, 0, count, worker_index(pool));
+}
@@ -0,0 +1,68 @@
+//===--------------------------------------------------------------------------------------------===
+// pool.h - Fixed worker pool with work-stealing tasks and parallel loops
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef POOL_H
+#define POOL_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// `worker` is the index of the thread running the task (0 to thread_count-1, 0 being the thread
+// that drives the pool). One thread runs one task at a time, so it can index per-worker scratch
+// space without locking, as long as the task doesn't wait on the pool while that space is in use.
+typedef void (*pool_task_fn)(void *arg, unsigned worker);
+typedef void (*pool_range_fn)(void *ctx, unsigned worker, unsigned begin, unsigned end);
+
+// A spawned task and its completion flag. Owned by the caller (usually on its stack), and must
+// stay alive until pool_join() returns: spawning never allocates.
+typedef struct {
+    pool_task_fn    fn;
+    void            *arg;
+    atomic_bool     done;
+} pool_future_t;
+
+// Each worker owns a deque of tasks: it pushes and pops its own at the bottom (newest first, which
+// keeps its working set warm), and idle workers steal the oldest, biggest tasks from the top.
+typedef struct {
+    pthread_mutex_t lock;
+    pool_future_t   **tasks;
+    unsigned        capacity;
+    unsigned        top;
+    unsigned        bottom;
+} pool_deque_t;
+
+typedef struct {
+    unsigned        thread_count;   // Including the thread that drives the pool.
+    pthread_t       *threads;
+    pool_deque_t    *deques;
+
+    pthread_mutex_t lock;
+    pthread_cond_t  wake;
+    atomic_uint     pending;        // Tasks sitting in a deque.
+    atomic_uint     sleepers;
+    bool            quit;
+} pool_t;
+
+// Starts `threads - 1` helper threads. 0 means one per online CPU. The thread that calls
+// pool_init() becomes worker 0; only one thread outside the pool should spawn or wait on it.
+void pool_init(pool_t *pool, unsigned threads);
+void pool_fini(pool_t *pool);
+
+// Queues fn(arg) on the calling worker's deque.
+void pool_spawn(pool_t *pool, pool_future_t *future, pool_task_fn fn, void *arg);
+// Waits for a spawned task, running other queued tasks in the meantime.
+void pool_join(pool_t *pool, pool_future_t *future);
+
+// Runs fn over [0, count) in chunks of at most `grain` indices and returns once all of it is done.
+// The range is split in halves recursively, so idle workers steal large pieces first. Can be
+// called from inside a task.
+void pool_for(pool_t *pool, unsigned count, unsigned grain, pool_range_fn fn, void *ctx);
+
+#endif /* end of include guard: POOL_H */
@@ -6,21 +6,26 @@
 // Licensed under the MIT License
 // =^•.•^=
 //===--------------------------------------------------------------------------------------------===
-#include "game.h"
+#include "printing.h"
+#include "profile.h"
 #include <assert.h>
-#include <ctype.h>
-#include <math.h>
 #include <term/colors.h>
 
-static void print_green(char c, FILE *out) {
+static void print_letter(const lang_t *lang, letter_t letter, FILE *out) {
+    char utf8[4];
+    unsigned len = lang_letter_utf8(lang, letter, true, utf8);
+    fwrite(utf8, 1, len, out);
+}
+
+static void print_green(const lang_t *lang, letter_t letter, FILE *out) {
     term_set_fg(out, TERM_GREEN);
-    fputc(c, out);
+    print_letter(lang, letter, out);
     term_set_fg(out, TERM_DEFAULT);
 }
 
-static void print_yellow(char c, FILE *out) {
+static void print_yellow(const lang_t *lang, letter_t letter, FILE *out) {
     term_set_fg(out, TERM_YELLOW);
-    fputc(c, out);
+    print_letter(lang, letter, out);
     term_set_fg(out, TERM_DEFAULT);
 }
 
@@ -28,37 +33,54 @@ static void print_yellow(char c, FILE *out) {
 //     fprintf(out, "\033[35m%c\033[0m", c);
 // }
 
-static void print_norm(char c, FILE *out) {
+static void print_norm(const lang_t *lang, letter_t letter, FILE *out) {
     term_set_fg(out, TERM_DEFAULT);
-    fputc(c, out);
+    print_letter(lang, letter, out);
 }
 
-static void print_alphabet_line(const letter_state_t alphabet[ALPHABET_SIZE], unsigned line, FILE *out) {
-    const unsigned letters_per_line = ceil((double)ALPHABET_SIZE/(double)MAX_GUESSES);
+// With several boards in play, a letter is only ruled out once every unsolved board rules it out.
+static letter_state_t combined_letter(const game_t *game, letter_t letter) {
+    if(game->board_count == 1) return board_letter(&game->boards[0], letter);
     
-    unsigned start = letters_per_line * line;
-    unsigned end = start + letters_per_line;
-    if(end > ALPHABET_SIZE) end = ALPHABET_SIZE;
+    letter_state_t state = GAME_LETTER_UNUSED;
+    bool all_no = true;
+    bool any_open = false;
+    
+    for(unsigned i = 0; i < game->board_count; ++i) {
+        const board_t *board = &game->boards[i];
+        if(board_is_solved(board)) continue;
+        any_open = true;
+        
+        letter_state_t board_state = board_letter(board, letter);
+        if(board_state != GAME_LETTER_NO) all_no = false;
+        if(board_state > state && board_state != GAME_LETTER_NO) state = board_state;
+    }
+    if(any_open && all_no) return GAME_LETTER_NO;
+    return state;
+}
 
+static void print_alphabet_range(const game_t *game, unsigned start, unsigned end, FILE *out) {
+    const lang_t *lang = game->lexicon->lang;
+    if(end > lang->size) end = lang->size;
+    
     term_set_bold(out, true);
     for(unsigned i = start; i < end; ++i) {
-        char letter = i + 'A';
-        switch(alphabet[i]) {
+        switch(combined_letter(game, i)) {
         case GAME_LETTER_UNUSED:
-            print_norm(letter, out);
+            print_norm(lang, i, out);
             break;
             
         case GAME_LETTER_NO:
-            // print_norm(tolower(letter), out);
-            print_norm(' ', out);
+            term_set_fg(out, TERM_DEFAULT);
+            fputc(' ', out);
             break;
             
         case GAME_LETTER_MISPLACED:
-            print_yellow(letter, out);
+            print_yellow(lang, i, out);
             break;
             
         case GAME_LETTER_RIGHT:
-            print_green(letter, out);
+            print_green(lang, i, out);
             break;
         }
         
@@ -69,32 +91,46 @@ static void print_alphabet_line(const letter_state_t alphabet[ALPHABET_SIZE], un
     term_style_reset(out);
 }
 
-static void print_guess(const guess_t *guess, FILE *out) {
+static void print_alphabet_line(const game_t *game, unsigned line, FILE *out) {
+    const lang_t *lang = game->lexicon->lang;
+    const unsigned letters_per_line = (lang->size + MAX_GUESSES - 1) / MAX_GUESSES;
+    
+    unsigned start = letters_per_line * line;
+    print_alphabet_range(game, start, start + letters_per_line, out);
+}
+
+static void print_guess(const lang_t *lang, word_t word, pattern_t pattern, FILE *out) {
+    letter_state_t check[WORD_SIZE];
+    pattern_decode(pattern, check);
+    
     term_set_bold(out, true);
     term_reverse(out);
     for(unsigned i = 0; i < WORD_SIZE; ++i) {
-        char c = toupper(guess->word[i]);
-        switch(guess->check[i]) {
+        letter_t letter = word_letter(word, i);
+        switch(check[i]) {
         case GAME_LETTER_RIGHT:
-            print_green(c, out);
+            print_green(lang, letter, out);
             break;
             
         case GAME_LETTER_MISPLACED:
-            print_yellow(c, out);
+            print_yellow(lang, letter, out);
             break;
             
         case GAME_LETTER_UNUSED:
         case GAME_LETTER_NO:
-            print_norm(c, out);
+            print_norm(lang, letter, out);
             break;
         }
     }
     term_style_reset(out);
 }
 
-static void print_emoji_guess(const guess_t *guess, FILE *out) {
+void print_emoji_pattern(pattern_t pattern, FILE *out) {
+    letter_state_t check[WORD_SIZE];
+    pattern_decode(pattern, check);
+    
     for(unsigned i = 0; i < WORD_SIZE; ++i) {
-        switch(guess->check[i]) {
+        switch(check[i]) {
         case GAME_LETTER_RIGHT:
             fprintf(out, "🟩");
             break;
@@ -109,7 +145,6 @@ static void print_emoji_guess(const guess_t *guess, FILE *out) {
             break;
         }
     }
-    printf("\n");
 }
 
 static void print_empty(FILE *out) {
@@ -124,9 +159,44 @@ static void print_emoji_empty(FILE *out) {
     }
 }
 
-void print_board(const game_t *game, bool show_emoji, FILE *out) {
-    fprintf(out, "\n----------\n");
-    for(unsigned i = 0; i < MAX_GUESSES; ++i) {
+// Whether a board shows a guess at turn `turn`: boards stop filling up once solved.
+static bool board_shows(const game_t *game, unsigned board, unsigned turn) {
+    if(turn >= game->guess_count) return false;
+    const board_t *b = &game->boards[board];
+    return !board_is_solved(b) || turn < b->solved_at;
+}
+
+#define BOARDS_PER_ROW (4)
+
+static void print_boards(const game_t *game, FILE *out) {
+    const lang_t *lang = game->lexicon->lang;
+    
+    for(unsigned first = 0; first < game->board_count; first += BOARDS_PER_ROW) {
+        unsigned last = first + BOARDS_PER_ROW;
+        if(last > game->board_count) last = game->board_count;
+        
+        for(unsigned i = 0; i < game->max_guesses; ++i) {
+            for(unsigned b = first; b < last; ++b) {
+                if(board_shows(game, b, i)) {
+                    print_guess(lang, game->guesses[i].word, game->guesses[i].patterns[b], out);
+                } else {
+                    print_empty(out);
+                }
+                fprintf(out, b < last-1 ? "  " : "\n");
+            }
+        }
+        fprintf(out, "\n");
+    }
+    
+    const unsigned half = (lang->size + 1) / 2;
+    print_alphabet_range(game, 0, half, out);
+    fprintf(out, "\n");
+    print_alphabet_range(game, half, lang->size, out);
+    fprintf(out, "\n\n");
+}
+
+static void print_single_board(const game_t *game, bool show_emoji, FILE *out) {
+    for(unsigned i = 0; i < game->max_guesses; ++i) {
         bool is_empty = i >= game->guess_count;
         const guess_t *guess = &game->guesses[i];
         
@@ -134,7 +204,7 @@ void print_board(const game_t *game, bool show_emoji, FILE *out) {
             if(is_empty) {
                 print_emoji_empty(out);
             } else {
-                print_emoji_guess(guess, out);
+                print_emoji_pattern(guess->patterns[0], out);
             }
             fprintf(out, "\t");
         }
@@ -142,20 +212,68 @@ void print_board(const game_t *game, bool show_emoji, FILE *out) {
         if(is_empty) {
             print_empty(out);
         } else {
-            print_guess(&game->guesses[i], out);
+            print_guess(game->lexicon->lang, guess->word, guess->patterns[0], out);
         }
         
         fprintf(out, "\t");
-        print_alphabet_line(game->alphabet, i, out);
+        print_alphabet_line(game, i, out);
         fprintf(out, "\n");
     }
     fprintf(out, "\n");
 }
 
+void print_board(const game_t *game, bool show_emoji, FILE *out) {
+    uint64_t start = prof_begin();
+    fprintf(out, "\n----------\n");
+    if(game->board_count > 1) {
+        print_boards(game, out);
+    } else {
+        print_single_board(game, show_emoji, out);
+    }
+    prof_end(PROF_RENDER, start);
+}
+
 void print_share_sheet(const game_t *game, FILE *out) {
-    fprintf(out, "Wordle %u %u/%u\n\n", game->seq, game->guess_count, MAX_GUESSES);
+    fprintf(out, "Wordle %u %u/%u\n\n", game->seq, game->guess_count, game->max_guesses);
     for(unsigned i = 0; i < game->guess_count; ++i) {
-        print_emoji_guess(&game->guesses[i], out);
+        for(unsigned b = 0; b < game->board_count; ++b) {
+            if(board_shows(game, b, i)) {
+                print_emoji_pattern(game->guesses[i].patterns[b], out);
+            } else {
+                print_emoji_empty(out);
+            }
+            if(b < game->board_count-1) fprintf(out, " ");
+        }
+        fprintf(out, "\n");
     }
 }
 
+void print_analysis(const analysis_t *analysis, const lexicon_t *lex, FILE *out) {
+    assert(analysis);
+    assert(lex);
+    char word[WORD_UTF8_SIZE];
+    
+    fprintf(out, "%-8s %8s %8s %9s %8s   %-8s %6s\n", "guess", "left", "after", "expected",
+            "gained", "best", "bits");
+    for(unsigned i = 0; i < analysis->turn_count; ++i) {
+        const analysis_turn_t *turn = &analysis->turns[i];
+        lang_decode(lex->lang, turn->guess, false, word);
+        fprintf(out, "%-8s %8u %8u %9.2f %8.2f   ", word, turn->before, turn->after,
+                turn->expected_bits, turn->gained_bits);
+        if(turn->best == turn->guess) {
+            fprintf(out, "%-8s %6s\n", "=", "");
+        } else {
+            lang_decode(lex->lang, turn->best, false, word);
+            fprintf(out, "%-8s %6.2f\n", word, turn->best_bits);
+        }
+    }
+    fprintf(out, "\nluck:   %+.2f bits\n", analysis->luck);
+    
+    fprintf(out, "solver:");
+    for(unsigned i = 0; i < analysis->solver_turn_count; ++i) {
+        lang_decode(lex->lang, analysis->solver_guesses[i], false, word);
+        fprintf(out, " %s", word);
+    }
+    fprintf(out, " (%s in %u)\n", analysis->solver_won ? "won" : "lost",
+            analysis->solver_turn_count);
+}
@@ -0,0 +1,23 @@
+//===--------------------------------------------------------------------------------------------===
+// printing.h - Terminal rendering of boards and share sheets
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef PRINTING_H
+#define PRINTING_H
+
+#include "analysis.h"
+#include "game.h"
+#include <stdio.h>
+
+// Not part of libjawc: these use termutils for colours.
+void print_board(const game_t *game, bool show_emoji, FILE *out);
+void print_share_sheet(const game_t *game, FILE *out);
+void print_analysis(const analysis_t *analysis, const lexicon_t *lex, FILE *out);
+// One share sheet row, without the newline.
+void print_emoji_pattern(pattern_t pattern, FILE *out);
+
+#endif /* end of include guard: PRINTING_H */
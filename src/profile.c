@@ -0,0 +1,154 @@
+//===--------------------------------------------------------------------------------------------===
+// profile.c - Instrumentation counters, summary and trace output
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "profile.h"
+#include "memory.h"
+#include <assert.h>
+#include <pthread.h>
+#include <time.h>
+
+#define MAX_TRACE_EVENTS (1u << 20)
+
+typedef struct {
+    prof_zone_t     zone;
+    unsigned        thread;
+    uint64_t        start;
+    uint64_t        duration;
+} trace_event_t;
+
+bool prof_enabled = false;
+prof_stat_t prof_counters[PROF_COUNTER_COUNT];
+
+static prof_stat_t zones[PROF_ZONE_COUNT];
+static uint64_t epoch = 0;
+static const char *trace_path = NULL;
+static trace_event_t *events = NULL;
+static unsigned event_count = 0;
+static unsigned event_capacity = 0;
+// Zones are recorded from any thread, so appending to the timeline takes a lock. Only runs with a
+// trace pay for it.
+static pthread_mutex_t event_lock = PTHREAD_MUTEX_INITIALIZER;
+static atomic_uint thread_count = 0;
+static _Thread_local unsigned thread_id = 0;     // 0 until the thread records its first event.
+
+static const char *zone_names[PROF_ZONE_COUNT] = {
+    [PROF_LEXICON_LOAD] = "lexicon_load",
+    [PROF_LEXICON_WAIT] = "lexicon_wait",
+    [PROF_CHECK] = "check",
+    [PROF_HINT] = "hint",
+    [PROF_STATS_LOAD] = "load_stats",
+    [PROF_STATS_SAVE] = "save_stats",
+    [PROF_RENDER] = "render",
+    [PROF_BOOK_BUILD] = "book_build",
+    [PROF_WAL_FLUSH] = "wal_flush",
+    [PROF_WAL_COMPACT] = "wal_compact",
+};
+
+static const char *counter_names[PROF_COUNTER_COUNT] = {
+    [PROF_HSET_PROBES] = "hset_contains probes",
+    [PROF_STATS_READ] = "stats bytes read",
+    [PROF_STATS_WRITTEN] = "stats bytes written",
+    [PROF_WAL_GROUP] = "wal records per write",
+};
+
+uint64_t prof_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void write_trace(const char *path) {
+    FILE *out = fopen(path, "wb");
+    if(!out) {
+        fprintf(stderr, "could not write trace to '%s'\n", path);
+        return;
+    }
+    
+    fprintf(out, "{\"traceEvents\": [\n");
+    for(unsigned i = 0; i < event_count; ++i) {
+        const trace_event_t *e = &events[i];
+        fprintf(out, "  {\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %u, "
+                "\"ts\": %.3f, \"dur\": %.3f}%s\n",
+                zone_names[e->zone], e->thread, (e->start - epoch) / 1e3, e->duration / 1e3,
+                i < event_count-1 ? "," : "");
+    }
+    fprintf(out, "], \"displayTimeUnit\": \"ns\"}\n");
+    fclose(out);
+}
+
+static void prof_shutdown(void) {
+    prof_report(stderr);
+    pthread_mutex_lock(&event_lock);
+    if(trace_path) write_trace(trace_path);
+    safe_free(events);
+    events = NULL;
+    event_count = event_capacity = 0;
+    pthread_mutex_unlock(&event_lock);
+}
+
+void prof_start(const char *path) {
+    if(prof_enabled) return;
+    prof_enabled = true;
+    trace_path = path;
+    epoch = prof_now();
+    atexit(prof_shutdown);
+}
+
+void prof_zone_end(prof_zone_t zone, uint64_t start) {
+    prof_zone_record(zone, start, prof_now());
+}
+
+void prof_stat_add(prof_stat_t *stat, uint64_t value) {
+    atomic_fetch_add_explicit(&stat->count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stat->total, value, memory_order_relaxed);
+    uint64_t max = atomic_load_explicit(&stat->max, memory_order_relaxed);
+    while(value > max && !atomic_compare_exchange_weak_explicit(&stat->max, &max, value,
+                                                                memory_order_relaxed,
+                                                                memory_order_relaxed)) {}
+}
+
+void prof_zone_record(prof_zone_t zone, uint64_t start, uint64_t end) {
+    assert(zone < PROF_ZONE_COUNT);
+    uint64_t duration = end - start;
+    prof_stat_add(&zones[zone], duration);
+    
+    if(!trace_path) return;
+    if(!thread_id) thread_id = atomic_fetch_add(&thread_count, 1) + 1;
+    pthread_mutex_lock(&event_lock);
+    if(event_count < MAX_TRACE_EVENTS) {
+        if(event_count + 1 > event_capacity) {
+            event_capacity = event_capacity ? event_capacity * 2 : 256;
+            events = safe_realloc(events, event_capacity * sizeof(trace_event_t));
+        }
+        events[event_count++] = (trace_event_t){zone, thread_id, start, duration};
+    }
+    pthread_mutex_unlock(&event_lock);
+}
+
+void prof_report(FILE *out) {
+    fprintf(out, "------\n");
+    fprintf(out, "%-22s %10s %12s %12s %12s\n", "zone", "calls", "total (us)", "mean (us)", "max (us)");
+    for(unsigned i = 0; i < PROF_ZONE_COUNT; ++i) {
+        uint64_t count = atomic_load(&zones[i].count), total = atomic_load(&zones[i].total);
+        if(!count) continue;
+        fprintf(out, "%-22s %10llu %12.1f %12.2f %12.1f\n", zone_names[i],
+                (unsigned long long)count, total / 1e3, total / 1e3 / count,
+                atomic_load(&zones[i].max) / 1e3);
+    }
+    
+    fprintf(out, "\n%-22s %10s %12s %12s %12s\n", "counter", "samples", "total", "mean", "max");
+    for(unsigned i = 0; i < PROF_COUNTER_COUNT; ++i) {
+        const prof_stat_t *stat = &prof_counters[i];
+        uint64_t count = atomic_load(&stat->count), total = atomic_load(&stat->total);
+        if(!count) continue;
+        fprintf(out, "%-22s %10llu %12llu %12.2f %12llu\n", counter_names[i],
+                (unsigned long long)count, (unsigned long long)total, (double)total / count,
+                (unsigned long long)atomic_load(&stat->max));
+    }
+    fprintf(out, "------\n");
+}
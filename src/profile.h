@@ -0,0 +1,76 @@
+//===--------------------------------------------------------------------------------------------===
+// profile.h - Lightweight hot-path instrumentation
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Instrumentation is always compiled in. While profiling is off, every hook is a single
+// predictable branch on `prof_enabled`. Hooks can be called from any thread: the batch modes run
+// lookups and games on pool workers.
+typedef enum {
+    PROF_LEXICON_LOAD,
+    PROF_LEXICON_WAIT,
+    PROF_CHECK,
+    PROF_HINT,
+    PROF_STATS_LOAD,
+    PROF_STATS_SAVE,
+    PROF_RENDER,
+    PROF_BOOK_BUILD,
+    PROF_WAL_FLUSH,
+    PROF_WAL_COMPACT,
+    PROF_ZONE_COUNT,
+} prof_zone_t;
+
+typedef enum {
+    PROF_HSET_PROBES,           // One sample per lookup: slots probed.
+    PROF_STATS_READ,            // One sample per load: bytes read.
+    PROF_STATS_WRITTEN,         // One sample per save: bytes written.
+    PROF_WAL_GROUP,             // One sample per log write: records committed together.
+    PROF_COUNTER_COUNT,
+} prof_counter_t;
+
+// Updated with relaxed atomics: each field is exact, but a report taken while other threads are
+// still recording may see them out of step.
+typedef struct {
+    _Atomic uint64_t count;
+    _Atomic uint64_t total;
+    _Atomic uint64_t max;
+} prof_stat_t;
+
+extern bool prof_enabled;
+extern prof_stat_t prof_counters[PROF_COUNTER_COUNT];
+
+// Turns profiling on. The summary is printed to stderr at exit, and a Chrome trace-event timeline
+// (chrome://tracing, Perfetto) is written to `trace_path` if it isn't NULL.
+void prof_start(const char *trace_path);
+void prof_report(FILE *out);
+
+uint64_t prof_now(void);
+void prof_zone_end(prof_zone_t zone, uint64_t start);
+// Records a zone timed elsewhere, e.g. on a helper thread. The trace puts it on the calling thread.
+void prof_zone_record(prof_zone_t zone, uint64_t start, uint64_t end);
+void prof_stat_add(prof_stat_t *stat, uint64_t value);
+
+static inline uint64_t prof_begin(void) {
+    return prof_enabled ? prof_now() : 0;
+}
+
+static inline void prof_end(prof_zone_t zone, uint64_t start) {
+    if(prof_enabled) prof_zone_end(zone, start);
+}
+
+static inline void prof_sample(prof_counter_t counter, uint64_t value) {
+    if(prof_enabled) prof_stat_add(&prof_counters[counter], value);
+}
+
+#endif /* end of include guard: PROFILE_H */
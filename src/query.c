@@ -0,0 +1,221 @@
+//===--------------------------------------------------------------------------------------------===
+// query.c - Wildcard and constraint queries over the dictionary
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "query.h"
+#include "cset.h"
+#include "memory.h"
+#include <assert.h>
+#include <string.h>
+
+static uint64_t all_letters(const lang_t *lang) {
+    return lang->size == 64 ? ~0ull : (1ull << lang->size) - 1;
+}
+
+// The bitset row for `letter` at `position`, or anywhere in the word for position WORD_SIZE.
+static unsigned row(const query_index_t *index, unsigned position, letter_t letter) {
+    return position * index->lex->lang->size + letter;
+}
+
+void query_index_init(query_index_t *index, const lexicon_t *lex) {
+    assert(index);
+    assert(lex);
+    lexicon_wait(lex);
+    index->lex = lex;
+    index->blocks = CSET_BLOCKS(lex->guess_count);
+    index->stride = (WORD_SIZE + 1) * lex->lang->size;
+    index->bits = safe_calloc(index->blocks * index->stride, sizeof(uint64_t));
+    
+    for(unsigned i = 0; i < lex->guess_count; ++i) {
+        uint64_t *block = index->bits + (i / 64) * index->stride;
+        uint64_t bit = 1ull << (i % 64);
+        for(unsigned p = 0; p < WORD_SIZE; ++p) {
+            letter_t letter = word_letter(lex->guesses[i], p);
+            block[row(index, p, letter)] |= bit;
+            block[row(index, WORD_SIZE, letter)] |= bit;
+        }
+    }
+}
+
+void query_index_fini(query_index_t *index) {
+    assert(index);
+    safe_free(index->bits);
+    index->bits = NULL;
+}
+
+void query_clear(const lang_t *lang, query_t *query) {
+    assert(lang);
+    assert(query);
+    for(unsigned p = 0; p < WORD_SIZE; ++p) {
+        query->allowed[p] = all_letters(lang);
+    }
+    query->required = 0;
+    query->answers_only = false;
+}
+
+static bool at_end(const char *str) {
+    return !*str || *str == ' ' || *str == '\t';
+}
+
+// Reads letters up to the end of the term, or up to '!'.
+static bool parse_letters(const lang_t *lang, const char **text, uint64_t *out) {
+    *out = 0;
+    while(!at_end(*text) && **text != '!') {
+        int letter = lang_index(lang, jawc_utf8_decode(text));
+        if(letter < 0) return false;
+        *out |= 1ull << letter;
+    }
+    return *out != 0;
+}
+
+static bool parse_pattern(const lang_t *lang, const char **text, query_t *query) {
+    for(unsigned p = 0; p < WORD_SIZE; ++p) {
+        if(at_end(*text)) return false;
+        if(**text == '?' || **text == '.') {
+            *text += 1;
+            continue;
+        }
+        int letter = lang_index(lang, jawc_utf8_decode(text));
+        if(letter < 0) return false;
+        query->allowed[p] &= 1ull << letter;
+    }
+    return at_end(*text);
+}
+
+static bool parse_term(const lang_t *lang, const char **text, query_t *query) {
+    uint64_t letters;
+    switch(**text) {
+    case '+':
+        *text += 1;
+        if(!parse_letters(lang, text, &letters)) return false;
+        query->required |= letters;
+        return at_end(*text);
+    
+    case '-':
+        *text += 1;
+        if(!parse_letters(lang, text, &letters)) return false;
+        for(unsigned p = 0; p < WORD_SIZE; ++p) {
+            query->allowed[p] &= ~letters;
+        }
+        return at_end(*text);
+    
+    case ':':
+        if(strncmp(*text, ":answers", 8) || !at_end(*text + 8)) return false;
+        query->answers_only = true;
+        *text += 8;
+        return true;
+    
+    default:
+        break;
+    }
+    
+    const char *start = *text;
+    if(parse_letters(lang, text, &letters) && **text == '!') {
+        *text += 1;
+        unsigned position = **text - '0';
+        if(position < 1 || position > WORD_SIZE) return false;
+        *text += 1;
+        query->allowed[position-1] &= ~letters;
+        return at_end(*text);
+    }
+    *text = start;
+    return parse_pattern(lang, text, query);
+}
+
+bool query_parse(const lang_t *lang, const char *text, query_t *query) {
+    assert(lang);
+    assert(text);
+    assert(query);
+    for(;;) {
+        while(*text == ' ' || *text == '\t') text += 1;
+        if(!*text) return true;
+        if(!parse_term(lang, &text, query)) return false;
+    }
+}
+
+// Each position is checked with whichever side of its letter set is smaller: the union of the
+// rows for the letters it allows, or the complement of the union for the ones it doesn't. A
+// position holds exactly one letter, so both give the same words.
+typedef struct {
+    unsigned        count;
+    bool            negate;
+    unsigned        rows[MAX_ALPHABET_SIZE];
+} position_plan_t;
+
+static void plan_position(const query_index_t *index, unsigned position, uint64_t allowed,
+                          position_plan_t *plan) {
+    unsigned size = index->lex->lang->size;
+    unsigned count = __builtin_popcountll(allowed);
+    plan->negate = count > size / 2;
+    plan->count = 0;
+    for(unsigned letter = 0; letter < size; ++letter) {
+        bool in = (allowed >> letter) & 1;
+        if(in != plan->negate) plan->rows[plan->count++] = row(index, position, letter);
+    }
+}
+
+unsigned query_run(const query_index_t *index, const query_t *query, unsigned offset,
+                   unsigned *out, unsigned cap) {
+    assert(index);
+    assert(query);
+    assert(out || !cap);
+    const lexicon_t *lex = index->lex;
+    unsigned size = lex->lang->size;
+    
+    // Letters ruled out everywhere are checked once against the rows for the whole word, rather
+    // than at every position.
+    uint64_t all = all_letters(lex->lang);
+    uint64_t banned = all;
+    for(unsigned p = 0; p < WORD_SIZE; ++p) {
+        banned &= ~query->allowed[p];
+    }
+    position_plan_t plans[WORD_SIZE];
+    unsigned plan_count = 0;
+    for(unsigned p = 0; p < WORD_SIZE; ++p) {
+        uint64_t allowed = query->allowed[p] | banned;
+        if(allowed == all) continue;
+        plan_position(index, p, allowed, &plans[plan_count++]);
+    }
+    unsigned required[MAX_ALPHABET_SIZE], excluded[MAX_ALPHABET_SIZE];
+    unsigned required_count = 0, excluded_count = 0;
+    for(unsigned letter = 0; letter < size; ++letter) {
+        unsigned anywhere = row(index, WORD_SIZE, letter);
+        if((query->required >> letter) & 1) required[required_count++] = anywhere;
+        if((banned >> letter) & 1) excluded[excluded_count++] = anywhere;
+    }
+    
+    unsigned words = query->answers_only ? lex->answer_count : lex->guess_count;
+    unsigned blocks = CSET_BLOCKS(words);
+    unsigned total = 0, written = 0;
+    for(unsigned b = 0; b < blocks; ++b) {
+        const uint64_t *block = index->bits + b * index->stride;
+        uint64_t match = b == blocks - 1 && words % 64 ? (1ull << (words % 64)) - 1 : ~0ull;
+        for(unsigned i = 0; i < plan_count && match; ++i) {
+            uint64_t any = 0;
+            for(unsigned r = 0; r < plans[i].count; ++r) {
+                any |= block[plans[i].rows[r]];
+            }
+            match &= plans[i].negate ? ~any : any;
+        }
+        for(unsigned i = 0; i < required_count && match; ++i) {
+            match &= block[required[i]];
+        }
+        for(unsigned i = 0; i < excluded_count && match; ++i) {
+            match &= ~block[excluded[i]];
+        }
+        
+        unsigned count = __builtin_popcountll(match);
+        if(written < cap && total + count > offset) {
+            unsigned seen = total;
+            for(uint64_t bits = match; bits && written < cap; bits &= bits - 1) {
+                if(seen++ >= offset) out[written++] = b * 64 + __builtin_ctzll(bits);
+            }
+        }
+        total += count;
+    }
+    return total;
+}
@@ -0,0 +1,54 @@
+//===--------------------------------------------------------------------------------------------===
+// query.h - Wildcard and constraint queries over the dictionary
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef QUERY_H
+#define QUERY_H
+
+#include "lexicon.h"
+
+// One bitset over the guess list per letter and position, and one per letter for words that
+// contain it anywhere. They are interleaved 64 words at a time, so a query reads everything it
+// needs for a block of words from one place, and never builds a bitset of its own.
+typedef struct {
+    const lexicon_t *lex;
+    unsigned        blocks;         // CSET_BLOCKS(guess_count).
+    unsigned        stride;         // Bitset words per block: (WORD_SIZE + 1) * lang->size.
+    uint64_t        *bits;
+} query_index_t;
+
+// Letter sets are bitmasks of letter indices, which MAX_ALPHABET_SIZE lets fit in 64 bits. Letter
+// counts aren't tracked: "contains e" matches words with one e or more.
+typedef struct {
+    uint64_t        allowed[WORD_SIZE]; // Letters each position may hold.
+    uint64_t        required;           // Letters that must be somewhere in the word.
+    bool            answers_only;       // Only match the answer list.
+} query_t;
+
+void query_index_init(query_index_t *index, const lexicon_t *lex);
+void query_index_fini(query_index_t *index);
+
+// A query that matches every valid guess.
+void query_clear(const lang_t *lang, query_t *query);
+
+// Adds the terms of `text`, separated by spaces, to `query`:
+//
+//  cr?n?       a pattern: letters, or ? (or .) for any letter.
+//  +ae         contains every one of the letters.
+//  -s          contains none of them.
+//  r!2         none of the letters at that position (1 to WORD_SIZE).
+//  :answers    only words from the answer list.
+//
+// Returns false, leaving `query` half-built, if a term doesn't parse.
+bool query_parse(const lang_t *lang, const char *text, query_t *query);
+
+// Counts the words that match, in guess list order, and writes the indices (into lex->guesses) of
+// matches `offset` to `offset + cap - 1` to `out`.
+unsigned query_run(const query_index_t *index, const query_t *query, unsigned offset,
+                   unsigned *out, unsigned cap);
+
+#endif /* end of include guard: QUERY_H */
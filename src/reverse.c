@@ -0,0 +1,225 @@
+//===--------------------------------------------------------------------------------------------===
+// reverse.c - Inferring the answer from share sheets
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "reverse.h"
+#include "memory.h"
+#include "pool.h"
+#include <assert.h>
+#include <string.h>
+
+// Guesses per task: enough rows of the matrix to amortise the task, few enough to balance.
+#define REVERSE_GRAIN   (256)
+
+typedef struct {
+    const lexicon_t *lex;
+    cset_t          *sets;          // PATTERN_COUNT per worker.
+    pattern_t       *patterns;      // answer_count per worker.
+} build_t;
+
+static void build_range(void *ctx, unsigned worker, unsigned begin, unsigned end) {
+    build_t *build = ctx;
+    const lexicon_t *lex = build->lex;
+    cset_t *sets = build->sets + worker * PATTERN_COUNT;
+    pattern_t *patterns = build->patterns + worker * lex->answer_count;
+    
+    for(unsigned g = begin; g < end; ++g) {
+        const pattern_t *row = patterns;
+        if(lex->patterns) {
+            row = lex->patterns + (size_t)g * lex->answer_count;
+        } else {
+            score_batch(lex->guesses[g], lex->answers, lex->answer_count, patterns);
+        }
+        for(unsigned a = 0; a < lex->answer_count; ++a) {
+            sets[row[a]].bits[a / 64] |= 1ull << (a % 64);
+        }
+    }
+}
+
+void reverse_init(reverse_t *rev, const lexicon_t *lex, unsigned threads) {
+    assert(rev && lex);
+    lexicon_wait(lex);
+    rev->lex = lex;
+    for(unsigned p = 0; p < PATTERN_COUNT; ++p) {
+        cset_init(&rev->reachable[p], lex->answer_count, false);
+    }
+    
+    pool_t pool;
+    pool_init(&pool, threads);
+    unsigned workers = pool.thread_count;
+    build_t build = {
+        .lex = lex,
+        .sets = safe_malloc(workers * PATTERN_COUNT * sizeof(cset_t)),
+        .patterns = safe_malloc(workers * lex->answer_count * sizeof(pattern_t)),
+    };
+    for(unsigned i = 0; i < workers * PATTERN_COUNT; ++i) {
+        cset_init(&build.sets[i], lex->answer_count, false);
+    }
+    
+    pool_for(&pool, lex->guess_count, REVERSE_GRAIN, build_range, &build);
+    pool_fini(&pool);
+    
+    // Workers only set bits, so their sets are merged without caring who scored which guess.
+    for(unsigned w = 0; w < workers; ++w) {
+        for(unsigned p = 0; p < PATTERN_COUNT; ++p) {
+            cset_union(&rev->reachable[p], &build.sets[w * PATTERN_COUNT + p]);
+        }
+    }
+    for(unsigned i = 0; i < workers * PATTERN_COUNT; ++i) {
+        cset_fini(&build.sets[i]);
+    }
+    safe_free(build.sets);
+    safe_free(build.patterns);
+}
+
+void reverse_fini(reverse_t *rev) {
+    assert(rev);
+    for(unsigned p = 0; p < PATTERN_COUNT; ++p) {
+        cset_fini(&rev->reachable[p]);
+    }
+}
+
+// Decodes one UTF-8 sequence, or returns 0 for anything malformed.
+static uint32_t next_codepoint(const unsigned char **cursor) {
+    const unsigned char *c = *cursor;
+    uint32_t cp;
+    unsigned extra;
+    if(c[0] < 0x80) {
+        cp = c[0];
+        extra = 0;
+    } else if((c[0] & 0xe0) == 0xc0) {
+        cp = c[0] & 0x1f;
+        extra = 1;
+    } else if((c[0] & 0xf0) == 0xe0) {
+        cp = c[0] & 0x0f;
+        extra = 2;
+    } else if((c[0] & 0xf8) == 0xf0) {
+        cp = c[0] & 0x07;
+        extra = 3;
+    } else {
+        return 0;
+    }
+    for(unsigned i = 1; i <= extra; ++i) {
+        if((c[i] & 0xc0) != 0x80) return 0;
+        cp = (cp << 6) | (c[i] & 0x3f);
+    }
+    *cursor = c + extra + 1;
+    return cp;
+}
+
+bool reverse_parse_row(const char *line, pattern_t *out) {
+    assert(line && out);
+    const unsigned char *cursor = (const unsigned char *)line;
+    letter_state_t check[WORD_SIZE];
+    unsigned cells = 0;
+    
+    while(*cursor && *cursor != '\n' && *cursor != '\r') {
+        uint32_t cp = next_codepoint(&cursor);
+        letter_state_t state;
+        switch(cp) {
+        case 0x1f7e9:   // 🟩
+            state = GAME_LETTER_RIGHT;
+            break;
+            
+        case 0x1f7e8:   // 🟨
+            state = GAME_LETTER_MISPLACED;
+            break;
+            
+        case 0x2b1b:    // ⬛
+        case 0x2b1c:    // ⬜, in light mode
+            state = GAME_LETTER_NO;
+            break;
+            
+        case 0xfe0f:    // Emoji presentation selector.
+            continue;
+            
+        case ' ':
+        case '\t':
+            if(cells == 0 || cells == WORD_SIZE) continue;
+            return false;
+            
+        default:
+            return false;
+        }
+        if(cells == WORD_SIZE) return false;
+        check[cells++] = state;
+    }
+    if(cells != WORD_SIZE) return false;
+    *out = pattern_encode(check);
+    return true;
+}
+
+void reverse_batch_init(reverse_batch_t *batch, const reverse_t *rev) {
+    assert(batch && rev);
+    memset(batch, 0, sizeof(*batch));
+    batch->rev = rev;
+    batch->votes = safe_calloc(rev->lex->answer_count, sizeof(unsigned));
+    cset_init(&batch->scratch, rev->lex->answer_count, true);
+}
+
+void reverse_batch_fini(reverse_batch_t *batch) {
+    assert(batch);
+    safe_free(batch->votes);
+    cset_fini(&batch->scratch);
+}
+
+void reverse_batch_add(reverse_batch_t *batch, const pattern_t *rows, unsigned count) {
+    assert(batch);
+    assert(rows || !count);
+    if(!count) return;
+    const reverse_t *rev = batch->rev;
+    
+    batch->grid_count += 1;
+    batch->row_count += count;
+    cset_copy(&batch->scratch, &rev->reachable[rows[0]]);
+    batch->rows[rows[0]] += 1;
+    for(unsigned i = 1; i < count; ++i) {
+        batch->rows[rows[i]] += 1;
+        cset_intersect(&batch->scratch, &rev->reachable[rows[i]]);
+    }
+    
+    const cset_t *set = &batch->scratch;
+    for(unsigned block = 0; block < CSET_BLOCKS(set->capacity); ++block) {
+        for(uint64_t bits = set->bits[block]; bits; bits &= bits - 1) {
+            batch->votes[block * 64 + __builtin_ctzll(bits)] += 1;
+        }
+    }
+}
+
+unsigned reverse_batch_best(const reverse_batch_t *batch, unsigned *out, unsigned cap) {
+    assert(batch);
+    assert(out || !cap);
+    unsigned answer_count = batch->rev->lex->answer_count;
+    
+    unsigned best = 0;
+    for(unsigned a = 0; a < answer_count; ++a) {
+        if(batch->votes[a] > best) best = batch->votes[a];
+    }
+    if(!best) return 0;
+    
+    unsigned count = 0;
+    for(unsigned a = 0; a < answer_count; ++a) {
+        if(batch->votes[a] != best) continue;
+        if(count < cap) out[count] = a;
+        count += 1;
+    }
+    return count;
+}
+
+unsigned reverse_explain(const reverse_t *rev, word_t answer, pattern_t pattern, word_t *out,
+                         unsigned cap) {
+    assert(rev);
+    assert(out || !cap);
+    const lexicon_t *lex = rev->lex;
+    unsigned count = 0;
+    for(unsigned g = 0; g < lex->guess_count; ++g) {
+        if(score_word(lex->guesses[g], answer) != pattern) continue;
+        if(count < cap) out[count] = lex->guesses[g];
+        count += 1;
+    }
+    return count;
+}
@@ -0,0 +1,55 @@
+//===--------------------------------------------------------------------------------------------===
+// reverse.h - Inferring the answer from share sheets
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef REVERSE_H
+#define REVERSE_H
+
+#include "cset.h"
+#include "lexicon.h"
+
+// The whole guess x answer pattern matrix, folded into what a share sheet can tell: for each
+// pattern, the answers that at least one valid guess gives it against. A grid is consistent with
+// an answer only if every one of its rows is reachable, so checking a grid is a handful of bitset
+// intersections, whatever the size of the dictionary.
+typedef struct {
+    const lexicon_t *lex;
+    cset_t          reachable[PATTERN_COUNT];
+} reverse_t;
+
+// Scores every guess against every answer, on `threads` threads (0 for one per CPU).
+void reverse_init(reverse_t *rev, const lexicon_t *lex, unsigned threads);
+void reverse_fini(reverse_t *rev);
+
+// Reads one row of a share sheet (five of 🟩, 🟨 and ⬛ or ⬜, as print_share_sheet() writes them).
+// Anything else on the line makes it not a row.
+bool reverse_parse_row(const char *line, pattern_t *out);
+
+// Grids from many players of the same puzzle. Each answer collects a vote from every grid it is
+// consistent with, so a few grids from another puzzle (or made up) don't wipe out the result.
+typedef struct {
+    const reverse_t *rev;
+    unsigned        grid_count;
+    unsigned        row_count;
+    unsigned        rows[PATTERN_COUNT];    // How many rows showed each pattern.
+    unsigned        *votes;                 // answer_count, one per answer.
+    cset_t          scratch;
+} reverse_batch_t;
+
+void reverse_batch_init(reverse_batch_t *batch, const reverse_t *rev);
+void reverse_batch_fini(reverse_batch_t *batch);
+void reverse_batch_add(reverse_batch_t *batch, const pattern_t *rows, unsigned count);
+// The answers with the most votes (consistent with every grid, if any are), as answer indices in
+// index order. Returns how many there are, of which at most `cap` are written.
+unsigned reverse_batch_best(const reverse_batch_t *batch, unsigned *out, unsigned cap);
+
+// The guesses that give `pattern` against `answer`. Returns how many there are, of which at most
+// `cap` are written to `out`.
+unsigned reverse_explain(const reverse_t *rev, word_t answer, pattern_t pattern, word_t *out,
+                         unsigned cap);
+
+#endif /* end of include guard: REVERSE_H */
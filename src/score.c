@@ -0,0 +1,118 @@
+//===--------------------------------------------------------------------------------------------===
+// score.c - Guess scoring implementation
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "score.h"
+#include <assert.h>
+#include <math.h>
+
+static const unsigned pow3[WORD_SIZE] = {1, 3, 9, 27, 81};
+
+pattern_t pattern_encode(const letter_state_t check[WORD_SIZE]) {
+    unsigned pattern = 0;
+    for(unsigned i = 0; i < WORD_SIZE; ++i) {
+        unsigned digit = check[i] == GAME_LETTER_UNUSED ? 0 : check[i] - GAME_LETTER_NO;
+        pattern += digit * pow3[i];
+    }
+    return pattern;
+}
+
+void pattern_decode(pattern_t pattern, letter_state_t check[WORD_SIZE]) {
+    for(unsigned i = 0; i < WORD_SIZE; ++i) {
+        check[i] = GAME_LETTER_NO + (pattern % 3);
+        pattern /= 3;
+    }
+}
+
+double pattern_entropy(const unsigned hist[PATTERN_COUNT], unsigned total) {
+    double sum = 0;
+    for(unsigned i = 0; i < PATTERN_COUNT; ++i) {
+        if(hist[i]) sum += hist[i] * log2(hist[i]);
+    }
+    return log2(total) - sum / total;
+}
+
+bool score_check(word_t guess, word_t word, letter_state_t check[WORD_SIZE]) {
+    unsigned noice_count = 0;
+    
+    letter_t letters[WORD_SIZE];
+    letter_t answer[WORD_SIZE];
+    word_unpack(guess, letters);
+    word_unpack(word, answer);
+    
+    for(unsigned i = 0; i < WORD_SIZE; ++i) {
+        check[i] = GAME_LETTER_NO;
+    }
+    
+    for(unsigned i = 0; i < WORD_SIZE; ++i) {
+        if(letters[i] == answer[i]) {
+            check[i] = GAME_LETTER_RIGHT;
+            answer[i] = LETTER_NONE;
+            noice_count += 1;
+        }
+    }
+    if(noice_count == WORD_SIZE) return true;
+    
+    for(unsigned i = 0; i < WORD_SIZE; ++i) {
+        if(check[i] == GAME_LETTER_RIGHT) continue;
+        for(unsigned j = 0; j < WORD_SIZE; ++j) {
+            if(answer[j] != letters[i]) continue;
+            answer[j] = LETTER_NONE;
+            check[i] = GAME_LETTER_MISPLACED;
+            break;
+        }
+    }
+    return false;
+}
+
+// Packed words are five 6-bit lanes. These masks pick out the lowest bit, the low five bits and the
+// top bit of every lane.
+#define LANE_LO     (0x01041041u)
+#define LANE_LOW5   (0x1f7df7dfu)
+#define LANE_HI     (0x20820820u)
+
+// Sets the top bit of every lane of `t` that is zero. Adding LANE_LOW5 to the low five bits sets a
+// lane's top bit if any of them is set, and can never carry into the next lane.
+static inline uint32_t zero_lanes(uint32_t t) {
+    uint32_t y = (t & LANE_LOW5) + LANE_LOW5;
+    return ~(y | t | LANE_LOW5) & LANE_HI;
+}
+
+void score_batch(word_t guess, const word_t *answers, unsigned count, pattern_t *out) {
+    assert(answers);
+    assert(out);
+    
+    uint32_t broadcast[WORD_SIZE];
+    for(unsigned i = 0; i < WORD_SIZE; ++i) {
+        broadcast[i] = word_letter(guess, i) * LANE_LO;
+    }
+    
+    for(unsigned k = 0; k < count; ++k) {
+        word_t answer = answers[k];
+        uint32_t right = zero_lanes(guess ^ answer);
+        if(right == LANE_HI) {
+            out[k] = PATTERN_WON;
+            continue;
+        }
+        
+        // Answer letters not already matched in place, as lane top bits. Each misplaced guess
+        // letter takes the leftmost one still available, which gets duplicates right.
+        uint32_t available = ~right & LANE_HI;
+        unsigned pattern = 0;
+        for(unsigned i = 0; i < WORD_SIZE; ++i) {
+            if(right & (1u << (i * LETTER_BITS + LETTER_BITS - 1))) {
+                pattern += 2 * pow3[i];
+                continue;
+            }
+            uint32_t match = zero_lanes(answer ^ broadcast[i]) & available;
+            if(!match) continue;
+            available &= ~(match & -match);
+            pattern += pow3[i];
+        }
+        out[k] = pattern;
+    }
+}
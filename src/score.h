@@ -0,0 +1,47 @@
+//===--------------------------------------------------------------------------------------------===
+// score.h - Guess scoring and feedback patterns
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef SCORE_H
+#define SCORE_H
+
+#include "lang.h"
+
+typedef enum {
+    GAME_LETTER_UNUSED,
+    GAME_LETTER_NO,
+    GAME_LETTER_MISPLACED,
+    GAME_LETTER_RIGHT,
+} letter_state_t;
+
+// A pattern is the feedback of a guess as a base-3 number, one digit per letter (first letter
+// least significant): 0 for no, 1 for misplaced, 2 for right.
+typedef uint8_t pattern_t;
+
+#define PATTERN_COUNT   (243)
+#define PATTERN_WON     (PATTERN_COUNT - 1)
+
+pattern_t pattern_encode(const letter_state_t check[WORD_SIZE]);
+void pattern_decode(pattern_t pattern, letter_state_t check[WORD_SIZE]);
+
+// Shannon entropy, in bits, of the pattern histogram of a guess over `total` candidates: how much
+// the feedback is expected to tell.
+double pattern_entropy(const unsigned hist[PATTERN_COUNT], unsigned total);
+
+// Reference scorer, written for clarity rather than speed. Every other scorer must agree with it.
+bool score_check(word_t guess, word_t answer, letter_state_t check[WORD_SIZE]);
+
+// Scores one guess against many answers in one pass.
+void score_batch(word_t guess, const word_t *answers, unsigned count, pattern_t *out);
+
+static inline pattern_t score_word(word_t guess, word_t answer) {
+    pattern_t pattern;
+    score_batch(guess, &answer, 1, &pattern);
+    return pattern;
+}
+
+#endif /* end of include guard: SCORE_H */
@@ -8,13 +8,14 @@
 //===--------------------------------------------------------------------------------------------===
 #include "set.h"
 #include "memory.h"
+#include "profile.h"
 #include <assert.h>
 #include <stdlib.h>
 #include <string.h>
 
 #define DEFAULT_CAPACITY (16)
 
-uint32_t hash_str(const char *str) {
+uint32_t jawc_hash_str(const char *str) {
     assert(str);
     //Fowler-Noll-Vo 1a hash
     //http://create.stephan-brumme.com/fnv-hash/
@@ -26,6 +27,18 @@ uint32_t hash_str(const char *str) {
     return hash;
 }
 
+uint32_t jawc_hash_word(word_t word) {
+    // murmur3 finaliser: packed words differ mostly in their high bits, which a plain modulo
+    // would throw away.
+    uint32_t hash = word;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+    return hash;
+}
+
 void hset_init(hset_t *hset) {
     assert(hset);
     hset->size = 0;
@@ -35,24 +48,19 @@ void hset_init(hset_t *hset) {
 
 void hset_fini(hset_t *hset) {
     assert(hset);
-    
-    for(size_t i = 0; i < hset->capacity; ++i) {
-        if(hset->entries[i]) safe_free(hset->entries[i]);
-    }
-    
     safe_free(hset->entries);
     hset_init(hset);
 }
 
-static bool do_insert(char **entries, size_t cap, char *entry) {
-    size_t idx = hash_str(entry) % cap;
+static bool do_insert(word_t *entries, size_t cap, word_t entry) {
+    size_t idx = jawc_hash_word(entry) % cap;
     size_t start_idx = idx;
     do {
-        if(!entries[idx]) {
+        if(entries[idx] == HSET_EMPTY) {
             entries[idx] = entry;
             return true;
         }
-        if(!strcmp(entries[idx], entry)) return false;
+        if(entries[idx] == entry) return false;
         idx = (idx + 1) % cap;
     } while(idx != start_idx);
     return false;
@@ -60,10 +68,11 @@ static bool do_insert(char **entries, size_t cap, char *entry) {
 
 static void grow(hset_t *hset) {
     size_t new_cap = hset->capacity ? hset->capacity * 2 : DEFAULT_CAPACITY;
-    char **new_entries = safe_calloc(new_cap, sizeof(char *));
+    word_t *new_entries = safe_malloc(new_cap * sizeof(word_t));
+    memset(new_entries, 0xff, new_cap * sizeof(word_t));
     
     for(size_t i = 0; i < hset->capacity; ++i) {
-        if(hset->entries[i]) {
+        if(hset->entries[i] != HSET_EMPTY) {
             do_insert(new_entries, new_cap, hset->entries[i]);
         }
     }
@@ -73,35 +82,35 @@ static void grow(hset_t *hset) {
     hset->capacity = new_cap;
 }
 
-void hset_insert(hset_t *hset, const char *str) {
+bool hset_insert(hset_t *hset, word_t word) {
     assert(hset);
-    assert(str);
+    assert(word != HSET_EMPTY);
     if(hset->size + 1 > hset->capacity * 0.7) {
         grow(hset);
     }
-    char *copy = safe_strdup(str);
-    if(do_insert(hset->entries, hset->capacity, copy)) {
-        hset->size += 1;
-    } else {
-        safe_free(copy);
-    }
+    if(!do_insert(hset->entries, hset->capacity, word)) return false;
+    hset->size += 1;
+    return true;
 }
 
-bool hset_contains(const hset_t *hset, const char *str) {
+bool hset_contains(const hset_t *hset, word_t word) {
     assert(hset);
-    assert(str);
+    if(!hset->capacity) return false;
     
-    uint32_t hash = hash_str(str);
-    size_t idx = hash % hset->capacity;
+    size_t idx = jawc_hash_word(word) % hset->capacity;
     size_t start_idx = idx;
+    unsigned probes = 1;
+    bool found = false;
     
-    while(hset->entries[idx]) {
-        uint32_t t_hash = hash_str(hset->entries[idx]);
-        if(t_hash == hash && !strcmp(str, hset->entries[idx])) {
-            return true;
+    while(hset->entries[idx] != HSET_EMPTY) {
+        if(hset->entries[idx] == word) {
+            found = true;
+            break;
         }
         idx = (idx + 1) % hset->capacity;
+        probes += 1;
         if(idx == start_idx) break;
     }
-    return false;
+    prof_sample(PROF_HSET_PROBES, probes);
+    return found;
 }
@@ -9,23 +9,27 @@
 #ifndef SET_H
 #define SET_H
 
+#include "lang.h"
 #include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
+#define HSET_EMPTY (WORD_NONE)
+
 typedef struct {
     size_t size;
     size_t capacity;
-    char **entries;
+    word_t *entries;
 } hset_t;
 
-uint32_t hash_str(const char *str);
+uint32_t jawc_hash_str(const char *str);
+uint32_t jawc_hash_word(word_t word);
 
 void hset_init(hset_t *hset);
 void hset_fini(hset_t *hset);
 
-void hset_insert(hset_t *hset, const char *str);
-bool hset_contains(const hset_t *hset, const char *str);
+bool hset_insert(hset_t *hset, word_t word);
+bool hset_contains(const hset_t *hset, word_t word);
 
 #endif /* end of include guard: SET_H */
 
@@ -0,0 +1,434 @@
+//===--------------------------------------------------------------------------------------------===
+// solver.c - Candidate tracking and hint implementation
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "solver.h"
+#include "memory.h"
+#include "profile.h"
+#include <assert.h>
+#include <string.h>
+
+void solver_init(solver_t *solver, const game_t *game) {
+    assert(solver);
+    assert(game);
+    
+    unsigned capacity = game->lexicon->answer_count;
+    solver->game = game;
+    solver->board_count = game->board_count;
+    solver->seen = 0;
+    solver->book = NULL;
+    for(unsigned i = 0; i < game->board_count; ++i) {
+        cset_init(&solver->boards[i], capacity, true);
+    }
+    cset_init(&solver->all, capacity, true);
+}
+
+void solver_fini(solver_t *solver) {
+    assert(solver);
+    for(unsigned i = 0; i < solver->board_count; ++i) {
+        cset_fini(&solver->boards[i]);
+    }
+    cset_fini(&solver->all);
+    solver->game = NULL;
+}
+
+void solver_reset(solver_t *solver) {
+    assert(solver);
+    assert(solver->game);
+    solver->seen = 0;
+    for(unsigned i = 0; i < solver->game->board_count; ++i) {
+        cset_fill(&solver->boards[i]);
+    }
+    cset_fill(&solver->all);
+}
+
+void solver_use_book(solver_t *solver, const book_t *book) {
+    assert(solver);
+    solver->book = book;
+}
+
+void solver_update(solver_t *solver) {
+    assert(solver);
+    const game_t *game = solver->game;
+    const word_t *answers = game->lexicon->answers;
+    
+    for(; solver->seen < game->guess_count; ++solver->seen) {
+        const guess_t *guess = &game->guesses[solver->seen];
+        for(unsigned b = 0; b < game->board_count; ++b) {
+            cset_filter(&solver->boards[b], answers, guess->word, guess->patterns[b]);
+        }
+    }
+    
+    // The union is what hints actually score against: boards share most of their candidates
+    // early on, so each distinct answer is only scored once per guess.
+    memset(solver->all.bits, 0, CSET_BLOCKS(solver->all.capacity) * sizeof(uint64_t));
+    solver->all.size = 0;
+    for(unsigned b = 0; b < game->board_count; ++b) {
+        if(board_is_solved(&game->boards[b])) continue;
+        cset_union(&solver->all, &solver->boards[b]);
+    }
+}
+
+// Everything a hint needs to score guesses: the distinct candidates of the boards still open, and
+// which of those boards each one belongs to.
+typedef struct {
+    const lexicon_t *lex;
+    unsigned        open_count;
+    const cset_t    *sets[MAX_BOARDS];
+    unsigned        count;
+    unsigned        *indices;
+    word_t          *words;
+    uint8_t         *masks;
+    pattern_t       *patterns;
+} hint_ctx_t;
+
+// Sets up `ctx`, unless the hint is obvious: then returns it and there is nothing to free.
+static word_t hint_prepare(solver_t *solver, hint_ctx_t *ctx) {
+    const game_t *game = solver->game;
+    const lexicon_t *lex = game->lexicon;
+    solver_update(solver);
+    
+    ctx->lex = lex;
+    ctx->open_count = 0;
+    for(unsigned b = 0; b < game->board_count; ++b) {
+        if(board_is_solved(&game->boards[b])) continue;
+        const cset_t *set = &solver->boards[b];
+        if(!set->size) continue;
+        
+        // A board down to one candidate is a guaranteed solve; nothing scores better than that.
+        if(set->size == 1) {
+            unsigned idx;
+            cset_list(set, &idx);
+            return lex->answers[idx];
+        }
+        ctx->sets[ctx->open_count++] = set;
+    }
+    if(!ctx->open_count) return lex->answers[0];
+    
+    unsigned count = solver->all.size;
+    ctx->count = count;
+    ctx->indices = safe_malloc(count * sizeof(unsigned));
+    ctx->words = safe_malloc(count * sizeof(word_t));
+    ctx->masks = safe_malloc(count);
+    ctx->patterns = safe_malloc(count);
+    
+    cset_list(&solver->all, ctx->indices);
+    for(unsigned i = 0; i < count; ++i) {
+        ctx->words[i] = lex->answers[ctx->indices[i]];
+        ctx->masks[i] = 0;
+        for(unsigned j = 0; j < ctx->open_count; ++j) {
+            if(cset_has(ctx->sets[j], ctx->indices[i])) ctx->masks[i] |= 1u << j;
+        }
+    }
+    return WORD_NONE;
+}
+
+static void hint_release(hint_ctx_t *ctx) {
+    safe_free(ctx->indices);
+    safe_free(ctx->words);
+    safe_free(ctx->masks);
+    safe_free(ctx->patterns);
+}
+
+// Scores `guess_idx` against `count` of the candidates (all of them, or a sample). Each board's
+// pattern histogram is filled into `hist`.
+static void hint_histogram(const hint_ctx_t *ctx, unsigned guess_idx, const word_t *words,
+                           const uint8_t *masks, unsigned count,
+                           unsigned hist[MAX_BOARDS][PATTERN_COUNT]) {
+    const lexicon_t *lex = ctx->lex;
+    if(lex->patterns && words == ctx->words) {
+        // The first `count` candidates, which `indices` has the answer indices of.
+        const pattern_t *row = lex->patterns + (size_t)guess_idx * lex->answer_count;
+        for(unsigned i = 0; i < count; ++i) {
+            ctx->patterns[i] = row[ctx->indices[i]];
+        }
+    } else {
+        score_batch(lex->guesses[guess_idx], words, count, ctx->patterns);
+    }
+    memset(hist, 0, ctx->open_count * sizeof(hist[0]));
+    for(unsigned i = 0; i < count; ++i) {
+        for(uint8_t mask = masks[i]; mask; mask &= mask - 1) {
+            hist[__builtin_ctz(mask)][ctx->patterns[i]] += 1;
+        }
+    }
+}
+
+// Information gained on each board, plus the odds of solving one outright, which breaks ties in
+// favour of guesses that can still win.
+static double hint_score(const hint_ctx_t *ctx, unsigned guess_idx) {
+    unsigned hist[MAX_BOARDS][PATTERN_COUNT];
+    hint_histogram(ctx, guess_idx, ctx->words, ctx->masks, ctx->count, hist);
+    
+    double score = 0;
+    for(unsigned j = 0; j < ctx->open_count; ++j) {
+        const cset_t *set = ctx->sets[j];
+        score += pattern_entropy(hist[j], set->size);
+        if(guess_idx < ctx->lex->answer_count && cset_has(set, guess_idx)) {
+            score += 1.0 / set->size;
+        }
+    }
+    return score;
+}
+
+static word_t find_hint(solver_t *solver) {
+    hint_ctx_t ctx;
+    word_t obvious = hint_prepare(solver, &ctx);
+    if(obvious != WORD_NONE) return obvious;
+    
+    bool full_search = ctx.count <= HINT_FULL_SEARCH_LIMIT;
+    unsigned pool_size = full_search ? ctx.lex->guess_count : ctx.count;
+    
+    word_t best = ctx.words[0];
+    double best_score = -1;
+    for(unsigned g = 0; g < pool_size; ++g) {
+        unsigned guess_idx = full_search ? g : ctx.indices[g];
+        double score = hint_score(&ctx, guess_idx);
+        if(score > best_score) {
+            best_score = score;
+            best = ctx.lex->guesses[guess_idx];
+        }
+    }
+    
+    hint_release(&ctx);
+    return best;
+}
+
+word_t solver_hint(solver_t *solver) {
+    assert(solver);
+    lexicon_wait(solver->game->lexicon);
+    uint64_t start = prof_begin();
+    word_t hint = solver->book ? book_hint(solver->book, solver->game) : WORD_NONE;
+    if(hint == WORD_NONE) hint = find_hint(solver);
+    prof_end(PROF_HINT, start);
+    return hint;
+}
+
+typedef struct {
+    double          score;
+    unsigned        slot;           // Index into the guess pool.
+} ranked_t;
+
+// The best few guesses seen so far, best first. Most guesses don't make the cut and cost one
+// comparison, which is cheaper than sorting the whole pool.
+typedef struct {
+    unsigned        size;
+    unsigned        capacity;
+    ranked_t        items[HINT_SHORTLIST];
+} shortlist_t;
+
+static void shortlist_add(shortlist_t *list, ranked_t item) {
+    if(list->size == list->capacity && item.score <= list->items[list->size-1].score) return;
+    unsigned i = list->size < list->capacity ? list->size++ : list->size - 1;
+    for(; i > 0 && list->items[i-1].score < item.score; --i) {
+        list->items[i] = list->items[i-1];
+    }
+    list->items[i] = item;
+}
+
+typedef struct {
+    uint64_t        deadline;
+    const atomic_bool *cancel;
+} budget_t;
+
+static bool expired(const budget_t *budget, uint64_t deadline) {
+    if(budget->cancel && atomic_load_explicit(budget->cancel, memory_order_relaxed)) return true;
+    return prof_now() >= deadline;
+}
+
+// Coarse pass: expected group size (lower is better) against an evenly spread sample of the
+// candidates, with no logarithms. Only decides what gets scored properly first. Returns how much
+// of the pool it got through.
+static unsigned rank_sampled(const hint_ctx_t *ctx, const unsigned *pool, unsigned pool_size,
+                             shortlist_t *list, const budget_t *budget, uint64_t deadline) {
+    unsigned sample = ctx->count < HINT_SAMPLE_SIZE ? ctx->count : HINT_SAMPLE_SIZE;
+    word_t words[HINT_SAMPLE_SIZE];
+    uint8_t masks[HINT_SAMPLE_SIZE];
+    pattern_t patterns[HINT_SAMPLE_SIZE];
+    double weights[MAX_BOARDS] = {0};
+    for(unsigned i = 0; i < sample; ++i) {
+        unsigned at = (uint64_t)i * ctx->count / sample;
+        words[i] = ctx->words[at];
+        masks[i] = ctx->masks[at];
+        for(uint8_t mask = masks[i]; mask; mask &= mask - 1) {
+            weights[__builtin_ctz(mask)] += 1;
+        }
+    }
+    for(unsigned j = 0; j < ctx->open_count; ++j) {
+        if(weights[j]) weights[j] = 1.0 / weights[j];
+    }
+    
+    // Sums of squares are kept as the histogram fills, and only the cells used are cleared after,
+    // so a guess costs O(sample) rather than O(patterns).
+    unsigned hist[MAX_BOARDS][PATTERN_COUNT] = {{0}};
+    unsigned slot = 0;
+    for(; slot < pool_size; ++slot) {
+        if(slot % 64 == 0 && expired(budget, deadline)) break;
+        score_batch(ctx->lex->guesses[pool[slot]], words, sample, patterns);
+        
+        unsigned squares[MAX_BOARDS] = {0};
+        for(unsigned i = 0; i < sample; ++i) {
+            for(uint8_t mask = masks[i]; mask; mask &= mask - 1) {
+                unsigned *cell = &hist[__builtin_ctz(mask)][patterns[i]];
+                squares[__builtin_ctz(mask)] += 2 * *cell + 1;
+                *cell += 1;
+            }
+        }
+        double spread = 0;
+        for(unsigned i = 0; i < sample; ++i) {
+            for(uint8_t mask = masks[i]; mask; mask &= mask - 1) {
+                hist[__builtin_ctz(mask)][patterns[i]] = 0;
+            }
+        }
+        for(unsigned j = 0; j < ctx->open_count; ++j) {
+            spread += squares[j] * weights[j];
+        }
+        shortlist_add(list, (ranked_t){-spread, slot});
+    }
+    return slot;
+}
+
+// Lookahead, single board only: information from the guess, plus the expected information from
+// the best follow-up among each group's own candidates.
+static double lookahead(const hint_ctx_t *ctx, unsigned guess_idx, const budget_t *budget,
+                        bool *complete) {
+    const lexicon_t *lex = ctx->lex;
+    unsigned count = ctx->count;
+    unsigned hist[MAX_BOARDS][PATTERN_COUNT];
+    hint_histogram(ctx, guess_idx, ctx->words, ctx->masks, count, hist);
+    double score = pattern_entropy(hist[0], count);
+    if(guess_idx < lex->answer_count && cset_has(ctx->sets[0], guess_idx)) score += 1.0 / count;
+    
+    // Group the candidates by pattern.
+    unsigned start[PATTERN_COUNT+1];
+    start[0] = 0;
+    for(unsigned p = 0; p < PATTERN_COUNT; ++p) {
+        start[p+1] = start[p] + hist[0][p];
+    }
+    word_t *grouped = safe_malloc(count * sizeof(word_t));
+    pattern_t *patterns = safe_malloc(count);
+    unsigned next[PATTERN_COUNT];
+    memcpy(next, start, sizeof(next));
+    for(unsigned i = 0; i < count; ++i) {
+        grouped[next[ctx->patterns[i]]++] = ctx->words[i];
+    }
+    
+    *complete = true;
+    for(unsigned p = 0; p < PATTERN_WON && *complete; ++p) {
+        unsigned size = start[p+1] - start[p];
+        if(!size) continue;
+        if(size == 1) {
+            // Solved next turn for sure: no bits left to gain, plus the 1 / size win bonus that
+            // larger groups get below.
+            score += 1.0 / count;
+            continue;
+        }
+        
+        double best = 0;
+        unsigned group[PATTERN_COUNT];
+        for(unsigned i = 0; i < size && *complete; ++i) {
+            if(i % 16 == 0 && expired(budget, budget->deadline)) *complete = false;
+            score_batch(grouped[start[p] + i], grouped + start[p], size, patterns);
+            memset(group, 0, sizeof(group));
+            for(unsigned j = 0; j < size; ++j) {
+                group[patterns[j]] += 1;
+            }
+            double bits = pattern_entropy(group, size) + 1.0 / size;
+            if(bits > best) best = bits;
+        }
+        score += best * size / count;
+    }
+    
+    safe_free(grouped);
+    safe_free(patterns);
+    return score;
+}
+
+word_t solver_hint_within(solver_t *solver, uint64_t budget_ns, const atomic_bool *cancel,
+                          hint_stage_t *stage) {
+    assert(solver);
+    budget_t budget = {budget_ns ? prof_now() + budget_ns : UINT64_MAX, cancel};
+    hint_stage_t reached = HINT_STAGE_EXACT;
+    lexicon_wait(solver->game->lexicon);
+    uint64_t start = prof_begin();
+    
+    word_t hint = solver->book ? book_hint(solver->book, solver->game) : WORD_NONE;
+    hint_ctx_t ctx;
+    if(hint != WORD_NONE) {
+        reached = HINT_STAGE_BOOK;
+    } else {
+        hint = hint_prepare(solver, &ctx);
+    }
+    if(hint != WORD_NONE) {
+        prof_end(PROF_HINT, start);
+        if(stage) *stage = reached;
+        return hint;
+    }
+    
+    // Any candidate is a legal, if unambitious, answer from the start.
+    const lexicon_t *lex = ctx.lex;
+    hint = ctx.words[0];
+    reached = HINT_STAGE_NONE;
+    
+    // Candidates first, since they might win outright, then every other valid guess.
+    unsigned *pool = safe_malloc(lex->guess_count * sizeof(unsigned));
+    unsigned pool_size = 0;
+    for(unsigned i = 0; i < ctx.count; ++i) {
+        pool[pool_size++] = ctx.indices[i];
+    }
+    for(unsigned g = 0; g < lex->guess_count; ++g) {
+        if(g < lex->answer_count && cset_has(&solver->all, g)) continue;
+        pool[pool_size++] = g;
+    }
+    
+    // The coarse pass gets half the budget at most, so there is always time to score its picks.
+    uint64_t coarse_deadline = budget_ns ? prof_now() + budget_ns / 2 : UINT64_MAX;
+    shortlist_t picks = {.capacity = HINT_SHORTLIST};
+    unsigned sampled = rank_sampled(&ctx, pool, pool_size, &picks, &budget, coarse_deadline);
+    if(picks.size) hint = lex->guesses[pool[picks.items[0].slot]];
+    if(sampled == pool_size) reached = HINT_STAGE_SAMPLED;
+    
+    // Exact entropy, the coarse pass's picks first, then the rest of the pool in order.
+    uint8_t *done = safe_calloc(pool_size, 1);
+    shortlist_t best = {.capacity = HINT_LOOKAHEAD_WIDTH};
+    unsigned scored = 0;
+    for(unsigned i = 0; i < picks.size + pool_size; ++i) {
+        unsigned slot = i < picks.size ? picks.items[i].slot : i - picks.size;
+        if(done[slot]) continue;
+        if(expired(&budget, budget.deadline)) break;
+        done[slot] = 1;
+        scored += 1;
+        shortlist_add(&best, (ranked_t){hint_score(&ctx, pool[slot]), slot});
+    }
+    if(best.size) hint = lex->guesses[pool[best.items[0].slot]];
+    if(scored == pool_size) reached = HINT_STAGE_EXACT;
+    
+    // Lookahead on the few best. Only a complete pass, over an exact ranking, can overrule it.
+    if(reached == HINT_STAGE_EXACT && ctx.open_count == 1 && best.size > 1) {
+        double best_lookahead = -1;
+        word_t best_word = hint;
+        bool complete = true;
+        for(unsigned r = 0; r < best.size && complete; ++r) {
+            unsigned guess_idx = pool[best.items[r].slot];
+            double score = lookahead(&ctx, guess_idx, &budget, &complete);
+            if(complete && score > best_lookahead) {
+                best_lookahead = score;
+                best_word = lex->guesses[guess_idx];
+            }
+        }
+        if(complete) {
+            hint = best_word;
+            reached = HINT_STAGE_LOOKAHEAD;
+        }
+    }
+    
+    safe_free(pool);
+    safe_free(done);
+    hint_release(&ctx);
+    prof_end(PROF_HINT, start);
+    if(stage) *stage = reached;
+    return hint;
+}
@@ -0,0 +1,67 @@
+//===--------------------------------------------------------------------------------------------===
+// solver.h - Candidate tracking and hints
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include "book.h"
+#include "game.h"
+#include "cset.h"
+#include <stdatomic.h>
+#include <stdint.h>
+
+// Past this many remaining candidates (across all boards), hints only consider guesses that
+// could still be an answer; below it, every valid guess is tried.
+#define HINT_FULL_SEARCH_LIMIT  (256)
+// Budgeted hints: candidates sampled by the coarse pass, guesses it hands on to be scored first,
+// and guesses given a lookahead.
+#define HINT_SAMPLE_SIZE        (96)
+#define HINT_SHORTLIST          (64)
+#define HINT_LOOKAHEAD_WIDTH    (8)
+
+// How far a budgeted hint got before it ran out of time, from least to most thorough.
+typedef enum {
+    HINT_STAGE_NONE,                // The first remaining candidate, unscored.
+    HINT_STAGE_SAMPLED,             // Every guess ranked against a sample of the candidates.
+    HINT_STAGE_EXACT,               // Every valid guess scored by exact entropy.
+    HINT_STAGE_LOOKAHEAD,           // The best few re-ranked by the guess after next.
+    HINT_STAGE_BOOK,                // Straight from the opening book.
+} hint_stage_t;
+
+typedef struct {
+    const game_t    *game;
+    // Copied from the game, which may already be gone by solver_fini(): the arena's strategies
+    // only drop their solver when the next game starts.
+    unsigned        board_count;
+    unsigned        seen;
+    cset_t          boards[MAX_BOARDS];
+    cset_t          all;
+    const book_t    *book;          // Optional, answers the first two hints when it can.
+} solver_t;
+
+void solver_init(solver_t *solver, const game_t *game);
+void solver_fini(solver_t *solver);
+// Forgets every guess, for a game that has been through game_reset(). Keeps the book.
+void solver_reset(solver_t *solver);
+// `book` must outlive the solver.
+void solver_use_book(solver_t *solver, const book_t *book);
+
+// Applies any guesses submitted to the game since the last update.
+void solver_update(solver_t *solver);
+
+// Best next guess by total expected information across the boards still in play.
+word_t solver_hint(solver_t *solver);
+
+// Anytime version of solver_hint(): refines its answer in stages (a coarse ranking against a
+// sample, then exact entropy in that order, then a lookahead on a single board) and returns the
+// best guess so far once `budget_ns` has passed or `*cancel` is set. Either may be 0/NULL.
+// `stage`, if not NULL, receives the last stage that ran to completion.
+word_t solver_hint_within(solver_t *solver, uint64_t budget_ns, const atomic_bool *cancel,
+                          hint_stage_t *stage);
+
+#endif /* end of include guard: SOLVER_H */
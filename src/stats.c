@@ -6,27 +6,18 @@
 // Licensed under the MIT License
 // =^•.•^=
 //===--------------------------------------------------------------------------------------------===
-#include "game.h"
+#include "stats.h"
 #include "memory.h"
+#include "profile.h"
 #include <stdio.h>
 #include <unistd.h>
 
 #define JSMN_STRICT
 #define JSMN_NEXT_SIBLING
+// Keeps jsmn out of libjawc's symbols, for embedders that link their own copy.
+#define JSMN_STATIC
 #include "jsmn.h"
 
-typedef struct {
-    unsigned won;
-    unsigned played;
-    unsigned cur_streak;
-    unsigned max_streak;
-    
-    unsigned last_won;
-    unsigned last_played;
-    
-    unsigned guesses[MAX_GUESSES];
-} stats_t;
-
 static void write_json_i(FILE *out, const char *key, int num) {
     fprintf(out, "\"%s\": %d", key, num);
 }
@@ -135,7 +126,7 @@ static int json_get_vi(const json_t *json, const char *path, int *out, unsigned
     return written;
 }
 
-bool load_stats(stats_t *stats, const char *path) {
+static bool read_stats(stats_t *stats, const char *path) {
     FILE *in = fopen(path, "rb");
     if(!in) return false;
     fseek(in, 0, SEEK_END);
@@ -146,6 +137,7 @@ bool load_stats(stats_t *stats, const char *path) {
     fread(json, json_len, 1, in);
     json[json_len] = '\0';
     fclose(in);
+    prof_sample(PROF_STATS_READ, json_len);
     
     int count = 0;
     int cap = 0;
@@ -155,13 +147,13 @@ bool load_stats(stats_t *stats, const char *path) {
     
     do {
         cap = cap ? cap * 2 : 50;
-        tok = safe_calloc(cap, sizeof(*tok));
+        tok = safe_realloc(tok, cap * sizeof(*tok));
         count = jsmn_parse(&parser, json, json_len, tok, cap);
     } while(count == JSMN_ERROR_NOMEM);
     
     if(count <= 0) {
-        if(tok) free(tok);
-        if(json) free(json);
+        safe_free(tok);
+        safe_free(json);
         return false;
     }
     
@@ -180,17 +172,24 @@ bool load_stats(stats_t *stats, const char *path) {
     if(!json_get_i(&dict, "last_won", (int *)&stats->last_won)) goto errout;
     if(!json_get_i(&dict, "last_played", (int *)&stats->last_played)) goto errout;
     if(json_get_vi(&dict, "guesses", (int *)&stats->guesses, MAX_GUESSES) != MAX_GUESSES) goto errout;
-    free(tok);
-    free(json);
+    safe_free(tok);
+    safe_free(json);
     return true;
     
 errout:
-    free(tok);
-    free(json);
+    safe_free(tok);
+    safe_free(json);
     return false;
 }
 
-bool save_stats(const stats_t *stats, const char *path) {
+bool load_stats(stats_t *stats, const char *path) {
+    uint64_t start = prof_begin();
+    bool ok = read_stats(stats, path);
+    prof_end(PROF_STATS_LOAD, start);
+    return ok;
+}
+
+static bool write_stats(const stats_t *stats, const char *path) {
     FILE *out = fopen(path, "wb");
     if(!out) return false;
     
@@ -204,10 +203,18 @@ bool save_stats(const stats_t *stats, const char *path) {
     write_json_vi(out, "guesses", (const int *)stats->guesses, MAX_GUESSES);
     fprintf(out, "}\n");
     
+    prof_sample(PROF_STATS_WRITTEN, ftell(out));
     fclose(out);
     return true;
 }
 
+bool save_stats(const stats_t *stats, const char *path) {
+    uint64_t start = prof_begin();
+    bool ok = write_stats(stats, path);
+    prof_end(PROF_STATS_SAVE, start);
+    return ok;
+}
+
 static const char* history_path() {
     const char* home = getenv("HOME");
     if(!home) return ".wordle_history";
@@ -248,8 +255,9 @@ static const char* history_path() {
 //         stats->freq[entry->guess_count - 1] += 1;
 //     }
 // }
-static void add_game_stats(stats_t *stats, const game_t *game) {
+void add_game_stats(stats_t *stats, const game_t *game) {
     if(game->seq == stats->last_played) return;
+    if(game->board_count != 1) return;
     stats->played += 1;
     if(game->won) {
         stats->won += 1;
@@ -281,7 +289,6 @@ static void print_bar(unsigned size) {
 }
 
 void game_stats(const game_t *game) {
-    (void)safe_strdup;
     const char *path = history_path();
     stats_t stats = {.won=0};
     load_stats(&stats, path);
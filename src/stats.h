@@ -0,0 +1,34 @@
+//===--------------------------------------------------------------------------------------------===
+// stats.h - Player stats file
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef STATS_H
+#define STATS_H
+
+#include "game.h"
+
+typedef struct {
+    unsigned won;
+    unsigned played;
+    unsigned cur_streak;
+    unsigned max_streak;
+    
+    unsigned last_won;
+    unsigned last_played;
+    
+    unsigned guesses[MAX_GUESSES];
+} stats_t;
+
+bool load_stats(stats_t *stats, const char *path);
+bool save_stats(const stats_t *stats, const char *path);
+// Records a finished single-board game. Replaying a puzzle that was already counted is a no-op.
+void add_game_stats(stats_t *stats, const game_t *game);
+
+// Updates the player's stats file with `game` and prints the summary to stdout.
+void game_stats(const game_t *game);
+
+#endif /* end of include guard: STATS_H */
@@ -0,0 +1,138 @@
+//===--------------------------------------------------------------------------------------------===
+// strategy.c - Strategy registry, plugin loading and the built-in strategies
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "strategy.h"
+#include "memory.h"
+#include "solver.h"
+#include <assert.h>
+#include <dlfcn.h>
+#include <string.h>
+
+static const strategy_t *registry[MAX_STRATEGIES];
+static unsigned registry_count = 0;
+
+bool strategy_register(const strategy_t *strategy) {
+    assert(strategy);
+    if(registry_count == MAX_STRATEGIES) return false;
+    if(strategy->abi != STRATEGY_ABI_VERSION) return false;
+    if(!strategy->name || !strategy->init || !strategy->reset || !strategy->choose) return false;
+    if(strategy_find(strategy->name)) return false;
+    registry[registry_count++] = strategy;
+    return true;
+}
+
+const char *strategy_load(const char *path) {
+    assert(path);
+    void *lib = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if(!lib) return dlerror();
+    
+    const strategy_t *(*entry)(void) = NULL;
+    // ISO C has no function <-> object pointer casts; POSIX guarantees this one works.
+    *(void **)&entry = dlsym(lib, STRATEGY_ENTRY_POINT);
+    if(!entry) {
+        dlclose(lib);
+        return "no " STRATEGY_ENTRY_POINT "() in the library";
+    }
+    const strategy_t *strategy = entry();
+    if(!strategy || strategy->abi != STRATEGY_ABI_VERSION) {
+        dlclose(lib);
+        return "the library was built for another strategy ABI";
+    }
+    if(!strategy_register(strategy)) {
+        dlclose(lib);
+        return "the registry is full, or a strategy already has that name";
+    }
+    return NULL;
+}
+
+unsigned strategy_count(void) {
+    return registry_count;
+}
+
+const strategy_t *strategy_get(unsigned idx) {
+    assert(idx < registry_count);
+    return registry[idx];
+}
+
+const strategy_t *strategy_find(const char *name) {
+    assert(name);
+    for(unsigned i = 0; i < registry_count; ++i) {
+        if(!strcmp(registry[i]->name, name)) return registry[i];
+    }
+    return NULL;
+}
+
+// Built-ins: all three track the candidates with a solver_t --------------------------------------
+
+typedef struct {
+    bool            ready;
+    solver_t        solver;
+    word_t          opener;         // The first hint is the same every game: worked out once.
+} solver_state_t;
+
+static void *solver_state_init(const lexicon_t *lex) {
+    (void)lex;
+    solver_state_t *s = safe_calloc(1, sizeof(solver_state_t));
+    s->opener = WORD_NONE;
+    return s;
+}
+
+static void solver_state_reset(void *state, const game_t *game) {
+    solver_state_t *s = state;
+    if(s->ready) solver_fini(&s->solver);
+    solver_init(&s->solver, game);
+    s->ready = true;
+}
+
+static void solver_state_fini(void *state) {
+    solver_state_t *s = state;
+    if(s->ready) solver_fini(&s->solver);
+    safe_free(s);
+}
+
+static word_t choose_entropy(void *state, const game_t *game, uint64_t budget_ns) {
+    (void)budget_ns;
+    solver_state_t *s = state;
+    if(game->guess_count) return solver_hint(&s->solver);
+    if(s->opener == WORD_NONE) s->opener = solver_hint(&s->solver);
+    return s->opener;
+}
+
+// Keeps a tenth of the budget back for the arena's own bookkeeping and scheduling noise.
+static word_t choose_anytime(void *state, const game_t *game, uint64_t budget_ns) {
+    (void)game;
+    return solver_hint_within(&((solver_state_t *)state)->solver, budget_ns - budget_ns / 10,
+                              NULL, NULL);
+}
+
+static word_t choose_candidate(void *state, const game_t *game, uint64_t budget_ns) {
+    (void)budget_ns;
+    solver_t *solver = &((solver_state_t *)state)->solver;
+    solver_update(solver);
+    const cset_t *set = &solver->boards[0];
+    for(unsigned block = 0; block < CSET_BLOCKS(set->capacity); ++block) {
+        if(!set->bits[block]) continue;
+        return game->lexicon->answers[block * 64 + __builtin_ctzll(set->bits[block])];
+    }
+    return game->lexicon->answers[0];
+}
+
+static const strategy_t builtins[] = {
+    {STRATEGY_ABI_VERSION, "entropy", solver_state_init, solver_state_reset, choose_entropy,
+     solver_state_fini},
+    {STRATEGY_ABI_VERSION, "anytime", solver_state_init, solver_state_reset, choose_anytime,
+     solver_state_fini},
+    {STRATEGY_ABI_VERSION, "candidate", solver_state_init, solver_state_reset, choose_candidate,
+     solver_state_fini},
+};
+
+void strategy_register_builtins(void) {
+    for(unsigned i = 0; i < sizeof(builtins) / sizeof(builtins[0]); ++i) {
+        strategy_register(&builtins[i]);
+    }
+}
@@ -0,0 +1,54 @@
+//===--------------------------------------------------------------------------------------------===
+// strategy.h - Pluggable solver strategies
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef STRATEGY_H
+#define STRATEGY_H
+
+#include "game.h"
+#include <stdint.h>
+
+// Bumped whenever strategy_t changes shape. Plugins built against another version are refused.
+#define STRATEGY_ABI_VERSION    (1)
+#define MAX_STRATEGIES          (32)
+
+// A bot that plays single-board games. One instance (what init() returns) plays one game at a
+// time, but the arena runs one instance per thread, so instances must not share mutable state.
+typedef struct {
+    unsigned        abi;            // STRATEGY_ABI_VERSION.
+    const char      *name;
+    
+    void            *(*init)(const lexicon_t *lex);
+    // A new game is starting. `game` stays valid, and is the one passed to choose(), until the
+    // next reset().
+    void            (*reset)(void *state, const game_t *game);
+    // The next guess, given the feedback so far in game->guesses. The move should take less than
+    // `budget_ns` (0 for no limit): the arena forfeits games whose moves take longer.
+    word_t          (*choose)(void *state, const game_t *game, uint64_t budget_ns);
+    void            (*fini)(void *state);
+} strategy_t;
+
+// Shared objects export their strategy through this function:
+//
+//     const strategy_t *jawc_strategy(void);
+#define STRATEGY_ENTRY_POINT    "jawc_strategy"
+
+// Adds a strategy to the registry. Not thread-safe: register everything before running the arena.
+// Fails if the registry is full, the ABI doesn't match, or the name is taken.
+bool strategy_register(const strategy_t *strategy);
+// Registers the strategies built on the solver: "entropy" (solver_hint), "anytime"
+// (solver_hint_within the move budget) and "candidate" (the first remaining candidate).
+void strategy_register_builtins(void);
+// dlopen()s `path` and registers the strategy it exports. The library stays loaded. Returns NULL
+// on success, or what went wrong.
+const char *strategy_load(const char *path);
+
+unsigned strategy_count(void);
+const strategy_t *strategy_get(unsigned idx);
+const strategy_t *strategy_find(const char *name);
+
+#endif /* end of include guard: STRATEGY_H */
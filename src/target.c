@@ -1,2312 +1,2312 @@
-const unsigned target_count = 2309;
-const unsigned targets[] = {
-    1639,
-    99,
-    329,
-    1000,
-    1774,
-    1458,
-    1942,
-    2261,
-    1117,
-    465,
-    1055,
-    2156,
-    1313,
-    987,
-    201,
-    2045,
-    625,
-    1520,
-    1846,
-    2003,
-    1327,
-    2234,
-    1893,
-    1542,
-    218,
-    1661,
-    1845,
-    1318,
-    107,
-    1498,
-    491,
-    1960,
-    1049,
-    1562,
-    240,
-    590,
-    942,
-    713,
-    793,
-    1149,
-    1870,
+const unsigned dict_target_count = 2309;
+const unsigned dict_targets[] = {
+    179,
+    241,
+    578,
+    1476,
+    1293,
+    1349,
+    2129,
+    1200,
+    2100,
+    939,
+    1390,
+    895,
+    2087,
     1563,
-    358,
-    82,
-    2184,
-    1569,
-    1672,
-    125,
-    1281,
-    550,
-    1315,
-    1192,
-    938,
-    1978,
-    1452,
-    1930,
-    1910,
-    234,
-    1523,
-    1063,
-    478,
-    485,
-    7,
+    2293,
+    1199,
+    343,
+    1462,
+    1070,
+    1809,
+    230,
+    1389,
+    1353,
+    280,
     2149,
-    1374,
-    212,
-    599,
-    1565,
-    1952,
-    1167,
-    1857,
-    2248,
-    165,
-    1749,
-    1487,
-    2221,
-    1957,
-    868,
-    744,
-    1886,
-    275,
-    581,
-    1427,
-    1224,
-    223,
-    2047,
-    2082,
-    2088,
-    1176,
-    1208,
-    42,
-    1782,
-    1172,
-    2118,
-    1232,
-    1062,
-    1637,
-    1936,
-    1642,
-    1302,
-    1495,
-    462,
-    1863,
-    130,
-    117,
-    2253,
-    1907,
-    154,
-    989,
-    2055,
     1847,
-    1295,
-    1811,
-    1038,
-    990,
-    829,
-    2187,
-    1152,
-    1525,
-    2162,
-    537,
-    813,
-    1665,
-    965,
-    2280,
-    251,
-    1834,
-    2025,
-    1956,
-    2185,
-    1447,
-    2250,
-    735,
-    2079,
-    1677,
-    1376,
+    1020,
+    547,
+    387,
+    611,
+    1211,
+    521,
+    8,
+    2223,
+    907,
+    143,
+    1626,
+    1970,
     2046,
-    1802,
-    517,
-    1456,
-    1668,
-    2167,
-    2028,
+    2010,
+    1159,
+    642,
+    39,
+    694,
+    455,
+    1067,
+    2230,
+    1307,
+    1733,
+    1653,
     1909,
-    2026,
-    52,
-    1510,
-    406,
-    531,
-    2115,
-    1603,
-    1046,
-    668,
-    1914,
-    254,
-    76,
-    44,
-    606,
-    88,
+    1800,
+    337,
+    1354,
+    706,
+    1383,
+    283,
+    1663,
+    880,
+    568,
+    722,
+    419,
+    1764,
+    1862,
+    1162,
+    243,
+    2096,
+    511,
+    1222,
+    2124,
+    1101,
+    204,
+    2056,
+    925,
+    1623,
+    1550,
+    2271,
+    1890,
+    139,
+    417,
+    1522,
+    546,
+    1231,
+    2092,
+    266,
+    328,
+    160,
+    1893,
+    595,
+    796,
+    1651,
+    460,
+    1506,
+    1572,
+    215,
+    339,
+    1718,
+    1123,
+    765,
+    478,
+    1720,
+    1648,
+    1071,
+    711,
     691,
-    1686,
-    850,
-    210,
-    495,
-    1372,
-    365,
-    1632,
-    2019,
-    2240,
-    921,
+    687,
+    1611,
+    1661,
+    1525,
+    1711,
+    2241,
+    203,
+    1256,
+    1430,
+    141,
+    1527,
+    540,
+    354,
+    1471,
+    1421,
+    439,
+    1622,
+    336,
+    396,
+    1567,
+    1617,
+    504,
+    2052,
+    1516,
+    1785,
+    644,
+    1205,
+    1704,
+    1114,
+    2270,
+    195,
+    369,
+    177,
+    807,
+    258,
+    300,
+    685,
+    1871,
+    46,
+    1919,
+    929,
+    858,
+    271,
+    683,
+    717,
+    2193,
+    1831,
+    1588,
+    159,
+    85,
+    2024,
+    1113,
+    1441,
+    1431,
+    1076,
     2256,
-    785,
-    1398,
-    19,
-    646,
-    1657,
-    1321,
-    361,
-    652,
-    800,
-    922,
-    617,
-    1625,
+    1209,
+    985,
+    955,
     1500,
-    1393,
-    565,
-    1564,
+    966,
+    372,
+    1236,
+    474,
+    104,
+    1455,
+    1649,
+    2217,
     2015,
-    764,
+    2115,
+    1742,
+    1006,
+    1739,
+    2110,
+    1170,
+    1497,
+    1450,
+    1952,
+    1829,
+    1292,
+    2229,
+    1089,
+    1280,
+    565,
+    822,
+    1050,
+    552,
+    1210,
+    237,
+    2183,
+    666,
+    498,
+    305,
+    503,
+    1124,
+    101,
+    2139,
+    1944,
+    2283,
+    1122,
+    557,
+    2294,
+    198,
+    650,
+    676,
+    1737,
+    192,
+    994,
     538,
-    1850,
-    1995,
-    1756,
-    883,
-    791,
-    936,
-    98,
-    1449,
-    770,
-    338,
-    856,
-    1504,
-    376,
+    427,
+    434,
+    2263,
+    1184,
+    1955,
+    2185,
+    178,
+    2243,
+    402,
+    816,
+    1703,
+    1483,
+    359,
+    1028,
+    312,
+    1603,
+    373,
+    350,
+    2194,
+    127,
+    1227,
+    221,
+    997,
+    120,
+    1535,
+    1870,
+    1736,
     1570,
-    2077,
-    637,
-    2132,
-    1982,
-    1844,
-    891,
-    598,
-    367,
-    283,
-    493,
-    554,
-    48,
-    489,
-    721,
-    1549,
-    977,
-    264,
-    711,
-    1300,
-    604,
-    1654,
-    687,
-    1197,
-    837,
+    2305,
+    1295,
+    1137,
+    2191,
+    459,
+    105,
+    1771,
+    954,
     1303,
-    302,
-    577,
-    1813,
-    269,
-    2288,
-    1892,
-    1003,
-    595,
-    947,
-    946,
-    47,
-    1538,
-    1746,
-    1714,
-    308,
-    2199,
-    169,
-    900,
-    1147,
-    836,
-    788,
-    1468,
-    651,
-    129,
-    1622,
-    1612,
-    11,
-    1115,
-    1297,
-    1784,
-    1373,
-    1682,
-    1026,
-    186,
-    1304,
-    1223,
-    751,
-    877,
-    1941,
-    410,
-    913,
-    1712,
-    1290,
-    449,
-    1815,
-    93,
-    843,
-    384,
-    508,
-    1629,
-    2211,
-    2255,
-    1094,
-    1937,
-    311,
-    211,
-    1203,
-    347,
-    787,
-    1998,
-    306,
-    1119,
-    1663,
-    1934,
-    433,
-    230,
-    1480,
-    163,
-    35,
-    1597,
-    1278,
-    313,
-    1634,
-    1824,
-    1973,
-    1928,
+    1679,
+    2195,
+    411,
+    1302,
+    1106,
+    601,
+    1761,
+    1642,
+    1259,
+    1396,
+    1608,
+    329,
+    1403,
+    1036,
+    1424,
+    693,
+    497,
+    481,
+    1023,
+    75,
+    1283,
+    1051,
+    25,
+    12,
+    231,
+    1368,
+    1116,
+    291,
+    437,
+    539,
+    1478,
+    1657,
+    2180,
+    953,
+    840,
+    252,
+    1274,
+    38,
+    2050,
+    2105,
+    1573,
+    690,
+    977,
+    233,
+    2246,
+    1637,
+    2118,
+    2275,
+    1185,
+    1228,
+    2211,
+    1333,
+    235,
+    96,
+    1994,
+    1213,
+    415,
+    970,
+    265,
+    14,
+    310,
+    1755,
+    603,
+    1356,
+    1532,
+    1995,
+    567,
+    571,
+    1861,
+    153,
+    1130,
+    292,
+    777,
+    1263,
+    2027,
+    1166,
+    1485,
+    586,
+    2108,
     1705,
+    965,
+    1512,
+    30,
+    515,
+    151,
+    1936,
+    654,
+    1147,
+    1879,
+    1418,
+    318,
+    1538,
+    443,
+    0,
+    2182,
+    222,
+    2216,
+    536,
+    1021,
+    1393,
+    1400,
+    1905,
+    1675,
+    461,
+    1380,
+    623,
+    1035,
+    378,
+    225,
+    1247,
+    2013,
+    1833,
+    1757,
+    2003,
+    67,
+    254,
+    377,
+    2042,
+    2295,
+    1086,
+    738,
+    594,
+    1974,
+    2184,
+    808,
+    1423,
+    1989,
+    325,
+    1714,
+    51,
+    1707,
+    905,
+    1272,
+    1191,
+    1638,
+    1377,
+    1899,
+    361,
+    1666,
+    56,
     1131,
-    573,
-    1155,
-    1077,
-    1754,
-    1047,
-    293,
-    1,
-    792,
-    1220,
-    1935,
-    207,
-    1042,
-    795,
-    1024,
-    1511,
-    1284,
-    1716,
+    754,
+    821,
+    2258,
+    556,
+    1079,
+    1685,
     285,
-    2123,
-    1981,
-    375,
-    846,
-    1354,
-    3,
-    2220,
-    1519,
-    425,
-    2101,
-    2119,
-    415,
-    1305,
-    1008,
-    1819,
-    662,
-    1753,
+    1135,
+    43,
+    1278,
+    1465,
+    1986,
+    1954,
+    321,
+    904,
+    1949,
+    267,
     854,
-    1577,
-    1488,
+    1373,
+    1224,
+    667,
+    1806,
+    184,
+    458,
+    609,
+    1515,
+    1818,
+    2088,
+    829,
+    2039,
+    166,
+    2067,
+    1188,
+    1489,
+    1480,
+    368,
+    1057,
+    454,
     1779,
-    1332,
-    1580,
-    292,
-    524,
-    1885,
-    2210,
-    2096,
-    1965,
-    794,
-    2068,
-    541,
-    2083,
-    1967,
-    2195,
-    1778,
-    487,
-    1758,
-    1467,
-    1729,
-    1201,
-    1065,
-    2098,
-    1776,
-    1371,
-    400,
-    1529,
-    10,
-    87,
-    2144,
-    2111,
-    997,
-    533,
-    2305,
-    1193,
-    469,
-    1927,
-    1953,
-    1862,
-    664,
-    247,
-    1514,
-    1348,
-    1103,
-    1478,
-    1187,
-    766,
-    46,
-    756,
-    1966,
-    1795,
-    780,
-    1762,
-    769,
-    1285,
-    548,
-    2284,
-    1638,
-    1293,
-    221,
-    924,
-    1460,
-    1572,
-    629,
-    1641,
-    4,
-    18,
-    1418,
-    1808,
-    412,
-    941,
-    592,
-    1675,
-    2104,
-    1233,
-    998,
-    971,
-    552,
-    2014,
-    809,
-    810,
-    276,
-    803,
-    749,
-    1350,
-    737,
-    1129,
-    1681,
-    1059,
-    17,
-    2112,
-    1608,
-    1153,
-    482,
-    1903,
-    1616,
-    2058,
-    1067,
-    707,
-    887,
-    1256,
-    1688,
-    844,
-    1214,
-    853,
-    1448,
-    1801,
-    822,
-    2191,
-    585,
-    1596,
-    205,
-    783,
-    1805,
-    104,
-    453,
-    2093,
-    2038,
-    1871,
-    1369,
-    370,
-    919,
-    437,
-    421,
-    1247,
-    808,
-    202,
-    1443,
-    1319,
-    386,
-    2206,
-    658,
-    1015,
-    2275,
-    675,
-    1079,
-    2258,
-    1964,
-    1711,
-    151,
-    243,
-    2241,
-    620,
-    2219,
-    2023,
-    132,
-    1267,
-    1986,
-    1944,
-    1963,
-    1701,
-    355,
-    1196,
-    755,
-    1761,
-    536,
-    1078,
-    1809,
-    521,
-    2154,
-    237,
-    934,
-    349,
-    1502,
-    840,
-    2090,
-    555,
-    1005,
-    156,
-    1940,
-    1206,
-    2059,
-    672,
-    2089,
-    826,
-    1980,
-    2037,
-    1073,
-    298,
-    1567,
+    725,
+    1756,
+    768,
     123,
-    673,
-    270,
-    1691,
-    65,
+    1088,
+    901,
+    323,
+    1096,
+    2033,
+    1883,
+    873,
+    83,
+    1963,
+    394,
+    559,
+    514,
+    1226,
+    627,
+    1583,
+    1095,
+    1558,
+    1223,
+    381,
+    88,
+    1053,
+    2261,
+    1186,
+    1306,
+    1938,
+    420,
+    569,
+    1068,
+    468,
+    2207,
+    671,
+    1920,
+    1708,
+    1767,
+    950,
     1261,
-    529,
-    2208,
-    632,
-    1744,
+    1498,
+    1412,
+    1351,
+    1395,
+    746,
+    210,
+    715,
+    791,
+    1700,
+    1741,
+    2099,
+    216,
+    1428,
+    1204,
     1858,
-    677,
-    1136,
-    1769,
-    197,
-    103,
-    1266,
-    2121,
-    564,
-    29,
-    1653,
-    1072,
-    867,
-    695,
-    1310,
-    2214,
-    199,
-    1202,
-    463,
-    27,
-    1902,
-    404,
-    1301,
-    943,
+    308,
+    2202,
+    1911,
+    957,
+    2097,
+    755,
     477,
-    602,
-    168,
-    2056,
-    2050,
-    2257,
-    870,
-    1718,
-    1623,
-    1648,
-    1004,
-    949,
-    1178,
-    1476,
-    190,
-    1336,
-    1357,
-    1252,
-    624,
-    588,
-    2072,
-    1162,
-    22,
-    2030,
-    1248,
-    2016,
-    1702,
-    1207,
-    464,
-    128,
-    1760,
-    393,
-    1022,
-    1913,
-    325,
-    2308,
-    1274,
-    381,
-    2209,
-    709,
-    155,
-    1669,
-    2249,
-    331,
-    490,
-    148,
+    672,
+    250,
+    548,
+    2222,
+    2090,
+    527,
+    843,
+    653,
+    447,
+    1598,
     1987,
-    958,
-    1917,
+    1897,
+    1319,
+    1087,
+    2055,
+    164,
+    973,
+    1474,
+    1454,
+    801,
+    2177,
+    891,
+    1002,
+    1469,
+    476,
+    859,
+    11,
+    333,
+    946,
+    1245,
+    2254,
+    944,
+    1085,
+    963,
+    1956,
+    1910,
+    782,
+    596,
+    924,
+    731,
+    2031,
+    1044,
+    1510,
+    340,
+    1880,
+    263,
+    2225,
     239,
-    1611,
-    395,
-    1750,
-    1121,
-    1104,
-    741,
-    1043,
-    2043,
-    2174,
-    233,
-    1581,
-    920,
-    2179,
-    676,
-    1797,
-    1099,
-    1270,
-    1619,
-    81,
-    499,
-    138,
-    1051,
+    1468,
+    993,
+    1221,
+    1315,
+    403,
+    29,
+    2111,
+    287,
+    1557,
+    79,
+    716,
+    60,
+    113,
+    316,
+    775,
+    1305,
+    1654,
+    932,
+    1820,
+    1813,
+    1260,
+    1339,
+    598,
+    1966,
+    1408,
+    1267,
+    525,
     317,
-    2178,
-    1742,
-    1154,
-    396,
-    2190,
-    1655,
-    600,
-    1439,
-    401,
-    2260,
-    1584,
-    1231,
-    2303,
-    1089,
-    328,
-    1410,
-    2293,
-    1771,
-    2137,
-    1791,
-    2085,
-    1884,
-    593,
-    1236,
-    1002,
-    2282,
-    1173,
-    2307,
-    1283,
-    80,
-    648,
-    2051,
-    507,
-    670,
-    1561,
-    689,
-    259,
-    1212,
-    1626,
-    383,
-    641,
-    684,
-    238,
-    357,
-    204,
-    1851,
-    1763,
-    511,
-    895,
-    1039,
-    1331,
-    1770,
-    1391,
-    170,
-    2242,
-    1422,
-    1183,
-    1895,
-    20,
-    2066,
-    566,
-    1179,
-    720,
-    350,
-    1095,
-    1018,
-    1436,
-    1102,
-    1175,
+    1823,
+    124,
+    1456,
+    297,
+    688,
+    1555,
+    1108,
+    624,
+    2266,
+    1058,
+    1778,
+    324,
+    1781,
+    1822,
+    825,
+    1670,
+    938,
+    1032,
+    856,
+    490,
+    1332,
     2244,
-    1840,
-    444,
-    858,
-    816,
-    492,
-    1069,
-    1598,
-    1230,
-    1575,
-    2301,
+    656,
+    2142,
+    1790,
+    1286,
+    633,
+    2269,
+    699,
+    897,
+    480,
+    1453,
+    441,
+    1145,
+    1187,
+    1749,
+    572,
+    661,
+    760,
+    2236,
+    1030,
+    1932,
+    213,
+    776,
+    1169,
+    643,
+    747,
+    1172,
+    1985,
     2281,
-    1540,
-    972,
-    1442,
-    1287,
-    910,
-    576,
-    1209,
-    560,
-    657,
-    1076,
-    1464,
-    1670,
-    635,
-    1557,
-    1674,
-    951,
-    241,
-    2232,
-    1123,
-    1958,
-    315,
-    1560,
-    1699,
+    1896,
+    2098,
+    1207,
+    227,
+    1314,
+    1586,
+    727,
+    1022,
+    864,
+    1248,
+    2169,
+    269,
+    1201,
+    158,
+    1826,
+    1851,
+    332,
+    2063,
+    1420,
+    589,
+    2064,
+    1342,
+    1301,
+    2210,
+    1178,
+    1313,
+    440,
+    1784,
+    488,
+    1627,
     1601,
-    33,
-    660,
-    2075,
-    339,
-    1085,
-    126,
-    32,
-    353,
-    1961,
-    72,
-    494,
-    839,
-    547,
-    1419,
-    1920,
-    1309,
-    2189,
+    518,
+    2045,
+    742,
+    1754,
+    2021,
+    1791,
+    1698,
+    1084,
+    1477,
+    665,
+    360,
+    319,
+    452,
+    1983,
+    1008,
+    217,
+    2252,
+    1080,
+    773,
+    1391,
+    908,
+    1217,
+    109,
+    1906,
+    1947,
+    553,
+    2186,
+    1768,
+    1519,
+    679,
+    150,
+    76,
+    1585,
+    1300,
+    1748,
+    352,
+    1338,
+    1442,
+    818,
+    108,
+    813,
+    303,
+    175,
+    190,
+    1463,
     983,
-    799,
-    1731,
-    640,
-    2165,
-    601,
-    173,
-    100,
-    419,
-    144,
-    1945,
-    1011,
-    1322,
-    2193,
-    1130,
-    1823,
+    1009,
+    1004,
+    3,
+    121,
+    1439,
+    483,
+    247,
+    531,
+    1852,
+    1735,
+    1630,
+    698,
+    1943,
+    831,
+    506,
+    77,
+    1196,
+    1316,
+    616,
     1308,
-    1141,
-    1516,
-    639,
+    1832,
+    338,
+    1174,
+    703,
+    1348,
+    2159,
+    1,
+    2299,
+    1486,
+    1914,
+    1918,
+    2298,
+    710,
+    1139,
+    692,
+    941,
+    176,
+    349,
+    2300,
+    1817,
+    1578,
+    1134,
+    2062,
+    1232,
+    2231,
+    1509,
+    785,
+    209,
+    2167,
+    1758,
+    1691,
+    1026,
+    2287,
+    802,
+    1128,
+    135,
+    749,
+    714,
+    2085,
+    2237,
+    730,
+    2175,
+    805,
+    169,
+    986,
+    188,
+    1559,
+    380,
+    95,
+    766,
+    1827,
+    1517,
+    1251,
+    867,
+    194,
+    562,
+    320,
+    931,
+    913,
+    1725,
+    1163,
+    274,
+    528,
+    390,
+    2057,
+    1013,
+    1569,
+    1782,
+    1143,
+    2209,
+    2074,
+    1524,
+    16,
+    1565,
+    251,
+    940,
+    2034,
+    1507,
+    1681,
+    1863,
+    728,
+    1942,
+    1849,
+    745,
+    1610,
+    1853,
+    1440,
+    1599,
+    214,
+    851,
+    809,
+    1860,
+    878,
+    510,
+    1972,
+    1482,
+    1310,
+    167,
+    2206,
+    1669,
+    2030,
+    92,
     1678,
-    1345,
-    777,
-    134,
-    1878,
-    2306,
-    806,
-    680,
-    1218,
+    607,
+    987,
+    1284,
+    1539,
+    1118,
+    647,
+    49,
+    131,
     2302,
-    67,
-    699,
-    1014,
-    90,
-    1343,
-    336,
-    136,
-    681,
-    255,
-    2126,
-    2000,
-    1394,
-    1420,
-    828,
-    420,
-    1720,
-    1609,
-    1493,
-    1320,
-    1556,
-    1748,
-    2107,
-    1262,
-    231,
-    2207,
-    1482,
-    1389,
-    195,
-    848,
-    12,
-    974,
-    1469,
-    2276,
-    1219,
-    1949,
-    886,
-    422,
-    1592,
-    2,
-    1490,
-    1325,
-    1461,
-    1786,
-    297,
-    26,
-    484,
-    1518,
-    1877,
-    1445,
-    1531,
-    1736,
-    765,
-    2122,
-    360,
-    2095,
-    1395,
-    423,
+    55,
+    535,
+    2076,
+    2208,
+    2001,
+    1745,
+    972,
+    949,
+    1287,
+    1650,
+    961,
+    1689,
+    1276,
+    849,
+    59,
     686,
-    36,
-    1752,
-    1164,
-    1470,
-    1060,
-    1228,
-    740,
-    333,
-    696,
-    2157,
-    389,
-    409,
-    366,
-    1831,
-    1027,
-    688,
-    963,
-    2097,
-    1955,
-    40,
-    1636,
-    647,
-    95,
-    1647,
-    1804,
-    1536,
+    1816,
+    1904,
+    1066,
+    74,
+    1805,
+    836,
+    2232,
+    479,
+    1073,
+    2248,
+    1701,
+    1093,
+    2079,
+    306,
+    887,
+    1160,
+    425,
+    1001,
+    2154,
+    1545,
+    4,
+    62,
+    971,
+    1446,
+    613,
+    522,
+    2127,
+    1783,
+    888,
+    362,
+    165,
+    1183,
+    405,
+    923,
+    400,
+    57,
+    68,
+    284,
+    1930,
+    657,
+    1618,
+    1239,
+    662,
+    1901,
+    1177,
+    975,
+    674,
     968,
-    1462,
-    666,
-    1166,
-    2196,
-    2270,
-    960,
-    330,
-    2263,
-    2271,
-    279,
+    236,
+    1672,
+    1304,
+    1993,
+    696,
+    1149,
+    2123,
+    1925,
+    1098,
+    842,
+    1407,
+    942,
+    2257,
+    413,
+    1271,
+    1034,
+    719,
+    1634,
+    2048,
+    590,
+    605,
+    238,
+    404,
+    1969,
+    2264,
     2172,
-    546,
-    732,
-    185,
-    1818,
-    1585,
-    1790,
-    1251,
-    1438,
-    2163,
-    225,
-    520,
-    754,
-    1613,
-    219,
-    137,
-    1148,
-    2222,
-    1429,
-    1092,
-    1689,
-    473,
-    1016,
-    1229,
-    337,
-    1472,
-    1360,
-    2035,
-    1111,
-    1031,
-    287,
-    2147,
-    2203,
-    514,
-    188,
-    1404,
+    1774,
+    206,
     817,
-    1551,
-    1088,
-    644,
-    1899,
-    2125,
-    1656,
-    1120,
-    299,
+    1410,
+    969,
+    2136,
+    2201,
+    1151,
+    632,
+    2233,
+    1234,
+    512,
+    72,
+    545,
     208,
-    1499,
-    1780,
-    1630,
-    488,
-    1387,
-    1150,
-    1898,
-    55,
-    2289,
-    2259,
-    1081,
-    2223,
-    627,
-    1037,
-    1709,
-    183,
-    1544,
-    2192,
-    2110,
-    758,
-    460,
-    1097,
-    1032,
-    532,
-    171,
-    513,
-    2243,
-    215,
-    1723,
-    928,
-    642,
-    789,
-    556,
-    2298,
-    209,
-    931,
-    884,
-    2274,
-    1604,
+    383,
+    389,
+    866,
+    33,
+    1548,
+    1776,
+    2152,
+    180,
+    1941,
+    1411,
+    2069,
+    1835,
+    1843,
+    1127,
+    1891,
+    1434,
+    1766,
+    2170,
+    2086,
+    767,
     1869,
-    1277,
-    1983,
-    996,
-    1390,
-    1919,
-    380,
-    2091,
-    804,
-    245,
-    112,
-    2065,
+    1968,
+    1789,
+    244,
+    1927,
+    1376,
+    1886,
+    2157,
+    142,
+    84,
+    1712,
+    450,
+    224,
+    612,
+    811,
+    945,
+    341,
+    1238,
+    424,
+    1639,
+    2122,
+    2120,
+    290,
+    558,
+    814,
+    978,
+    991,
+    313,
+    1900,
+    161,
+    71,
+    868,
+    2071,
+    1713,
+    256,
+    486,
+    1576,
+    331,
+    1521,
+    709,
+    762,
+    2054,
+    881,
+    1444,
+    1999,
+    1584,
+    1328,
+    736,
+    1641,
+    196,
+    1807,
+    570,
+    2192,
+    517,
+    1673,
+    133,
+    181,
+    453,
+    2290,
+    1593,
+    2286,
+    670,
+    2218,
+    1472,
+    1496,
+    2126,
+    2176,
+    1702,
+    1156,
+    1117,
+    2035,
+    771,
+    1005,
+    681,
+    1037,
+    1837,
+    1111,
+    1419,
+    432,
+    1244,
+    1750,
+    1821,
+    1220,
+    695,
+    1215,
+    1591,
+    1416,
+    15,
+    883,
+    1357,
+    516,
+    1612,
     2262,
-    1259,
-    303,
-    135,
-    1020,
-    1401,
-    1068,
-    1146,
-    2181,
-    1239,
-    262,
-    2194,
-    203,
-    1751,
-    324,
-    414,
-    1991,
-    379,
-    616,
-    334,
-    543,
-    2177,
-    468,
-    1829,
-    316,
-    1399,
-    1880,
-    91,
-    2202,
-    623,
-    1554,
-    1385,
-    821,
-    321,
-    545,
-    1477,
-    655,
-    309,
-    540,
-    1894,
-    704,
-    1828,
+    200,
+    740,
+    1523,
+    899,
     2009,
-    319,
+    974,
+    576,
+    1451,
+    1574,
+    1734,
+    1615,
+    1929,
+    1059,
+    1090,
+    906,
+    2253,
+    1647,
+    2274,
+    1493,
+    1682,
+    2083,
+    964,
+    91,
+    2059,
+    1337,
+    2178,
+    1140,
+    554,
+    599,
+    2128,
+    1198,
+    1466,
+    1786,
+    2133,
+    398,
+    960,
+    388,
+    1769,
+    299,
+    2235,
+    2304,
+    579,
+    393,
+    1965,
+    620,
+    1417,
+    1581,
+    1105,
+    689,
+    1374,
+    1695,
+    879,
+    2306,
+    286,
+    2134,
+    42,
+    288,
+    370,
+    134,
+    988,
+    718,
+    2037,
+    1437,
+    1903,
+    1452,
+    1436,
+    1488,
+    1810,
+    737,
+    1668,
+    1935,
+    1099,
+    1915,
+    934,
+    1882,
+    117,
+    1777,
+    90,
+    566,
+    850,
+    2284,
+    1683,
     739,
-    1821,
-    1221,
-    73,
-    1860,
-    1825,
-    1406,
-    1645,
-    175,
-    975,
-    551,
-    1757,
-    575,
-    1555,
+    1547,
+    1988,
+    1282,
+    1394,
+    502,
+    484,
+    1257,
+    1662,
+    1874,
+    1710,
+    2014,
+    920,
+    1136,
+    1503,
+    1884,
+    2117,
+    1797,
+    1381,
+    1913,
+    118,
+    262,
+    207,
+    1692,
+    1218,
+    1138,
+    1047,
+    744,
+    2228,
+    2282,
+    682,
+    1398,
+    106,
+    956,
+    168,
+    1388,
+    418,
+    1341,
+    367,
+    865,
+    1490,
+    429,
+    186,
+    2011,
+    976,
+    1841,
+    353,
+    152,
+    17,
+    1877,
+    1102,
+    2214,
+    1715,
+    2203,
+    401,
+    797,
+    2141,
+    311,
+    774,
+    1273,
+    327,
+    2084,
+    445,
+    391,
+    1329,
+    530,
+    990,
+    1289,
+    436,
+    376,
+    872,
+    1040,
+    144,
+    112,
+    47,
+    2005,
+    1142,
+    1175,
+    2164,
+    273,
+    1921,
+    2119,
+    278,
+    1551,
+    1467,
+    2019,
+    1960,
+    1074,
+    1326,
+    2278,
+    2044,
+    786,
+    1928,
+    1340,
+    1290,
+    2174,
+    952,
+    1605,
+    1027,
     918,
-    343,
-    96,
-    1837,
-    654,
-    63,
-    192,
-    2180,
-    1566,
-    1832,
-    830,
-    782,
-    815,
-    743,
-    1457,
-    2020,
-    2171,
-    712,
-    442,
-    1528,
-    450,
-    1662,
-    1673,
-    1583,
-    1706,
-    2031,
-    340,
-    1888,
-    2081,
-    2130,
-    498,
-    1174,
-    250,
-    1044,
+    1366,
+    2168,
+    980,
+    959,
+    668,
+    758,
+    1950,
+    1495,
+    700,
+    98,
+    2240,
+    365,
+    827,
+    466,
+    1144,
+    1072,
     1402,
-    653,
-    927,
-    411,
-    1874,
-    731,
-    881,
-    1211,
-    801,
-    1912,
-    1755,
-    1312,
-    2113,
-    1680,
-    2277,
-    1867,
-    50,
-    157,
-    318,
-    1272,
-    2012,
-    348,
+    281,
+    1948,
+    1762,
+    2131,
+    1978,
+    2089,
+    2291,
+    1765,
+    232,
+    1331,
+    664,
+    469,
+    903,
+    69,
+    294,
+    2041,
+    1432,
+    998,
+    1802,
+    23,
+    628,
+    1109,
+    852,
+    119,
+    2051,
+    900,
+    1763,
+    584,
+    823,
+    330,
+    309,
+    996,
+    1275,
+    1716,
     583,
-    869,
-    1344,
-    2294,
-    1741,
-    359,
-    669,
-    969,
-    266,
-    1796,
-    820,
-    1204,
-    1576,
-    184,
-    1539,
-    1868,
-    880,
-    180,
-    1108,
-    2029,
-    51,
-    1007,
-    5,
-    1807,
-    109,
-    1887,
-    191,
-    510,
-    106,
-    683,
-    176,
-    1168,
-    470,
-    2128,
-    2183,
-    2127,
+    841,
+    622,
+    635,
+    1317,
+    1370,
+    58,
+    1787,
+    2072,
+    32,
+    347,
+    1277,
+    789,
+    1998,
+    2220,
+    617,
+    845,
+    187,
+    1121,
+    1753,
+    1197,
     2150,
-    1848,
-    1056,
-    842,
-    953,
-    526,
-    626,
-    1444,
-    310,
-    612,
-    1833,
-    2200,
-    1411,
-    539,
-    320,
-    1217,
-    258,
-    105,
-    1643,
-    71,
-    734,
-    506,
-    1074,
-    1143,
-    1316,
-    1140,
-    2092,
-    923,
-    553,
-    68,
-    1599,
-    503,
-    1911,
-    875,
-    2267,
-    2138,
+    2227,
+    442,
+    1872,
+    2251,
+    533,
+    496,
+    129,
+    1619,
+    1082,
+    1110,
+    1154,
+    1957,
+    1808,
+    1660,
+    1726,
+    1937,
+    1219,
+    1684,
+    1043,
+    2140,
+    1180,
+    713,
+    435,
     1091,
-    178,
-    200,
-    703,
-    1533,
-    1759,
-    392,
-    879,
-    77,
+    787,
+    1007,
+    898,
+    53,
+    272,
+    1003,
+    819,
+    834,
+    560,
     1582,
-    1772,
-    1717,
-    286,
-    852,
-    1365,
-    466,
-    827,
-    244,
-    1080,
+    2273,
+    293,
+    182,
+    2276,
+    1971,
+    618,
+    130,
+    1590,
+    315,
+    928,
+    1225,
+    140,
+    2189,
+    80,
+    154,
+    138,
+    1448,
+    862,
+    631,
+    1624,
+    587,
+    28,
+    2259,
+    1640,
+    1120,
     282,
-    1459,
-    512,
-    614,
-    961,
-    1412,
-    304,
-    1535,
-    715,
-    1875,
-    193,
-    220,
-    864,
-    1610,
-    1948,
-    1855,
-    1473,
-    1415,
-    2218,
-    1708,
-    356,
-    1434,
-    956,
-    1180,
-    150,
-    1768,
-    288,
-    372,
-    1199,
-    1954,
-    525,
-    1658,
-    911,
-    2142,
-    569,
-    1430,
-    561,
-    1854,
-    445,
-    249,
-    1859,
-    229,
-    2158,
-    979,
-    1526,
-    1745,
-    1294,
-    407,
-    1382,
-    2100,
-    291,
-    1508,
-    1338,
-    179,
-    1810,
-    15,
-    759,
+    1580,
     636,
-    162,
-    351,
-    2227,
-    1337,
-    273,
-    1098,
-    959,
-    797,
-    120,
-    1364,
-    1282,
-    101,
-    1975,
-    1242,
-    1122,
-    1323,
-    1664,
-    97,
-    2013,
-    2254,
-    1243,
-    1311,
-    2001,
-    1713,
-    1165,
-    1861,
-    1359,
-    2120,
-    274,
-    74,
-    496,
-    835,
-    242,
-    559,
-    49,
-    812,
-    753,
-    122,
-    2022,
-    1036,
-    591,
-    774,
-    1929,
-    2216,
-    940,
-    166,
-    2071,
-    505,
-    1517,
-    1240,
-    2152,
-    385,
-    1792,
-    1190,
-    1485,
-    2173,
-    1591,
-    1735,
-    2170,
-    2024,
-    1012,
-    2143,
-    280,
-    1541,
-    1593,
-    222,
-    2036,
-    1210,
-    728,
-    1400,
-    621,
-    1627,
-    1728,
-    1466,
-    2217,
-    1926,
-    1216,
-    1631,
-    2283,
+    824,
+    63,
+    2148,
+    275,
+    1676,
+    423,
+    399,
     31,
-    1992,
-    92,
-    613,
-    37,
+    234,
+    5,
+    10,
+    1039,
+    1635,
+    2198,
+    846,
+    2073,
+    1773,
+    1731,
+    815,
+    529,
+    658,
+    1724,
+    574,
+    2061,
+    487,
+    24,
+    2000,
+    793,
+    1358,
+    1252,
+    298,
+    2075,
+    707,
+    935,
+    1192,
+    226,
+    1055,
+    1922,
+    712,
+    2038,
+    2171,
+    772,
+    922,
+    99,
+    2173,
+    1258,
+    577,
+    2145,
+    1542,
+    149,
+    1425,
+    358,
+    2265,
+    541,
+    890,
+    2125,
+    513,
+    2242,
+    1566,
+    61,
+    116,
+    136,
+    1722,
+    172,
+    1505,
+    1646,
+    1054,
+    2018,
+    2199,
+    173,
+    1016,
+    1312,
+    763,
+    2308,
     296,
-    1474,
-    2272,
-    544,
-    1378,
-    1125,
-    1838,
-    1298,
-    1269,
-    260,
-    1925,
-    1363,
-    773,
-    8,
-    1697,
-    265,
-    436,
-    1424,
-    1640,
-    985,
-    2161,
-    476,
-    1579,
-    256,
+    726,
+    2130,
+    896,
+    2066,
+    375,
+    2132,
+    1347,
+    1798,
+    748,
+    597,
+    875,
     2017,
-    1852,
-    1145,
-    2292,
-    108,
-    1113,
-    2291,
-    160,
-    2070,
-    102,
-    405,
-    2155,
-    1352,
-    1403,
-    988,
-    1827,
-    307,
-    1013,
-    1703,
-    344,
-    115,
-    1989,
-    1041,
-    1962,
-    1620,
-    2213,
-    277,
-    907,
-    567,
-    630,
-    1405,
-    1107,
-    747,
-    214,
-    966,
-    1463,
-    1537,
-    1171,
-    995,
-    866,
-    622,
-    1522,
-    1425,
-    716,
-    1388,
-    427,
-    876,
-    2300,
-    451,
-    674,
-    131,
-    1021,
-    41,
-    300,
-    1497,
-    75,
-    267,
-    522,
-    1061,
-    1234,
-    182,
-    917,
-    2109,
-    784,
-    1959,
-    925,
-    1227,
-    725,
-    1375,
-    86,
-    1023,
-    2233,
-    2032,
-    314,
-    2197,
-    1291,
-    2236,
-    368,
-    1135,
-    1552,
-    643,
-    1112,
-    1947,
-    1006,
-    301,
-    2135,
-    1160,
-    1417,
-    885,
-    1624,
-    2010,
-    16,
-    619,
-    432,
-    1547,
+    720,
+    2060,
+    1253,
+    1322,
+    1796,
+    999,
+    926,
+    22,
+    1526,
+    588,
+    1369,
+    1917,
+    1012,
+    947,
+    255,
     1484,
-    857,
-    373,
-    475,
-    722,
-    2159,
-    461,
-    1087,
-    1124,
-    967,
+    1291,
+    1621,
+    995,
+    276,
+    245,
+    855,
+    1152,
+    1690,
+    756,
+    1902,
+    1671,
+    1443,
+    751,
+    1865,
+    1504,
+    812,
+    81,
+    97,
+    1327,
+    524,
+    1212,
+    2147,
+    212,
+    705,
     295,
-    710,
-    991,
-    1835,
-    1905,
-    2285,
-    1545,
-    597,
-    762,
-    114,
-    903,
-    263,
-    2117,
-    164,
-    2148,
-    1896,
-    1853,
-    281,
-    2027,
-    1169,
+    1908,
+    70,
+    1017,
+    1371,
+    1885,
+    1019,
+    673,
+    2280,
+    148,
+    860,
+    1709,
+    625,
+    2268,
+    629,
+    2138,
+    784,
+    1363,
+    1294,
+    426,
+    444,
+    1194,
+    534,
+    1706,
+    1233,
+    1980,
+    1097,
+    1321,
+    9,
+    1103,
+    828,
+    911,
+    406,
+    1203,
+    408,
+    1889,
+    1298,
+    146,
+    464,
+    1579,
+    489,
+    500,
+    1346,
+    1323,
+    2204,
+    1492,
+    591,
+    264,
+    783,
+    1075,
+    1854,
+    1330,
+    1460,
+    2065,
+    193,
+    2078,
+    1609,
+    374,
+    1997,
+    1560,
+    659,
+    886,
+    884,
+    1362,
+    249,
+    1179,
+    1069,
+    334,
+    2040,
+    422,
+    156,
+    2022,
+    634,
+    2023,
+    1297,
+    1325,
+    2224,
+    2068,
+    260,
+    1984,
+    759,
+    1365,
+    1614,
     847,
-    572,
-    2166,
+    1760,
+    724,
+    1939,
+    1024,
+    615,
+    806,
+    917,
+    155,
+    1659,
+    1543,
+    2267,
+    619,
+    1738,
+    979,
+    1531,
+    1838,
+    1158,
+    1269,
+    2250,
+    1167,
+    242,
+    122,
+    1061,
     1384,
-    1465,
-    862,
-    2279,
-    1864,
-    768,
-    608,
-    1803,
-    2106,
-    1114,
-    2266,
-    1377,
-    2239,
-    2231,
-    1025,
-    1527,
-    1090,
-    926,
-    841,
-    327,
-    1820,
-    2251,
-    2290,
-    121,
-    528,
-    435,
-    429,
-    1057,
-    1606,
-    363,
-    1719,
+    407,
+    1793,
+    892,
+    1190,
+    431,
+    1364,
+    205,
+    1674,
+    1206,
+    19,
+    637,
+    428,
+    446,
+    1959,
+    982,
+    36,
+    1011,
+    1473,
+    2032,
+    820,
+    2151,
+    1840,
+    741,
+    2,
+    1856,
+    638,
+    1426,
+    73,
+    803,
+    1873,
+    1554,
+    470,
     701,
-    388,
-    633,
-    962,
-    181,
-    481,
-    1053,
-    730,
-    2008,
-    1222,
-    1329,
-    312,
-    417,
-    118,
-    403,
-    705,
-    440,
-    2103,
-    153,
-    483,
-    213,
-    23,
-    1132,
-    1667,
-    2054,
-    1001,
-    278,
-    897,
-    398,
-    692,
-    1109,
-    1822,
-    284,
-    2286,
-    79,
-    708,
-    999,
-    527,
-    558,
-    1017,
-    172,
-    1698,
+    2002,
+    1309,
+    912,
+    526,
+    2288,
+    1119,
+    1438,
+    2047,
+    573,
+    1867,
+    1730,
+    1046,
+    2238,
+    1214,
+    314,
+    1992,
+    132,
+    201,
+    921,
+    1595,
+    794,
+    1962,
+    1529,
+    115,
+    1792,
+    2196,
+    189,
+    876,
+    1727,
+    1772,
     1335,
-    14,
-    519,
-    1916,
-    1428,
-    1244,
-    1683,
-    2205,
-    1142,
-    1994,
-    1602,
-    596,
-    1191,
-    1590,
-    459,
-    1783,
-    352,
-    1993,
-    1687,
-    1118,
-    119,
-    607,
-    1505,
-    1970,
+    2043,
+    885,
+    1195,
+    270,
+    1320,
+    126,
+    1868,
+    1881,
+    781,
+    433,
+    1744,
+    289,
+    1926,
+    1655,
+    457,
+    1747,
+    1081,
+    684,
+    111,
+    2081,
+    508,
+    1645,
+    1907,
+    1604,
+    253,
+    412,
+    1352,
+    1010,
+    1596,
+    1501,
+    1266,
+    1056,
+    499,
+    2006,
+    157,
+    1788,
+    1887,
+    1697,
+    1732,
+    218,
+    1345,
+    1243,
+    2113,
+    1628,
+    465,
+    581,
+    163,
+    810,
+    640,
+    1153,
+    2301,
+    639,
+    626,
+    1038,
+    416,
+    844,
+    2121,
+    2106,
+    2279,
+    1815,
+    1240,
+    2181,
+    414,
+    909,
+    493,
+    780,
+    645,
+    147,
+    1801,
+    2116,
     930,
-    2299,
-    1595,
-    767,
-    196,
-    1245,
-    718,
-    724,
-    142,
-    455,
-    1483,
-    456,
-    833,
-    748,
-    1330,
+    1502,
+    1804,
+    542,
+    1399,
+    82,
+    1216,
+    1859,
+    770,
+    1415,
+    1912,
+    1845,
+    1625,
+    788,
+    1594,
+    1334,
+    18,
+    680,
+    1161,
+    1025,
+    100,
+    1379,
     1475,
-    161,
-    140,
+    125,
+    1536,
+    1613,
+    1629,
+    2245,
+    228,
+    1409,
+    1414,
+    240,
+    1318,
+    1967,
+    346,
     501,
-    1578,
-    980,
-    1933,
-    2225,
-    1134,
-    1034,
+    649,
+    1811,
+    1686,
+    185,
+    507,
+    1435,
+    585,
+    1544,
+    660,
+    1230,
+    1961,
     916,
-    1865,
-    729,
-    1086,
-    382,
-    1075,
-    1690,
-    950,
-    1471,
-    1841,
-    824,
-    933,
-    530,
-    394,
-    790,
-    146,
-    471,
-    582,
-    1286,
-    1727,
-    899,
-    141,
-    2224,
-    1307,
-    1793,
-    1532,
-    1897,
-    594,
-    752,
-    1181,
-    1872,
-    1159,
-    1194,
-    898,
-    1342,
-    1785,
-    271,
-    1492,
-    574,
-    682,
-    1440,
+    355,
+    1299,
+    564,
+    268,
+    592,
+    721,
+    110,
+    145,
+    646,
+    1148,
+    197,
+    1953,
+    830,
+    753,
+    1717,
+    1664,
+    1528,
+    678,
+    1062,
+    2188,
+    1279,
+    1934,
+    223,
+    2187,
+    1014,
     1568,
-    1205,
-    390,
-    1594,
-    64,
-    694,
-    2057,
-    1938,
-    1721,
-    945,
-    1849,
-    84,
-    1889,
-    1030,
-    428,
-    1676,
-    111,
-    1157,
-    1696,
-    2228,
-    894,
-    2265,
-    1715,
-    818,
-    2067,
-    1009,
-    1546,
-    1765,
-    438,
-    1156,
-    571,
-    152,
-    1370,
-    1843,
-    78,
-    638,
-    1548,
-    1441,
+    1577,
+    2296,
+    2020,
+    1540,
+    2156,
+    1875,
+    1616,
+    1254,
+    259,
+    2095,
+    915,
+    1606,
+    2082,
+    2107,
+    593,
     1530,
+    1157,
+    2109,
+    1520,
+    1265,
+    248,
+    335,
+    1977,
+    675,
+    35,
+    87,
+    1146,
+    1658,
+    606,
+    449,
+    523,
+    472,
+    1343,
+    1386,
+    191,
+    40,
+    1830,
+    54,
+    50,
+    2200,
+    1288,
+    1964,
+    2091,
+    1078,
+    170,
+    958,
+    1382,
+    114,
+    410,
+    2190,
+    1360,
+    2249,
+    2053,
+    2162,
+    351,
+    2008,
+    1182,
+    2077,
+    1176,
+    2215,
+    2070,
+    1844,
+    229,
+    482,
+    2028,
+    1296,
+    1481,
+    1208,
+    1235,
+    962,
+    246,
+    933,
+    833,
+    943,
+    927,
+    2255,
+    363,
+    1990,
+    1246,
+    1447,
+    345,
+    302,
+    1746,
+    630,
+    307,
+    1553,
+    910,
+    1552,
+    1132,
+    2219,
+    1607,
+    409,
+    1728,
+    1836,
+    1324,
+    2049,
+    2277,
+    792,
+    1878,
+    1250,
+    1799,
+    494,
+    301,
+    735,
+    1780,
+    219,
+    48,
+    1387,
+    2179,
+    1895,
     2146,
-    257,
-    1064,
-    1633,
-    1509,
-    2064,
-    1386,
-    1738,
-    1617,
-    1707,
-    1249,
-    1029,
-    1587,
-    497,
-    167,
-    1137,
-    882,
-    1177,
-    2061,
-    1279,
-    2048,
-    1618,
-    1185,
-    863,
-    1747,
-    1366,
-    1571,
-    1260,
-    1842,
-    1045,
-    1437,
-    1328,
+    86,
+    893,
     2160,
-    2168,
-    1188,
-    1383,
-    964,
-    1922,
-    474,
-    2073,
-    252,
-    1253,
-    1984,
-    1950,
-    1534,
-    480,
-    408,
-    391,
-    430,
+    1155,
     861,
-    1100,
-    1646,
-    650,
-    889,
-    1288,
-    667,
-    1144,
-    871,
-    2273,
-    1451,
-    661,
-    1607,
-    2287,
-    2296,
-    1128,
-    1276,
-    1356,
-    984,
-    2230,
-    663,
-    1789,
-    1740,
-    1263,
-    781,
-    1734,
-    2304,
-    1421,
-    2034,
-    1170,
-    902,
-    760,
-    786,
-    1695,
-    1660,
-    43,
-    761,
-    939,
-    1235,
-    189,
-    1574,
-    1275,
-    2182,
-    849,
-    1184,
-    656,
-    2153,
-    2175,
-    2011,
-    587,
-    901,
-    1976,
+    1189,
+    1842,
+    1945,
+    550,
+    2165,
+    2137,
+    371,
+    551,
+    45,
+    382,
+    1049,
+    669,
+    1281,
+    13,
     174,
-    1812,
-    335,
-    1381,
-    912,
-    1615,
-    326,
-    736,
-    322,
-    1237,
-    1106,
-    1416,
-    446,
-    1694,
-    1901,
-    1943,
-    859,
-    1396,
-    563,
-    2176,
-    1408,
-    2133,
     779,
-    1431,
-    909,
-    970,
-    733,
-    2151,
-    993,
-    831,
-    62,
-    1666,
-    1494,
-    413,
-    1407,
-    523,
-    1651,
-    1722,
-    500,
-    1052,
-    1799,
-    610,
-    549,
-    825,
-    1317,
-    2002,
-    116,
-    127,
-    294,
-    1732,
-    1341,
-    2198,
-    447,
-    57,
-    1426,
-    802,
-    1096,
-    1246,
-    1826,
-    143,
-    1258,
-    726,
-    362,
-    865,
-    1489,
-    1997,
-    750,
-    145,
-    1521,
-    387,
-    2237,
-    402,
-    1506,
-    1839,
-    1105,
-    757,
-    434,
-    1879,
-    1773,
-    354,
-    424,
-    1890,
-    2134,
-    1195,
-    2004,
-    1296,
-    1151,
-    697,
-    85,
-    893,
-    486,
+    804,
+    877,
+    1541,
+    563,
+    1892,
+    519,
+    1825,
+    1620,
+    1855,
+    1740,
+    1587,
+    914,
+    1680,
+    2197,
+    1940,
+    734,
+    1000,
+    2016,
+    1693,
+    1077,
+    2153,
+    1803,
+    520,
+    94,
+    326,
+    1048,
+    1667,
+    485,
+    1514,
+    220,
+    1537,
+    1413,
+    1556,
     981,
-    1733,
-    1972,
-    2226,
-    1794,
-    1550,
-    458,
-    426,
+    1652,
     1083,
-    534,
-    227,
-    678,
-    1614,
+    835,
+    1193,
+    1015,
+    1561,
+    729,
+    6,
+    641,
+    1864,
+    261,
+    1115,
+    1898,
+    1336,
+    1973,
+    1344,
+    451,
+    799,
+    162,
+    385,
+    1262,
+    838,
+    2285,
+    723,
+    1404,
+    1888,
+    951,
+    2007,
+    357,
+    2289,
+    279,
+    1795,
+    1241,
+    2303,
+    1164,
+    137,
+    1150,
+    366,
+    89,
+    621,
+    853,
+    7,
+    790,
+    421,
+    1931,
+    832,
+    863,
+    936,
+    1487,
+    364,
+    1633,
+    2163,
+    392,
+    761,
+    532,
+    648,
+    1041,
+    1165,
+    1065,
     1924,
-    659,
-    216,
-    914,
-    1700,
-    1883,
-    502,
-    1450,
-    807,
-    1764,
-    206,
-    568,
-    1255,
-    811,
-    1454,
-    2041,
-    1362,
-    1507,
-    1724,
-    1392,
-    374,
-    58,
-    1932,
-    2141,
-    746,
+    837,
+    1828,
+    348,
+    743,
+    1060,
+    2205,
+    1133,
+    848,
+    1359,
+    655,
     1268,
-    1455,
-    878,
-    1649,
-    819,
-    778,
-    693,
-    236,
-    246,
-    1739,
-    509,
-    2204,
-    796,
-    1101,
-    1361,
-    952,
-    1093,
-    562,
-    1349,
-    1974,
-    589,
-    714,
-    1513,
-    1650,
-    2252,
-    1367,
-    1254,
-    341,
-    332,
-    272,
-    611,
-    955,
-    70,
-    948,
-    431,
-    1314,
-    2021,
-    1766,
-    2049,
-    448,
-    872,
-    584,
-    342,
-    1186,
-    224,
-    775,
-    2074,
-    89,
-    896,
-    1767,
-    628,
-    2212,
-    1189,
-    2094,
-    2108,
-    1515,
-    1110,
-    2102,
-    2235,
-    378,
-    13,
-    1138,
-    834,
+    21,
+    211,
+    1470,
+    1202,
+    356,
+    1018,
+    66,
+    1378,
+    1597,
+    2135,
+    1445,
+    1031,
+    1401,
+    1819,
+    467,
+    2161,
+    1255,
+    1045,
+    1479,
+    1996,
+    733,
+    1406,
+    44,
+    1104,
+    919,
+    1270,
+    1385,
+    2292,
+    1092,
+    438,
+    2226,
+    2213,
+    492,
+    604,
+    1107,
     874,
-    1968,
-    738,
-    700,
-    1414,
-    2264,
-    1010,
-    1635,
-    603,
-    1071,
-    1908,
-    2039,
-    2246,
-    253,
-    2105,
-    1524,
-    457,
-    1543,
-    1876,
-    443,
-    888,
+    2143,
+    1975,
+    543,
+    1665,
+    2026,
+    1848,
+    2080,
+    27,
+    1866,
+    2102,
+    651,
+    171,
+    1171,
+    697,
+    1729,
+    1775,
+    1643,
+    1367,
+    826,
+    1458,
+    871,
+    1513,
+    1511,
+    2297,
+    544,
+    344,
+    1770,
+    750,
+    1461,
+    1499,
+    1839,
+    989,
+    1571,
+    1094,
+    37,
+    1311,
+    1033,
+    1723,
+    1751,
+    1814,
+    509,
     798,
-    1139,
-    124,
-    1891,
-    113,
-    1915,
-    147,
-    1054,
-    1340,
-    30,
-    1692,
-    771,
-    1182,
-    1435,
-    139,
-    452,
-    1830,
-    1226,
-    1704,
+    1850,
+    52,
+    555,
+    1141,
+    702,
+    1677,
+    386,
+    1372,
+    652,
+    183,
+    1631,
+    1237,
+    769,
+    2272,
+    1699,
+    1429,
+    1112,
+    202,
+    2239,
+    937,
+    1063,
+    1433,
+    1459,
+    2093,
+    2155,
+    795,
+    78,
+    1392,
+    857,
+    1632,
+    1242,
+    1759,
+    1564,
+    304,
+    1824,
+    1494,
+    1457,
+    600,
+    764,
     1644,
-    2169,
-    371,
-    1856,
-    1814,
-    890,
-    323,
-    973,
-    742,
-    1326,
-    1951,
-    6,
-    1881,
-    634,
-    1368,
-    2018,
-    1588,
-    1730,
-    28,
-    2215,
-    228,
-    2033,
-    1280,
-    1423,
-    2044,
-    454,
+    2058,
+    1694,
     1491,
-    1969,
-    1058,
-    2069,
-    177,
-    1446,
-    1652,
-    2278,
-    1836,
-    763,
-    1481,
-    855,
-    2124,
-    1273,
-    1271,
-    1684,
-    1726,
-    1257,
-    1679,
-    908,
-    615,
-    2140,
-    2040,
-    1685,
-    2053,
-    69,
-    892,
-    1433,
-    399,
-    1292,
-    580,
-    467,
-    2145,
+    103,
+    967,
+    663,
+    2166,
+    1719,
+    902,
+    1933,
+    128,
+    1562,
+    2025,
+    1916,
+    1981,
+    1361,
+    1575,
+    757,
+    800,
+    839,
+    575,
+    1743,
+    1533,
+    608,
+    1129,
+    34,
     1923,
-    149,
-    2099,
-    1816,
-    776,
-    986,
-    645,
-    904,
-    906,
-    1904,
-    0,
-    1353,
-    1586,
-    2042,
-    1503,
-    1737,
-    1512,
-    1163,
-    1621,
-    1116,
-    2086,
-    1918,
-    1397,
-    1817,
-    518,
-    60,
-    578,
-    2076,
-    1971,
-    1265,
-    2164,
-    2269,
-    832,
-    377,
-    994,
-    845,
-    289,
-    479,
-    66,
-    690,
-    1241,
-    290,
-    1339,
-    1882,
-    1127,
-    187,
-    1306,
-    1788,
-    2139,
-    685,
-    1628,
-    2052,
-    935,
-    1238,
-    1200,
-    1084,
-    1725,
-    2129,
-    2245,
-    772,
-    2186,
-    158,
-    1553,
-    1605,
-    1558,
-    194,
-    851,
-    1501,
+    1064,
+    2036,
+    1264,
+    614,
+    889,
+    463,
+    2234,
+    1846,
+    1600,
+    1752,
+    1876,
+    495,
+    1355,
+    561,
+    65,
+    1549,
+    199,
+    397,
+    1100,
+    2094,
+    462,
+    505,
+    1029,
+    2004,
+    1958,
+    2221,
+    677,
+    1508,
+    342,
+    1249,
+    1042,
+    580,
+    1688,
+    1181,
+    1464,
+    732,
+    870,
+    992,
+    1794,
+    537,
+    1721,
+    1518,
+    1449,
+    1375,
+    1656,
+    1946,
+    2144,
+    430,
+    2158,
+    1168,
+    1229,
+    1052,
+    1636,
+    1687,
+    1976,
+    2103,
+    1991,
+    1602,
+    107,
+    752,
+    1951,
+    1894,
+    869,
+    2029,
+    395,
+    1812,
     2114,
-    39,
-    1573,
+    2260,
+    1534,
+    2012,
+    448,
+    882,
     1589,
-    1225,
-    719,
-    1413,
-    83,
-    1787,
-    369,
-    1355,
-    1380,
-    1347,
-    2136,
-    441,
-    976,
-    1346,
-    45,
-    745,
-    838,
-    515,
-    586,
-    2188,
-    982,
-    698,
-    59,
-    1693,
-    1798,
-    2131,
-    2084,
-    2295,
-    1264,
-    198,
-    1486,
-    34,
-    1358,
-    1939,
-    472,
-    679,
-    631,
-    1985,
-    2060,
-    1035,
+    1834,
+    277,
+    1405,
+    1982,
+    1427,
+    708,
+    1696,
+    2212,
+    64,
+    257,
+    1173,
+    1350,
+    610,
+    1857,
+    384,
+    102,
+    2101,
+    1285,
+    456,
+    1546,
+    475,
     1126,
-    1900,
-    94,
-    2063,
-    61,
-    1906,
-    2007,
-    1600,
-    1931,
-    1806,
-    702,
-    609,
-    2087,
-    570,
+    41,
+    582,
+    2112,
+    948,
+    704,
+    379,
+    1592,
+    894,
+    549,
+    602,
     1979,
-    2005,
-    2078,
-    1379,
-    823,
-    1921,
-    226,
-    2229,
-    717,
-    954,
-    649,
-    2201,
-    418,
-    1082,
-    1775,
-    504,
-    706,
-    814,
-    217,
-    159,
-    1334,
+    1125,
+    2104,
+    984,
+    93,
+    1397,
+    322,
+    473,
+    471,
+    778,
+    491,
+    1422,
+    2307,
     2247,
-    1070,
-    1559,
-    516,
-    1289,
-    232,
-    1048,
-    535,
-    915,
-    261,
-    345,
-    24,
-    346,
-    1777,
-    2080,
-    1250,
-    1299,
-    1019,
-    1671,
-    873,
-    1432,
-    605,
-    542,
-    1479,
-    1040,
-    133,
-    944,
-    1066,
-    1496,
-    54,
-    2062,
-    248,
-    1213,
-    439,
-    416,
-    1333,
-    1050,
-    671,
-    1133,
-    1996,
-    978,
-    2238,
-    1659,
-    1873,
-    723,
-    557,
-    56,
-    268,
-    1988,
-    860,
-    1324,
-    1351,
-    905,
-    397,
-    21,
-    805,
-    618,
-    1946,
-    1710,
-    1215,
-    2268,
-    53,
-    25,
-    932,
-    110,
-    1800,
-    1866,
-    957,
-    38,
-    1743,
-    9,
-    305,
-    1453,
-    2297,
-    2006,
-    2116,
-    1028,
-    1033,
-    992,
-    1198,
-    1161,
-    1158,
-    579,
-    364,
-    929,
-    937,
-    665,
-    1990,
-    1999,
-    1409,
-    235,
-    1977,
-    727,
-    1781,
+    20,
+    26,
 };
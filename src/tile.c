@@ -0,0 +1,171 @@
+//===--------------------------------------------------------------------------------------------===
+// tile.c - Cache-tiled pattern histograms, for ranking every guess on large dictionaries
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "tile.h"
+#include "memory.h"
+#include "pool.h"
+#include "score.h"
+#include "set.h"
+#include <assert.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define TILE_MAGIC      "JWCT"
+#define TILE_VERSION    (1)
+
+// Spill file layout, in host byte order like the book: the header, one byte per tile of guesses
+// (set once its histograms are complete), then PATTERN_COUNT counts per guess from hist_offset().
+typedef struct {
+    char            magic[4];
+    uint32_t        version;
+    uint32_t        lexicon_hash;
+    uint32_t        words_hash;
+    uint32_t        guess_count;
+    uint32_t        word_count;
+} tile_header_t;
+
+typedef struct {
+    const lexicon_t *lex;
+    const word_t    *words;
+    unsigned        count;
+    double          *entropy;
+    // lex->patterns, when the words are the answer list: rows are read rather than scored.
+    const pattern_t *matrix;
+    
+    unsigned        *scratch;       // TILE_GUESSES * PATTERN_COUNT per worker, unless spilling.
+    pattern_t       *patterns;      // TILE_ANSWERS per worker.
+    uint8_t         *done;          // In the spill file, or NULL.
+    unsigned        *spilled;       // Every guess's histogram, in the spill file.
+} tile_job_t;
+
+static size_t hist_offset(unsigned tile_count) {
+    return (sizeof(tile_header_t) + tile_count + 63) & ~(size_t)63;
+}
+
+static uint32_t hash_words(const word_t *words, unsigned count) {
+    uint32_t hash = jawc_hash_word(count);
+    for(unsigned i = 0; i < count; ++i) {
+        hash = jawc_hash_word(hash ^ words[i]);
+    }
+    return hash;
+}
+
+static void tile_range(void *ctx, unsigned worker, unsigned begin, unsigned end) {
+    tile_job_t *job = ctx;
+    const lexicon_t *lex = job->lex;
+    pattern_t *patterns = job->patterns + worker * TILE_ANSWERS;
+    
+    for(unsigned t = begin; t < end; ++t) {
+        unsigned first = t * TILE_GUESSES;
+        unsigned guesses = lex->guess_count - first < TILE_GUESSES
+                         ? lex->guess_count - first : TILE_GUESSES;
+        unsigned (*hist)[PATTERN_COUNT] = job->done
+            ? (unsigned (*)[PATTERN_COUNT])(job->spilled + first * PATTERN_COUNT)
+            : (unsigned (*)[PATTERN_COUNT])(job->scratch + worker * TILE_GUESSES * PATTERN_COUNT);
+        
+        if(!job->done || !job->done[t]) {
+            memset(hist, 0, guesses * sizeof(hist[0]));
+            for(unsigned a = 0; a < job->count; a += TILE_ANSWERS) {
+                unsigned size = job->count - a < TILE_ANSWERS ? job->count - a : TILE_ANSWERS;
+                for(unsigned g = 0; g < guesses; ++g) {
+                    const pattern_t *row = patterns;
+                    if(job->matrix) {
+                        row = job->matrix + (size_t)(first + g) * lex->answer_count + a;
+                    } else {
+                        score_batch(lex->guesses[first + g], job->words + a, size, patterns);
+                    }
+                    for(unsigned i = 0; i < size; ++i) {
+                        hist[g][row[i]] += 1;
+                    }
+                }
+            }
+            if(job->done) job->done[t] = 1;
+        }
+        for(unsigned g = 0; g < guesses; ++g) {
+            job->entropy[first + g] = pattern_entropy(hist[g], job->count);
+        }
+    }
+}
+
+// Maps the spill file, keeping the tiles it already has if it was made for the same words.
+static void *map_spill(tile_job_t *job, const char *path, unsigned tile_count, size_t *size) {
+    const lexicon_t *lex = job->lex;
+    tile_header_t header = {
+        .magic = TILE_MAGIC,
+        .version = TILE_VERSION,
+        .lexicon_hash = lexicon_hash(lex),
+        .words_hash = hash_words(job->words, job->count),
+        .guess_count = lex->guess_count,
+        .word_count = job->count,
+    };
+    *size = hist_offset(tile_count) + (size_t)lex->guess_count * PATTERN_COUNT * sizeof(unsigned);
+    
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if(fd < 0) return NULL;
+    struct stat info;
+    tile_header_t old;
+    bool fresh = true;
+    if(fstat(fd, &info) != 0) goto errout;
+    if(info.st_size > 0) {
+        // Anything but one of our own files is left alone.
+        if(pread(fd, &old, sizeof(old), 0) != sizeof(old)) goto errout;
+        if(memcmp(old.magic, TILE_MAGIC, sizeof(old.magic))) goto errout;
+        fresh = (size_t)info.st_size != *size || memcmp(&old, &header, sizeof(header));
+    }
+    if(fresh && (ftruncate(fd, 0) != 0 || ftruncate(fd, *size) != 0)) goto errout;
+    
+    void *map = mmap(NULL, *size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if(map == MAP_FAILED) return NULL;
+    if(fresh) memcpy(map, &header, sizeof(header));
+    job->done = (uint8_t *)map + sizeof(tile_header_t);
+    job->spilled = (unsigned *)((uint8_t *)map + hist_offset(tile_count));
+    return map;
+
+errout:
+    close(fd);
+    return NULL;
+}
+
+bool tile_entropy(const lexicon_t *lex, const word_t *words, unsigned count,
+                  const tile_options_t *options, double *entropy) {
+    assert(lex);
+    assert(words || !count);
+    assert(options);
+    assert(entropy);
+    lexicon_wait(lex);
+    
+    unsigned tile_count = (lex->guess_count + TILE_GUESSES - 1) / TILE_GUESSES;
+    tile_job_t job = {.lex = lex, .words = words, .count = count, .entropy = entropy};
+    if(words == lex->answers && count == lex->answer_count) job.matrix = lex->patterns;
+    void *map = NULL;
+    size_t map_size = 0;
+    if(options->spill_path) {
+        map = map_spill(&job, options->spill_path, tile_count, &map_size);
+        if(!map) return false;
+    }
+    
+    pool_t pool;
+    pool_init(&pool, options->threads);
+    unsigned workers = pool.thread_count;
+    job.patterns = safe_malloc(workers * TILE_ANSWERS * sizeof(pattern_t));
+    if(!map) job.scratch = safe_malloc(workers * TILE_GUESSES * PATTERN_COUNT * sizeof(unsigned));
+    pool_for(&pool, tile_count, 1, tile_range, &job);
+    pool_fini(&pool);
+    safe_free(job.patterns);
+    safe_free(job.scratch);
+    
+    if(map) {
+        msync(map, map_size, MS_SYNC);
+        munmap(map, map_size);
+    }
+    return true;
+}
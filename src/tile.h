@@ -0,0 +1,37 @@
+//===--------------------------------------------------------------------------------------------===
+// tile.h - Cache-tiled pattern histograms, for ranking every guess on large dictionaries
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef TILE_H
+#define TILE_H
+
+#include "lexicon.h"
+
+// The guess x answer pattern matrix is never stored: it is scored one tile at a time, a tile of
+// guesses against a tile of answers, and only the guesses' histograms are kept. A tile of answers
+// and its patterns stay in L1 while every guess of the tile goes over them, and the histograms of a
+// tile of guesses (TILE_GUESSES * PATTERN_COUNT counts, 31kB) stay in L2. Tiles of guesses are
+// what workers share out, so memory doesn't depend on the size of the dictionary.
+#define TILE_GUESSES    (32)
+#define TILE_ANSWERS    (2048)
+
+typedef struct {
+    unsigned        threads;        // 0 for one per CPU.
+    // Optional: keep the histograms of every guess in this file, mapped rather than in memory. A
+    // run that is interrupted picks up from the tiles it had finished, if the file is given again
+    // with the same lexicon and words. Writes aren't synced until the end, so this covers the
+    // process dying, not the machine.
+    const char      *spill_path;
+} tile_options_t;
+
+// Writes to `entropy[g]` the entropy of the patterns lex->guesses[g] gets against the `count`
+// words, for every guess. Returns false if the spill file couldn't be used, and leaves `entropy`
+// alone.
+bool tile_entropy(const lexicon_t *lex, const word_t *words, unsigned count,
+                  const tile_options_t *options, double *entropy);
+
+#endif /* end of include guard: TILE_H */
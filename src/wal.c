@@ -0,0 +1,466 @@
+//===--------------------------------------------------------------------------------------------===
+// wal.c - Session log records, group commit, replay and compaction
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#include "wal.h"
+#include "memory.h"
+#include "profile.h"
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define WAL_MAGIC       "JWCW"
+#define WAL_VERSION     (1)
+
+typedef struct {
+    char            magic[4];
+    uint32_t        version;
+    uint64_t        lexicon_hash;
+} wal_header_t;
+
+typedef enum {
+    WAL_RECORD_BEGIN = 1,           // `value` is the puzzle number.
+    WAL_RECORD_GUESS,               // `value` is the word.
+    WAL_RECORD_END,
+} wal_record_type_t;
+
+// One record per event, in host byte order like the other caches. `check` covers the rest of the
+// record, so a write torn by a crash is told apart from a real one.
+typedef struct {
+    uint32_t        id;
+    uint8_t         type;
+    uint8_t         mode;
+    uint8_t         board_count;
+    uint8_t         reserved;
+    uint32_t        value;
+    uint32_t        check;
+} wal_record_t;
+
+static uint32_t record_check(const wal_record_t *record) {
+    const uint8_t *bytes = (const uint8_t *)record;
+    uint32_t hash = 2166136261u;
+    for(unsigned i = 0; i < offsetof(wal_record_t, check); ++i) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Session table -------------------------------------------------------------------------------
+
+static unsigned slot_of(const wal_t *wal, uint32_t id) {
+    uint32_t hash = id * 0x9e3779b1u;
+    return (hash ^ (hash >> 16)) & (wal->session_capacity - 1);
+}
+
+// board_count is never 0 for a real session, so it marks empty slots.
+static wal_session_t *session_find(wal_t *wal, uint32_t id) {
+    for(unsigned i = slot_of(wal, id);; i = (i + 1) & (wal->session_capacity - 1)) {
+        wal_session_t *session = &wal->sessions[i];
+        if(!session->board_count) return NULL;
+        if(session->id == id) return session;
+    }
+}
+
+static wal_session_t *session_insert(wal_t *wal, uint32_t id);
+
+static void session_grow(wal_t *wal) {
+    wal_session_t *old = wal->sessions;
+    unsigned old_capacity = wal->session_capacity;
+    wal->session_capacity = old_capacity ? old_capacity * 2 : 64;
+    wal->sessions = safe_calloc(wal->session_capacity, sizeof(wal_session_t));
+    wal->session_count = 0;
+    for(unsigned i = 0; i < old_capacity; ++i) {
+        if(old[i].board_count) *session_insert(wal, old[i].id) = old[i];
+    }
+    safe_free(old);
+}
+
+static wal_session_t *session_insert(wal_t *wal, uint32_t id) {
+    if(2 * (wal->session_count + 1) > wal->session_capacity) session_grow(wal);
+    unsigned i = slot_of(wal, id);
+    while(wal->sessions[i].board_count) {
+        i = (i + 1) & (wal->session_capacity - 1);
+    }
+    wal->session_count += 1;
+    wal->sessions[i].id = id;
+    return &wal->sessions[i];
+}
+
+// Linear probing without tombstones: entries after the hole that would no longer be reachable
+// from their home slot are shifted back into it.
+static void session_remove(wal_t *wal, wal_session_t *session) {
+    unsigned mask = wal->session_capacity - 1;
+    unsigned hole = session - wal->sessions;
+    for(unsigned i = (hole + 1) & mask; wal->sessions[i].board_count; i = (i + 1) & mask) {
+        unsigned home = slot_of(wal, wal->sessions[i].id);
+        if(((i - home) & mask) >= ((i - hole) & mask)) {
+            wal->sessions[hole] = wal->sessions[i];
+            hole = i;
+        }
+    }
+    wal->sessions[hole].board_count = 0;
+    wal->session_count -= 1;
+}
+
+// Brings the session table up to date with one record. Records that don't fit what the table
+// knows (a guess for a session that never began) are dropped.
+static void apply_record(wal_t *wal, const wal_record_t *record) {
+    wal_session_t *session = wal->session_capacity ? session_find(wal, record->id) : NULL;
+    switch(record->type) {
+    case WAL_RECORD_BEGIN:
+        if(session) {
+            wal->live_records -= 1 + session->guess_count;
+        } else {
+            session = session_insert(wal, record->id);
+        }
+        session->mode = record->mode;
+        session->board_count = record->board_count;
+        session->guess_count = 0;
+        session->seq = record->value;
+        wal->live_records += 1;
+        break;
+    
+    case WAL_RECORD_GUESS:
+        if(!session || session->guess_count >= MAX_TURNS) break;
+        session->guesses[session->guess_count++] = record->value;
+        wal->live_records += 1;
+        break;
+    
+    case WAL_RECORD_END:
+        if(!session) break;
+        wal->live_records -= 1 + session->guess_count;
+        session_remove(wal, session);
+        break;
+    }
+}
+
+static bool record_valid(const wal_record_t *record) {
+    if(record->check != record_check(record)) return false;
+    if(record->type < WAL_RECORD_BEGIN || record->type > WAL_RECORD_END) return false;
+    if(record->type != WAL_RECORD_BEGIN) return true;
+    return record->board_count >= 1 && record->board_count <= MAX_BOARDS;
+}
+
+// File I/O ------------------------------------------------------------------------------------
+
+static bool write_all(int fd, const void *data, uint64_t size) {
+    const uint8_t *bytes = data;
+    while(size) {
+        ssize_t written = write(fd, bytes, size);
+        if(written < 0 && errno == EINTR) continue;
+        if(written <= 0) return false;
+        bytes += written;
+        size -= written;
+    }
+    return true;
+}
+
+static bool read_all(int fd, void *data, uint64_t size) {
+    uint8_t *bytes = data;
+    while(size) {
+        ssize_t got = read(fd, bytes, size);
+        if(got < 0 && errno == EINTR) continue;
+        if(got <= 0) return false;
+        bytes += got;
+        size -= got;
+    }
+    return true;
+}
+
+static bool write_header(wal_t *wal, int fd) {
+    wal_header_t header = {.version = WAL_VERSION, .lexicon_hash = lexicon_hash(wal->lexicon)};
+    memcpy(header.magic, WAL_MAGIC, sizeof(header.magic));
+    return write_all(fd, &header, sizeof(header));
+}
+
+// A rename is only durable once the directory holding it is synced.
+static bool sync_parent(const char *path) {
+    const char *slash = strrchr(path, '/');
+    char *dir = safe_malloc(slash ? (size_t)(slash - path) + 2 : 2);
+    if(!slash) {
+        strcpy(dir, ".");
+    } else {
+        size_t len = slash == path ? 1 : (size_t)(slash - path);
+        memcpy(dir, path, len);
+        dir[len] = '\0';
+    }
+    int fd = open(dir, O_RDONLY);
+    safe_free(dir);
+    if(fd < 0) return false;
+    bool ok = fsync(fd) == 0;
+    close(fd);
+    return ok;
+}
+
+static void buffer_push(wal_buffer_t *buffer, const void *data, uint64_t size) {
+    if(buffer->size + size > buffer->capacity) {
+        buffer->capacity = buffer->capacity ? buffer->capacity * 2 : 4096;
+        buffer->data = safe_realloc(buffer->data, buffer->capacity);
+    }
+    memcpy(buffer->data + buffer->size, data, size);
+    buffer->size += size;
+}
+
+// Reads the records after the header into the session table, and returns where the last good
+// one ends.
+static uint64_t replay(wal_t *wal, uint64_t size) {
+    uint64_t end = sizeof(wal_header_t);
+    uint64_t count = (size - end) / sizeof(wal_record_t);
+    if(!count) return end;
+    
+    wal_record_t *records = safe_malloc(count * sizeof(wal_record_t));
+    if(read_all(wal->fd, records, count * sizeof(wal_record_t))) {
+        for(uint64_t i = 0; i < count && record_valid(&records[i]); ++i) {
+            apply_record(wal, &records[i]);
+            end += sizeof(wal_record_t);
+        }
+    }
+    safe_free(records);
+    return end;
+}
+
+bool wal_open(wal_t *wal, const lexicon_t *lexicon, const char *path,
+              const wal_options_t *options) {
+    assert(wal);
+    assert(lexicon);
+    assert(path);
+    assert(options);
+    lexicon_wait(lexicon);
+    
+    memset(wal, 0, sizeof(*wal));
+    wal->lexicon = lexicon;
+    wal->options = *options;
+    wal->fd = open(path, O_RDWR | O_CREAT, 0644);
+    if(wal->fd < 0) return false;
+    
+    struct stat info;
+    if(fstat(wal->fd, &info) != 0) goto errout;
+    uint64_t size = info.st_size;
+    if(size < sizeof(wal_header_t)) {
+        // Empty, or the crash came before the header was even written.
+        if(ftruncate(wal->fd, 0) != 0 || !write_header(wal, wal->fd)) goto errout;
+        if(fsync(wal->fd) != 0) goto errout;
+        size = sizeof(wal_header_t);
+    } else {
+        wal_header_t header;
+        if(!read_all(wal->fd, &header, sizeof(header))) goto errout;
+        if(memcmp(header.magic, WAL_MAGIC, sizeof(header.magic))) goto errout;
+        if(header.version != WAL_VERSION) goto errout;
+        if(header.lexicon_hash != lexicon_hash(lexicon)) goto errout;
+        
+        uint64_t end = replay(wal, size);
+        if(end != size && ftruncate(wal->fd, end) != 0) goto errout;
+        size = end;
+    }
+    if(lseek(wal->fd, size, SEEK_SET) < 0) goto errout;
+    
+    size_t path_len = strlen(path) + 1;
+    wal->path = safe_malloc(path_len);
+    memcpy(wal->path, path, path_len);
+    wal->file_size = size;
+    pthread_mutex_init(&wal->lock, NULL);
+    pthread_cond_init(&wal->flushed, NULL);
+    return true;
+
+errout:
+    close(wal->fd);
+    safe_free(wal->sessions);
+    return false;
+}
+
+void wal_close(wal_t *wal) {
+    assert(wal);
+    wal_commit(wal, wal->next_lsn - 1);
+    close(wal->fd);
+    pthread_cond_destroy(&wal->flushed);
+    pthread_mutex_destroy(&wal->lock);
+    safe_free(wal->pending.data);
+    safe_free(wal->spare.data);
+    safe_free(wal->sessions);
+    safe_free(wal->path);
+}
+
+unsigned wal_recover(wal_t *wal, wal_recover_fn fn, void *ctx) {
+    assert(wal);
+    assert(fn);
+    unsigned count = 0;
+    for(unsigned i = 0; i < wal->session_capacity; ++i) {
+        const wal_session_t *session = &wal->sessions[i];
+        if(!session->board_count) continue;
+        
+        game_t game;
+        if(session->mode == GAME_MODE_ABSURDLE) {
+            game_init_absurdle(&game, wal->lexicon);
+        } else {
+            game_init_boards(&game, wal->lexicon, session->seq, session->board_count);
+        }
+        const guess_t *guess = NULL;
+        for(unsigned g = 0; g < session->guess_count; ++g) {
+            game_submit_word(&game, session->guesses[g], &guess);
+        }
+        fn(ctx, session->id, &game);
+        count += 1;
+    }
+    return count;
+}
+
+// Appending -----------------------------------------------------------------------------------
+
+static uint64_t append(wal_t *wal, wal_record_t record) {
+    record.check = record_check(&record);
+    pthread_mutex_lock(&wal->lock);
+    apply_record(wal, &record);
+    buffer_push(&wal->pending, &record, sizeof(record));
+    uint64_t lsn = wal->next_lsn++;
+    pthread_mutex_unlock(&wal->lock);
+    return lsn;
+}
+
+uint64_t wal_begin(wal_t *wal, uint32_t id, const game_t *game) {
+    assert(wal);
+    assert(game);
+    return append(wal, (wal_record_t){.id = id, .type = WAL_RECORD_BEGIN, .mode = game->mode,
+                                      .board_count = game->board_count, .value = game->seq});
+}
+
+uint64_t wal_guess(wal_t *wal, uint32_t id, word_t guess) {
+    assert(wal);
+    return append(wal, (wal_record_t){.id = id, .type = WAL_RECORD_GUESS, .value = guess});
+}
+
+uint64_t wal_end(wal_t *wal, uint32_t id) {
+    assert(wal);
+    return append(wal, (wal_record_t){.id = id, .type = WAL_RECORD_END});
+}
+
+// Writes the open sessions to a new file next to the log and renames it over the log. Called with
+// the lock held and no flush running; every record appended so far is reflected in the table, so
+// the pending buffer is dropped and counts as committed.
+static bool compact_locked(wal_t *wal) {
+    uint64_t start = prof_begin();
+    size_t path_len = strlen(wal->path);
+    char *tmp_path = safe_malloc(path_len + 5);
+    memcpy(tmp_path, wal->path, path_len);
+    memcpy(tmp_path + path_len, ".tmp", 5);
+    
+    int fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(fd < 0) {
+        safe_free(tmp_path);
+        return false;
+    }
+    
+    wal_buffer_t out = {0};
+    for(unsigned i = 0; i < wal->session_capacity; ++i) {
+        const wal_session_t *session = &wal->sessions[i];
+        if(!session->board_count) continue;
+        wal_record_t record = {.id = session->id, .type = WAL_RECORD_BEGIN, .mode = session->mode,
+                               .board_count = session->board_count, .value = session->seq};
+        record.check = record_check(&record);
+        buffer_push(&out, &record, sizeof(record));
+        for(unsigned g = 0; g < session->guess_count; ++g) {
+            record = (wal_record_t){.id = session->id, .type = WAL_RECORD_GUESS,
+                                    .value = session->guesses[g]};
+            record.check = record_check(&record);
+            buffer_push(&out, &record, sizeof(record));
+        }
+    }
+    
+    // Synced whatever the options say: a rename over the log that lands before its data would
+    // lose every session, not just the last few guesses.
+    bool ok = write_header(wal, fd) && write_all(fd, out.data, out.size) && fsync(fd) == 0;
+    ok = ok && rename(tmp_path, wal->path) == 0 && sync_parent(wal->path);
+    if(ok) {
+        close(wal->fd);
+        wal->fd = fd;
+        wal->file_size = sizeof(wal_header_t) + out.size;
+        wal->pending.size = 0;
+        wal->durable_lsn = wal->next_lsn;
+    } else {
+        close(fd);
+        unlink(tmp_path);
+    }
+    safe_free(out.data);
+    safe_free(tmp_path);
+    prof_end(PROF_WAL_COMPACT, start);
+    return ok;
+}
+
+static bool should_compact(const wal_t *wal) {
+    if(!wal->options.compact_bytes || wal->file_size < wal->options.compact_bytes) return false;
+    return 2 * wal->live_records * sizeof(wal_record_t) < wal->file_size;
+}
+
+// Leader side of group commit: takes everything pending, writes it without holding the lock, and
+// publishes the new durable position. Called and returns with the lock held.
+static void flush_locked(wal_t *wal) {
+    wal->flushing = true;
+    if(wal->options.group_window_ns) {
+        pthread_mutex_unlock(&wal->lock);
+        struct timespec delay = {
+            .tv_sec = wal->options.group_window_ns / 1000000000ull,
+            .tv_nsec = wal->options.group_window_ns % 1000000000ull,
+        };
+        nanosleep(&delay, NULL);
+        pthread_mutex_lock(&wal->lock);
+    }
+    
+    wal_buffer_t group = wal->pending;
+    wal->pending = wal->spare;
+    wal->pending.size = 0;
+    uint64_t upto = wal->next_lsn;
+    pthread_mutex_unlock(&wal->lock);
+    
+    uint64_t start = prof_begin();
+    bool ok = write_all(wal->fd, group.data, group.size);
+    if(ok && wal->options.fsync) ok = fdatasync(wal->fd) == 0;
+    
+    pthread_mutex_lock(&wal->lock);
+    prof_end(PROF_WAL_FLUSH, start);
+    prof_sample(PROF_WAL_GROUP, group.size / sizeof(wal_record_t));
+    wal->spare = group;
+    wal->flushing = false;
+    if(ok) {
+        wal->file_size += group.size;
+        wal->durable_lsn = upto;
+        if(should_compact(wal)) compact_locked(wal);
+    } else {
+        wal->failed = true;
+    }
+    pthread_cond_broadcast(&wal->flushed);
+}
+
+bool wal_commit(wal_t *wal, uint64_t lsn) {
+    assert(wal);
+    pthread_mutex_lock(&wal->lock);
+    while(!wal->failed && wal->durable_lsn <= lsn && lsn < wal->next_lsn) {
+        if(wal->flushing) {
+            pthread_cond_wait(&wal->flushed, &wal->lock);
+        } else {
+            flush_locked(wal);
+        }
+    }
+    bool ok = !wal->failed;
+    pthread_mutex_unlock(&wal->lock);
+    return ok;
+}
+
+bool wal_compact(wal_t *wal) {
+    assert(wal);
+    pthread_mutex_lock(&wal->lock);
+    while(wal->flushing) {
+        pthread_cond_wait(&wal->flushed, &wal->lock);
+    }
+    bool ok = !wal->failed && compact_locked(wal);
+    pthread_cond_broadcast(&wal->flushed);
+    pthread_mutex_unlock(&wal->lock);
+    return ok;
+}
@@ -0,0 +1,96 @@
+//===--------------------------------------------------------------------------------------------===
+// wal.h - Write-ahead log of game sessions
+//
+// Created by Amy Parent <amy@amyparent.com>
+// Copyright (c) 2022 Amy Parent
+// Licensed under the MIT License
+// =^•.•^=
+//===--------------------------------------------------------------------------------------------===
+#ifndef WAL_H
+#define WAL_H
+
+#include "game.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+    // Sync every group to disk. Without it, a crash of the whole machine (rather than the
+    // process) can lose the last few guesses.
+    bool            fsync;
+    // How long a committer waits for others to join its group before writing it. 0 still groups
+    // whatever queued up during the previous write.
+    uint64_t        group_window_ns;
+    // Rewrite the log once it is past this size and mostly finished sessions. 0 never does.
+    uint64_t        compact_bytes;
+} wal_options_t;
+
+// What the log knows of a session that hasn't ended: enough to replay it.
+typedef struct {
+    uint32_t        id;
+    uint8_t         mode;
+    uint8_t         board_count;
+    uint8_t         guess_count;
+    uint32_t        seq;
+    word_t          guesses[MAX_TURNS];
+} wal_session_t;
+
+typedef struct {
+    uint8_t         *data;
+    uint64_t        size;
+    uint64_t        capacity;
+} wal_buffer_t;
+
+// Records are appended to an in-memory buffer under `lock`; wal_commit() makes them durable. The
+// first committer to find nobody writing becomes the leader: it takes the whole buffer, writes and
+// syncs it in one go, and wakes every committer whose record made it in. Anyone who commits while
+// it does that waits for it, then the next leader takes all of them at once.
+typedef struct {
+    const lexicon_t *lexicon;
+    char            *path;
+    int             fd;
+    wal_options_t   options;
+    
+    pthread_mutex_t lock;
+    pthread_cond_t  flushed;
+    bool            flushing;
+    bool            failed;         // A write failed: nothing can be committed any more.
+    wal_buffer_t    pending;
+    wal_buffer_t    spare;          // Swapped with `pending` by the leader, so appends never wait.
+    uint64_t        next_lsn;       // Sequence number of the next record appended.
+    uint64_t        durable_lsn;    // Every record before this one is on disk.
+    uint64_t        file_size;
+    
+    // Live sessions, open-addressed by id.
+    wal_session_t   *sessions;
+    unsigned        session_count;
+    unsigned        session_capacity;
+    uint64_t        live_records;
+} wal_t;
+
+// Opens or creates the log at `path` and reads back the sessions it holds. A torn record at the
+// end (a crash mid-write) is cut off. Fails if the file isn't a log or was written for another
+// dictionary.
+bool wal_open(wal_t *wal, const lexicon_t *lexicon, const char *path,
+              const wal_options_t *options);
+// Commits anything still pending.
+void wal_close(wal_t *wal);
+
+// Hands every session the log holds, replayed, to fn(). The game belongs to fn() from then on.
+typedef void (*wal_recover_fn)(void *ctx, uint32_t id, game_t *game);
+unsigned wal_recover(wal_t *wal, wal_recover_fn fn, void *ctx);
+
+// Each returns the record's sequence number, to pass to wal_commit(). None of them block on I/O.
+// A session id can be reused once its session has ended.
+uint64_t wal_begin(wal_t *wal, uint32_t id, const game_t *game);
+uint64_t wal_guess(wal_t *wal, uint32_t id, word_t guess);
+uint64_t wal_end(wal_t *wal, uint32_t id);
+
+// Returns once record `lsn` (and everything before it) is in the file, and synced if the options
+// ask for it. False if writing failed.
+bool wal_commit(wal_t *wal, uint64_t lsn);
+
+// Rewrites the log with only the sessions still open, then swaps it in atomically.
+bool wal_compact(wal_t *wal);
+
+#endif /* end of include guard: WAL_H */